@@ -204,20 +204,19 @@ private:
         std::cout << text << std::endl;
     }
 
-    static void EncodeSecondaryCommandBuffer(
-        Bundle&         bundle,
-        std::uint32_t   numIndices,
-        std::mutex&     mtx,
-        std::string     threadName)
+    void EncodeSecondaryCommandBuffer(Bundle& bundle, std::string threadName)
     {
         // Print thread start
-        PrintThreadsafe(mtx, "Enter thread: " + threadName);
+        PrintThreadsafe(logMutex, "Enter thread: " + threadName);
 
-        // Encode command buffer
+        // Encode command buffer; states of the primary command buffer are not inherited
         auto& cmdBuffer = *bundle.secondaryCmdBuffer;
 
         cmdBuffer.Begin();
         {
+            cmdBuffer.SetViewport(context->GetVideoMode().resolution);
+            cmdBuffer.SetVertexBuffer(*vertexBuffer);
+            cmdBuffer.SetIndexBuffer(*indexBuffer);
             cmdBuffer.SetGraphicsPipeline(*bundle.pipeline);
             cmdBuffer.SetGraphicsResourceHeap(*bundle.resourceHeap, 0);
             cmdBuffer.DrawIndexed(numIndices, 0);
@@ -225,7 +224,7 @@ private:
         cmdBuffer.End();
 
         // Print thread end
-        PrintThreadsafe(mtx, "Leave thread: " + threadName);
+        PrintThreadsafe(logMutex, "Leave thread: " + threadName);
     }
 
     void EncodePrimaryCommandBuffer(const std::string& threadName)
@@ -284,8 +283,9 @@ private:
 
         #ifdef ENABLE_SECONDARY_COMMAND_BUFFERS
 
-        // Create secondary command buffers
-        cmdBufferDesc.flags = (LLGL::CommandBufferFlags::DeferredSubmit | LLGL::CommandBufferFlags::MultiSubmit);
+        // Create secondary command buffers that continue the render pass of the render context
+        cmdBufferDesc.flags         = (LLGL::CommandBufferFlags::DeferredSubmit | LLGL::CommandBufferFlags::MultiSubmit);
+        cmdBufferDesc.renderPass    = context->GetRenderPass();
 
         // Start encoding secondary command buffers in parallel
         std::thread workerThread[2];
@@ -297,22 +297,14 @@ private:
 
             // Start worker thread to encode secondary command buffer
             workerThread[i] = std::thread(
-                Example_MultiThreading::EncodeSecondaryCommandBuffer,
+                &Example_MultiThreading::EncodeSecondaryCommandBuffer,
+                this,
                 std::ref(bundle[i]),
-                numIndices,
-                std::ref(logMutex),
                 "workerThread[" + std::to_string(i) + "]"
             );
         }
 
-        #endif // /ENABLE_SECONDARY_COMMAND_BUFFERS
-
-        // Encode primary command buffer
-        EncodePrimaryCommandBuffer("mainThread");
-
-        #ifdef ENABLE_SECONDARY_COMMAND_BUFFERS
-
-        // Wait for worker threads to finish
+        // Wait for worker threads to finish, since secondary command buffers must be encoded before they can be executed
         for (auto& worker : workerThread)
         {
             if (worker.joinable())
@@ -320,6 +312,9 @@ private:
         }
 
         #endif // /ENABLE_SECONDARY_COMMAND_BUFFERS
+
+        // Encode primary command buffer
+        EncodePrimaryCommandBuffer("mainThread");
     }
 
     void Transform(Gs::Matrix4f& matrix, const Gs::Vector3f& pos, float angle)
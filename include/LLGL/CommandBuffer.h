@@ -25,6 +25,7 @@
 #include "GraphicsPipeline.h"
 #include "ComputePipeline.h"
 #include "QueryHeap.h"
+#include "IndirectArguments.h"
 
 #include <cstdint>
 
@@ -73,8 +74,12 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         \param[in] deferredCommandBuffer Specifies the deferred command buffer which is meant to be executed.
         This command buffer must have been created with the flag CommandBufferFlags::DeferredSubmit.
         \remarks This function can only be used by primary command buffers, i.e. command buffers that have not been created with the flag CommandBufferFlags::DeferredSubmit.
+        Inside a render pass, the deferred command buffer must have been created with a compatible render pass (see CommandBufferDescriptor::renderPass),
+        and only further calls to \c Execute and the call to EndRenderPass are allowed to follow.
+        All states that were set before this call must be set again if any commands other than \c Execute are encoded afterwards.
         \see CommandBufferFlags
-        \todo Incomplete for: D3D12, Vulkan, Metal.
+        \see CommandBufferDescriptor::renderPass
+        \todo Incomplete for: D3D12, Metal.
         */
         virtual void Execute(CommandBuffer& deferredCommandBuffer) = 0;
 
@@ -91,6 +96,8 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         \remarks To update buffers larger than 65536 bytes, use RenderSystem::WriteBuffer or RenderSystem::MapBuffer.
         For performance reasons, it is recommended to encode this command outside of a render pass.
         Otherwise, render pass interruptions might be inserted by LLGL.
+        The Vulkan backend avoids them for buffers that no command has referenced since this command buffer began encoding,
+        and for dynamic constant buffers (see MiscFlags::DynamicUsage).
         */
         virtual void UpdateBuffer(
             Buffer&         dstBuffer,
@@ -739,6 +746,86 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
 
+        /**
+        \brief Draws an unknown amount of instances of primitives whose draw command arguments and number of draw commands are taken from buffer objects.
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the number of draw commands is taken as a single 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer flag.
+        \param[in] countOffset Specifies an offset within the count buffer from which the number of draw commands is to be taken. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands. The number taken from the count buffer is clamped to this value.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawIndirectArguments)</code>. This stride must be a multiple of 4.
+        \remarks This allows a compute shader to generate and compact the draw command arguments entirely on the GPU, e.g. for GPU-driven occlusion culling.
+        \note Only supported with: OpenGL (with \c GL_ARB_indirect_parameters), Vulkan (with \c VK_KHR_draw_indirect_count), Direct3D 12.
+        For Direct3D 12, the stride must be equal to <code>sizeof(DrawIndirectArguments)</code>.
+        \see DrawIndirectArguments
+        \see RenderingFeatures::hasIndirectCountDrawing
+        */
+        virtual void DrawIndirect(
+            Buffer&         buffer,
+            std::uint64_t   offset,
+            Buffer&         countBuffer,
+            std::uint64_t   countOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
+        /**
+        \brief Draws an unknown amount of instances of primitives whose indexed draw command arguments and number of draw commands are taken from buffer objects.
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the number of draw commands is taken as a single 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer flag.
+        \param[in] countOffset Specifies an offset within the count buffer from which the number of draw commands is to be taken. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands. The number taken from the count buffer is clamped to this value.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawIndexedIndirectArguments)</code>. This stride must be a multiple of 4.
+        \note Only supported with: OpenGL (with \c GL_ARB_indirect_parameters), Vulkan (with \c VK_KHR_draw_indirect_count), Direct3D 12.
+        For Direct3D 12, the stride must be equal to <code>sizeof(DrawIndexedIndirectArguments)</code>.
+        \see DrawIndirect(Buffer&, std::uint64_t, Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+        \see DrawIndexedIndirectArguments
+        \see RenderingFeatures::hasIndirectCountDrawing
+        */
+        virtual void DrawIndexedIndirect(
+            Buffer&         buffer,
+            std::uint64_t   offset,
+            Buffer&         countBuffer,
+            std::uint64_t   countOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
+        /**
+        \brief Draws multiple sets of instanced primitives whose draw command arguments are taken from an array in CPU memory space.
+        \param[in] numDraws Specifies the number of draw commands.
+        \param[in] draws Pointer to an array of draw command arguments. This must point to at least \c numDraws elements.
+        \remarks This is equivalent to the following example, but the arguments are passed through the command buffer interface only once,
+        which avoids the per-draw call overhead of the interface (and the debug layer) for a large number of small draw commands:
+        \code
+        for (std::uint32_t i = 0; i < numDraws; ++i)
+            DrawInstanced(draws[i].numVertices, draws[i].firstVertex, draws[i].numInstances, draws[i].firstInstance);
+        \endcode
+        \see DrawIndirectArguments
+        \see RenderingFeatures::hasOffsetInstancing
+        */
+        virtual void MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws) = 0;
+
+        /**
+        \brief Draws multiple sets of instanced primitives whose indexed draw command arguments are taken from an array in CPU memory space.
+        \param[in] numDraws Specifies the number of draw commands.
+        \param[in] draws Pointer to an array of indexed draw command arguments. This must point to at least \c numDraws elements.
+        \remarks This is equivalent to the following example:
+        \code
+        for (std::uint32_t i = 0; i < numDraws; ++i)
+            DrawIndexedInstanced(draws[i].numIndices, draws[i].numInstances, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
+        \endcode
+        \see MultiDraw
+        \see DrawIndexedIndirectArguments
+        \see RenderingFeatures::hasOffsetInstancing
+        */
+        virtual void MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws) = 0;
+
         /* ----- Compute ----- */
 
         /**
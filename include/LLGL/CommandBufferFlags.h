@@ -10,6 +10,7 @@
 
 
 #include "ColorRGBA.h"
+#include "ForwardDecls.h"
 
 
 namespace LLGL
@@ -35,6 +36,18 @@ enum class RenderConditionMode
     ByRegionNoWaitInverted, //!< Same as ByRegionNoWait, but the condition is inverted.
 };
 
+/**
+\brief Command queue type enumeration.
+\see RenderSystem::GetCommandQueue(const CommandQueueType)
+\see CommandBufferDescriptor::queueType
+*/
+enum class CommandQueueType
+{
+    Graphics,   //!< Graphics queue, which supports graphics, compute, and transfer commands. This is the queue returned by RenderSystem::GetCommandQueue().
+    Compute,    //!< Asynchronous compute queue, which supports compute and transfer commands.
+    Transfer,   //!< Asynchronous transfer queue, which supports transfer commands only, e.g. CommandBuffer::UpdateBuffer and CommandBuffer::CopyBuffer.
+};
+
 
 /* ----- Flags ----- */
 
@@ -194,7 +207,7 @@ struct CommandBufferDescriptor
     the command buffer must be encoded again after it has been submitted to the command queue.
     \see CommandBufferFlags
     */
-    long            flags               = 0;
+    long                flags               = 0;
 
     /**
     \brief Specifies the number of internal native command buffers. By default 2.
@@ -203,9 +216,35 @@ struct CommandBufferDescriptor
     These native command buffers are then switched everytime encoding begins with the CommandBuffer::Begin function.
     The benefit of having multiple native command buffers is that it reduces the time the GPU is idle
     because it waits for a command buffer to be completed before it can be reused.
+    \remarks For the Vulkan renderer, this is at least the maximum number of frames in flight of all render contexts that exist when the command buffer is created.
     \see CommandBuffer::Begin
+    \see RenderContextDescriptor::maxFramesInFlight
+    */
+    std::uint32_t       numNativeBuffers    = 2;
+
+    /**
+    \brief Specifies the render pass a deferred command buffer is executed in. By default null.
+    \remarks This is only used for command buffers that have been created with the CommandBufferFlags::DeferredSubmit flag.
+    If this is not null, the deferred command buffer continues the render pass of the primary command buffer that executes it,
+    i.e. draw commands can be encoded without a call to CommandBuffer::BeginRenderPass, and the command buffer can only be executed inside a render pass.
+    This render pass must be compatible with the one the primary command buffer has begun, e.g. the one returned by RenderTarget::GetRenderPass.
+    Such command buffers can be encoded by multiple threads at the same time, each thread with its own command buffer,
+    to split a large render pass into several parts. Transfer and clear commands are not allowed in such a command buffer.
+    \see CommandBuffer::Execute
+    \see RenderTarget::GetRenderPass
+    */
+    const RenderPass*   renderPass          = nullptr;
+
+    /**
+    \brief Specifies the type of command queue the command buffer is submitted to. By default CommandQueueType::Graphics.
+    \remarks The command buffer must only be submitted to the command queue that is returned by RenderSystem::GetCommandQueue(const CommandQueueType) for this type.
+    A command buffer of type CommandQueueType::Compute must only encode compute and transfer commands,
+    and a command buffer of type CommandQueueType::Transfer must only encode transfer commands.
+    All buffers and textures that are accessed by command buffers of another type than CommandQueueType::Graphics must be created with MiscFlags::SharedQueues.
+    \see RenderSystem::GetCommandQueue(const CommandQueueType)
+    \see MiscFlags::SharedQueues
     */
-    std::uint32_t   numNativeBuffers    = 2;
+    CommandQueueType    queueType           = CommandQueueType::Graphics;
 };
 
 
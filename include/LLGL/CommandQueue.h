@@ -50,13 +50,38 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void Submit(CommandBuffer& commandBuffer) = 0;
 
-        #if 0
         /**
         \brief Submits all command buffers in the specified array to the command queue at once.
+        \param[in] numCommandBuffers Specifies the number of command buffers to submit. If this is zero, the function has no effect.
+        \param[in] commandBuffers Pointer to an array of \c numCommandBuffers command buffers. They are executed in the order of this array.
+        \remarks This is equivalent to submitting each command buffer with Submit(CommandBuffer&) in the same order,
+        but for Vulkan, all command buffers are submitted with a single native call and a single fence, which reduces the CPU overhead per command buffer.
+        Dependencies to other command queues that have been declared with WaitQueue apply to the entire batch.
         \see Submit(CommandBuffer&)
+        \see WaitQueue
         */
         virtual void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers);
-        #endif
+
+        /**
+        \brief Makes all command buffers that are submitted to this queue after this call wait for the work that has been submitted to another queue so far.
+        \param[in] signalQueue Specifies the command queue whose submitted work is to be waited for.
+        If this is the same queue as this one, the function has no effect.
+        \remarks The waiting happens on the GPU only, i.e. this function does not block the CPU.
+        This is used to synchronize the queues that are returned by RenderSystem::GetCommandQueue(const CommandQueueType) with each other:
+        \code
+        // Run particle simulation on the compute queue while the graphics queue renders the scene
+        myComputeQueue->Submit(*mySimulationCmdBuffer);
+        myGraphicsQueue->Submit(*mySceneCmdBuffer);
+
+        // Render particles after the simulation has completed
+        myGraphicsQueue->WaitQueue(*myComputeQueue);
+        myGraphicsQueue->Submit(*myParticlesCmdBuffer);
+        \endcode
+        For rendering APIs that only have a single command queue, this function has no effect,
+        since all command buffers are executed in submission order.
+        \see RenderSystem::GetCommandQueue(const CommandQueueType)
+        */
+        virtual void WaitQueue(CommandQueue& signalQueue);
 
         /* ----- Queries ----- */
 
@@ -87,6 +87,7 @@ struct ShaderUniform;
 struct SrcImageDescriptor;
 struct StencilDescriptor;
 struct StencilFaceDescriptor;
+struct StreamImageDescriptor;
 struct TextureDescriptor;
 struct TextureRegion;
 struct VertexAttribute;
@@ -15,6 +15,7 @@
 #include "TextureFlags.h"
 #include "ColorRGBA.h"
 #include <memory>
+#include <functional>
 #include <cstdint>
 
 
@@ -33,6 +34,16 @@ Therefore, the byte buffer type is an std::unique_ptr<char[]>.
 */
 using ByteBuffer = std::unique_ptr<char[]>;
 
+/**
+\brief Callback interface to read the image data of a single tile for streaming texture uploads.
+\param[in] tileRegion Specifies the texture region of the requested tile. This region always lies within a single MIP-map level.
+\param[out] data Pointer to the output buffer the tile image data must be written to.
+The image data must be tightly packed with the image format and data type specified by the StreamImageDescriptor.
+\param[in] dataSize Specifies the size (in bytes) of the output buffer.
+\see StreamImageDescriptor::readCallback
+*/
+using ImageStreamCallback = std::function<void(const TextureRegion& tileRegion, void* data, std::size_t dataSize)>;
+
 
 /* ----- Structures ----- */
 
@@ -60,16 +71,33 @@ struct SrcImageDescriptor
     }
 
     //! Specifies the image format. By default ImageFormat::RGBA.
-    ImageFormat format      = ImageFormat::RGBA;
+    ImageFormat     format      = ImageFormat::RGBA;
 
     //! Specifies the image data type. This must be DataType::UInt8 for compressed images. By default DataType::UInt8.
-    DataType    dataType    = DataType::UInt8;
+    DataType        dataType    = DataType::UInt8;
 
     //! Pointer to the read-only image data.
-    const void* data        = nullptr;
+    const void*     data        = nullptr;
 
     //! Specifies the size (in bytes) of the image data. This is primarily used for compressed images and serves for robustness.
-    std::size_t dataSize    = 0;
+    std::size_t     dataSize    = 0;
+
+    /**
+    \brief Specifies the stride (in bytes) between two consecutive rows of the image. By default 0.
+    \remarks If this is 0, the rows are tightly packed, i.e. the row stride is the image width times the size of each pixel.
+    This can be used to upload a sub-rectangle of a larger image (e.g. a texture atlas) or an image with padded rows (e.g. a video frame)
+    without repacking the image data into a temporary buffer first. This is ignored for compressed formats.
+ConvertImageBuffer accepts any row stride that is not less than the row size, but render systems might require a multiple of the pixel size.
+    */
+    std::uint32_t   rowStride   = 0;
+
+    /**
+    \brief Specifies the stride (in bytes) between two consecutive depth slices or array layers of the image. By default 0.
+    \remarks If this is 0, the layers are tightly packed, i.e. the layer stride is the image height times the row stride.
+    This must be a multiple of the row stride and is ignored for compressed formats.
+    \see rowStride
+    */
+    std::uint32_t   layerStride = 0;
 };
 
 /**
@@ -94,16 +122,72 @@ struct DstImageDescriptor
     }
 
     //! Specifies the image format. By default ImageFormat::RGBA.
-    ImageFormat format      = ImageFormat::RGBA;
+    ImageFormat     format      = ImageFormat::RGBA;
 
     //! Specifies the image data type. This must be DataType::UInt8 for compressed images. By default DataType::UInt8.
-    DataType    dataType    = DataType::UInt8;
+    DataType        dataType    = DataType::UInt8;
 
     //! Pointer to the read/write image data.
-    void*       data        = nullptr;
+    void*           data        = nullptr;
 
     //! Specifies the size (in bytes) of the image data. This is primarily used for compressed images and serves for robustness.
-    std::size_t dataSize    = 0;
+    std::size_t     dataSize    = 0;
+
+    /**
+    \brief Specifies the stride (in bytes) between two consecutive rows of the image. By default 0.
+    \remarks If this is 0, the rows are tightly packed, i.e. the row stride is the image width times the size of each pixel.
+    This can be used to read back into a sub-rectangle of a larger image (e.g. a texture atlas) or an image with padded rows (e.g. a video frame)
+    without repacking the image data into a temporary buffer first. This is ignored for compressed formats.
+ConvertImageBuffer accepts any row stride that is not less than the row size, but render systems might require a multiple of the pixel size.
+    */
+    std::uint32_t   rowStride   = 0;
+
+    /**
+    \brief Specifies the stride (in bytes) between two consecutive depth slices or array layers of the image. By default 0.
+    \remarks If this is 0, the layers are tightly packed, i.e. the layer stride is the image height times the row stride.
+    This must be a multiple of the row stride and is ignored for compressed formats.
+    \see rowStride
+    */
+    std::uint32_t   layerStride = 0;
+};
+
+/**
+\brief Descriptor structure for an image that is used as source for streaming texture uploads.
+\remarks The image data is uploaded tile by tile, so the peak memory consumption is bounded by the tile size instead of the texture size.
+Either the \c data or the \c readCallback member must be specified.
+\see RenderSystem::WriteTextureStreamed
+*/
+struct StreamImageDescriptor
+{
+    //! Specifies the image format. Compressed formats are not supported. By default ImageFormat::RGBA.
+    ImageFormat             format          = ImageFormat::RGBA;
+
+    //! Specifies the image data type. By default DataType::UInt8.
+    DataType                dataType        = DataType::UInt8;
+
+    /**
+    \brief Optional pointer to the read-only image data of all MIP-map levels, e.g. a memory-mapped file region. By default null.
+    \remarks The MIP-map levels must be tightly packed and consecutive, beginning with the base MIP-map level of the texture region.
+    If this is null, the image data is read with the \c readCallback function.
+    */
+    const void*             data            = nullptr;
+
+    //! Specifies the size (in bytes) of the image data. This is only used if \c data is non-null.
+    std::size_t             dataSize        = 0;
+
+    /**
+    \brief Callback to read the image data tile by tile. This is only used if \c data is null.
+    \remarks The tiles are requested MIP-map level by MIP-map level, beginning with the lowest resolution,
+    and row by row within each MIP-map level. The callback is always invoked on the calling thread.
+    */
+    ImageStreamCallback     readCallback;
+
+    /**
+    \brief Specifies the maximal size (in bytes) of the image data of each tile. By default 0.
+    \remarks If this is 0, a tile size of 4 MB is used. A tile contains at least a single row of the image.
+    \remarks Backends with staging memory (e.g. Vulkan) stage up to four tiles at once before their copies are submitted together.
+    */
+    std::size_t             tileSize        = 0;
 };
 
 
@@ -174,6 +258,26 @@ LLGL_EXPORT bool ConvertImageBuffer(
     std::size_t                 threadCount = 0
 );
 
+/**
+\brief Converts the image format and data type of the source image (only uncompressed color formats) and honors the row and layer strides of both images.
+\param[in] srcImageDesc Specifies the source image descriptor.
+\param[out] dstImageDesc Specifies the destination image descriptor.
+\param[in] extent Specifies the extent (in pixels) of both images. This is required to determine the rows and layers of the images.
+\param[in] threadCount Specifies the number of threads to use for conversion. See the other overload for details.
+\return True if any conversion was necessary. Otherwise, no conversion was necessary and the destination buffer is not modified!
+\remarks The members \c rowStride and \c layerStride of both image descriptors are taken into account.
+If both images are tightly packed, this is equivalent to the overload without the \c extent parameter.
+Otherwise, the rows of strided images are converted directly from the source into the destination image without intermediate image buffers.
+\see SrcImageDescriptor::rowStride
+\see DstImageDescriptor::rowStride
+*/
+LLGL_EXPORT bool ConvertImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    const DstImageDescriptor&   dstImageDesc,
+    const Extent3D&             extent,
+    std::size_t                 threadCount = 0
+);
+
 /**
 \brief Converst the image format and data type of the source image (only uncompressed color formats) and returns the new generated image buffer.
 \param[in] srcImageDesc Specifies the source image descriptor.
@@ -201,6 +305,32 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     std::size_t                 threadCount = 0
 );
 
+/**
+\brief Converts the image format and data type of the source image (only uncompressed color formats) and honors the row and layer strides of the source image.
+\param[in] srcImageDesc Specifies the source image descriptor.
+\param[in] dstFormat Specifies the destination image format.
+\param[in] dstDataType Specifies the destination image data type.
+\param[in] extent Specifies the extent (in pixels) of the source image. This is required to determine the rows and layers of the image.
+\param[in] threadCount Specifies the number of threads to use for conversion. See the other overload for details.
+\return Byte buffer with the tightly packed converted image data or null if no conversion is necessary.
+In the latter case, the strides of the source image still need to be taken into account by the caller.
+\remarks In contrast to the other overloads, this function also supports the block compression formats ImageFormat::BC1 to ImageFormat::BC5
+either as source or as destination format (but not both). This can be used as fallback when a device does not support compressed textures,
+or to compress textures that are generated at runtime.
+For compressed images, the data type specifies the signedness of the BC4 and BC5 formats, i.e. DataType::Int8 for signed and DataType::UInt8 for unsigned formats.
+Compressed images are decompressed into ImageFormat::RGBA with that data type before they are converted into the destination format.
+Missing color components are set to zero and missing alpha components are set to one.
+Compressed destination images are encoded with a fast encoder that favors speed over quality.
+\see SrcImageDescriptor::rowStride
+*/
+LLGL_EXPORT ByteBuffer ConvertImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    ImageFormat                 dstFormat,
+    DataType                    dstDataType,
+    const Extent3D&             extent,
+    std::size_t                 threadCount = 0
+);
+
 /**
 \brief Generates an image buffer with the specified fill data for each pixel.
 \param[in] format Specifies the image format of each pixel in the output image.
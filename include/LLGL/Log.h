@@ -74,16 +74,28 @@ using ReportCallback = std::function<void(ReportType type, const std::string& me
 
 /**
 \brief Posts a report to the currently set report callback.
+\remarks This function does not lock any mutex. Reports that exceed the report limit are rejected before the callback is invoked.
 \see ReportCallback
+\see SetReportLimit
 */
 LLGL_EXPORT void PostReport(ReportType type, const std::string& message, const std::string& contextInfo = "");
 
+/**
+\brief Posts a report to the currently set report callback.
+\remarks Overload with null terminated strings. The message strings are only converted to \c std::string objects when the report is actually passed to the callback.
+This is the preferred overload for reports with constant messages on hot paths.
+\param[in] contextInfo Optional pointer to a null terminated string. This may also be null.
+\see ReportCallback
+*/
+LLGL_EXPORT void PostReport(ReportType type, const char* message, const char* contextInfo = nullptr);
+
 /**
 \brief Sets the new report callback. No report callback is specified by default, in which case the reports are ignored.
 \param[in] callback Specifies the new report callback. This can also be null.
 \param[in] userData Optional raw pointer to some user data that will be passed to the callback each time a report is generated.
 \remarks The reports can be generated in a multi-threaded environment. Even this function can be called on multiple threads.
 The functionality of the entire Log namespace is synchronized by LLGL.
+A previously set callback may still be invoked by reports that are posted concurrently with this function.
 Use SetReportCallbackStd to forward the reports to the standard C++ I/O streams.
 \see PostReport
 \see SetReportCallbackStd
@@ -103,6 +115,15 @@ LLGL_EXPORT void SetReportCallbackStd(std::ostream& stream = std::cerr);
 */
 LLGL_EXPORT void SetReportLimit(std::size_t maxCount);
 
+/**
+\brief Sets the maximum number of reports of the specified type that will be triggered. All remaining reports of that type will be ignored.
+\param[in] type Specifies the report type whose limit is to be set.
+\param[in] maxCount Specifies the maximum number of reports of this type. If this is 0, there is affectively no limit. By default 0.
+\remarks This limit is applied in addition to the global limit that is set by the other overload of this function.
+For example, a limit of 10 warnings does not suppress any error reports.
+*/
+LLGL_EXPORT void SetReportLimit(ReportType type, std::size_t maxCount);
+
 
 } // /namespace Log
 
@@ -14,6 +14,7 @@
 #include "BufferFlags.h"
 #include "ShaderFlags.h"
 #include <vector>
+#include <string>
 
 
 namespace LLGL
@@ -119,6 +120,21 @@ struct PipelineLayoutDescriptor
 };
 
 
+/* ----- Operators ----- */
+
+//! Compares the two specified binding descriptors on equality.
+LLGL_EXPORT bool operator == (const BindingDescriptor& lhs, const BindingDescriptor& rhs);
+
+//! Compares the two specified binding descriptors on inequality.
+LLGL_EXPORT bool operator != (const BindingDescriptor& lhs, const BindingDescriptor& rhs);
+
+//! Compares the two specified pipeline layout descriptors on equality, i.e. all bindings must be equal and in the same order.
+LLGL_EXPORT bool operator == (const PipelineLayoutDescriptor& lhs, const PipelineLayoutDescriptor& rhs);
+
+//! Compares the two specified pipeline layout descriptors on inequality.
+LLGL_EXPORT bool operator != (const PipelineLayoutDescriptor& lhs, const PipelineLayoutDescriptor& rhs);
+
+
 } // /namespace LLGL
 
 
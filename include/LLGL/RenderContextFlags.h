@@ -109,6 +109,15 @@ struct RenderContextDescriptor
 
     //! Video mode descriptor.
     VideoModeDescriptor     videoMode;
+
+    /**
+    \brief Maximum number of frames the CPU can encode ahead of the GPU. By default 2.
+    \remarks With more than one frame in flight, the CPU can encode the next frame while the GPU is still processing the previous ones,
+    so the frame time approaches the maximum of CPU and GPU time instead of their sum. Each additional frame adds one frame of latency.
+    This is only a hint to the renderer and currently only supported by the Vulkan renderer. A value of 0 is treated as 1.
+    \see RenderContext::Present
+    */
+    std::uint32_t           maxFramesInFlight   = 2;
 };
 
 
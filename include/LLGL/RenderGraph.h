@@ -0,0 +1,316 @@
+/*
+ * RenderGraph.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RENDER_GRAPH_H
+#define LLGL_RENDER_GRAPH_H
+
+
+#include "NonCopyable.h"
+#include "RenderGraphFlags.h"
+#include "TextureFlags.h"
+#include "BufferFlags.h"
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class WorkerPool;
+
+/**
+\brief Render graph that orders the passes of a frame and manages their transient resources.
+\remarks The render graph is built on top of the CommandBuffer interface and works with all render systems.
+Each frame, the passes are declared in the order they are meant to be executed, together with the resources they read and write.
+When the graph is compiled, it culls all passes whose outputs are not used, determines the lifetime of each transient resource,
+and aliases transient resources with matching descriptors and disjoint lifetimes with the same texture or buffer.
+Consecutive passes that render into the same attachments without clearing them are merged into a single render pass.
+Transient resources, render targets, and render passes are kept between frames and only released when they are no longer used by the compiled graph.
+\code
+myRenderGraph.Reset();
+
+auto myGBuffer = myRenderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA8UNorm, 800, 600));
+auto myScreen  = myRenderGraph.ImportRenderTarget(*myContext);
+
+LLGL::RenderGraphPassDescriptor myGeometryPassDesc;
+{
+    myGeometryPassDesc.name         = "Geometry";
+    myGeometryPassDesc.attachments  = { { LLGL::AttachmentType::Color, myGBuffer, LLGL::AttachmentLoadOp::Clear } };
+}
+myRenderGraph.AddPass(myGeometryPassDesc, [&](LLGL::CommandBuffer& cmdBuffer) { ... });
+
+LLGL::RenderGraphPassDescriptor myLightingPassDesc;
+{
+    myLightingPassDesc.name         = "Lighting";
+    myLightingPassDesc.attachments  = { { LLGL::AttachmentType::Color, myScreen } };
+    myLightingPassDesc.reads        = { myGBuffer };
+}
+myRenderGraph.AddPass(myLightingPassDesc, [&](LLGL::CommandBuffer& cmdBuffer) { ... myRenderGraph.GetTexture(myGBuffer) ... });
+
+myCmdBuffer->Begin();
+myRenderGraph.Execute(*myCmdBuffer);
+myCmdBuffer->End();
+\endcode
+\note Parallel encoding (see RenderGraphPassFlags::ParallelEncoding) is only supported with: OpenGL, Vulkan, Null.
+\see RenderGraphPassDescriptor
+*/
+class LLGL_EXPORT RenderGraph : public NonCopyable
+{
+
+    public:
+
+        //! Initializes the render graph for the specified render system. The render system must outlive the render graph.
+        RenderGraph(RenderSystem& renderSystem);
+
+        //! Releases all textures, buffers, render targets, render passes, and command buffers that have been created by the render graph.
+        ~RenderGraph();
+
+        /* ----- Declaration ----- */
+
+        /**
+        \brief Declares a transient texture with the specified descriptor.
+        \param[in] textureDesc Specifies the texture descriptor. The texture is created with the MiscFlags::NoInitialData flag.
+        \param[in] name Optional name for validation errors. This string must remain valid until the render graph is reset.
+        \remarks The content of a transient texture is undefined before a pass writes to it.
+        \return Handle of the new resource.
+        */
+        RenderGraphResource CreateTexture(const TextureDescriptor& textureDesc, const char* name = nullptr);
+
+        /**
+        \brief Declares a transient buffer with the specified descriptor.
+        \remarks Buffers with vertex attributes are never aliased.
+        \see CreateTexture
+        */
+        RenderGraphResource CreateBuffer(const BufferDescriptor& bufferDesc, const char* name = nullptr);
+
+        /**
+        \brief Imports the specified texture into the render graph.
+        \remarks The content of imported resources is kept, i.e. passes that write to imported resources are never culled.
+        */
+        RenderGraphResource ImportTexture(Texture& texture, const char* name = nullptr);
+
+        //! Imports the specified buffer into the render graph. \see ImportTexture
+        RenderGraphResource ImportBuffer(Buffer& buffer, const char* name = nullptr);
+
+        /**
+        \brief Imports the specified render target into the render graph, e.g. a RenderContext.
+        \remarks An imported render target can only be used as attachment, and all attachments of such a pass must refer to it.
+        The attachment types only determine which attachments are cleared.
+        \see RenderGraphAttachment::resource
+        */
+        RenderGraphResource ImportRenderTarget(RenderTarget& renderTarget, const char* name = nullptr);
+
+        /**
+        \brief Adds a new pass to the render graph. Passes are executed in the order they are added.
+        \param[in] passDesc Specifies the pass descriptor with all resources the pass reads and writes.
+        \param[in] callback Specifies the callback that encodes the commands of the pass. This is only invoked if the pass is not culled.
+        \throw std::out_of_range If any of the resource handles is invalid.
+        \throw std::invalid_argument If the pass reads a transient resource that has not been written by a previous pass.
+        \throw std::invalid_argument If the pass uses a resource both as attachment and in its \c reads or \c writes lists.
+        \throw std::invalid_argument If an attachment refers to a buffer, or the attachments have different extents.
+        \throw std::invalid_argument If an imported render target is mixed with other attachments, or it is used in the \c reads or \c writes lists.
+        \throw std::invalid_argument If the pass has the RenderGraphPassFlags::ParallelEncoding flag but no attachments.
+        */
+        void AddPass(const RenderGraphPassDescriptor& passDesc, const RenderGraphPassCallback& callback);
+
+        /**
+        \brief Removes all passes and resource declarations, so a new graph can be declared.
+        \remarks The textures and buffers that backed the transient resources are kept and reused by the next compiled graph.
+        */
+        void Reset();
+
+        /* ----- Execution ----- */
+
+        /**
+        \brief Culls unused passes, computes the resource lifetimes, and assigns textures and buffers to all transient resources.
+        \remarks This is called by Execute if the graph has been modified since it was compiled the last time.
+        Textures, buffers, and render targets that have not been used by the last three compiled graphs are released,
+        so objects that are still in use by previous frames are not released immediately.
+        */
+        void Compile();
+
+        /**
+        \brief Encodes all passes that have not been culled into the specified command buffer.
+        \param[in] commandBuffer Specifies the primary command buffer. Encoding must have been begun with CommandBuffer::Begin.
+        \param[in] threadCount Specifies the number of threads to encode passes with the RenderGraphPassFlags::ParallelEncoding flag.
+        If this is less than 2, all passes are encoded into the primary command buffer. If this is 'Constants::maxThreadCount',
+        the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+        \remarks All callbacks have returned when this function returns. The compiled graph can be executed again in the next frame.
+        \remarks The debug layer does not support encoding from multiple threads, so \c threadCount should be less than 2 if the debug layer is enabled.
+        \see Constants::maxThreadCount
+        */
+        void Execute(CommandBuffer& commandBuffer, std::size_t threadCount = 0);
+
+        /* ----- Resources ----- */
+
+        /**
+        \brief Returns the texture of the specified resource, or null if the resource is not a texture or not used by the compiled graph.
+        \remarks This can be called from within the pass callbacks. Different transient resources may return the same texture if their lifetimes are disjoint.
+        \throw std::out_of_range If the resource handle is invalid.
+        */
+        Texture* GetTexture(RenderGraphResource resource) const;
+
+        //! Returns the buffer of the specified resource, or null if the resource is not a buffer or not used by the compiled graph. \see GetTexture
+        Buffer* GetBuffer(RenderGraphResource resource) const;
+
+        //! Returns the statistics of the last compilation.
+        inline const RenderGraphStatistics& GetStatistics() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        enum class ResourceType
+        {
+            Texture,
+            Buffer,
+            RenderTarget,
+        };
+
+        struct ResourceEntry
+        {
+            ResourceType    type            = ResourceType::Texture;
+            const char*     name            = nullptr;
+            bool            imported        = false;
+            bool            written         = false;
+            bool            needed          = false;
+            std::uint32_t   descIndex       = 0;
+            std::uint32_t   firstPass       = 0;
+            std::uint32_t   lastPass        = 0;
+            Texture*        texture         = nullptr;
+            Buffer*         buffer          = nullptr;
+            RenderTarget*   renderTarget    = nullptr;
+        };
+
+        struct PassEntry
+        {
+            RenderGraphPassDescriptor   desc;
+            RenderGraphPassCallback     callback;
+            bool                        culled      = false;
+        };
+
+        // Consecutive passes that are encoded within the same render pass, or a single pass without attachments.
+        struct PassGroup
+        {
+            std::uint32_t       firstPass       = 0;
+            std::uint32_t       numPasses       = 0;
+            RenderTarget*       renderTarget    = nullptr;
+            const RenderPass*   renderPass      = nullptr;
+            std::uint32_t       firstClearValue = 0;
+            std::uint32_t       numClearValues  = 0;
+            bool                parallel        = false;
+        };
+
+        struct TransientTexture
+        {
+            TextureDescriptor   desc;
+            Texture*            texture             = nullptr;
+            std::uint32_t       lastPass            = 0;
+            std::uint32_t       numUnusedCompiles   = 0;
+            bool                assigned            = false;
+        };
+
+        struct TransientBuffer
+        {
+            BufferDescriptor    desc;
+            Buffer*             buffer              = nullptr;
+            std::uint32_t       lastPass            = 0;
+            std::uint32_t       numUnusedCompiles   = 0;
+            bool                assigned            = false;
+        };
+
+        struct CachedRenderTarget
+        {
+            std::vector<AttachmentDescriptor>   attachments;
+            RenderTarget*                       renderTarget        = nullptr;
+            std::uint32_t                       numUnusedCompiles   = 0;
+        };
+
+        struct CachedRenderPass
+        {
+            RenderPassDescriptor    desc;
+            RenderPass*             renderPass  = nullptr;
+        };
+
+        struct DeferredCommandBuffer
+        {
+            CommandBuffer*      commandBuffer   = nullptr;
+            const RenderPass*   renderPass      = nullptr;
+            std::uint32_t       pass            = 0;
+        };
+
+    private:
+
+        RenderGraphResource AddResource(const ResourceType type, const char* name, bool imported);
+
+        const ResourceEntry& GetResourceEntry(RenderGraphResource resource) const;
+
+        void ValidatePassAttachments(const RenderGraphPassDescriptor& passDesc, std::uint32_t passIndex) const;
+        void ValidatePassResources(const RenderGraphPassDescriptor& passDesc, std::uint32_t passIndex) const;
+
+        void CullPasses();
+        void ComputeLifetimes();
+        void AssignTransientResources();
+        void BuildPassGroups();
+        void BuildRenderPass(PassGroup& group);
+        void ReleaseUnusedResources();
+        void UpdateStatistics();
+
+        bool IsMergeable(const PassGroup& group, const PassEntry& pass) const;
+        bool IsStoreRequired(RenderGraphResource resource, const PassGroup& group) const;
+
+        Texture* AcquireTransientTexture(const TextureDescriptor& textureDesc, std::uint32_t firstPass, std::uint32_t lastPass);
+        Buffer* AcquireTransientBuffer(const BufferDescriptor& bufferDesc, std::uint32_t firstPass, std::uint32_t lastPass);
+        RenderTarget* AcquireRenderTarget(const std::vector<AttachmentDescriptor>& attachments, const Extent2D& resolution);
+        const RenderPass* AcquireRenderPass(const RenderPassDescriptor& renderPassDesc);
+
+        std::size_t EncodeDeferredPasses(std::size_t threadCount);
+        void EncodePass(CommandBuffer& commandBuffer, const PassEntry& pass);
+
+    private:
+
+        RenderSystem&                       renderSystem_;
+
+        /* ----- Declaration ----- */
+
+        std::vector<ResourceEntry>          resources_;
+        std::vector<TextureDescriptor>      textureDescs_;
+        std::vector<BufferDescriptor>       bufferDescs_;
+        std::vector<PassEntry>              passes_;
+        bool                                compiled_               = false;
+
+        /* ----- Compiled graph ----- */
+
+        std::vector<std::uint32_t>          executionOrder_;
+        std::vector<PassGroup>              passGroups_;
+        std::vector<ClearValue>             clearValues_;
+        RenderGraphStatistics               stats_;
+
+        /* ----- Cached objects ----- */
+
+        std::vector<TransientTexture>       transientTextures_;
+        std::vector<TransientBuffer>        transientBuffers_;
+        std::vector<CachedRenderTarget>     renderTargets_;
+        std::vector<CachedRenderPass>       renderPasses_;
+        std::vector<DeferredCommandBuffer>  deferredCommandBuffers_;
+        std::unique_ptr<WorkerPool>         workerPool_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,200 @@
+/*
+ * RenderGraphFlags.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RENDER_GRAPH_FLAGS_H
+#define LLGL_RENDER_GRAPH_FLAGS_H
+
+
+#include "RenderTargetFlags.h"
+#include "RenderPassFlags.h"
+#include "CommandBufferFlags.h"
+#include "ForwardDecls.h"
+#include <functional>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Types ----- */
+
+/**
+\brief Handle of a resource that has been declared in a render graph.
+\remarks Handles are indices into the resources of a render graph.
+They are only valid until the render graph is reset.
+\see RenderGraph::CreateTexture
+\see RenderGraph::ImportTexture
+*/
+using RenderGraphResource = std::uint32_t;
+
+/**
+\brief Callback interface to encode the commands of a render graph pass.
+\param[in] commandBuffer Specifies the command buffer the commands of the pass are encoded into.
+If the pass has attachments, the render pass for these attachments has already been begun.
+\see RenderGraph::AddPass
+*/
+using RenderGraphPassCallback = std::function<void(CommandBuffer& commandBuffer)>;
+
+
+/* ----- Flags ----- */
+
+/**
+\brief Render graph pass flags.
+\see RenderGraphPassDescriptor::flags
+*/
+struct RenderGraphPassFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the pass must never be culled, e.g. because it has side effects the render graph cannot see.
+        \remarks Passes that write to imported resources are never culled either.
+        */
+        NeverCull           = (1 << 0),
+
+        /**
+        \brief Specifies that the pass can be encoded by a worker thread.
+        \remarks This is only allowed for passes with attachments. The pass is encoded into a deferred command buffer that continues the render pass,
+        so the callback must only encode commands that are allowed inside a render pass (see CommandBufferDescriptor::renderPass).
+        Passes with this flag are only merged with other passes that have this flag as well.
+        \see RenderGraph::Execute
+        */
+        ParallelEncoding    = (1 << 1),
+    };
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Render graph pass attachment structure.
+\see RenderGraphPassDescriptor::attachments
+*/
+struct RenderGraphAttachment
+{
+    RenderGraphAttachment() = default;
+    RenderGraphAttachment(const RenderGraphAttachment&) = default;
+
+    //! Constructor to initialize the attachment type, the resource, and optionally the load operation.
+    inline RenderGraphAttachment(
+        AttachmentType          type,
+        RenderGraphResource     resource,
+        AttachmentLoadOp        loadOp      = AttachmentLoadOp::Load) :
+            type     { type     },
+            resource { resource },
+            loadOp   { loadOp   }
+    {
+    }
+
+    //! Specifies for which output information the attachment is used. By default AttachmentType::Color.
+    AttachmentType      type        = AttachmentType::Color;
+
+    /**
+    \brief Specifies the texture resource that is written by the pass. By default 0.
+    \remarks This can also be a render target that has been imported with RenderGraph::ImportRenderTarget.
+    In that case, all attachments of the pass must refer to this render target, and the attachment types only determine which attachments are cleared.
+    */
+    RenderGraphResource resource    = 0;
+
+    /**
+    \brief Specifies the load operation of the previous attachment content. By default AttachmentLoadOp::Load.
+    \remarks Only AttachmentLoadOp::Load makes the pass depend on the previous content of the resource.
+    The store operation is determined by the render graph: the content is only stored if a later pass reads it, if the resource is imported,
+    or if the pass shares its render pass with other passes.
+    */
+    AttachmentLoadOp    loadOp      = AttachmentLoadOp::Load;
+
+    //! Specifies the clear value that is used if the load operation is AttachmentLoadOp::Clear.
+    ClearValue          clearValue;
+};
+
+/**
+\brief Render graph pass descriptor structure.
+\see RenderGraph::AddPass
+*/
+struct RenderGraphPassDescriptor
+{
+    /**
+    \brief Optional name of the pass. By default null.
+    \remarks The name is used for validation errors and as debug group around the commands of the pass (see CommandBuffer::PushDebugGroup),
+    so the debug layer can record GPU timings for each pass (see RenderingProfiler::timeRecording).
+    The string must remain valid until the render graph is reset.
+    */
+    const char*                         name        = nullptr;
+
+    /**
+    \brief Specifies the pass flags. This can be a bitwise OR combination of the RenderGraphPassFlags entries. By default 0.
+    \see RenderGraphPassFlags
+    */
+    long                                flags       = 0;
+
+    /**
+    \brief Specifies the attachments the pass renders into.
+    \remarks If this is empty, the pass is encoded outside of a render pass, e.g. for compute or transfer commands.
+    Otherwise, the render graph begins a render pass for these attachments before the pass callback is invoked.
+    */
+    std::vector<RenderGraphAttachment>  attachments;
+
+    //! Specifies the resources the pass reads from, e.g. sampled textures, constant buffers, or the source of a copy command.
+    std::vector<RenderGraphResource>    reads;
+
+    /**
+    \brief Specifies the resources the pass writes to other than its attachments, e.g. storage buffers, or the destination of a copy command.
+    \remarks These writes are assumed to modify the resources only partially, i.e. earlier writes are kept alive.
+    */
+    std::vector<RenderGraphResource>    writes;
+};
+
+/**
+\brief Render graph statistics structure.
+\remarks This is updated every time the render graph is compiled.
+\see RenderGraph::GetStatistics
+*/
+struct RenderGraphStatistics
+{
+    //! Number of passes that have been added to the render graph.
+    std::uint32_t numPasses             = 0;
+
+    //! Number of passes that have been culled, because none of their outputs are used.
+    std::uint32_t numCulledPasses       = 0;
+
+    //! Number of passes that have been merged into the render pass of their predecessor.
+    std::uint32_t numMergedPasses       = 0;
+
+    //! Number of render passes that are begun by the render graph.
+    std::uint32_t numRenderPasses       = 0;
+
+    //! Number of transient textures that are used by the passes which have not been culled.
+    std::uint32_t numTransientTextures  = 0;
+
+    //! Number of transient buffers that are used by the passes which have not been culled.
+    std::uint32_t numTransientBuffers   = 0;
+
+    //! Number of textures that back the transient textures. This is less than \c numTransientTextures if textures are aliased.
+    std::uint32_t numPhysicalTextures   = 0;
+
+    //! Number of buffers that back the transient buffers. This is less than \c numTransientBuffers if buffers are aliased.
+    std::uint32_t numPhysicalBuffers    = 0;
+
+    /**
+    \brief Number of times a resource changes its usage between two passes, e.g. from attachment to sampled texture.
+    \remarks This is the number of resource transitions the passes require. Consecutive passes with the same usage of a resource don't add to this number.
+    */
+    std::uint32_t numTransitions        = 0;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
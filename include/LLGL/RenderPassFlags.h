@@ -25,7 +25,10 @@ namespace LLGL
 */
 enum class AttachmentLoadOp
 {
-    //! We don't care about the previous content of the respective render target attachment.
+    /**
+    \brief We don't care about the previous content of the respective render target attachment.
+    \remarks For OpenGL, the attachment is invalidated when the render pass begins (with \c GL_ARB_invalidate_subdata).
+    */
     Undefined,
 
     //! Loads the previous content of the respective render target attachment.
@@ -48,6 +51,9 @@ enum class AttachmentStoreOp
     /**
     \brief We don't care about the outcome of the respective render target attachment.
     \remarks Can be used, for example, if we only need the depth buffer for the depth test, but nothing is written to it.
+    For OpenGL, the attachment is invalidated when the render pass ends (with \c GL_ARB_invalidate_subdata),
+    and multi-sampled color attachments are invalidated after they have been resolved.
+    \see CommandBuffer::EndRenderPass
     */
     Undefined,
 
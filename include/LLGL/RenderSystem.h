@@ -95,6 +95,7 @@ class LLGL_EXPORT RenderSystem : public Interface
         \param[in] debugger Optional pointer to a rendering debugger. This is only supported if LLGL was compiled with the \c LLGL_ENABLE_DEBUG_LAYER flag.
         If the default debugger is used (i.e. no sub class of RenderingDebugger), then all reports will be send to the Log.
         In order to see any reports from the Log, use either Log::SetReportCallback or Log::SetReportCallbackStd.
+        The amount of validation is determined by the validation mode of the debugger at the time this function is called (see RenderingDebugger::SetValidationMode).
         \remarks The descriptor structure can be initialized by only the module name like shown in the following example:
         \code
         // Load the "OpenGL" render system module
@@ -197,9 +198,23 @@ class LLGL_EXPORT RenderSystem : public Interface
 
         /* ----- Command queues ----- */
 
-        //! Returns the single instance of the command queue.
+        //! Returns the single instance of the graphics command queue.
         virtual CommandQueue* GetCommandQueue() = 0;
 
+        /**
+        \brief Returns the command queue of the specified type.
+        \param[in] type Specifies the type of command queue.
+        \return Pointer to the command queue of the specified type.
+        If the device does not expose a dedicated queue for this type, the graphics queue is returned, i.e. the same as GetCommandQueue().
+        \remarks Only Vulkan currently supports dedicated compute and transfer queues.
+        Work that is submitted to different queues can be executed concurrently on the GPU,
+        e.g. long running compute jobs or streaming uploads can overlap with graphics work.
+        Use CommandQueue::WaitQueue to synchronize the queues with each other.
+        \see CommandBufferDescriptor::queueType
+        \see CommandQueue::WaitQueue
+        */
+        virtual CommandQueue* GetCommandQueue(const CommandQueueType type);
+
         /* ----- Command buffers ----- */
 
         /**
@@ -301,6 +316,56 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) = 0;
 
+        /**
+        \brief Begins an asynchronous update of the image data of the specified texture.
+        \param[in] texture Specifies the texture whose data is to be updated.
+        \param[in] textureRegion Specifies the texture region where the texture is to be updated. The field TextureRegion::numMipLevels \b must be 1.
+        \param[in] imageDesc Specifies the image data descriptor. Its \c data member must not be null!
+        The source image data must remain valid until QueryTextureWrite returns true for this write operation.
+        \return Non-zero identifier of the write operation, which is passed to QueryTextureWrite.
+        \remarks In contrast to WriteTexture, this function returns as soon as the conversion of the source image has been queued.
+        The texture must not be used until QueryTextureWrite returns true for this write operation.
+        The OpenGL backend converts the source image into a persistently mapped pixel unpack buffer on a worker thread,
+        and issues the upload command when the conversion has finished and QueryTextureWrite is called.
+        The default implementation writes the texture data immediately with WriteTexture.
+        \see QueryTextureWrite
+        \see WriteTexture
+        */
+        virtual std::uint64_t WriteTextureAsync(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc);
+
+        /**
+        \brief Queries whether the specified asynchronous texture write operation has been completed.
+        \param[in] writeID Specifies the identifier of the write operation that was returned by WriteTextureAsync.
+        \param[in] wait Specifies whether to wait until the write operation has been completed. By default false.
+        \return True if the upload of the texture data has been issued, i.e. the texture can be used and the source image data can be released.
+        After that, the identifier is no longer valid. Unknown identifiers are considered to be completed.
+        \remarks This function must be called regularly (e.g. once per frame) for pending write operations to make progress,
+        and it must be called on the same thread as WriteTextureAsync. Write operations complete in the order they were begun.
+        \see WriteTextureAsync
+        */
+        virtual bool QueryTextureWrite(std::uint64_t writeID, bool wait = false);
+
+        /**
+        \brief Updates the image data of the specified texture by streaming the source image tile by tile.
+        \param[in] texture Specifies the texture whose data is to be updated.
+        \param[in] textureRegion Specifies the texture region where the texture is to be updated.
+        In contrast to WriteTexture, the field TextureRegion::numMipLevels can be greater than 1 to upload multiple MIP-map levels progressively.
+        The offset and extent of the texture region refer to the base MIP-map level and are halved for each subsequent MIP-map level.
+        \param[in] imageDesc Specifies the streaming image descriptor, i.e. either a pointer to the image data or a callback to read each tile.
+        \remarks The MIP-map levels are uploaded beginning with the lowest resolution, so a texture can be sampled at a lower detail while it's streamed in.
+        The peak memory consumption of this function is bounded by the tile size (see StreamImageDescriptor::tileSize) instead of the texture size.
+        Backends with staging memory (e.g. Vulkan) convert and read the tiles directly into the mapped staging memory.
+        \remarks This function can only be used for non-multi-sample textures with uncompressed formats.
+        \throws std::invalid_argument If the image data of \c imageDesc is null and no read callback is specified.
+        \throws std::invalid_argument If the image data of \c imageDesc is too small for the specified texture region.
+        \throws std::invalid_argument If a compressed image format is specified.
+        \throws std::invalid_argument If the texture region of any MIP-map level exceeds the texture,
+        e.g. when an odd offset is rounded down for a lower MIP-map level but the extent is clamped to 1.
+        \see StreamImageDescriptor
+        \see WriteTexture
+        */
+        virtual void WriteTextureStreamed(Texture& texture, const TextureRegion& textureRegion, const StreamImageDescriptor& imageDesc);
+
         /**
         \brief Reads the image data from the specified texture.
         \param[in] texture Specifies the texture object to read from.
@@ -336,6 +401,36 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) = 0;
 
+        /**
+        \brief Begins an asynchronous read of the image data from the specified texture.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] mipLevel Specifies the MIP-map level from which to read the texture data.
+        \param[out] imageDesc Specifies the destination image descriptor to write the texture data to.
+        The destination buffer must remain valid until QueryTextureRead returns true for this read operation.
+        \return Non-zero identifier of the read operation, which is passed to QueryTextureRead.
+        \remarks In contrast to ReadTexture, this function does not wait until all previous rendering commands have been completed.
+        This is intended for continuous captures (e.g. for video encoding) where the results are queried a few frames later.
+        The OpenGL backend copies the texture data into a pooled pixel pack buffer and converts it into the destination image on a worker thread.
+        The default implementation reads the texture data immediately with ReadTexture.
+        \throws std::runtime_error If <code>imageDesc.data</code> is null.
+        \throws std::invalid_argument If <code>imageDesc.dataSize</code> is too small for the MIP-map level with the row and layer strides of \c imageDesc.
+        \see QueryTextureRead
+        \see ReadTexture
+        */
+        virtual std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc);
+
+        /**
+        \brief Queries whether the specified asynchronous texture read operation has been completed.
+        \param[in] readID Specifies the identifier of the read operation that was returned by ReadTextureAsync.
+        \param[in] wait Specifies whether to wait until the read operation has been completed. By default false.
+        \return True if the texture data has been written to the destination image. After that, the identifier is no longer valid.
+        Unknown identifiers are considered to be completed.
+        \remarks This function must be called regularly (e.g. once per frame) for pending read operations to make progress,
+        and it must be called on the same thread as ReadTextureAsync.
+        \see ReadTextureAsync
+        */
+        virtual bool QueryTextureRead(std::uint64_t readID, bool wait = false);
+
         /* ----- Samplers ---- */
 
         /**
@@ -427,6 +522,8 @@ class LLGL_EXPORT RenderSystem : public Interface
         \remarks A pipeline layout is required in combination with a ResourceHeap to bind multiple resources at once.
         For modern graphics APIs (i.e. Direct3D 12 and Vulkan), this is only way to bind shader resources.
         For legacy graphics APIs (i.e. Direct3D 11 and OpenGL), shader resources can also be bound individually with the extended command buffer.
+        Pipeline layouts with identical bindings are shared, i.e. this function returns the same object for equal descriptors
+        and the object is only destroyed when it has been released as often as it has been created.
         \return Pointer to the new PipelineLayout object or null if the renderer does not support pipeline layouts.
         \see CreateResourceHeap
         \see PipelineLayoutDesc
@@ -481,6 +578,34 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified Fence object. After this call, the specified object must no longer be used.
         virtual void Release(Fence& fence) = 0;
 
+        /* ----- Background loading ----- */
+
+        /**
+        \brief Enqueues a task that creates or updates resources on a background loader thread.
+        \param[in] task Specifies the function that is invoked with this render system on the loader thread.
+        Within this function, only the following functions of the render system must be used:
+        CreateBuffer, WriteBuffer, CreateTexture, WriteTexture, CreateSampler, CreateShader, and CreateShaderProgram.
+        \return Non-zero identifier of the task, which is passed to QueryLoadTask.
+        \remarks The resources that are created or modified by the task must not be used until QueryLoadTask returns true for this task.
+        The OpenGL backend runs the tasks on a dedicated thread with a shared GL context if RendererConfigurationOpenGL::backgroundLoader is enabled.
+        Otherwise, the task is executed immediately on the calling thread and exceptions are forwarded to the caller.
+        \see QueryLoadTask
+        \see RendererConfigurationOpenGL::backgroundLoader
+        */
+        virtual std::uint64_t EnqueueLoadTask(const LoadTaskFunction& task);
+
+        /**
+        \brief Queries whether the specified background loader task has been completed.
+        \param[in] taskID Specifies the identifier of the task that was returned by EnqueueLoadTask.
+        \param[in] wait Specifies whether to wait until the task has been completed. By default false.
+        \return True if the task has been completed and its resources can be used on the calling thread. After that, the identifier is no longer valid.
+        Unknown identifiers are considered to be completed.
+        \remarks This function must be called on the same thread as EnqueueLoadTask.
+        \throws Forwards any exception that was thrown by the task on the loader thread.
+        \see EnqueueLoadTask
+        */
+        virtual bool QueryLoadTask(std::uint64_t taskID, bool wait = false);
+
     protected:
 
         RenderSystem() = default;
@@ -509,6 +634,9 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Validates the specified render pass descriptor.
         void AssertCreateRenderPass(const RenderPassDescriptor& desc);
 
+        //! Validates the specified streaming image descriptor for the texture region of all its MIP-map levels.
+        void AssertStreamImageDesc(const Texture& texture, const TextureRegion& textureRegion, const StreamImageDescriptor& imageDesc);
+
         //! Validates the specified image data size against the required size (in bytes).
         void AssertImageDataSize(std::size_t dataSize, std::size_t requiredDataSize, const char* info = nullptr);
 
@@ -14,6 +14,7 @@
 #include "TextureFlags.h"
 #include "Constants.h"
 #include "RendererConfiguration.h"
+#include "ForwardDecls.h"
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -39,6 +40,14 @@ namespace LLGL
 */
 using DebugCallback = std::function<void(const std::string& type, const std::string& message)>;
 
+/**
+\brief Background loader task function interface.
+\param[in] renderSystem Specifies the render system the task has been enqueued with.
+\ingroup group_callbacks
+\see RenderSystem::EnqueueLoadTask
+*/
+using LoadTaskFunction = std::function<void(RenderSystem& renderSystem)>;
+
 
 /* ----- Enumerations ----- */
 
@@ -212,6 +221,7 @@ struct RendererID
     static const int Direct3D12 = 0x00000008; //!< ID number for a Direct3D 12 renderer.
     static const int Vulkan     = 0x00000009; //!< ID number for a Vulkan renderer.
     static const int Metal      = 0x0000000a; //!< ID number for a Metal renderer.
+    static const int Null       = 0x0000000b; //!< ID number for a Null renderer. This renderer only keeps track of resources on the CPU and does not execute any rendering commands.
 
     static const int Reserved   = 0x000000ff; //!< Highest ID number for reserved future renderers. Value is 0x000000ff.
 };
@@ -437,6 +447,13 @@ struct RenderingFeatures
     */
     bool hasIndirectDrawing             = false;
 
+    /**
+    \brief Specifies whether indirect draw commands with a GPU-side draw count are supported.
+    \see CommandBuffer::DrawIndirect(Buffer&, std::uint64_t, Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+    \see CommandBuffer::DrawIndexedIndirect(Buffer&, std::uint64_t, Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+    */
+    bool hasIndirectCountDrawing        = false;
+
     /**
     \brief Specifies whether multiple viewports, depth-ranges, and scissors at once are supported.
     \see RenderingLimits::maxViewports
@@ -122,6 +122,15 @@ struct RendererConfigurationOpenGL
     \remarks This member is ignored if \c contextProfile is OpenGLContextProfile::CompatibilityProfile.
     */
     int                     minorVersion    = 0;
+
+    /**
+    \brief Specifies whether to create a background loader thread with a shared GL context. By default false.
+    \remarks If enabled, the tasks of RenderSystem::EnqueueLoadTask are executed on this thread,
+    so that creating resources does not block the render thread.
+    This is ignored if the platform does not support a shared GL context for a background thread.
+    \see RenderSystem::EnqueueLoadTask
+    */
+    bool                    backgroundLoader = false;
 };
 
 
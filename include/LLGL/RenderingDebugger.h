@@ -10,8 +10,11 @@
 
 
 #include "Export.h"
-#include <map>
+#include <unordered_map>
+#include <vector>
 #include <string>
+#include <mutex>
+#include <cstdint>
 
 
 namespace LLGL
@@ -37,6 +40,49 @@ enum class WarningType
 };
 
 
+/**
+\brief Rendering debugger validation mode enumeration.
+\see RenderingDebugger::SetValidationMode
+*/
+enum class ValidationMode
+{
+    /**
+    \brief No validation is performed by the debug layer.
+    \remarks The profiler still receives its counter values.
+    */
+    Off,
+
+    /**
+    \brief Only every N-th command buffer encoding is validated.
+    \remarks Render system functions outside of command encoding are still validated.
+    \see RenderingDebugger::GetSamplingInterval
+    */
+    Sampled,
+
+    //! Every command is validated. This is the default mode.
+    Full,
+};
+
+/**
+\brief Accumulated cost of a validation function in the debug layer.
+\see RenderingDebugger::GetValidationCosts
+*/
+struct ValidationCost
+{
+    /**
+    \brief Qualified name of the function whose validation has been measured, including its parameter types to distinguish overloaded functions.
+    \remarks The format depends on the compiler, e.g. <code>"virtual void LLGL::DbgCommandBuffer::DrawIndexed(uint32_t, uint32_t)"</code>.
+    */
+    std::string     source;
+
+    //! Number of times this validation has been performed.
+    std::uint64_t   invocations = 0;
+
+    //! Accumulated time (in nanoseconds) that has been spent with this validation.
+    std::uint64_t   elapsedTime = 0;
+};
+
+
 /**
 \brief Rendering debugger interface.
 \remarks This can be used to profile the renderer draw calls and buffer updates.
@@ -65,17 +111,78 @@ class LLGL_EXPORT RenderingDebugger
         /**
         \brief Posts an error message.
         \param[in] type Specifies the type of error.
-        \param[in] message Specifies the string which describes the failure.
+        \param[in] message Pointer to a null terminated string which describes the failure. This must not be null.
+        \remarks Further occurrences of a message that has already been posted do not allocate any memory.
         */
+        void PostError(const ErrorType type, const char* message);
+
+        //! \see PostError(const ErrorType, const char*)
         void PostError(const ErrorType type, const std::string& message);
 
         /**
         \brief Posts a warning message.
         \param[in] type Specifies the type of error.
-        \param[in] message Specifies the string which describes the warning.
+        \param[in] message Pointer to a null terminated string which describes the warning. This must not be null.
+        \remarks Further occurrences of a message that has already been posted do not allocate any memory.
         */
+        void PostWarning(const WarningType type, const char* message);
+
+        //! \see PostWarning(const WarningType, const char*)
         void PostWarning(const WarningType type, const std::string& message);
 
+        /**
+        \brief Sets the validation mode of the debug layer.
+        \param[in] mode Specifies the new validation mode. By default ValidationMode::Full.
+        \param[in] samplingInterval Specifies the interval of validated command buffer encodings for ValidationMode::Sampled.
+        A value of 16 for instance means that every 16th command buffer encoding is validated. If this is 0, the value 1 is used. By default 16.
+        \remarks The validation mode must be set before the render system is loaded, i.e. before RenderSystem::Load is called with this debugger.
+        \see RenderSystem::Load
+        */
+        void SetValidationMode(const ValidationMode mode, std::uint32_t samplingInterval = 16);
+
+        //! Returns the validation mode of the debug layer. By default ValidationMode::Full.
+        inline ValidationMode GetValidationMode() const
+        {
+            return validationMode_;
+        }
+
+        //! Returns the interval of validated command buffer encodings for ValidationMode::Sampled. By default 16.
+        inline std::uint32_t GetSamplingInterval() const
+        {
+            return samplingInterval_;
+        }
+
+        /**
+        \brief Enables or disables the time measurement of all validations in the debug layer. By default disabled.
+        \remarks This can be used to find out how much overhead is caused by the debug layer itself.
+        \see GetValidationCosts
+        */
+        void SetTimeRecording(bool enabled);
+
+        //! Returns true if the time measurement of all validations is enabled.
+        inline bool GetTimeRecording() const
+        {
+            return timeRecording_;
+        }
+
+        /**
+        \brief Records the specified validation time for the specified source function.
+        \remarks This is called by the debug layer if time recording is enabled. This function is thread-safe.
+        \param[in] source Pointer to a null terminated string that specifies the function name. This must have static storage duration, e.g. a string literal.
+        \param[in] elapsedTime Specifies the elapsed time (in nanoseconds).
+        \see SetTimeRecording
+        */
+        void RecordValidationCost(const char* source, std::uint64_t elapsedTime);
+
+        /**
+        \brief Returns the accumulated costs of all validations that have been recorded, sorted by their elapsed time in descending order.
+        \see SetTimeRecording
+        */
+        std::vector<ValidationCost> GetValidationCosts() const;
+
+        //! Resets all accumulated validation costs.
+        void ResetValidationCosts();
+
     protected:
 
         /**
@@ -183,10 +290,23 @@ class LLGL_EXPORT RenderingDebugger
 
     private:
 
-        std::map<std::string, Message>  errors_;
-        std::map<std::string, Message>  warnings_;
-        const char*                     source_     = "";
-        const char*                     groupName_  = "";
+        using MessageMap = std::unordered_multimap<std::uint64_t, Message>;
+
+        // Returns the message with the specified text from the map or null if there is no such message.
+        static Message* FindMessage(MessageMap& messages, std::uint64_t hash, const char* text);
+
+    private:
+
+        MessageMap                                      errors_;    // Messages are keyed by the hash of their text, so posting them again does not allocate
+        MessageMap                                      warnings_;
+        const char*                                     source_     = "";
+        const char*                                     groupName_  = "";
+
+        ValidationMode                                  validationMode_     = ValidationMode::Full;
+        std::uint32_t                                   samplingInterval_   = 16;
+        bool                                            timeRecording_      = false;
+        mutable std::mutex                              validationCostMutex_;   // Validation costs are recorded by all threads that encode commands
+        std::unordered_map<const char*, ValidationCost> validationCosts_;
 
 };
 
@@ -12,8 +12,12 @@
 #include "Export.h"
 #include "RenderContextFlags.h"
 #include "GraphicsPipelineFlags.h"
+#include "QueryHeapFlags.h"
 #include <cstdint>
 #include <algorithm>
+#include <vector>
+#include <string>
+#include <ostream>
 
 
 namespace LLGL
@@ -266,6 +270,34 @@ struct FrameProfile
     };
 };
 
+/**
+\brief GPU time record of a command buffer section.
+\remarks Time records are only generated if RenderingProfiler::timeRecording is enabled.
+Render passes and compute dispatches are measured with queries of type QueryType::TimeElapsed.
+Debug groups are not measured directly. Instead, their elapsed time is the sum of all sections they enclose.
+\see RenderingProfiler::timeRecords
+*/
+struct ProfileTimeRecord
+{
+    /**
+    \brief Annotation of this section.
+    \remarks This is either the name of a debug group (see CommandBuffer::PushDebugGroup), \c "RenderPass", or \c "Dispatch".
+    */
+    std::string             annotation;
+
+    //! Nesting level of this section within the debug group hierarchy. Sections that are not enclosed by any debug group have level 0.
+    std::uint32_t           level       = 0;
+
+    //! Elapsed GPU time (in nanoseconds) of this section.
+    std::uint64_t           elapsedTime = 0;
+
+    /**
+    \brief Pipeline statistics of this section.
+    \remarks This is only filled if RenderingProfiler::pipelineStatistics is enabled and RenderingFeatures::hasPipelineStatistics is supported.
+    */
+    QueryPipelineStatistics statistics;
+};
+
 /**
 \brief Rendering profiler model class.
 \remarks This can be used to profile the renderer draw calls and buffer updates.
@@ -279,8 +311,10 @@ class LLGL_EXPORT RenderingProfiler
         /**
         \brief Returns the current frame profile and resets the counters for the next frame.
         \param[out] outputProfile Optional pointer to an output profile to retrieve the current values. By default null.
+        \param[out] outputTimeRecords Optional pointer to a container to retrieve the time records that have been resolved since the last call. By default null.
+        \remarks The time records are cleared as well.
         */
-        void NextProfile(FrameProfile* outputProfile = nullptr);
+        void NextProfile(FrameProfile* outputProfile = nullptr, std::vector<ProfileTimeRecord>* outputTimeRecords = nullptr);
 
         /**
         \brief Accumulates the specified profile with the current values.
@@ -289,10 +323,44 @@ class LLGL_EXPORT RenderingProfiler
         */
         void Accumulate(const FrameProfile& profile);
 
+        /**
+        \brief Writes the specified time records as Chrome trace-event JSON format to the specified output stream.
+        \param[out] stream Specifies the output stream the JSON data is written to.
+        \param[in] timeRecords Specifies the time records in the order they were resolved by the profiler.
+        \remarks The time records only provide elapsed times, so all sections are laid out consecutively on a single timeline.
+        The output can be loaded in the tracing tool of Chromium based browsers (i.e. \c chrome://tracing).
+        \see timeRecords
+        */
+        static void WriteChromeTrace(std::ostream& stream, const std::vector<ProfileTimeRecord>& timeRecords);
+
     public:
 
         //! Current frame profile with all counter values.
-        FrameProfile frameProfile;
+        FrameProfile                    frameProfile;
+
+        /**
+        \brief Specifies whether GPU time recording is enabled. By default false.
+        \remarks If enabled, the debug layer measures all render passes and compute dispatches with queries of type QueryType::TimeElapsed.
+        The results are resolved asynchronously, i.e. they are appended to \c timeRecords a few frames later when a command buffer is submitted.
+        Since timer queries cannot be nested, the client programmer must not measure render passes or dispatches with own queries of type QueryType::TimeElapsed while this is enabled.
+        \see timeRecords
+        */
+        bool                            timeRecording       = false;
+
+        /**
+        \brief Specifies whether pipeline statistics are recorded together with the GPU time records. By default false.
+        \remarks This has no effect if \c timeRecording is disabled or pipeline statistics are not supported.
+        \see ProfileTimeRecord::statistics
+        \see RenderingFeatures::hasPipelineStatistics
+        */
+        bool                            pipelineStatistics  = false;
+
+        /**
+        \brief Time records that have been resolved since the last call to NextProfile.
+        \remarks The records of each command buffer encoding are stored in depth-first order, i.e. each debug group precedes its enclosed sections.
+        \see ProfileTimeRecord::level
+        */
+        std::vector<ProfileTimeRecord>  timeRecords;
 
 };
 
@@ -207,6 +207,14 @@ struct MiscFlags
         \remarks If this is specified, a texture or buffer resource will stay uninitialized during creation and the content is undefined.
         */
         NoInitialData   = (1 << 3),
+
+        /**
+        \brief Specifies that the resource is accessed by command buffers of more than one command queue type.
+        \remarks This must be specified for all buffers and textures that are accessed by command buffers of type CommandQueueType::Compute or CommandQueueType::Transfer.
+        Without this flag, a resource is only accessible by the graphics queue, which is more efficient on some devices (e.g. exclusive sharing mode for Vulkan).
+        \see CommandBufferDescriptor::queueType
+        */
+        SharedQueues    = (1 << 4),
     };
 };
 
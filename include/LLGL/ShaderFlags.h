@@ -270,7 +270,9 @@ struct ShaderDescriptor
     /**
     \brief Optional compilation flags. By default 0.
     \remarks This can be a bitwise OR combination of the ShaderCompileFlags enumeration entries.
-    \note Only supported with: HLSL.
+    For SPIR-V modules, debug instructions (such as OpName and OpLine) are stripped before the module is passed to the driver,
+    unless ShaderCompileFlags::Debug is specified.
+    \note Only supported with: HLSL, SPIR-V.
     \see ShaderCompileFlags
     */
     long                        flags           = 0;
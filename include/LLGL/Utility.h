@@ -205,10 +205,24 @@ auto myLayoutDescUtil = LLGL::PipelineLayoutDesc(
 );
 auto myLayout = myRenderer->CreatePipelineLayout(myLayoutDescUtil);
 \endcode
+\remarks Each distinct layout signature is only parsed once; subsequent calls with the same signature return a copy of the cached descriptor.
+The number of cached signatures is limited, so signatures that are generated at runtime might be parsed again.
+Since render systems share pipeline layouts with identical bindings, the same signature always results in the same PipelineLayout object as long as it has not been released.
+\remarks Use CreatePipelineLayout(RenderSystem&, const char*) to create a pipeline layout from a signature without copying the cached descriptor.
 \throws std::invalid_argument If the input parameter is null of parsing the layout signature failed.
 */
 LLGL_EXPORT PipelineLayoutDescriptor PipelineLayoutDesc(const char* layoutSignature);
 
+/**
+\brief Creates a pipeline layout with the specified render system from the specified layout signature.
+\remarks This is equivalent to <code>renderSystem.CreatePipelineLayout(LLGL::PipelineLayoutDesc(layoutSignature))</code>,
+but the cached descriptor is passed to the render system directly instead of being copied for each call.
+\throws std::invalid_argument If the input parameter is null or parsing the layout signature failed.
+\see PipelineLayoutDesc(const char*)
+\see RenderSystem::CreatePipelineLayout
+*/
+LLGL_EXPORT PipelineLayout* CreatePipelineLayout(RenderSystem& renderSystem, const char* layoutSignature);
+
 /* ----- RenderPassDescriptor utility functions ----- */
 
 /**
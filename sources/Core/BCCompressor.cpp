@@ -0,0 +1,675 @@
+/*
+ * BCCompressor.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "BCCompressor.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <cstdlib>
+
+
+namespace LLGL
+{
+
+
+/*
+All blocks are decoded into and encoded from an intermediate array of 4x4 RGBA texels.
+The inner loops always process all 16 texels of a block without data dependent branches,
+so the compiler can vectorize them, and the blocks are distributed over worker threads by rows of blocks.
+*/
+
+using BCTexelBlock  = std::uint8_t[16][4];
+using BCValueBlock  = int[16];
+
+// Minimal number of blocks each worker thread shall process
+static const std::size_t g_bcThreadMinWorkSize = 256;
+
+/* ----- Common ----- */
+
+static std::size_t GetBCBlockSize(const ImageFormat format)
+{
+    switch (format)
+    {
+        case ImageFormat::BC1:
+        case ImageFormat::BC4:
+            return 8;
+        case ImageFormat::BC2:
+        case ImageFormat::BC3:
+        case ImageFormat::BC5:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+static std::uint32_t ReadUInt16LE(const std::uint8_t* src)
+{
+    return (static_cast<std::uint32_t>(src[0]) | (static_cast<std::uint32_t>(src[1]) << 8));
+}
+
+static std::uint32_t ReadUInt32LE(const std::uint8_t* src)
+{
+    return (ReadUInt16LE(src) | (ReadUInt16LE(src + 2) << 16));
+}
+
+static void WriteUInt16LE(std::uint8_t* dst, std::uint32_t value)
+{
+    dst[0] = static_cast<std::uint8_t>(value & 0xFF);
+    dst[1] = static_cast<std::uint8_t>((value >> 8) & 0xFF);
+}
+
+static void WriteUInt32LE(std::uint8_t* dst, std::uint32_t value)
+{
+    WriteUInt16LE(dst, value & 0xFFFF);
+    WriteUInt16LE(dst + 2, value >> 16);
+}
+
+// Divides the specified value by the divisor and rounds to the nearest integer (also for negative values).
+static int DivRound(int value, int divisor)
+{
+    return (value >= 0 ? (value + divisor/2) / divisor : -((-value + divisor/2) / divisor));
+}
+
+static void UnpackRGB565(std::uint32_t color, int (&rgb)[3])
+{
+    const int r = static_cast<int>((color >> 11) & 0x1F);
+    const int g = static_cast<int>((color >>  5) & 0x3F);
+    const int b = static_cast<int>( color        & 0x1F);
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+static std::uint32_t PackRGB565(const int (&rgb)[3])
+{
+    const auto r = static_cast<std::uint32_t>((rgb[0] * 31 + 127) / 255);
+    const auto g = static_cast<std::uint32_t>((rgb[1] * 63 + 127) / 255);
+    const auto b = static_cast<std::uint32_t>((rgb[2] * 31 + 127) / 255);
+    return ((r << 11) | (g << 5) | b);
+}
+
+// Builds the palette of 8 values for a BC4 block (also used for the alpha block of BC3).
+static void BuildAlphaPalette(int a0, int a1, bool isSigned, int (&palette)[8])
+{
+    palette[0] = a0;
+    palette[1] = a1;
+
+    if (a0 > a1)
+    {
+        for (int i = 1; i <= 6; ++i)
+            palette[i + 1] = DivRound((7 - i) * a0 + i * a1, 7);
+    }
+    else
+    {
+        for (int i = 1; i <= 4; ++i)
+            palette[i + 1] = DivRound((5 - i) * a0 + i * a1, 5);
+        palette[6] = (isSigned ? -127 :   0);
+        palette[7] = (isSigned ?  127 : 255);
+    }
+}
+
+// Builds the palette of 4 colors for a BC1 color block.
+static void BuildColorPalette(std::uint32_t c0, std::uint32_t c1, bool allowPunchThrough, int (&palette)[4][4])
+{
+    int rgb0[3], rgb1[3];
+    UnpackRGB565(c0, rgb0);
+    UnpackRGB565(c1, rgb1);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        palette[0][i] = rgb0[i];
+        palette[1][i] = rgb1[i];
+    }
+
+    palette[0][3] = 255;
+    palette[1][3] = 255;
+    palette[2][3] = 255;
+    palette[3][3] = 255;
+
+    if (c0 > c1 || !allowPunchThrough)
+    {
+        /* Four color mode */
+        for (int i = 0; i < 3; ++i)
+        {
+            palette[2][i] = (2 * rgb0[i] + rgb1[i] + 1) / 3;
+            palette[3][i] = (rgb0[i] + 2 * rgb1[i] + 1) / 3;
+        }
+    }
+    else
+    {
+        /* Three color mode with transparent black */
+        for (int i = 0; i < 3; ++i)
+        {
+            palette[2][i] = (rgb0[i] + rgb1[i]) / 2;
+            palette[3][i] = 0;
+        }
+        palette[3][3] = 0;
+    }
+}
+
+/* ----- Decoding ----- */
+
+static void DecodeColorBlock(const std::uint8_t* src, bool allowPunchThrough, BCTexelBlock& texels)
+{
+    int palette[4][4];
+    BuildColorPalette(ReadUInt16LE(src), ReadUInt16LE(src + 2), allowPunchThrough, palette);
+
+    const auto indices = ReadUInt32LE(src + 4);
+    for (int i = 0; i < 16; ++i)
+    {
+        const auto& color = palette[(indices >> (i * 2)) & 0x3];
+        texels[i][0] = static_cast<std::uint8_t>(color[0]);
+        texels[i][1] = static_cast<std::uint8_t>(color[1]);
+        texels[i][2] = static_cast<std::uint8_t>(color[2]);
+        texels[i][3] = static_cast<std::uint8_t>(color[3]);
+    }
+}
+
+// Decodes a BC4 block into the specified component of the texel block.
+static void DecodeAlphaBlock(const std::uint8_t* src, bool isSigned, BCTexelBlock& texels, int component)
+{
+    int a0 = (isSigned ? static_cast<int>(static_cast<std::int8_t>(src[0])) : static_cast<int>(src[0]));
+    int a1 = (isSigned ? static_cast<int>(static_cast<std::int8_t>(src[1])) : static_cast<int>(src[1]));
+
+    /* Signed value -128 is treated as -127 */
+    if (isSigned)
+    {
+        a0 = std::max(a0, -127);
+        a1 = std::max(a1, -127);
+    }
+
+    int palette[8];
+    BuildAlphaPalette(a0, a1, isSigned, palette);
+
+    /* Read 48 bits of 3-bit indices */
+    std::uint64_t indices = 0;
+    for (int i = 0; i < 6; ++i)
+        indices |= (static_cast<std::uint64_t>(src[2 + i]) << (i * 8));
+
+    for (int i = 0; i < 16; ++i)
+        texels[i][component] = static_cast<std::uint8_t>(palette[(indices >> (i * 3)) & 0x7]);
+}
+
+static void DecodeExplicitAlphaBlock(const std::uint8_t* src, BCTexelBlock& texels)
+{
+    for (int i = 0; i < 16; ++i)
+    {
+        const auto alpha = static_cast<std::uint8_t>((src[i / 2] >> ((i % 2) * 4)) & 0xF);
+        texels[i][3] = static_cast<std::uint8_t>(alpha * 17);
+    }
+}
+
+static void DecodeBlock(const ImageFormat format, bool isSigned, const std::uint8_t* src, BCTexelBlock& texels)
+{
+    const std::uint8_t one = (isSigned ? 127 : 255);
+
+    switch (format)
+    {
+        case ImageFormat::BC1:
+            DecodeColorBlock(src, true, texels);
+            break;
+
+        case ImageFormat::BC2:
+            DecodeColorBlock(src + 8, false, texels);
+            DecodeExplicitAlphaBlock(src, texels);
+            break;
+
+        case ImageFormat::BC3:
+            DecodeColorBlock(src + 8, false, texels);
+            DecodeAlphaBlock(src, false, texels, 3);
+            break;
+
+        case ImageFormat::BC4:
+            DecodeAlphaBlock(src, isSigned, texels, 0);
+            for (int i = 0; i < 16; ++i)
+            {
+                texels[i][1] = 0;
+                texels[i][2] = 0;
+                texels[i][3] = one;
+            }
+            break;
+
+        case ImageFormat::BC5:
+            DecodeAlphaBlock(src, isSigned, texels, 0);
+            DecodeAlphaBlock(src + 8, isSigned, texels, 1);
+            for (int i = 0; i < 16; ++i)
+            {
+                texels[i][2] = 0;
+                texels[i][3] = one;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* ----- Encoding ----- */
+
+// Swaps the min/max endpoints of the red and blue components if they are anti-correlated with the green component.
+static void SelectColorDiagonal(const BCTexelBlock& texels, int (&minColor)[3], int (&maxColor)[3])
+{
+    const int center[3] =
+    {
+        (minColor[0] + maxColor[0]) / 2,
+        (minColor[1] + maxColor[1]) / 2,
+        (minColor[2] + maxColor[2]) / 2,
+    };
+
+    int covRG = 0, covBG = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        const int g = static_cast<int>(texels[i][1]) - center[1];
+        covRG += (static_cast<int>(texels[i][0]) - center[0]) * g;
+        covBG += (static_cast<int>(texels[i][2]) - center[2]) * g;
+    }
+
+    if (covRG < 0)
+        std::swap(minColor[0], maxColor[0]);
+    if (covBG < 0)
+        std::swap(minColor[2], maxColor[2]);
+}
+
+// Encodes the color block with the specified endpoints in four color mode and returns the squared error.
+static int EncodeColorBlockWithEndpoints(const BCTexelBlock& texels, const int (&color0)[3], const int (&color1)[3], std::uint8_t* dst)
+{
+    /* Write endpoints in four color mode (c0 > c1) */
+    auto c0 = PackRGB565(color0);
+    auto c1 = PackRGB565(color1);
+
+    if (c0 < c1)
+        std::swap(c0, c1);
+
+    WriteUInt16LE(dst, c0);
+    WriteUInt16LE(dst + 2, c1);
+
+    /* Select nearest palette color for each texel (all indices are 0 if both endpoints are equal) */
+    int palette[4][4];
+    BuildColorPalette(c0, c1, false, palette);
+
+    const int numColors = (c0 == c1 ? 1 : 4);
+
+    std::uint32_t   indices     = 0;
+    int             errorSum    = 0;
+
+    for (int i = 0; i < 16; ++i)
+    {
+        int dist[4];
+        for (int j = 0; j < 4; ++j)
+        {
+            const int dr = static_cast<int>(texels[i][0]) - palette[j][0];
+            const int dg = static_cast<int>(texels[i][1]) - palette[j][1];
+            const int db = static_cast<int>(texels[i][2]) - palette[j][2];
+            dist[j] = dr*dr + dg*dg + db*db;
+        }
+
+        std::uint32_t index = 0;
+        for (int j = 1; j < numColors; ++j)
+        {
+            if (dist[j] < dist[index])
+                index = static_cast<std::uint32_t>(j);
+        }
+
+        indices  |= (index << (i * 2));
+        errorSum += dist[index];
+    }
+
+    WriteUInt32LE(dst + 4, indices);
+
+    return errorSum;
+}
+
+/*
+Refines the endpoints of the encoded color block by a least squares fit for its selected indices.
+Returns false if the endpoints cannot be refined, e.g. if all texels use the same index.
+*/
+static bool RefineColorEndpoints(const BCTexelBlock& texels, const std::uint8_t* block, int (&color0)[3], int (&color1)[3])
+{
+    /* Weights (scaled by 3) of the first endpoint for each index in four color mode */
+    static const int weights[4] = { 3, 0, 2, 1 };
+
+    const auto indices = ReadUInt32LE(block + 4);
+
+    int aa = 0, ab = 0, bb = 0;
+    int ax[3] = { 0, 0, 0 };
+    int bx[3] = { 0, 0, 0 };
+
+    for (int i = 0; i < 16; ++i)
+    {
+        const int a = weights[(indices >> (i * 2)) & 0x3];
+        const int b = 3 - a;
+
+        aa += a*a;
+        ab += a*b;
+        bb += b*b;
+
+        for (int c = 0; c < 3; ++c)
+        {
+            ax[c] += a * static_cast<int>(texels[i][c]);
+            bx[c] += b * static_cast<int>(texels[i][c]);
+        }
+    }
+
+    const int det = aa*bb - ab*ab;
+    if (det == 0)
+        return false;
+
+    /* Solve 2x2 linear system for each component (weights are scaled by 3, so the solution is scaled by 3 as well) */
+    for (int c = 0; c < 3; ++c)
+    {
+        color0[c] = std::max(0, std::min(255, DivRound(3 * (ax[c]*bb - bx[c]*ab), det)));
+        color1[c] = std::max(0, std::min(255, DivRound(3 * (bx[c]*aa - ax[c]*ab), det)));
+    }
+
+    return true;
+}
+
+static void EncodeColorBlock(const BCTexelBlock& texels, std::uint8_t* dst)
+{
+    /* Determine bounding box of colors */
+    int minColor[3] = { 255, 255, 255 };
+    int maxColor[3] = {   0,   0,   0 };
+
+    for (int i = 0; i < 16; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            minColor[c] = std::min(minColor[c], static_cast<int>(texels[i][c]));
+            maxColor[c] = std::max(maxColor[c], static_cast<int>(texels[i][c]));
+        }
+    }
+
+    /* Inset bounding box by 1/16 of its size to reduce the error of the interpolated colors */
+    for (int c = 0; c < 3; ++c)
+    {
+        const int inset = (maxColor[c] - minColor[c]) >> 4;
+        minColor[c] += inset;
+        maxColor[c] -= inset;
+    }
+
+    SelectColorDiagonal(texels, minColor, maxColor);
+
+    int error = EncodeColorBlockWithEndpoints(texels, maxColor, minColor, dst);
+
+    /* Refine endpoints with the selected indices, and keep them only if they reduce the error */
+    int color0[3], color1[3];
+    if (error > 0 && RefineColorEndpoints(texels, dst, color0, color1))
+    {
+        std::uint8_t refinedBlock[8];
+        if (EncodeColorBlockWithEndpoints(texels, color0, color1, refinedBlock) < error)
+            std::copy(refinedBlock, refinedBlock + 8, dst);
+    }
+}
+
+static void EncodeAlphaBlock(const BCValueBlock& values, bool isSigned, std::uint8_t* dst)
+{
+    /* Determine endpoints in eight value mode (a0 > a1) */
+    int a0 = values[0], a1 = values[0];
+
+    for (int i = 1; i < 16; ++i)
+    {
+        a0 = std::max(a0, values[i]);
+        a1 = std::min(a1, values[i]);
+    }
+
+    if (isSigned)
+    {
+        a0 = std::max(a0, -127);
+        a1 = std::max(a1, -127);
+    }
+
+    dst[0] = static_cast<std::uint8_t>(a0);
+    dst[1] = static_cast<std::uint8_t>(a1);
+
+    /* Select nearest palette value for each texel */
+    std::uint64_t indices = 0;
+
+    if (a0 != a1)
+    {
+        int palette[8];
+        BuildAlphaPalette(a0, a1, isSigned, palette);
+
+        for (int i = 0; i < 16; ++i)
+        {
+            std::uint64_t index = 0;
+            int minDist = std::abs(values[i] - palette[0]);
+
+            for (std::uint64_t j = 1; j < 8; ++j)
+            {
+                const int dist = std::abs(values[i] - palette[j]);
+                if (dist < minDist)
+                {
+                    minDist = dist;
+                    index   = j;
+                }
+            }
+
+            indices |= (index << (i * 3));
+        }
+    }
+
+    for (int i = 0; i < 6; ++i)
+        dst[2 + i] = static_cast<std::uint8_t>((indices >> (i * 8)) & 0xFF);
+}
+
+static void EncodeExplicitAlphaBlock(const BCTexelBlock& texels, std::uint8_t* dst)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        const auto a0 = static_cast<std::uint32_t>(texels[i*2    ][3] + 8) / 17;
+        const auto a1 = static_cast<std::uint32_t>(texels[i*2 + 1][3] + 8) / 17;
+        dst[i] = static_cast<std::uint8_t>(a0 | (a1 << 4));
+    }
+}
+
+static void GetBlockComponent(const BCTexelBlock& texels, bool isSigned, int component, BCValueBlock& values)
+{
+    for (int i = 0; i < 16; ++i)
+    {
+        values[i] =
+        (
+            isSigned
+                ? static_cast<int>(static_cast<std::int8_t>(texels[i][component]))
+                : static_cast<int>(texels[i][component])
+        );
+    }
+}
+
+static void EncodeBlock(const ImageFormat format, bool isSigned, const BCTexelBlock& texels, std::uint8_t* dst)
+{
+    BCValueBlock values;
+
+    switch (format)
+    {
+        case ImageFormat::BC1:
+            EncodeColorBlock(texels, dst);
+            break;
+
+        case ImageFormat::BC2:
+            EncodeExplicitAlphaBlock(texels, dst);
+            EncodeColorBlock(texels, dst + 8);
+            break;
+
+        case ImageFormat::BC3:
+            GetBlockComponent(texels, false, 3, values);
+            EncodeAlphaBlock(values, false, dst);
+            EncodeColorBlock(texels, dst + 8);
+            break;
+
+        case ImageFormat::BC4:
+            GetBlockComponent(texels, isSigned, 0, values);
+            EncodeAlphaBlock(values, isSigned, dst);
+            break;
+
+        case ImageFormat::BC5:
+            GetBlockComponent(texels, isSigned, 0, values);
+            EncodeAlphaBlock(values, isSigned, dst);
+            GetBlockComponent(texels, isSigned, 1, values);
+            EncodeAlphaBlock(values, isSigned, dst + 8);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* ----- Workers ----- */
+
+// Processes the rows of blocks in the range [begin, end) with the specified function.
+static void ForEachBlockRowConcurrent(
+    std::size_t                                             numBlockRows,
+    std::size_t                                             numBlocksPerRow,
+    std::size_t                                             threadCount,
+    const std::function<void(std::size_t, std::size_t)>&    rowRangeFunc)
+{
+    threadCount = std::min(threadCount, (numBlockRows * numBlocksPerRow) / g_bcThreadMinWorkSize);
+    threadCount = std::min(threadCount, numBlockRows);
+
+    if (threadCount > 1)
+    {
+        /* Create worker threads */
+        std::vector<std::thread> workers(threadCount);
+
+        auto workSize       = numBlockRows / threadCount;
+        auto workSizeRemain = numBlockRows % threadCount;
+
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            workers[i] = std::thread(rowRangeFunc, offset, offset + workSize);
+            offset += workSize;
+        }
+
+        /* Execute remaining work on main thread */
+        if (workSizeRemain > 0)
+            rowRangeFunc(offset, offset + workSizeRemain);
+
+        /* Join worker threads */
+        for (auto& w : workers)
+            w.join();
+    }
+    else
+    {
+        /* Execute work only on main thread */
+        rowRangeFunc(0, numBlockRows);
+    }
+}
+
+
+/*
+ * Global functions
+ */
+
+bool IsBCFormat(const ImageFormat format)
+{
+    return (GetBCBlockSize(format) > 0);
+}
+
+std::size_t BCImageDataSize(const ImageFormat format, const Extent3D& extent)
+{
+    const std::size_t numBlocksX = (extent.width  + 3) / 4;
+    const std::size_t numBlocksY = (extent.height + 3) / 4;
+    return (numBlocksX * numBlocksY * extent.depth * GetBCBlockSize(format));
+}
+
+void DecompressBC(
+    const ImageFormat   format,
+    bool                isSigned,
+    const void*         srcData,
+    void*               dstData,
+    const Extent3D&     extent,
+    std::size_t         threadCount)
+{
+    const auto blockSize    = GetBCBlockSize(format);
+    const auto numBlocksX   = (extent.width  + 3) / 4;
+    const auto numBlocksY   = (extent.height + 3) / 4;
+
+    auto src = reinterpret_cast<const std::uint8_t*>(srcData);
+    auto dst = reinterpret_cast<std::uint8_t*>(dstData);
+
+    auto decodeRows = [&](std::size_t begin, std::size_t end)
+    {
+        BCTexelBlock texels;
+
+        for (auto row = begin; row < end; ++row)
+        {
+            const auto z    = static_cast<std::uint32_t>(row / numBlocksY);
+            const auto by   = static_cast<std::uint32_t>(row % numBlocksY);
+
+            for (std::uint32_t bx = 0; bx < numBlocksX; ++bx)
+            {
+                DecodeBlock(format, isSigned, src + (row * numBlocksX + bx) * blockSize, texels);
+
+                /* Write texels inside the image boundary */
+                const auto numX = std::min(4u, extent.width  - bx * 4);
+                const auto numY = std::min(4u, extent.height - by * 4);
+
+                for (std::uint32_t y = 0; y < numY; ++y)
+                {
+                    auto dstRow = dst + ((static_cast<std::size_t>(z) * extent.height + by * 4 + y) * extent.width + bx * 4) * 4;
+                    std::copy(&texels[y * 4][0], &texels[y * 4][0] + numX * 4, dstRow);
+                }
+            }
+        }
+    };
+
+    ForEachBlockRowConcurrent(static_cast<std::size_t>(numBlocksY) * extent.depth, numBlocksX, threadCount, decodeRows);
+}
+
+void CompressBC(
+    const ImageFormat   format,
+    bool                isSigned,
+    const void*         srcData,
+    std::size_t         srcRowStride,
+    std::size_t         srcLayerStride,
+    void*               dstData,
+    const Extent3D&     extent,
+    std::size_t         threadCount)
+{
+    const auto blockSize    = GetBCBlockSize(format);
+    const auto numBlocksX   = (extent.width  + 3) / 4;
+    const auto numBlocksY   = (extent.height + 3) / 4;
+
+    auto src = reinterpret_cast<const std::uint8_t*>(srcData);
+    auto dst = reinterpret_cast<std::uint8_t*>(dstData);
+
+    auto encodeRows = [&](std::size_t begin, std::size_t end)
+    {
+        BCTexelBlock texels;
+
+        for (auto row = begin; row < end; ++row)
+        {
+            const auto z    = static_cast<std::uint32_t>(row / numBlocksY);
+            const auto by   = static_cast<std::uint32_t>(row % numBlocksY);
+
+            for (std::uint32_t bx = 0; bx < numBlocksX; ++bx)
+            {
+                /* Read texels and replicate the edge texels for partial blocks */
+                for (std::uint32_t i = 0; i < 16; ++i)
+                {
+                    const auto x = std::min(bx * 4 + i % 4, extent.width  - 1);
+                    const auto y = std::min(by * 4 + i / 4, extent.height - 1);
+                    auto srcTexel = src + z * srcLayerStride + y * srcRowStride + x * 4;
+                    std::copy(srcTexel, srcTexel + 4, texels[i]);
+                }
+
+                EncodeBlock(format, isSigned, texels, dst + (row * numBlocksX + bx) * blockSize);
+            }
+        }
+    };
+
+    ForEachBlockRowConcurrent(static_cast<std::size_t>(numBlocksY) * extent.depth, numBlocksX, threadCount, encodeRows);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
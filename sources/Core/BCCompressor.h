@@ -0,0 +1,68 @@
+/*
+ * BCCompressor.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_BC_COMPRESSOR_H
+#define LLGL_BC_COMPRESSOR_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Format.h>
+#include <LLGL/Types.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Returns true if the specified image format is one of the block compression formats BC1 - BC5.
+bool IsBCFormat(const ImageFormat format);
+
+// Returns the size (in bytes) of the block compressed image data with the specified format and extent.
+std::size_t BCImageDataSize(const ImageFormat format, const Extent3D& extent);
+
+/*
+Decompresses the block compressed image data (BC1 - BC5) into RGBA image data with 8-bit components.
+For signed formats (BC4 and BC5 with 'isSigned' = true) the output components are signed 8-bit integers.
+Channels that are not contained in the compressed format are set to 0 for color and to 1 (normalized) for alpha.
+The 'depth' component of the extent specifies the number of consecutive 2D slices (depth slices or array layers).
+*/
+void DecompressBC(
+    const ImageFormat   format,
+    bool                isSigned,
+    const void*         srcData,
+    void*               dstData,
+    const Extent3D&     extent,
+    std::size_t         threadCount
+);
+
+/*
+Compresses the RGBA image data with 8-bit components into block compressed image data (BC1 - BC5).
+For signed formats (BC4 and BC5 with 'isSigned' = true) the input components must be signed 8-bit integers.
+The source rows and slices are addressed with the specified strides (in bytes).
+The encoder is optimized for speed (e.g. for runtime generated textures) and uses bounding box endpoints.
+*/
+void CompressBC(
+    const ImageFormat   format,
+    bool                isSigned,
+    const void*         srcData,
+    std::size_t         srcRowStride,
+    std::size_t         srcLayerStride,
+    void*               dstData,
+    const Extent3D&     extent,
+    std::size_t         threadCount
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
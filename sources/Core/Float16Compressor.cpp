@@ -7,6 +7,19 @@
 
 #include "Float16Compressor.h"
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#   define LLGL_FLOAT16_F16C
+#   include <immintrin.h>
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#   define LLGL_FLOAT16_NEON
+#   include <arm_neon.h>
+#endif
+
 
 namespace LLGL
 {
@@ -15,28 +28,46 @@ namespace LLGL
 /*
 This class has been adopted from a public-domain code sample.
 see http://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion
+The compression has been modified to round to nearest even (instead of truncating the mantissa).
 */
 class Float16Compressor
 {
 
     public:
 
+        // Converts with round-to-nearest-even to match the hardware conversion (e.g. F16C).
         static std::uint16_t Compress(float value)
         {
-            Bits v, s;
+            Bits v;
             v.f = value;
-            std::uint32_t sign = v.si & signN;
-            v.si ^= sign;
+            std::uint32_t sign = v.ui & signN;
+            v.ui ^= sign;
             sign >>= shiftSign; // logical shift
-            s.si = mulN;
-            s.si = static_cast<std::int32_t>(s.f * v.f); // correct subnormals
-            v.si ^= (s.si ^ v.si) & -(minN > v.si);
-            v.si ^= (infN ^ v.si) & -((infN > v.si) & (v.si > maxN));
-            v.si ^= (nanN ^ v.si) & -((nanN > v.si) & (v.si > infN));
-            v.ui >>= shift; // logical shift
-            v.si ^= ((v.si - maxD) ^ v.si) & -(v.si > maxC);
-            v.si ^= ((v.si - minD) ^ v.si) & -(v.si > subC);
-            return (v.ui | sign);
+
+            std::uint32_t result = 0;
+
+            if (v.ui >= ovfN)
+            {
+                /* Overflow to infinity, or quiet NaN with truncated payload */
+                result = (v.ui > static_cast<std::uint32_t>(infN) ? (nanH | ((v.ui >> shift) & subC)) : infH);
+            }
+            else if (v.ui < static_cast<std::uint32_t>(minN))
+            {
+                /* Let the FPU round subnormals by shifting the mantissa into place with a magic number */
+                Bits s;
+                s.ui = denN;
+                v.f += s.f;
+                result = v.ui - denN;
+            }
+            else
+            {
+                /* Rebias exponent and round mantissa to nearest even */
+                const std::uint32_t odd = (v.ui >> shift) & 1u;
+                v.ui += rebN + 0x0fffu + odd;
+                result = v.ui >> shift;
+            }
+
+            return static_cast<std::uint16_t>(result | sign);
         }
 
         static float Decompress(std::uint16_t value)
@@ -76,12 +107,10 @@ class Float16Compressor
         static const std::int32_t signN     = 0x80000000; // flt32 sign bit
 
         static const std::int32_t infC      = (infN >> shift);
-        static const std::int32_t nanN      = ((infC + 1) << shift); // minimum flt16 nan as a flt32
         static const std::int32_t maxC      = (maxN >> shift);
         static const std::int32_t minC      = (minN >> shift);
         static const std::int32_t signC     = (signN >> shiftSign); // flt16 sign bit
 
-        static const std::int32_t mulN      = 0x52000000; // (1 << 23) / minN
         static const std::int32_t mulC      = 0x33800000; // minN / (1 << (23 - shift))
 
         static const std::int32_t subC      = 0x003ff; // max flt32 subnormal down shifted
@@ -90,9 +119,132 @@ class Float16Compressor
         static const std::int32_t maxD      = (infC - maxC - 1);
         static const std::int32_t minD      = (minC - subC - 1);
 
+        static const std::uint32_t ovfN     = 0x47800000; // min flt32 that overflows flt16 after rounding
+        static const std::uint32_t denN     = 0x3f000000; // 0.5 shifts flt16 subnormal mantissa into the lower flt32 bits
+        static const std::uint32_t rebN     = 0xc8000000; // (15 - 127) << 23 rebiases flt32 exponent to flt16
+        static const std::uint32_t infH     = 0x07c00;    // flt16 infinity
+        static const std::uint32_t nanH     = 0x07e00;    // flt16 quiet nan
+
 };
 
 
+
+#if defined LLGL_FLOAT16_F16C
+
+#ifdef _MSC_VER
+#   define LLGL_TARGET_F16C
+#else
+#   define LLGL_TARGET_F16C __attribute__((target("avx,f16c")))
+#endif
+
+// Returns true if the CPU supports F16C and the OS preserves the AVX registers.
+static bool QueryF16CSupport()
+{
+    #ifdef _MSC_VER
+
+    int info[4] = {};
+    __cpuid(info, 1);
+    const auto ecx = static_cast<unsigned>(info[2]);
+
+    #else
+
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return false;
+
+    #endif
+
+    const unsigned osxsaveAvxF16cBits = (1u << 27) | (1u << 28) | (1u << 29);
+    if ((ecx & osxsaveAvxF16cBits) != osxsaveAvxF16cBits)
+        return false;
+
+    #ifdef _MSC_VER
+    const auto xcr0 = static_cast<unsigned long long>(_xgetbv(0));
+    #else
+    unsigned xcr0Lo = 0, xcr0Hi = 0;
+    __asm__ ("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+    const auto xcr0 = (static_cast<unsigned long long>(xcr0Hi) << 32) | xcr0Lo;
+    #endif
+
+    /* XMM and YMM state must be enabled */
+    return ((xcr0 & 0x6) == 0x6);
+}
+
+static bool HasF16CSupport()
+{
+    static const bool supported = QueryF16CSupport();
+    return supported;
+}
+
+LLGL_TARGET_F16C
+static std::size_t CompressFloat16ArrayF16C(const float* src, std::uint16_t* dst, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        auto v = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+    return i;
+}
+
+LLGL_TARGET_F16C
+static std::size_t DecompressFloat16ArrayF16C(const std::uint16_t* src, float* dst, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(v));
+    }
+    return i;
+}
+
+#undef LLGL_TARGET_F16C
+
+#endif // /LLGL_FLOAT16_F16C
+
+// Converts the leading part of the array with SIMD instructions and returns the number of converted elements.
+static std::size_t CompressFloat16ArraySIMD(const float* src, std::uint16_t* dst, std::size_t count)
+{
+    #if defined LLGL_FLOAT16_F16C
+
+    if (HasF16CSupport())
+        return CompressFloat16ArrayF16C(src, dst, count);
+
+    #elif defined LLGL_FLOAT16_NEON
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+    return i;
+
+    #endif
+
+    return 0;
+}
+
+// Converts the leading part of the array with SIMD instructions and returns the number of converted elements.
+static std::size_t DecompressFloat16ArraySIMD(const std::uint16_t* src, float* dst, std::size_t count)
+{
+    #if defined LLGL_FLOAT16_F16C
+
+    if (HasF16CSupport())
+        return DecompressFloat16ArrayF16C(src, dst, count);
+
+    #elif defined LLGL_FLOAT16_NEON
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    return i;
+
+    #endif
+
+    return 0;
+}
+
+
 LLGL_EXPORT std::uint16_t CompressFloat16(float value)
 {
     return Float16Compressor::Compress(value);
@@ -103,6 +255,20 @@ LLGL_EXPORT float DecompressFloat16(std::uint16_t value)
     return Float16Compressor::Decompress(value);
 }
 
+LLGL_EXPORT void CompressFloat16Array(const float* src, std::uint16_t* dst, std::size_t count)
+{
+    /* Convert remaining elements that don't fill an entire SIMD register */
+    for (auto i = CompressFloat16ArraySIMD(src, dst, count); i < count; ++i)
+        dst[i] = Float16Compressor::Compress(src[i]);
+}
+
+LLGL_EXPORT void DecompressFloat16Array(const std::uint16_t* src, float* dst, std::size_t count)
+{
+    /* Convert remaining elements that don't fill an entire SIMD register */
+    for (auto i = DecompressFloat16ArraySIMD(src, dst, count); i < count; ++i)
+        dst[i] = Float16Compressor::Decompress(src[i]);
+}
+
 
 } // /namespace LLGL
 
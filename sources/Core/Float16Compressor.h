@@ -11,18 +11,29 @@
 
 #include <LLGL/Export.h>
 #include <cstdint>
+#include <cstddef>
 
 
 namespace LLGL
 {
 
 
-// Compresses the specified 32-bit float into a 16-bit float (represented as 16-bit unsigned integer).
+// Compresses the specified 32-bit float into a 16-bit float (represented as 16-bit unsigned integer) with round-to-nearest-even.
 LLGL_EXPORT std::uint16_t CompressFloat16(float value);
 
 // Decompresses the specified 16-bit float (represented as 16-bit unsigned integer) into a 32-bit float.
 LLGL_EXPORT float DecompressFloat16(std::uint16_t value);
 
+/*
+Compresses the specified array of 32-bit floats into 16-bit floats.
+Uses the F16C instruction set on x86 (if supported by the CPU) and the FP16 conversion instructions on ARM64.
+The results are bit-identical to 'CompressFloat16' for all non-NaN values.
+*/
+LLGL_EXPORT void CompressFloat16Array(const float* src, std::uint16_t* dst, std::size_t count);
+
+// Decompresses the specified array of 16-bit floats into 32-bit floats. See 'CompressFloat16Array'.
+LLGL_EXPORT void DecompressFloat16Array(const std::uint16_t* src, float* dst, std::size_t count);
+
 
 } // /namespace LLGL
 
@@ -45,6 +45,51 @@ LLGL_EXPORT std::vector<char> ReadFileBuffer(const char* filename)
     return buffer;
 }
 
+LLGL_EXPORT std::uint64_t HashBuffer(const void* data, std::size_t size)
+{
+    const std::uint64_t fnvOffsetBasis  = 0xcbf29ce484222325ull;
+    const std::uint64_t fnvPrime        = 0x00000100000001b3ull;
+
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+
+    std::uint64_t hash = fnvOffsetBasis;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= fnvPrime;
+    }
+
+    return hash;
+}
+
+LLGL_EXPORT Hash128 HashBuffer128(const void* data, std::size_t size)
+{
+    /* FNV prime is 2^88 + 0x13B, so the 128-bit multiplication is split into a multiplication with 0x13B and a shift by 88 bits */
+    const std::uint64_t fnvPrimeLow = 0x13B;
+
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+
+    Hash128 hash;
+    {
+        hash.lo = 0x62b821756295c58dull;
+        hash.hi = 0x6c62272e07bb0142ull;
+    }
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash.lo ^= bytes[i];
+
+        /* Multiply low 64 bits in 32-bit halves to get the carry into the high 64 bits */
+        const std::uint64_t lo0     = (hash.lo & 0xFFFFFFFFull) * fnvPrimeLow;
+        const std::uint64_t lo1     = (hash.lo >> 32) * fnvPrimeLow + (lo0 >> 32);
+        const std::uint64_t shifted = (hash.lo << 24);
+
+        hash.hi = hash.hi * fnvPrimeLow + (lo1 >> 32) + shifted;
+        hash.lo = (lo1 << 32) | (lo0 & 0xFFFFFFFFull);
+    }
+
+    return hash;
+}
+
 
 } // /namespace LLGL
 
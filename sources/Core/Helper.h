@@ -251,6 +251,29 @@ LLGL_EXPORT std::string ReadFileString(const char* filename);
 // Reads the specified binary file into a buffer.
 LLGL_EXPORT std::vector<char> ReadFileBuffer(const char* filename);
 
+// Returns the 64-bit FNV-1a hash of the specified buffer.
+LLGL_EXPORT std::uint64_t HashBuffer(const void* data, std::size_t size);
+
+// 128-bit hash value, which is wide enough to identify a buffer by its content without storing a copy of it.
+struct Hash128
+{
+    std::uint64_t lo = 0;
+    std::uint64_t hi = 0;
+};
+
+inline bool operator == (const Hash128& lhs, const Hash128& rhs)
+{
+    return (lhs.lo == rhs.lo && lhs.hi == rhs.hi);
+}
+
+inline bool operator < (const Hash128& lhs, const Hash128& rhs)
+{
+    return (lhs.hi < rhs.hi || (lhs.hi == rhs.hi && lhs.lo < rhs.lo));
+}
+
+// Returns the 128-bit FNV-1a hash of the specified buffer.
+LLGL_EXPORT Hash128 HashBuffer128(const void* data, std::size_t size);
+
 
 } // /namespace LLGL
 
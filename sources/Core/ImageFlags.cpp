@@ -15,6 +15,7 @@
 #include "../Core/Helper.h"
 #include "../Core/Assertion.h"
 #include "Float16Compressor.h"
+#include "BCCompressor.h"
 
 
 namespace LLGL
@@ -167,8 +168,46 @@ static void WriteNormalizedTypedVariant(DataType dstDataType, VariantBuffer& dst
     }
 }
 
-// Worker thread procedure for the "ConvertImageBufferDataType" function
-static void ConvertImageBufferDataTypeWorker(
+// Number of entries that are converted at once from or into half-precision floats.
+static const std::size_t g_float16ChunkSize = 256;
+
+// Converts between half-precision floats and any other data type in chunks with the bulk conversion functions.
+static void ConvertImageBufferFloat16Chunks(
+    DataType                    srcDataType,
+    const VariantConstBuffer&   srcBuffer,
+    DataType                    dstDataType,
+    VariantBuffer&              dstBuffer,
+    std::size_t                 idxBegin,
+    std::size_t                 idxEnd)
+{
+    float chunk[g_float16ChunkSize];
+
+    for (auto chunkBegin = idxBegin; chunkBegin < idxEnd; chunkBegin += g_float16ChunkSize)
+    {
+        const auto chunkSize = std::min(g_float16ChunkSize, idxEnd - chunkBegin);
+
+        /* Read source entries into single-precision chunk */
+        if (srcDataType == DataType::Float16)
+            DecompressFloat16Array(srcBuffer.uint16 + chunkBegin, chunk, chunkSize);
+        else
+        {
+            for (std::size_t i = 0; i < chunkSize; ++i)
+                chunk[i] = static_cast<float>(ReadNormalizedTypedVariant(srcDataType, srcBuffer, chunkBegin + i));
+        }
+
+        /* Write single-precision chunk into destination entries */
+        if (dstDataType == DataType::Float16)
+            CompressFloat16Array(chunk, dstBuffer.uint16 + chunkBegin, chunkSize);
+        else
+        {
+            for (std::size_t i = 0; i < chunkSize; ++i)
+                WriteNormalizedTypedVariant(dstDataType, dstBuffer, chunkBegin + i, static_cast<double>(chunk[i]));
+        }
+    }
+}
+
+// Converts between any data types via double-precision normalized values.
+static void ConvertImageBufferDataTypeGeneric(
     DataType                    srcDataType,
     const VariantConstBuffer&   srcBuffer,
     DataType                    dstDataType,
@@ -188,6 +227,26 @@ static void ConvertImageBufferDataTypeWorker(
     }
 }
 
+// Worker thread procedure for the "ConvertImageBufferDataType" function
+static void ConvertImageBufferDataTypeWorker(
+    DataType                    srcDataType,
+    const VariantConstBuffer&   srcBuffer,
+    DataType                    dstDataType,
+    VariantBuffer&              dstBuffer,
+    std::size_t                 idxBegin,
+    std::size_t                 idxEnd)
+{
+    /* Use bulk conversion for half-precision floats */
+    if (srcDataType == DataType::Float32 && dstDataType == DataType::Float16)
+        CompressFloat16Array(srcBuffer.real32 + idxBegin, dstBuffer.uint16 + idxBegin, idxEnd - idxBegin);
+    else if (srcDataType == DataType::Float16 && dstDataType == DataType::Float32)
+        DecompressFloat16Array(srcBuffer.uint16 + idxBegin, dstBuffer.real32 + idxBegin, idxEnd - idxBegin);
+    else if (srcDataType == DataType::Float16 || dstDataType == DataType::Float16)
+        ConvertImageBufferFloat16Chunks(srcDataType, srcBuffer, dstDataType, dstBuffer, idxBegin, idxEnd);
+    else
+        ConvertImageBufferDataTypeGeneric(srcDataType, srcBuffer, dstDataType, dstBuffer, idxBegin, idxEnd);
+}
+
 // Minimal number of entries each worker thread shall process
 static const std::size_t g_threadMinWorkSize = 64;
 
@@ -560,11 +619,11 @@ LLGL_EXPORT std::uint32_t ImageFormatSize(const ImageFormat imageFormat)
         case ImageFormat::ABGR:             return 4;
         case ImageFormat::Depth:            return 1;
         case ImageFormat::DepthStencil:     return 2;
-        case ImageFormat::BC1:              return 0; // no conversion supported yet
-        case ImageFormat::BC2:              return 0; // no conversion supported yet
-        case ImageFormat::BC3:              return 0; // no conversion supported yet
-        case ImageFormat::BC4:              return 0; // no conversion supported yet
-        case ImageFormat::BC5:              return 0; // no conversion supported yet
+        case ImageFormat::BC1:              return 0; // block compressed (see ConvertImageBuffer with extent)
+        case ImageFormat::BC2:              return 0; // block compressed (see ConvertImageBuffer with extent)
+        case ImageFormat::BC3:              return 0; // block compressed (see ConvertImageBuffer with extent)
+        case ImageFormat::BC4:              return 0; // block compressed (see ConvertImageBuffer with extent)
+        case ImageFormat::BC5:              return 0; // block compressed (see ConvertImageBuffer with extent)
     }
     return 0;
 }
@@ -584,6 +643,152 @@ LLGL_EXPORT bool IsDepthStencilFormat(const ImageFormat imageFormat)
     return (imageFormat == ImageFormat::Depth || imageFormat == ImageFormat::DepthStencil);
 }
 
+// Returns the effective row stride of an image with the specified pixel size.
+static std::size_t GetImageRowStride(std::uint32_t rowStride, std::size_t bytesPerPixel, const Extent3D& extent)
+{
+    return (rowStride != 0 ? rowStride : bytesPerPixel * extent.width);
+}
+
+// Returns the effective layer stride of an image with the specified row stride.
+static std::size_t GetImageLayerStride(std::uint32_t layerStride, std::size_t rowStride, const Extent3D& extent)
+{
+    return (layerStride != 0 ? layerStride : rowStride * extent.height);
+}
+
+// Validates the strides of an image; rows might be padded with any number of bytes.
+static void ValidateImageStrides(std::size_t rowStride, std::size_t layerStride, std::size_t bytesPerPixel, const Extent3D& extent)
+{
+    if (rowStride < bytesPerPixel * extent.width)
+        throw std::invalid_argument("image row stride must not be less than the image width times the pixel size");
+    if (layerStride < rowStride * extent.height)
+        throw std::invalid_argument("image layer stride must not be less than the row stride times the image height");
+}
+
+static void ConvertImageBufferRowsWorker(
+    const SrcImageDescriptor&   srcImageDesc,
+    const DstImageDescriptor&   dstImageDesc,
+    std::size_t                 srcRowStride,
+    std::size_t                 srcLayerStride,
+    std::size_t                 dstRowStride,
+    std::size_t                 dstLayerStride,
+    const Extent3D&             extent,
+    std::size_t                 begin,
+    std::size_t                 end)
+{
+    const bool convertDataType  = (srcImageDesc.dataType != dstImageDesc.dataType);
+    const bool convertFormat    = (srcImageDesc.format != dstImageDesc.format);
+
+    const auto srcRowSize       = ImageDataSize(srcImageDesc.format, srcImageDesc.dataType, extent.width);
+    const auto dstRowSize       = ImageDataSize(dstImageDesc.format, dstImageDesc.dataType, extent.width);
+
+    /* Allocate intermediate buffer for a single row if both data type and format must be converted */
+    std::unique_ptr<char[]> intermediateRow;
+    std::size_t             intermediateRowSize = 0;
+
+    if (convertDataType && convertFormat)
+    {
+        intermediateRowSize = ImageDataSize(srcImageDesc.format, dstImageDesc.dataType, extent.width);
+        intermediateRow     = MakeUniqueArray<char>(intermediateRowSize);
+    }
+
+    auto src = reinterpret_cast<const char*>(srcImageDesc.data);
+    auto dst = reinterpret_cast<char*>(dstImageDesc.data);
+
+    for (auto i = begin; i < end; ++i)
+    {
+        /* Convert row directly from the source image into the destination image */
+        const auto layer    = i / extent.height;
+        const auto row      = i % extent.height;
+        const auto srcRow   = src + layer * srcLayerStride + row * srcRowStride;
+        const auto dstRow   = dst + layer * dstLayerStride + row * dstRowStride;
+
+        if (convertDataType && convertFormat)
+        {
+            ConvertImageBufferDataType(srcImageDesc.dataType, srcRow, srcRowSize, dstImageDesc.dataType, intermediateRow.get(), intermediateRowSize, 0);
+            ConvertImageBufferFormat(
+                SrcImageDescriptor{ srcImageDesc.format, dstImageDesc.dataType, intermediateRow.get(), intermediateRowSize },
+                DstImageDescriptor{ dstImageDesc.format, dstImageDesc.dataType, dstRow, dstRowSize },
+                0
+            );
+        }
+        else if (convertDataType)
+            ConvertImageBufferDataType(srcImageDesc.dataType, srcRow, srcRowSize, dstImageDesc.dataType, dstRow, dstRowSize, 0);
+        else
+        {
+            ConvertImageBufferFormat(
+                SrcImageDescriptor{ srcImageDesc.format, srcImageDesc.dataType, srcRow, srcRowSize },
+                DstImageDescriptor{ dstImageDesc.format, dstImageDesc.dataType, dstRow, dstRowSize },
+                0
+            );
+        }
+    }
+}
+
+// Converts the strided images row by row, distributed in chunks of rows across the worker threads.
+static void ConvertImageBufferRows(
+    const SrcImageDescriptor&   srcImageDesc,
+    const DstImageDescriptor&   dstImageDesc,
+    std::size_t                 srcRowStride,
+    std::size_t                 srcLayerStride,
+    std::size_t                 dstRowStride,
+    std::size_t                 dstLayerStride,
+    const Extent3D&             extent,
+    std::size_t                 threadCount)
+{
+    const auto numRows = static_cast<std::size_t>(extent.height) * extent.depth;
+
+    threadCount = std::min(threadCount, numRows * extent.width / g_threadMinWorkSize);
+
+    if (threadCount > 1)
+    {
+        /* Create worker threads */
+        std::vector<std::thread> workers(threadCount);
+
+        auto workSize       = numRows / threadCount;
+        auto workSizeRemain = numRows % threadCount;
+
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            workers[i] = std::thread(
+                ConvertImageBufferRowsWorker,
+                std::cref(srcImageDesc),
+                std::cref(dstImageDesc),
+                srcRowStride,
+                srcLayerStride,
+                dstRowStride,
+                dstLayerStride,
+                std::cref(extent),
+                offset,
+                offset + workSize
+            );
+            offset += workSize;
+        }
+
+        /* Execute conversion of remaining work on main thread */
+        if (workSizeRemain > 0)
+        {
+            ConvertImageBufferRowsWorker(
+                srcImageDesc, dstImageDesc, srcRowStride, srcLayerStride, dstRowStride, dstLayerStride,
+                extent, offset, offset + workSizeRemain
+            );
+        }
+
+        /* Join worker threads */
+        for (auto& w : workers)
+            w.join();
+    }
+    else
+    {
+        /* Execute conversion only on main thread */
+        ConvertImageBufferRowsWorker(
+            srcImageDesc, dstImageDesc, srcRowStride, srcLayerStride, dstRowStride, dstLayerStride,
+            extent, 0, numRows
+        );
+    }
+}
+
 static void ValidateImageConversionParams(
     const SrcImageDescriptor&   srcImageDesc,
     ImageFormat                 dstFormat,
@@ -594,10 +799,91 @@ static void ValidateImageConversionParams(
         throw std::invalid_argument("cannot convert compressed image formats");
     if (IsDepthStencilFormat(srcImageDesc.format) || IsDepthStencilFormat(dstFormat))
         throw std::invalid_argument("cannot convert depth-stencil image formats");
+}
+
+// Validates the data size of a tightly packed source image. Strided images are validated against their extent instead.
+static void ValidatePackedImageDataSize(const SrcImageDescriptor& srcImageDesc)
+{
     if (srcImageDesc.dataSize % (DataTypeSize(srcImageDesc.dataType) * ImageFormatSize(srcImageDesc.format)) != 0)
         throw std::invalid_argument("source image data size is not a multiple of the source data type size");
 }
 
+LLGL_EXPORT bool ConvertImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    const DstImageDescriptor&   dstImageDesc,
+    const Extent3D&             extent,
+    std::size_t                 threadCount)
+{
+    /* Validate input parameters */
+    ValidateImageConversionParams(srcImageDesc, dstImageDesc.format, dstImageDesc.dataType);
+    LLGL_ASSERT_PTR(dstImageDesc.data);
+
+    if (srcImageDesc.dataType == dstImageDesc.dataType && srcImageDesc.format == dstImageDesc.format)
+        return false;
+
+    /* Determine effective strides of source and destination images */
+    const std::size_t srcBytesPerPixel  = ImageDataSize(srcImageDesc.format, srcImageDesc.dataType, 1);
+    const std::size_t dstBytesPerPixel  = ImageDataSize(dstImageDesc.format, dstImageDesc.dataType, 1);
+
+    const auto srcRowStride     = GetImageRowStride(srcImageDesc.rowStride, srcBytesPerPixel, extent);
+    const auto srcLayerStride   = GetImageLayerStride(srcImageDesc.layerStride, srcRowStride, extent);
+    const auto dstRowStride     = GetImageRowStride(dstImageDesc.rowStride, dstBytesPerPixel, extent);
+    const auto dstLayerStride   = GetImageLayerStride(dstImageDesc.layerStride, dstRowStride, extent);
+
+    ValidateImageStrides(srcRowStride, srcLayerStride, srcBytesPerPixel, extent);
+    ValidateImageStrides(dstRowStride, dstLayerStride, dstBytesPerPixel, extent);
+
+    /* Validate buffer sizes against the last pixel of the (possibly strided) images */
+    if (extent.depth > 0 && extent.height > 0 && extent.width > 0)
+    {
+        const auto srcRequiredSize = (extent.depth - 1) * srcLayerStride + (extent.height - 1) * srcRowStride + extent.width * srcBytesPerPixel;
+        const auto dstRequiredSize = (extent.depth - 1) * dstLayerStride + (extent.height - 1) * dstRowStride + extent.width * dstBytesPerPixel;
+
+        if (srcImageDesc.dataSize < srcRequiredSize)
+            throw std::invalid_argument("source image data size is too small for the specified extent and strides");
+        if (dstImageDesc.dataSize < dstRequiredSize)
+            throw std::invalid_argument("destination image data size is too small for the specified extent and strides");
+    }
+
+    const auto srcRowSize   = srcBytesPerPixel * extent.width;
+    const auto dstRowSize   = dstBytesPerPixel * extent.width;
+
+    if (srcRowStride   == srcRowSize                    &&
+        srcLayerStride == srcRowSize * extent.height    &&
+        dstRowStride   == dstRowSize                    &&
+        dstLayerStride == dstRowSize * extent.height)
+    {
+        /* Convert tightly packed images in one go */
+        const auto numPixels = static_cast<std::size_t>(extent.width) * extent.height * extent.depth;
+
+        const SrcImageDescriptor srcPackedDesc
+        {
+            srcImageDesc.format,
+            srcImageDesc.dataType,
+            srcImageDesc.data,
+            numPixels * srcBytesPerPixel
+        };
+
+        const DstImageDescriptor dstPackedDesc
+        {
+            dstImageDesc.format,
+            dstImageDesc.dataType,
+            dstImageDesc.data,
+            numPixels * dstBytesPerPixel
+        };
+
+        return ConvertImageBuffer(srcPackedDesc, dstPackedDesc, threadCount);
+    }
+
+    if (threadCount >= Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Convert strided images row by row without intermediate image buffers */
+    ConvertImageBufferRows(srcImageDesc, dstImageDesc, srcRowStride, srcLayerStride, dstRowStride, dstLayerStride, extent, threadCount);
+
+    return true;
+}
+
 LLGL_EXPORT bool ConvertImageBuffer(
     const SrcImageDescriptor&   srcImageDesc,
     const DstImageDescriptor&   dstImageDesc,
@@ -605,6 +891,7 @@ LLGL_EXPORT bool ConvertImageBuffer(
 {
     /* Validate input parameters */
     ValidateImageConversionParams(srcImageDesc, dstImageDesc.format, dstImageDesc.dataType);
+    ValidatePackedImageDataSize(srcImageDesc);
     LLGL_ASSERT_PTR(dstImageDesc.data);
 
     if (threadCount >= Constants::maxThreadCount)
@@ -672,6 +959,7 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
 {
     /* Validate input parameters */
     ValidateImageConversionParams(srcImageDesc, dstFormat, dstDataType);
+    ValidatePackedImageDataSize(srcImageDesc);
 
     if (threadCount >= Constants::maxThreadCount)
         threadCount = std::thread::hardware_concurrency();
@@ -752,6 +1040,117 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     return nullptr;
 }
 
+// Decompresses or compresses the specified image with block compression (BC1 - BC5).
+static ByteBuffer ConvertImageBufferBC(
+    const SrcImageDescriptor&   srcImageDesc,
+    ImageFormat                 dstFormat,
+    DataType                    dstDataType,
+    const Extent3D&             extent,
+    std::size_t                 threadCount)
+{
+    LLGL_ASSERT_PTR(srcImageDesc.data);
+
+    if (threadCount >= Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    const auto numPixels = static_cast<std::uint32_t>(extent.width * extent.height * extent.depth);
+
+    if (IsCompressedFormat(srcImageDesc.format))
+    {
+        /* Validate input parameters */
+        if (!IsBCFormat(srcImageDesc.format))
+            throw std::invalid_argument("cannot decompress image format");
+        if (IsCompressedFormat(dstFormat))
+            throw std::invalid_argument("cannot convert between compressed image formats");
+        if (srcImageDesc.dataSize < BCImageDataSize(srcImageDesc.format, extent))
+            throw std::invalid_argument("source image data size is too small for the specified extent of the compressed image");
+
+        /* Decompress image into RGBA with 8-bit components (signed for BC4 and BC5 with DataType::Int8) */
+        const auto rgbaDataType = (srcImageDesc.dataType == DataType::Int8 ? DataType::Int8 : DataType::UInt8);
+        const auto rgbaDataSize = ImageDataSize(ImageFormat::RGBA, rgbaDataType, numPixels);
+
+        auto rgbaImage = MakeUniqueArray<char>(rgbaDataSize);
+        DecompressBC(srcImageDesc.format, (rgbaDataType == DataType::Int8), srcImageDesc.data, rgbaImage.get(), extent, threadCount);
+
+        /* Convert decompressed image into destination format */
+        const SrcImageDescriptor rgbaImageDesc { ImageFormat::RGBA, rgbaDataType, rgbaImage.get(), rgbaDataSize };
+        if (auto dstImage = ConvertImageBuffer(rgbaImageDesc, dstFormat, dstDataType, threadCount))
+            return dstImage;
+
+        return rgbaImage;
+    }
+    else
+    {
+        /* Validate input parameters */
+        if (!IsBCFormat(dstFormat))
+            throw std::invalid_argument("cannot compress image format");
+        if (dstDataType != DataType::UInt8 && !(dstDataType == DataType::Int8 && (dstFormat == ImageFormat::BC4 || dstFormat == ImageFormat::BC5)))
+            throw std::invalid_argument("block compressed images must have data type UInt8, or Int8 for signed BC4 and BC5 images");
+
+        /* Convert source image into RGBA with 8-bit components (will be null if no conversion is necessary) */
+        auto rgbaImage = ConvertImageBuffer(srcImageDesc, ImageFormat::RGBA, dstDataType, extent, threadCount);
+
+        const void* rgbaData        = rgbaImage.get();
+        std::size_t rgbaRowStride   = extent.width * 4;
+        std::size_t rgbaLayerStride = rgbaRowStride * extent.height;
+
+        if (!rgbaImage)
+        {
+            /* Use source image directly with its strides */
+            rgbaData        = srcImageDesc.data;
+            rgbaRowStride   = GetImageRowStride(srcImageDesc.rowStride, 4, extent);
+            rgbaLayerStride = GetImageLayerStride(srcImageDesc.layerStride, rgbaRowStride, extent);
+
+            ValidateImageStrides(rgbaRowStride, rgbaLayerStride, 4, extent);
+
+            if (numPixels > 0 && srcImageDesc.dataSize < (extent.depth - 1) * rgbaLayerStride + (extent.height - 1) * rgbaRowStride + extent.width * 4)
+                throw std::invalid_argument("source image data size is too small for the specified extent and strides");
+        }
+
+        /* Compress image */
+        auto dstImage = MakeUniqueArray<char>(BCImageDataSize(dstFormat, extent));
+        CompressBC(dstFormat, (dstDataType == DataType::Int8), rgbaData, rgbaRowStride, rgbaLayerStride, dstImage.get(), extent, threadCount);
+
+        return dstImage;
+    }
+}
+
+LLGL_EXPORT ByteBuffer ConvertImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    ImageFormat                 dstFormat,
+    DataType                    dstDataType,
+    const Extent3D&             extent,
+    std::size_t                 threadCount)
+{
+    /* Decompress or compress images with block compression */
+    if (IsCompressedFormat(srcImageDesc.format) || IsCompressedFormat(dstFormat))
+        return ConvertImageBufferBC(srcImageDesc, dstFormat, dstDataType, extent, threadCount);
+
+    /* Validate input parameters */
+    ValidateImageConversionParams(srcImageDesc, dstFormat, dstDataType);
+
+    if (srcImageDesc.dataType == dstDataType && srcImageDesc.format == dstFormat)
+        return nullptr;
+
+    /* Convert into tightly packed destination buffer */
+    const auto numPixels = static_cast<std::uint32_t>(extent.width * extent.height * extent.depth);
+
+    DstImageDescriptor dstImageDesc
+    {
+        dstFormat,
+        dstDataType,
+        nullptr,
+        ImageDataSize(dstFormat, dstDataType, numPixels)
+    };
+
+    auto dstImage = MakeUniqueArray<char>(dstImageDesc.dataSize);
+    {
+        dstImageDesc.data = dstImage.get();
+        ConvertImageBuffer(srcImageDesc, dstImageDesc, extent, threadCount);
+    }
+    return dstImage;
+}
+
 LLGL_EXPORT ByteBuffer GenerateImageBuffer(
     ImageFormat         format,
     DataType            dataType,
@@ -7,6 +7,9 @@
 
 #include <LLGL/Log.h>
 #include <mutex>
+#include <atomic>
+#include <vector>
+#include <memory>
 
 
 namespace LLGL
@@ -16,72 +19,174 @@ namespace Log
 {
 
 
+/*
+Immutable callback state. A new instance is published with every call to SetReportCallback,
+so PostReport only needs a single atomic load to access the callback and its user data.
+Previous instances are retired and deleted with the next call to SetReportCallback that observes no active reports.
+*/
+struct LogCallbackState
+{
+    ReportCallback  callback;
+    void*           userData    = nullptr;
+};
+
+static const std::size_t g_numReportTypes = static_cast<std::size_t>(ReportType::Performance) + 1;
+
 struct LogState
 {
-    std::mutex      reportMutex;
-    ReportCallback  reportCallback  = nullptr;
-    std::ostream*   outputStream    = nullptr;
-    void*           userData        = nullptr;
-    std::size_t     limit           = 0;
-    std::size_t     counter         = 0;
+    std::mutex                                      callbackMutex;
+    std::unique_ptr<LogCallbackState>               callbackOwner;                  // Owner of the current callback state, guarded by callbackMutex
+    std::vector<std::unique_ptr<LogCallbackState>>  retiredCallbackStates;          // Previous states that might still be referred to, guarded by callbackMutex
+    std::atomic<const LogCallbackState*>            callbackState   { nullptr };
+    std::atomic<std::size_t>                        activeReports   { 0 };          // Number of reports that might refer to a callback state
+    std::atomic<std::size_t>                        limit           { 0 };
+    std::atomic<std::size_t>                        counter         { 0 };
+    std::atomic<std::size_t>                        typeLimits[g_numReportTypes];
+    std::atomic<std::size_t>                        typeCounters[g_numReportTypes];
+
+    LogState()
+    {
+        for (std::size_t i = 0; i < g_numReportTypes; ++i)
+        {
+            typeLimits[i]   = 0;
+            typeCounters[i] = 0;
+        }
+    }
 };
 
 static LogState g_logState;
 
 
-/* ----- Functions ----- */
+/* ----- Internal functions ----- */
 
-LLGL_EXPORT void PostReport(ReportType type, const std::string& message, const std::string& contextInfo)
+// Returns true if the specified counter exceeds the specified limit (if the limit is not 0).
+static bool ExceedsLimit(std::atomic<std::size_t>& counter, const std::atomic<std::size_t>& limit)
 {
-    ReportCallback  callback;
-    void*           userData    = nullptr;
-    bool            ignore      = false;
+    const auto count = ++counter;
+    const auto maxCount = limit.load(std::memory_order_relaxed);
+    return (maxCount > 0 && count > maxCount);
+}
 
-    /* Get callback and user data with a lock guard */
-    {
-        std::lock_guard<std::mutex> guard { g_logState.reportMutex };
+// Counts a report as active for the lifetime of this scope, so its callback state is not deleted in the meantime.
+class LogReportScope
+{
+
+    public:
+
+        LogReportScope()
+        {
+            ++g_logState.activeReports;
+        }
+
+        ~LogReportScope()
+        {
+            --g_logState.activeReports;
+        }
+
+        LogReportScope(const LogReportScope&) = delete;
+        LogReportScope& operator = (const LogReportScope&) = delete;
+
+};
 
-        /* Get callback and user data */
-        callback = g_logState.reportCallback;
-        userData = g_logState.userData;
+// Increments the report counters and returns the callback state if the report is not rejected. Must be called within a LogReportScope.
+static const LogCallbackState* AcquireReportCallback(ReportType type)
+{
+    const auto typeIndex = static_cast<std::size_t>(type);
+
+    /* Increase report counters and check if the report must be ignored */
+    const bool ignore       = ExceedsLimit(g_logState.counter, g_logState.limit);
+    const bool ignoreType = (typeIndex < g_numReportTypes && ExceedsLimit(g_logState.typeCounters[typeIndex], g_logState.typeLimits[typeIndex]));
+    if (ignore || ignoreType)
+        return nullptr;
+
+    /* Get callback state */
+    auto state = g_logState.callbackState.load();
+    if (state != nullptr && state->callback != nullptr)
+        return state;
 
-        /* Increase report counter and check if the report must be ignored */
-        g_logState.counter++;
-        if (g_logState.limit > 0 && g_logState.counter > g_logState.limit)
-            ignore = true;
+    return nullptr;
+}
+
+static void PublishReportCallback(const ReportCallback& callback, void* userData)
+{
+    std::lock_guard<std::mutex> guard { g_logState.callbackMutex };
+
+    /* Create new immutable callback state */
+    std::unique_ptr<LogCallbackState> state { new LogCallbackState{} };
+    {
+        state->callback = callback;
+        state->userData = userData;
     }
+    g_logState.callbackState.store(state.get());
+
+    /* Retire previous callback state */
+    if (g_logState.callbackOwner)
+        g_logState.retiredCallbackStates.push_back(std::move(g_logState.callbackOwner));
+    g_logState.callbackOwner = std::move(state);
+
+    /*
+    Delete retired callback states if no report is active. Both the store above and the load below are sequentially consistent,
+    so reports that become active after this load can only refer to the new callback state.
+    */
+    if (g_logState.activeReports.load() == 0)
+        g_logState.retiredCallbackStates.clear();
+}
+
+
+/* ----- Functions ----- */
 
+LLGL_EXPORT void PostReport(ReportType type, const std::string& message, const std::string& contextInfo)
+{
     /* Post report to callback */
-    if (!ignore && callback != nullptr)
-        callback(type, message, contextInfo, userData);
+    LogReportScope scope;
+    if (auto state = AcquireReportCallback(type))
+        state->callback(type, message, contextInfo, state->userData);
+}
+
+LLGL_EXPORT void PostReport(ReportType type, const char* message, const char* contextInfo)
+{
+    /* Post report to callback; strings are only constructed if the report is not rejected */
+    LogReportScope scope;
+    if (auto state = AcquireReportCallback(type))
+    {
+        state->callback(
+            type,
+            std::string(message != nullptr ? message : ""),
+            std::string(contextInfo != nullptr ? contextInfo : ""),
+            state->userData
+        );
+    }
 }
 
 LLGL_EXPORT void SetReportCallback(const ReportCallback& callback, void* userData)
 {
-    std::lock_guard<std::mutex> guard { g_logState.reportMutex };
-    g_logState.reportCallback   = callback;
-    g_logState.userData         = userData;
+    PublishReportCallback(callback, userData);
 }
 
 LLGL_EXPORT void SetReportCallbackStd(std::ostream& stream)
 {
-    std::lock_guard<std::mutex> guard { g_logState.reportMutex };
-    g_logState.outputStream     = (&stream);
-    g_logState.reportCallback   = [](ReportType type, const std::string& message, const std::string& contextInfo, void* userData)
+    auto callback = [](ReportType type, const std::string& message, const std::string& contextInfo, void* userData)
     {
+        auto& outputStream = *reinterpret_cast<std::ostream*>(userData);
         if (!contextInfo.empty())
-            (*g_logState.outputStream) << contextInfo << ": ";
-        (*g_logState.outputStream) << message << std::endl;
+            outputStream << contextInfo << ": ";
+        outputStream << message << std::endl;
     };
-    g_logState.userData         = nullptr;
+    PublishReportCallback(callback, &stream);
 }
 
 LLGL_EXPORT void SetReportLimit(std::size_t maxCount)
 {
-    std::lock_guard<std::mutex> guard { g_logState.reportMutex };
     g_logState.limit = maxCount;
 }
 
+LLGL_EXPORT void SetReportLimit(ReportType type, std::size_t maxCount)
+{
+    const auto typeIndex = static_cast<std::size_t>(type);
+    if (typeIndex < g_numReportTypes)
+        g_logState.typeLimits[typeIndex] = maxCount;
+}
+
 
 } // /namespace Log
 
@@ -13,6 +13,11 @@
 #include <LLGL/Sampler.h>
 #include <LLGL/Shader.h>
 #include <LLGL/VertexFormat.h>
+#include <LLGL/RenderSystem.h>
+#include "Helper.h"
+#include <unordered_map>
+#include <memory>
+#include <mutex>
 #include <cstring>
 #include <cctype>
 
@@ -442,11 +447,14 @@ static long ParseLayoutSignatureStageFlag(const char*& s)
         ++s;
     auto tokenLen = static_cast<std::size_t>(s - token);
 
-    /* Determine which identifier is used */
-    for (const auto& flag : g_flags)
+    /* Determine which identifier is used (all identifiers have four characters) */
+    if (tokenLen == 4)
     {
-        if (std::strncmp(token, flag.ident, tokenLen) == 0)
-            return flag.bitmask;
+        for (const auto& flag : g_flags)
+        {
+            if (std::strncmp(token, flag.ident, tokenLen) == 0)
+                return flag.bitmask;
+        }
     }
 
     /* Identifier not found */
@@ -486,14 +494,19 @@ static void ParseLayoutSignatureBindingPoint(PipelineLayoutDescriptor& desc, con
 
     for (;;)
     {
-        /* Parse optional name */
+        /* Parse optional name; each slot has its own name */
+        IgnoreWhiteSpaces(s);
         if (std::isalpha(static_cast<unsigned char>(*s)) || *s == '_')
         {
-            for (; std::isalnum(static_cast<unsigned char>(*s)) || *s == '_'; ++s)
-                bindingDesc.name += *s;
+            auto token = s;
+            while (std::isalnum(static_cast<unsigned char>(*s)) || *s == '_')
+                ++s;
+            bindingDesc.name.assign(token, s);
             IgnoreWhiteSpaces(s);
             AcceptChar(s, '@');
         }
+        else
+            bindingDesc.name.clear();
 
         /* Parse slot number */
         bindingDesc.slot = ParseUInt32(s);
@@ -554,18 +567,71 @@ static void ParseLayoutSignature(PipelineLayoutDescriptor& desc, const char* s)
     }
 }
 
-LLGL_EXPORT PipelineLayoutDescriptor PipelineLayoutDesc(const char* layoutSignature)
+// Maximum number of layout signatures that are cached by PipelineLayoutDesc.
+static const std::size_t g_maxCachedLayoutSignatures = 256;
+
+/*
+Returns the cached descriptor of the specified layout signature and parses the signature if it is not cached yet.
+Layout signatures are usually string literals, so each signature is only parsed once.
+The cache is keyed by the hash of the signature, so looking up a signature does not allocate any memory.
+The descriptor is shared with the cache, so it remains valid even if the cache is cleared in the meantime.
+*/
+static std::shared_ptr<const PipelineLayoutDescriptor> GetCachedPipelineLayoutDesc(const char* layoutSignature)
 {
-    PipelineLayoutDescriptor desc;
+    if (!layoutSignature)
+        throw std::invalid_argument("input parameter must not be null: layoutSignature");
+
+    struct CacheEntry
     {
-        if (layoutSignature)
-            ParseLayoutSignature(desc, layoutSignature);
-        else
-            throw std::invalid_argument("input parameter must not be null: layoutSignature");
+        std::string                                     signature;
+        std::shared_ptr<const PipelineLayoutDescriptor> desc;
+    };
+
+    static std::mutex                                           cacheMutex;
+    static std::unordered_multimap<std::uint64_t, CacheEntry>   cache;
+
+    const auto hash = HashBuffer(layoutSignature, std::strlen(layoutSignature));
+    {
+        std::lock_guard<std::mutex> guard { cacheMutex };
+        auto range = cache.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second.signature == layoutSignature)
+                return it->second.desc;
+        }
     }
+
+    /* Parse layout signature; invalid signatures are not cached */
+    auto desc = std::make_shared<PipelineLayoutDescriptor>();
+    ParseLayoutSignature(*desc, layoutSignature);
+
+    CacheEntry entry;
+    {
+        entry.signature = layoutSignature;
+        entry.desc      = desc;
+    }
+
+    /* Store descriptor in cache, which is cleared when it is full, e.g. when signatures are generated at runtime */
+    std::lock_guard<std::mutex> guard { cacheMutex };
+    if (cache.size() >= g_maxCachedLayoutSignatures)
+        cache.clear();
+    cache.insert({ hash, std::move(entry) });
+
     return desc;
 }
 
+LLGL_EXPORT PipelineLayoutDescriptor PipelineLayoutDesc(const char* layoutSignature)
+{
+    return *GetCachedPipelineLayoutDesc(layoutSignature);
+}
+
+LLGL_EXPORT PipelineLayout* CreatePipelineLayout(RenderSystem& renderSystem, const char* layoutSignature)
+{
+    /* Pass the cached descriptor by reference, so it is not copied */
+    auto desc = GetCachedPipelineLayoutDesc(layoutSignature);
+    return renderSystem.CreatePipelineLayout(*desc);
+}
+
 /* ----- RenderPassDescriptor utility functions ----- */
 
 LLGL_EXPORT RenderPassDescriptor RenderPassDesc(const RenderTargetDescriptor& renderTargetDesc)
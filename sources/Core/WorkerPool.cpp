@@ -0,0 +1,124 @@
+/*
+ * WorkerPool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "WorkerPool.h"
+
+
+namespace LLGL
+{
+
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        stop_ = true;
+    }
+    taskSignal_.notify_all();
+
+    for (auto& worker : workers_)
+        worker.join();
+}
+
+void WorkerPool::Run(std::size_t threadCount, const Task& task)
+{
+    if (threadCount == 0)
+        return;
+
+    /* Worker index 0 is run on the calling thread, so only (threadCount - 1) worker threads are required */
+    while (workers_.size() + 1 < threadCount)
+        workers_.emplace_back(&WorkerPool::WorkerMain, this, workers_.size() + 1);
+
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        task_           = &task;
+        threadCount_    = threadCount;
+        numPending_     = threadCount - 1;
+        errors_.assign(threadCount, nullptr);
+        ++generation_;
+    }
+    taskSignal_.notify_all();
+
+    /* Run first share of work on the calling thread */
+    try
+    {
+        task(0);
+    }
+    catch (...)
+    {
+        errors_[0] = std::current_exception();
+    }
+
+    /* Wait until all worker threads have finished this task */
+    {
+        std::unique_lock<std::mutex> lock { mutex_ };
+        finishSignal_.wait(lock, [this]{ return (numPending_ == 0); });
+        task_ = nullptr;
+    }
+
+    for (const auto& error : errors_)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void WorkerPool::WorkerMain(std::size_t workerIndex)
+{
+    std::uint64_t lastGeneration = 0;
+
+    for (;;)
+    {
+        const Task* task = nullptr;
+
+        /* Wait for the next task that requires this worker */
+        {
+            std::unique_lock<std::mutex> lock { mutex_ };
+            taskSignal_.wait(
+                lock,
+                [this, workerIndex, lastGeneration]
+                {
+                    return (stop_ || (generation_ != lastGeneration && workerIndex < threadCount_));
+                }
+            );
+
+            if (stop_)
+                return;
+
+            lastGeneration  = generation_;
+            task            = task_;
+        }
+
+        /* Run task outside of the lock; the error slot of this worker is not accessed by any other thread */
+        try
+        {
+            (*task)(workerIndex);
+        }
+        catch (...)
+        {
+            errors_[workerIndex] = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> guard { mutex_ };
+            if (--numPending_ == 0)
+                finishSignal_.notify_one();
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
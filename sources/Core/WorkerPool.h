@@ -0,0 +1,74 @@
+/*
+ * WorkerPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_WORKER_POOL_H
+#define LLGL_WORKER_POOL_H
+
+
+#include <LLGL/NonCopyable.h>
+#include <functional>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Pool of persistent worker threads that run the same task with different worker indices.
+class WorkerPool : public NonCopyable
+{
+
+    public:
+
+        using Task = std::function<void(std::size_t workerIndex)>;
+
+        WorkerPool() = default;
+
+        // Signals all worker threads to stop and joins them.
+        ~WorkerPool();
+
+        /**
+        Runs the specified task with the worker indices [0, threadCount) and blocks until all of them have returned.
+        The worker index 0 is run on the calling thread; worker threads are only created when more are required than before.
+        The first exception that was thrown by any of the tasks is rethrown on the calling thread.
+        */
+        void Run(std::size_t threadCount, const Task& task);
+
+    private:
+
+        void WorkerMain(std::size_t workerIndex);
+
+    private:
+
+        std::vector<std::thread>            workers_;
+        std::vector<std::exception_ptr>     errors_;
+        std::mutex                          mutex_;
+        std::condition_variable             taskSignal_;
+        std::condition_variable             finishSignal_;
+        const Task*                         task_           = nullptr;
+        std::size_t                         threadCount_    = 0;
+        std::size_t                         numPending_     = 0;
+        std::uint64_t                       generation_     = 0;
+        bool                                stop_           = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
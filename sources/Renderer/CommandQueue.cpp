@@ -0,0 +1,31 @@
+/*
+ * CommandQueue.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/CommandQueue.h>
+
+
+namespace LLGL
+{
+
+
+void CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+        Submit(*commandBuffers[i]);
+}
+
+void CommandQueue::WaitQueue(CommandQueue& /*signalQueue*/)
+{
+    /* Nothing to synchronize, since all command buffers are executed in submission order on a single command queue */
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
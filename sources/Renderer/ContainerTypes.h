@@ -9,8 +9,10 @@
 #define LLGL_CONTAINER_TYPES_H
 
 
-#include <set>
+#include <vector>
 #include <memory>
+#include <cstddef>
+#include <cstdint>
 
 
 namespace LLGL
@@ -20,8 +22,262 @@ namespace LLGL
 template <typename T>
 using HWObjectInstance = std::unique_ptr<T>;
 
+/*
+Hash table that maps object pointers to slot indices with open addressing and linear probing.
+All entries are stored in a single array, so insertion only allocates memory when the table grows.
+Removal shifts the following entries of the same probe sequence back, so no tombstones are left behind.
+*/
 template <typename T>
-using HWObjectContainer = std::set<HWObjectInstance<T>>;
+class HWObjectIndexMap
+{
+
+    public:
+
+        // Returns the slot index of the specified object, or null if the object is not in this map.
+        const std::size_t* Find(const T* object) const
+        {
+            if (!entries_.empty())
+            {
+                for (auto i = GetBucket(object); entries_[i].object != nullptr; i = (i + 1) & mask_)
+                {
+                    if (entries_[i].object == object)
+                        return &(entries_[i].index);
+                }
+            }
+            return nullptr;
+        }
+
+        // Inserts the specified object or replaces its slot index.
+        void Insert(const T* object, std::size_t index)
+        {
+            /* Keep load factor at or below 1/2, so probe sequences stay short */
+            if ((size_ + 1) * 2 > entries_.size())
+                Rehash(entries_.empty() ? 16 : entries_.size() * 2);
+
+            auto i = GetBucket(object);
+            while (entries_[i].object != nullptr && entries_[i].object != object)
+                i = (i + 1) & mask_;
+
+            if (entries_[i].object == nullptr)
+                ++size_;
+
+            entries_[i].object  = object;
+            entries_[i].index   = index;
+        }
+
+        // Removes the specified object. Returns false if the object is not in this map.
+        bool Erase(const T* object)
+        {
+            if (entries_.empty())
+                return false;
+
+            auto i = GetBucket(object);
+            while (entries_[i].object != object)
+            {
+                if (entries_[i].object == nullptr)
+                    return false;
+                i = (i + 1) & mask_;
+            }
+
+            /* Shift back all following entries whose home bucket does not lie between the freed entry and themselves */
+            for (auto j = (i + 1) & mask_; entries_[j].object != nullptr; j = (j + 1) & mask_)
+            {
+                const auto k = GetBucket(entries_[j].object);
+                if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+                    continue;
+                entries_[i] = entries_[j];
+                i = j;
+            }
+
+            entries_[i].object = nullptr;
+            --size_;
+
+            return true;
+        }
+
+        void clear()
+        {
+            for (auto& entry : entries_)
+                entry.object = nullptr;
+            size_ = 0;
+        }
+
+        void reserve(std::size_t size)
+        {
+            std::size_t capacity = 16;
+            while (capacity < size * 2)
+                capacity *= 2;
+            if (capacity > entries_.size())
+                Rehash(capacity);
+        }
+
+    private:
+
+        struct Entry
+        {
+            const T*    object  = nullptr;
+            std::size_t index   = 0;
+        };
+
+    private:
+
+        // Returns the first bucket of the probe sequence; the low bits of object pointers are mostly zero due to alignment, so they are mixed first.
+        std::size_t GetBucket(const T* object) const
+        {
+            auto hash = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(object));
+            hash ^= (hash >> 4) ^ (hash >> 16);
+            hash *= static_cast<std::size_t>(0x9E3779B1u);
+            return ((hash >> 8) & mask_);
+        }
+
+        void Rehash(std::size_t capacity)
+        {
+            std::vector<Entry> prevEntries(capacity);
+            prevEntries.swap(entries_);
+
+            mask_ = capacity - 1;
+            size_ = 0;
+
+            for (const auto& entry : prevEntries)
+            {
+                if (entry.object != nullptr)
+                    Insert(entry.object, entry.index);
+            }
+        }
+
+    private:
+
+        std::vector<Entry>  entries_;           // number of entries is always zero or a power of two
+        std::size_t         mask_       = 0;
+        std::size_t         size_       = 0;
+
+};
+
+/*
+Container for all hardware objects of one type that are owned by a render system.
+Objects are stored contiguously and insertion and removal are O(1) (amortized). Neither allocates memory unless the container grows.
+Removal moves the last object into the freed slot, so the iteration order is unspecified.
+
+Scope: objects are identified by their pointers, since this is how the public interface refers to them, so there are no generational handles.
+Objects are destroyed immediately on removal; backends that must keep native objects alive until the GPU has completed them do so themselves.
+The container is not thread-safe, i.e. render systems must synchronize creation and release of objects like any other access to this container.
+*/
+template <typename T>
+class HWObjectContainer
+{
+
+    public:
+
+        using container_type    = std::vector<HWObjectInstance<T>>;
+        using iterator          = typename container_type::iterator;
+        using const_iterator    = typename container_type::const_iterator;
+
+    public:
+
+        // Takes the ownership of the specified object and returns its raw pointer.
+        template <typename TSub>
+        TSub* Emplace(std::unique_ptr<TSub>&& object)
+        {
+            auto ref = object.get();
+            if (ref)
+            {
+                indices_.Insert(ref, objects_.size());
+                objects_.emplace_back(std::forward<std::unique_ptr<TSub>>(object));
+            }
+            return ref;
+        }
+
+        // Destroys the specified object. Returns false if the object is not owned by this container.
+        bool Erase(const T* object)
+        {
+            auto entry = indices_.Find(object);
+            if (entry == nullptr)
+                return false;
+
+            /* Move last object into the slot of the removed object */
+            const auto index = *entry;
+            indices_.Erase(object);
+
+            if (index + 1 < objects_.size())
+            {
+                objects_[index] = std::move(objects_.back());
+                indices_.Insert(objects_[index].get(), index);
+            }
+
+            objects_.pop_back();
+
+            return true;
+        }
+
+        // Returns true if the specified object is owned by this container.
+        bool Contains(const T* object) const
+        {
+            return (indices_.Find(object) != nullptr);
+        }
+
+        void clear()
+        {
+            objects_.clear();
+            indices_.clear();
+        }
+
+        void reserve(std::size_t size)
+        {
+            objects_.reserve(size);
+            indices_.reserve(size);
+        }
+
+        bool empty() const
+        {
+            return objects_.empty();
+        }
+
+        std::size_t size() const
+        {
+            return objects_.size();
+        }
+
+        iterator begin()
+        {
+            return objects_.begin();
+        }
+
+        const_iterator begin() const
+        {
+            return objects_.begin();
+        }
+
+        iterator end()
+        {
+            return objects_.end();
+        }
+
+        const_iterator end() const
+        {
+            return objects_.end();
+        }
+
+    private:
+
+        container_type          objects_;
+        HWObjectIndexMap<T>     indices_;
+
+};
+
+// Takes the ownership of the specified object and returns its raw pointer.
+template <typename BaseType, typename SubType>
+SubType* TakeOwnership(HWObjectContainer<BaseType>& objectSet, std::unique_ptr<SubType>&& object)
+{
+    return objectSet.Emplace(std::forward<std::unique_ptr<SubType>>(object));
+}
+
+// Destroys the specified object in O(1) time.
+template <typename T, typename TBase>
+void RemoveFromUniqueSet(HWObjectContainer<T>& cont, const TBase* entry)
+{
+    if (entry)
+        cont.Erase(static_cast<const T*>(entry));
+}
 
 
 } // /namespace LLGL
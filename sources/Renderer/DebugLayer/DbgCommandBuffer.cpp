@@ -38,16 +38,23 @@ static const char* GetLabelOrDefault(const std::string& label, const char* defau
 }
 
 DbgCommandBuffer::DbgCommandBuffer(
+    RenderSystem&                   renderSystemInstance,
+    CommandQueue&                   commandQueueInstance,
     CommandBuffer&                  instance,
+    RenderingProfiler*              profiler,
     RenderingDebugger*              debugger,
     const CommandBufferDescriptor&  desc,
     const RenderingCapabilities&    caps)
 :
-    instance      { instance      },
-    desc          { desc          },
-    debugger_     { debugger      },
-    features_     { caps.features },
-    limits_       { caps.limits   }
+    instance                { instance             },
+    desc                    { desc                 },
+    renderSystemInstance_   { renderSystemInstance },
+    commandQueueInstance_   { commandQueueInstance },
+    profiler_               { profiler             },
+    debugger_               { debugger             },
+    validator_              { debugger             },
+    features_               { caps.features        },
+    limits_                 { caps.limits          }
 {
 }
 
@@ -55,15 +62,24 @@ DbgCommandBuffer::DbgCommandBuffer(
 
 void DbgCommandBuffer::Begin()
 {
+    SelectValidationForEncoding();
     ResetFrameProfile();
     ResetBindings();
     ResetStates();
 
     if (debugger_)
+    {
         EnableRecording(true);
 
+        /* Deferred command buffers with a render pass continue the render pass of the primary command buffer */
+        if ((desc.flags & CommandBufferFlags::DeferredSubmit) != 0 && desc.renderPass != nullptr)
+            states_.insideRenderPass = true;
+    }
+
     instance.Begin();
 
+    StartTimeRecording();
+
     profile_.commandBufferEncodings++;
 }
 
@@ -71,6 +87,10 @@ void DbgCommandBuffer::End()
 {
     if (debugger_)
         EnableRecording(false);
+
+    if (timeRecording_)
+        queryTimer_->Finish();
+
     instance.End();
 }
 
@@ -91,6 +111,11 @@ void DbgCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
             CommandBufferFlags::DeferredSubmit,
             "LLGL::CommandBuffer"
         );
+
+        if (states_.insideRenderPass && commandBufferDbg.desc.renderPass == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot execute deferred command buffer inside a render pass if it was created without a render pass");
+        else if (!states_.insideRenderPass && commandBufferDbg.desc.renderPass != nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot execute deferred command buffer with a render pass outside of a render pass");
     }
 
     instance.Execute(commandBufferDbg.instance);
@@ -110,6 +135,7 @@ void DbgCommandBuffer::UpdateBuffer(
     {
         LLGL_DBG_SOURCE;
         AssertRecording();
+        ValidateSharedQueues(dstBufferDbg);
     }
 
     instance.UpdateBuffer(dstBufferDbg.instance, dstOffset, data, dataSize);
@@ -131,6 +157,8 @@ void DbgCommandBuffer::CopyBuffer(
     {
         LLGL_DBG_SOURCE;
         AssertRecording();
+        ValidateSharedQueues(dstBufferDbg);
+        ValidateSharedQueues(srcBufferDbg);
     }
 
     instance.CopyBuffer(dstBufferDbg.instance, dstOffset, srcBufferDbg.instance, srcOffset, size);
@@ -152,6 +180,8 @@ void DbgCommandBuffer::CopyTexture(
     {
         LLGL_DBG_SOURCE;
         AssertRecording();
+        ValidateSharedQueues(dstTextureDbg);
+        ValidateSharedQueues(srcTextureDbg);
     }
 
     instance.CopyTexture(dstTextureDbg.instance, dstLocation, srcTextureDbg.instance, srcLocation, extent);
@@ -239,8 +269,11 @@ void DbgCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport*
 
 void DbgCommandBuffer::SetScissor(const Scissor& scissor)
 {
-    LLGL_DBG_SOURCE;
-    AssertRecording();
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+    }
     instance.SetScissor(scissor);
 }
 
@@ -320,6 +353,7 @@ void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
         bindings_.vertexBuffers             = bindings_.vertexBufferStore;
         bindings_.numVertexBuffers          = 1;
         bindings_.anyNonEmptyVertexBuffer   = (bufferDbg.elements > 0);
+        bindings_.vertexLayoutValidated     = false;
     }
 
     instance.SetVertexBuffer(bufferDbg.instance);
@@ -339,6 +373,7 @@ void DbgCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 
         bindings_.vertexBuffers         = bufferArrayDbg.buffers.data();
         bindings_.numVertexBuffers      = static_cast<std::uint32_t>(bufferArrayDbg.buffers.size());
+        bindings_.vertexLayoutValidated = false;
 
         /* Check if all vertex buffers are empty */
         bindings_.anyNonEmptyVertexBuffer = false;
@@ -520,6 +555,7 @@ void DbgCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long
                 (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage),
                 GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer")
             );
+            ValidateSharedQueues(bufferDbg);
 
             instance.SetResource(bufferDbg.instance, slot, bindFlags, stageFlags);
 
@@ -544,6 +580,7 @@ void DbgCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long
                 (BindFlags::Sampled | BindFlags::Storage | BindFlags::CombinedTextureSampler),
                 GetLabelOrDefault(textureDbg.label, "LLGL::Buffer")
             );
+            ValidateSharedQueues(textureDbg);
 
             instance.SetResource(textureDbg.instance, slot, bindFlags, stageFlags);
 
@@ -607,6 +644,9 @@ void DbgCommandBuffer::BeginRenderPass(
         states_.insideRenderPass = true;
     }
 
+    if (timeRecording_)
+        queryTimer_->BeginSection(instance, "RenderPass");
+
     if (renderTarget.IsRenderContext())
     {
         auto& renderContextDbg = LLGL_CAST(DbgRenderContext&, renderTarget);
@@ -641,6 +681,9 @@ void DbgCommandBuffer::EndRenderPass()
     }
 
     instance.EndRenderPass();
+
+    if (timeRecording_)
+        queryTimer_->EndSection(instance);
 }
 
 /* ----- Pipeline States ----- */
@@ -655,8 +698,9 @@ void DbgCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
         AssertRecording();
 
         /* Bind graphics pipeline and unbind compute pipeline */
-        bindings_.graphicsPipeline  = (&graphicsPipelineDbg);
-        bindings_.computePipeline   = nullptr;
+        bindings_.graphicsPipeline      = (&graphicsPipelineDbg);
+        bindings_.computePipeline       = nullptr;
+        bindings_.vertexLayoutValidated = false;
 
         if (auto shaderProgram = graphicsPipelineDbg.desc.shaderProgram)
         {
@@ -767,8 +811,11 @@ void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t
 {
     auto& queryHeapDbg = LLGL_CAST(DbgQueryHeap&, queryHeap);
 
-    LLGL_DBG_SOURCE;
-    AssertRecording();
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+    }
 
     instance.BeginRenderCondition(queryHeapDbg.instance, query, mode);
 
@@ -777,8 +824,11 @@ void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t
 
 void DbgCommandBuffer::EndRenderCondition()
 {
-    LLGL_DBG_SOURCE;
-    AssertRecording();
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+    }
     instance.EndRenderCondition();
 }
 
@@ -922,7 +972,7 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::u
         LLGL_DBG_SOURCE;
         AssertIndirectDrawingSupported();
         ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
-        ValidateBufferRange(bufferDbg, offset, stride*numCommands);
+        ValidateBufferRange(bufferDbg, offset, static_cast<std::uint64_t>(stride) * numCommands);
         ValidateAddressAlignment(offset, 4, "<offset> parameter");
         ValidateAddressAlignment(stride, 4, "<stride> parameter");
     }
@@ -959,7 +1009,7 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
         LLGL_DBG_SOURCE;
         AssertIndirectDrawingSupported();
         ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
-        ValidateBufferRange(bufferDbg, offset, stride*numCommands);
+        ValidateBufferRange(bufferDbg, offset, static_cast<std::uint64_t>(stride) * numCommands);
         ValidateAddressAlignment(offset, 4, "<offset> parameter");
         ValidateAddressAlignment(stride, 4, "<stride> parameter");
     }
@@ -969,6 +1019,98 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
     profile_.drawCommands += numCommands;
 }
 
+void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertIndirectDrawingSupported();
+        AssertIndirectCountDrawingSupported();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, static_cast<std::uint64_t>(stride) * maxNumCommands);
+        ValidateBufferRange(countBufferDbg, countOffset, sizeof(std::uint32_t));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    instance.DrawIndirect(bufferDbg.instance, offset, countBufferDbg.instance, countOffset, maxNumCommands, stride);
+
+    profile_.drawCommands++;
+}
+
+void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertIndirectDrawingSupported();
+        AssertIndirectCountDrawingSupported();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, static_cast<std::uint64_t>(stride) * maxNumCommands);
+        ValidateBufferRange(countBufferDbg, countOffset, sizeof(std::uint32_t));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    instance.DrawIndexedIndirect(bufferDbg.instance, offset, countBufferDbg.instance, countOffset, maxNumCommands, stride);
+
+    profile_.drawCommands++;
+}
+
+void DbgCommandBuffer::MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (numDraws > 0)
+        {
+            AssertNullPointer(draws, "draws");
+            AssertInstancingSupported();
+            AssertOffsetInstancingSupported();
+            for (std::uint32_t i = 0; i < numDraws; ++i)
+                ValidateDrawCmd(draws[i].numVertices, draws[i].firstVertex, draws[i].numInstances, draws[i].firstInstance);
+        }
+        else
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no draw commands specified");
+    }
+
+    instance.MultiDraw(numDraws, draws);
+
+    profile_.drawCommands += numDraws;
+}
+
+void DbgCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (numDraws > 0)
+        {
+            AssertNullPointer(draws, "draws");
+            AssertInstancingSupported();
+            AssertOffsetInstancingSupported();
+            for (std::uint32_t i = 0; i < numDraws; ++i)
+                ValidateDrawIndexedCmd(draws[i].numIndices, draws[i].numInstances, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
+        }
+        else
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no draw commands specified");
+    }
+
+    instance.MultiDrawIndexed(numDraws, draws);
+
+    profile_.drawCommands += numDraws;
+}
+
 /* ----- Compute ----- */
 
 void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -986,8 +1128,14 @@ void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numW
         ValidateThreadGroupLimit(numWorkGroupsZ, limits_.maxComputeShaderWorkGroups[2]);
     }
 
+    if (timeRecording_)
+        queryTimer_->BeginSection(instance, "Dispatch");
+
     instance.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 
+    if (timeRecording_)
+        queryTimer_->EndSection(instance);
+
     profile_.dispatchCommands++;
 }
 
@@ -1003,8 +1151,14 @@ void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
         ValidateAddressAlignment(offset, 4, "<offset> parameter");
     }
 
+    if (timeRecording_)
+        queryTimer_->BeginSection(instance, "Dispatch");
+
     instance.DispatchIndirect(bufferDbg.instance, offset);
 
+    if (timeRecording_)
+        queryTimer_->EndSection(instance);
+
     profile_.dispatchCommands++;
 }
 
@@ -1024,6 +1178,9 @@ void DbgCommandBuffer::PushDebugGroup(const char* name)
 
     debugGroups_.push(name);
     instance.PushDebugGroup(name);
+
+    if (timeRecording_)
+        queryTimer_->Push(name);
 }
 
 void DbgCommandBuffer::PopDebugGroup()
@@ -1031,6 +1188,9 @@ void DbgCommandBuffer::PopDebugGroup()
     instance.PopDebugGroup();
     debugGroups_.pop();
 
+    if (timeRecording_)
+        queryTimer_->Pop();
+
     if (debugger_)
     {
         if (debugGroups_.empty())
@@ -1071,6 +1231,16 @@ void DbgCommandBuffer::NextProfile(FrameProfile& outputProfile)
     std::copy(std::begin(profile_.values), std::end(profile_.values), std::begin(outputProfile.values));
 }
 
+void DbgCommandBuffer::NextTimeRecords(std::vector<ProfileTimeRecord>& outputTimeRecords)
+{
+    if (queryTimer_)
+    {
+        if (timeRecording_)
+            queryTimer_->Submit();
+        queryTimer_->Resolve(outputTimeRecords);
+    }
+}
+
 
 /*
  * ======= Private: =======
@@ -1194,6 +1364,12 @@ void DbgCommandBuffer::ValidateAttachmentClear(const AttachmentClear& attachment
 
 void DbgCommandBuffer::ValidateVertexLayout()
 {
+    /* Vertex layout only needs to be validated again after the graphics pipeline or vertex buffers have changed */
+    if (bindings_.vertexLayoutValidated)
+        return;
+
+    bindings_.vertexLayoutValidated = true;
+
     if (bindings_.graphicsPipeline && bindings_.numVertexBuffers > 0)
     {
         auto shaderProgramDbg = LLGL_CAST(const DbgShaderProgram*, bindings_.graphicsPipeline->desc.shaderProgram);
@@ -1489,6 +1665,30 @@ void DbgCommandBuffer::ValidateBindBufferFlags(DbgBuffer& bufferDbg, long bindFl
     ValidateBindFlags(bufferDbg.desc.bindFlags, bindFlags, bindFlags, GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer"));
 }
 
+void DbgCommandBuffer::ValidateSharedQueues(DbgBuffer& bufferDbg)
+{
+    if (desc.queueType != CommandQueueType::Graphics && (bufferDbg.desc.miscFlags & MiscFlags::SharedQueues) == 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            std::string(GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer")) +
+            " is accessed by a command buffer of another queue type than graphics, but was not created with LLGL::MiscFlags::SharedQueues"
+        );
+    }
+}
+
+void DbgCommandBuffer::ValidateSharedQueues(DbgTexture& textureDbg)
+{
+    if (desc.queueType != CommandQueueType::Graphics && (textureDbg.desc.miscFlags & MiscFlags::SharedQueues) == 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            std::string(GetLabelOrDefault(textureDbg.label, "LLGL::Texture")) +
+            " is accessed by a command buffer of another queue type than graphics, but was not created with LLGL::MiscFlags::SharedQueues"
+        );
+    }
+}
+
 void DbgCommandBuffer::ValidateIndexType(const Format format)
 {
     if (format != Format::R16UInt && format != Format::R32UInt)
@@ -1510,11 +1710,12 @@ void DbgCommandBuffer::ValidateStageFlags(long stageFlags, long validFlags)
 
 void DbgCommandBuffer::ValidateBufferRange(DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size)
 {
-    if (offset + size > bufferDbg.desc.size)
+    /* Compare without computing 'offset + size' first, since the sum can wrap around */
+    if (offset > bufferDbg.desc.size || size > bufferDbg.desc.size - offset)
     {
         LLGL_DBG_ERROR(
             ErrorType::InvalidArgument,
-            "buffer range out of bounds (" + std::to_string(offset + size) +
+            "buffer range out of bounds (" + std::to_string(offset) + " + " + std::to_string(size) +
             " specified but limit is " + std::to_string(bufferDbg.desc.size) + ")"
         );
     }
@@ -1626,6 +1827,12 @@ void DbgCommandBuffer::AssertIndirectDrawingSupported()
         LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
 }
 
+void DbgCommandBuffer::AssertIndirectCountDrawingSupported()
+{
+    if (!features_.hasIndirectCountDrawing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing with draw count buffer");
+}
+
 void DbgCommandBuffer::AssertNullPointer(const void* ptr, const char* name)
 {
     if (ptr == nullptr)
@@ -1652,6 +1859,32 @@ void DbgCommandBuffer::ResetFrameProfile()
     std::fill(std::begin(profile_.values), std::end(profile_.values), 0);
 }
 
+void DbgCommandBuffer::SelectValidationForEncoding()
+{
+    /* Only validate every N-th command buffer encoding in sampled validation mode */
+    if (validator_ != nullptr && validator_->GetValidationMode() == ValidationMode::Sampled)
+    {
+        debugger_ = (numEncodings_ % validator_->GetSamplingInterval() == 0 ? validator_ : nullptr);
+        ++numEncodings_;
+    }
+}
+
+void DbgCommandBuffer::StartTimeRecording()
+{
+    /* Only measure primary command buffers, since deferred command buffers are never submitted directly */
+    timeRecording_ = (profiler_ != nullptr && profiler_->timeRecording && (desc.flags & CommandBufferFlags::DeferredSubmit) == 0);
+
+    if (timeRecording_)
+    {
+        if (!queryTimer_)
+        {
+            const bool pipelineStatistics = (profiler_->pipelineStatistics && features_.hasPipelineStatistics);
+            queryTimer_ = MakeUnique<DbgQueryTimer>(renderSystemInstance_, commandQueueInstance_, pipelineStatistics);
+        }
+        queryTimer_->Start();
+    }
+}
+
 void DbgCommandBuffer::ResetBindings()
 {
     ::memset(&bindings_, 0, sizeof(bindings_));
@@ -13,9 +13,12 @@
 #include <LLGL/RenderingProfiler.h>
 #include "DbgGraphicsPipeline.h"
 #include "DbgQueryHeap.h"
+#include "DbgQueryTimer.h"
 #include <cstdint>
 #include <string>
 #include <stack>
+#include <vector>
+#include <memory>
 
 
 namespace LLGL
@@ -29,6 +32,8 @@ class DbgRenderTarget;
 class DbgComputePipeline;
 class DbgShaderProgram;
 class RenderingDebugger;
+class RenderSystem;
+class CommandQueue;
 
 class DbgCommandBuffer final : public CommandBuffer
 {
@@ -38,7 +43,10 @@ class DbgCommandBuffer final : public CommandBuffer
         /* ----- Common ----- */
 
         DbgCommandBuffer(
+            RenderSystem&                   renderSystemInstance,
+            CommandQueue&                   commandQueueInstance,
             CommandBuffer&                  instance,
+            RenderingProfiler*              profiler,
             RenderingDebugger*              debugger,
             const CommandBufferDescriptor&  desc,
             const RenderingCapabilities&    caps
@@ -184,6 +192,12 @@ class DbgCommandBuffer final : public CommandBuffer
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
 
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws) override;
+        void MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ) override;
@@ -206,6 +220,15 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void NextProfile(FrameProfile& outputProfile);
 
+        // Marks the last encoding as submitted and appends all time records of submitted encodings whose query results are available.
+        void NextTimeRecords(std::vector<ProfileTimeRecord>& outputTimeRecords);
+
+        // Returns the command queue instance this command buffer must be submitted to.
+        inline CommandQueue& GetCommandQueueInstance() const
+        {
+            return commandQueueInstance_;
+        }
+
     public:
 
         /* ----- Debugging members ----- */
@@ -236,6 +259,8 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void ValidateBindFlags(long resourceFlags, long bindFlags, long validFlags, const char* resourceName = nullptr);
         void ValidateBindBufferFlags(DbgBuffer& bufferDbg, long bindFlags);
+        void ValidateSharedQueues(DbgBuffer& bufferDbg);
+        void ValidateSharedQueues(DbgTexture& textureDbg);
         void ValidateIndexType(const Format format);
 
         void ValidateStageFlags(long stageFlags, long validFlags);
@@ -255,11 +280,15 @@ class DbgCommandBuffer final : public CommandBuffer
         void AssertInstancingSupported();
         void AssertOffsetInstancingSupported();
         void AssertIndirectDrawingSupported();
+        void AssertIndirectCountDrawingSupported();
 
         void AssertNullPointer(const void* ptr, const char* name);
 
         void WarnImproperVertices(const std::string& topologyName, std::uint32_t unusedVertices);
 
+        void SelectValidationForEncoding();
+        void StartTimeRecording();
+
         void ResetFrameProfile();
         void ResetBindings();
         void ResetStates();
@@ -268,13 +297,22 @@ class DbgCommandBuffer final : public CommandBuffer
 
         /* ----- Common objects ----- */
 
+        RenderSystem&                   renderSystemInstance_;
+        CommandQueue&                   commandQueueInstance_;
+
+        RenderingProfiler*              profiler_               = nullptr;
         RenderingDebugger*              debugger_               = nullptr;
+        RenderingDebugger*              validator_              = nullptr;
+        std::uint64_t                   numEncodings_           = 0;
 
         const RenderingFeatures&        features_;
         const RenderingLimits&          limits_;
 
         std::stack<std::string>         debugGroups_;
 
+        std::unique_ptr<DbgQueryTimer>  queryTimer_;
+        bool                            timeRecording_          = false;
+
         /* ----- Render states ----- */
 
         FrameProfile                    profile_;
@@ -290,6 +328,7 @@ class DbgCommandBuffer final : public CommandBuffer
             std::uint32_t           numVertexBuffers        = 0;
             bool                    anyNonEmptyVertexBuffer = false;
             bool                    anyShaderAttributes     = false;
+            bool                    vertexLayoutValidated   = false;
             DbgBuffer*              indexBuffer             = nullptr;
             DbgBuffer*              streamOutput            = nullptr;
             DbgGraphicsPipeline*    graphicsPipeline        = nullptr;
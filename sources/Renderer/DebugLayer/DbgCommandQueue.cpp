@@ -30,19 +30,50 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferDbg = LLGL_CAST(DbgCommandBuffer&, commandBuffer);
 
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateCommandBufferQueue(commandBufferDbg);
+    }
+
     instance.Submit(commandBufferDbg.instance);
 
     if (profiler_)
+        AccumulateProfile(commandBufferDbg);
+}
+
+void DbgCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    if (debugger_)
     {
-        /* Merge frame profile values into rendering profiler */
-        FrameProfile profile;
-        commandBufferDbg.NextProfile(profile);
-        profile.commandBufferSubmittions++;
+        LLGL_DBG_SOURCE;
+        for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+            ValidateCommandBufferQueue(LLGL_CAST(DbgCommandBuffer&, *commandBuffers[i]));
+    }
+
+    /* Forward batch of command buffer instances */
+    commandBufferInstances_.resize(numCommandBuffers);
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffers[i]);
+        commandBufferInstances_[i] = &(commandBufferDbg->instance);
+    }
 
-        profiler_->Accumulate(profile);
+    instance.Submit(numCommandBuffers, commandBufferInstances_.data());
+
+    if (profiler_)
+    {
+        for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+            AccumulateProfile(LLGL_CAST(DbgCommandBuffer&, *commandBuffers[i]));
     }
 }
 
+void DbgCommandQueue::WaitQueue(CommandQueue& signalQueue)
+{
+    auto& signalQueueDbg = LLGL_CAST(DbgCommandQueue&, signalQueue);
+    instance.WaitQueue(signalQueueDbg.instance);
+}
+
 /* ----- Queries ----- */
 
 bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize)
@@ -82,6 +113,25 @@ void DbgCommandQueue::WaitIdle()
  * ======= Private: =======
  */
 
+void DbgCommandQueue::ValidateCommandBufferQueue(DbgCommandBuffer& commandBuffer)
+{
+    if (&(commandBuffer.GetCommandQueueInstance()) != &instance)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "command buffer submitted to a command queue that does not match its type: see <LLGL::CommandBufferDescriptor::queueType>");
+}
+
+void DbgCommandQueue::AccumulateProfile(DbgCommandBuffer& commandBuffer)
+{
+    /* Merge frame profile values into rendering profiler */
+    FrameProfile profile;
+    commandBuffer.NextProfile(profile);
+    profile.commandBufferSubmittions++;
+
+    profiler_->Accumulate(profile);
+
+    /* Append time records of previous submissions whose results are available */
+    commandBuffer.NextTimeRecords(profiler_->timeRecords);
+}
+
 void DbgCommandQueue::ValidateQueryResult(
     DbgQueryHeap&   queryHeap,
     std::uint32_t   firstQuery,
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/CommandQueue.h>
+#include <vector>
 
 
 namespace LLGL
@@ -19,6 +20,7 @@ namespace LLGL
 class RenderingProfiler;
 class RenderingDebugger;
 class DbgQueryHeap;
+class DbgCommandBuffer;
 
 class DbgCommandQueue final : public CommandQueue
 {
@@ -36,6 +38,9 @@ class DbgCommandQueue final : public CommandQueue
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        void WaitQueue(CommandQueue& signalQueue) override;
 
         /* ----- Queries ----- */
 
@@ -70,10 +75,16 @@ class DbgCommandQueue final : public CommandQueue
             std::size_t     dataSize
         );
 
+        void ValidateCommandBufferQueue(DbgCommandBuffer& commandBuffer);
+
+        void AccumulateProfile(DbgCommandBuffer& commandBuffer);
+
     private:
 
-        RenderingProfiler* profiler_ = nullptr;
-        RenderingDebugger* debugger_ = nullptr;
+        RenderingProfiler*          profiler_ = nullptr;
+        RenderingDebugger*          debugger_ = nullptr;
+
+        std::vector<CommandBuffer*> commandBufferInstances_;
 
 };
 
@@ -11,14 +11,24 @@
 
 #include <LLGL/RenderingProfiler.h>
 #include <LLGL/RenderingDebugger.h>
+#include <chrono>
 
 
 namespace LLGL
 {
 
 
-#define LLGL_DBG_SOURCE \
-    DbgSetSource(debugger_, __FUNCTION__)
+// Qualified function name with parameter types, so overloaded functions are recorded as separate validation costs.
+#ifdef _MSC_VER
+#   define LLGL_DBG_QUALIFIED_FUNCTION __FUNCSIG__
+#else
+#   define LLGL_DBG_QUALIFIED_FUNCTION __PRETTY_FUNCTION__
+#endif
+
+// Sets the source function for error messages and measures the validation cost until the end of the current scope.
+#define LLGL_DBG_SOURCE                                                     \
+    DbgSetSource(debugger_, __FUNCTION__);                                  \
+    DbgValidationTimer dbgValidationTimer { debugger_, LLGL_DBG_QUALIFIED_FUNCTION }
 
 #define LLGL_DBG_ERROR(TYPE, MESSAGE) \
     DbgPostError(debugger_, (TYPE), (MESSAGE))
@@ -27,7 +37,7 @@ namespace LLGL
     DbgPostWarning(debugger_, (TYPE), (MESSAGE))
 
 #define LLGL_DBG_ERROR_NOT_SUPPORTED(FEATURE) \
-    LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, std::string(FEATURE) + " not supported")
+    LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, FEATURE " not supported")
 
 
 inline void DbgSetSource(RenderingDebugger* debugger, const char* source)
@@ -36,18 +46,66 @@ inline void DbgSetSource(RenderingDebugger* debugger, const char* source)
         debugger->SetSource(source);
 }
 
-inline void DbgPostError(RenderingDebugger* debugger, ErrorType type, const std::string& message)
+// Measures the time of a validation scope if time recording is enabled in the debugger.
+class DbgValidationTimer
+{
+
+    public:
+
+        inline DbgValidationTimer(RenderingDebugger* debugger, const char* source) :
+            debugger_ { (debugger != nullptr && debugger->GetTimeRecording() ? debugger : nullptr) },
+            source_   { source                                                                    }
+        {
+            if (debugger_)
+                startTime_ = std::chrono::steady_clock::now();
+        }
+
+        inline ~DbgValidationTimer()
+        {
+            if (debugger_)
+            {
+                auto elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime_);
+                debugger_->RecordValidationCost(source_, static_cast<std::uint64_t>(elapsedTime.count()));
+            }
+        }
+
+        DbgValidationTimer(const DbgValidationTimer&) = delete;
+        DbgValidationTimer& operator = (const DbgValidationTimer&) = delete;
+
+    private:
+
+        RenderingDebugger*                      debugger_   = nullptr;
+        const char*                             source_     = nullptr;
+        std::chrono::steady_clock::time_point   startTime_;
+
+};
+
+// Posts an error to the debugger. Constant messages are passed on without constructing a string.
+inline void DbgPostError(RenderingDebugger* debugger, ErrorType type, const char* message)
 {
     if (debugger)
         debugger->PostError(type, message);
 }
 
-inline void DbgPostWarning(RenderingDebugger* debugger, WarningType type, const std::string& message)
+inline void DbgPostError(RenderingDebugger* debugger, ErrorType type, const std::string& message)
+{
+    if (debugger)
+        debugger->PostError(type, message.c_str());
+}
+
+// Posts a warning to the debugger. Constant messages are passed on without constructing a string.
+inline void DbgPostWarning(RenderingDebugger* debugger, WarningType type, const char* message)
 {
     if (debugger)
         debugger->PostWarning(type, message);
 }
 
+inline void DbgPostWarning(RenderingDebugger* debugger, WarningType type, const std::string& message)
+{
+    if (debugger)
+        debugger->PostWarning(type, message.c_str());
+}
+
 // Sets the name of the specified debug layer object.
 template <typename T>
 inline void DbgSetObjectName(T& obj, const char* name)
@@ -12,6 +12,7 @@
 #include <LLGL/PipelineLayout.h>
 #include <LLGL/PipelineLayoutFlags.h>
 #include <string>
+#include <cstdint>
 
 
 namespace LLGL
@@ -34,6 +35,7 @@ class DbgPipelineLayout final : public PipelineLayout
         PipelineLayout&                 instance;
         const PipelineLayoutDescriptor  desc;
         std::string                     label;
+        std::uint32_t                   refCount    = 1; // Number of CreatePipelineLayout calls that returned this wrapper.
 
 };
 
@@ -0,0 +1,280 @@
+/*
+ * DbgQueryTimer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "DbgQueryTimer.h"
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/QueryHeap.h>
+#include <algorithm>
+#include <iterator>
+
+
+namespace LLGL
+{
+
+
+// Number of queries per query heap.
+static const std::uint32_t g_numQueriesPerHeap = 64;
+
+static void AccumulateStatistics(QueryPipelineStatistics& dst, const QueryPipelineStatistics& src)
+{
+    dst.inputAssemblyVertices           += src.inputAssemblyVertices;
+    dst.inputAssemblyPrimitives         += src.inputAssemblyPrimitives;
+    dst.vertexShaderInvocations         += src.vertexShaderInvocations;
+    dst.geometryShaderInvocations       += src.geometryShaderInvocations;
+    dst.geometryShaderPrimitives        += src.geometryShaderPrimitives;
+    dst.clippingInvocations             += src.clippingInvocations;
+    dst.clippingPrimitives              += src.clippingPrimitives;
+    dst.fragmentShaderInvocations       += src.fragmentShaderInvocations;
+    dst.tessControlShaderInvocations    += src.tessControlShaderInvocations;
+    dst.tessEvaluationShaderInvocations += src.tessEvaluationShaderInvocations;
+    dst.computeShaderInvocations        += src.computeShaderInvocations;
+}
+
+DbgQueryTimer::DbgQueryTimer(RenderSystem& renderSystem, CommandQueue& commandQueue, bool pipelineStatistics) :
+    renderSystem_       { renderSystem       },
+    commandQueue_       { commandQueue       },
+    pipelineStatistics_ { pipelineStatistics }
+{
+}
+
+DbgQueryTimer::~DbgQueryTimer()
+{
+    /* Release query heaps of all encodings and the pool */
+    for (auto& heaps : current_.heaps)
+        ReleaseQueryHeaps(heaps);
+    for (auto& encoding : pending_)
+    {
+        for (auto& heaps : encoding.heaps)
+            ReleaseQueryHeaps(heaps);
+    }
+    for (auto& heaps : heapPool_)
+        ReleaseQueryHeaps(heaps);
+}
+
+void DbgQueryTimer::Start()
+{
+    /* Return query heaps of an unfinished encoding back to the pool */
+    for (const auto& heaps : current_.heaps)
+        heapPool_.push_back(heaps);
+
+    /* The previous encoding can no longer be submitted once the command buffer is encoded again, so its queries will never be available */
+    DropUnsubmittedEncodings();
+
+    current_ = Encoding{};
+    groupStack_.clear();
+    sectionActive_ = false;
+}
+
+void DbgQueryTimer::Finish()
+{
+    if (!current_.records.empty())
+        pending_.emplace_back(std::move(current_));
+    current_ = Encoding{};
+}
+
+void DbgQueryTimer::Submit()
+{
+    if (!pending_.empty())
+        pending_.back().submitted = true;
+}
+
+void DbgQueryTimer::Push(const char* annotation)
+{
+    const auto index = static_cast<std::int64_t>(current_.records.size());
+    AppendRecord(annotation);
+    groupStack_.push_back(index);
+}
+
+void DbgQueryTimer::Pop()
+{
+    if (!groupStack_.empty())
+        groupStack_.pop_back();
+}
+
+void DbgQueryTimer::BeginSection(CommandBuffer& commandBuffer, const char* annotation)
+{
+    if (sectionActive_)
+        return;
+
+    /* Allocate new query heaps if the current ones are exhausted */
+    const auto section = static_cast<std::uint32_t>(current_.sections.size());
+    if (section / g_numQueriesPerHeap >= current_.heaps.size())
+        current_.heaps.push_back(AllocQueryHeaps());
+
+    /* Begin queries for new section */
+    const auto& heaps = current_.heaps[section / g_numQueriesPerHeap];
+    const auto query = section % g_numQueriesPerHeap;
+
+    commandBuffer.BeginQuery(*heaps.timeElapsed, query);
+    if (heaps.statistics != nullptr)
+        commandBuffer.BeginQuery(*heaps.statistics, query);
+
+    current_.sections.push_back(current_.records.size());
+    AppendRecord(annotation);
+
+    sectionActive_ = true;
+}
+
+void DbgQueryTimer::EndSection(CommandBuffer& commandBuffer)
+{
+    if (!sectionActive_)
+        return;
+
+    /* End queries of current section */
+    const auto section = static_cast<std::uint32_t>(current_.sections.size() - 1);
+    const auto& heaps = current_.heaps[section / g_numQueriesPerHeap];
+    const auto query = section % g_numQueriesPerHeap;
+
+    if (heaps.statistics != nullptr)
+        commandBuffer.EndQuery(*heaps.statistics, query);
+    commandBuffer.EndQuery(*heaps.timeElapsed, query);
+
+    sectionActive_ = false;
+}
+
+void DbgQueryTimer::Resolve(std::vector<ProfileTimeRecord>& outputRecords)
+{
+    /* Resolve submitted encodings in the order they were finished until the first one is not available yet */
+    while (!pending_.empty())
+    {
+        auto& encoding = pending_.front();
+        if (!encoding.submitted || !ResolveEncoding(encoding))
+            break;
+
+        outputRecords.insert(
+            outputRecords.end(),
+            std::make_move_iterator(encoding.records.begin()),
+            std::make_move_iterator(encoding.records.end())
+        );
+
+        /* Return query heaps back to the pool */
+        heapPool_.insert(heapPool_.end(), encoding.heaps.begin(), encoding.heaps.end());
+        pending_.pop_front();
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+DbgQueryTimer::QueryHeapPair DbgQueryTimer::AllocQueryHeaps()
+{
+    /* Take query heaps from the pool if possible */
+    if (!heapPool_.empty())
+    {
+        auto heaps = heapPool_.back();
+        heapPool_.pop_back();
+        return heaps;
+    }
+
+    /* Create new query heaps */
+    QueryHeapPair heaps;
+
+    QueryHeapDescriptor queryHeapDesc;
+    {
+        queryHeapDesc.type          = QueryType::TimeElapsed;
+        queryHeapDesc.numQueries    = g_numQueriesPerHeap;
+    }
+    heaps.timeElapsed = renderSystem_.CreateQueryHeap(queryHeapDesc);
+
+    if (pipelineStatistics_)
+    {
+        queryHeapDesc.type = QueryType::PipelineStatistics;
+        heaps.statistics = renderSystem_.CreateQueryHeap(queryHeapDesc);
+    }
+
+    return heaps;
+}
+
+void DbgQueryTimer::ReleaseQueryHeaps(QueryHeapPair& heaps)
+{
+    if (heaps.timeElapsed != nullptr)
+        renderSystem_.Release(*heaps.timeElapsed);
+    if (heaps.statistics != nullptr)
+        renderSystem_.Release(*heaps.statistics);
+    heaps = QueryHeapPair{};
+}
+
+void DbgQueryTimer::DropUnsubmittedEncodings()
+{
+    /* Return query heaps of dropped encodings back to the pool */
+    while (!pending_.empty() && !pending_.back().submitted)
+    {
+        const auto& heaps = pending_.back().heaps;
+        heapPool_.insert(heapPool_.end(), heaps.begin(), heaps.end());
+        pending_.pop_back();
+    }
+}
+
+bool DbgQueryTimer::ResolveEncoding(Encoding& encoding)
+{
+    std::uint64_t           elapsedTimes[g_numQueriesPerHeap];
+    QueryPipelineStatistics statistics[g_numQueriesPerHeap];
+
+    /* Query results of all measured sections */
+    const auto numSections = static_cast<std::uint32_t>(encoding.sections.size());
+
+    for (std::uint32_t firstSection = 0; firstSection < numSections; firstSection += g_numQueriesPerHeap)
+    {
+        const auto& heaps = encoding.heaps[firstSection / g_numQueriesPerHeap];
+        const auto numQueries = std::min(g_numQueriesPerHeap, numSections - firstSection);
+
+        if (!commandQueue_.QueryResult(*heaps.timeElapsed, 0, numQueries, elapsedTimes, numQueries * sizeof(std::uint64_t)))
+            return false;
+
+        if (heaps.statistics != nullptr)
+        {
+            if (!commandQueue_.QueryResult(*heaps.statistics, 0, numQueries, statistics, numQueries * sizeof(QueryPipelineStatistics)))
+                return false;
+        }
+
+        for (std::uint32_t i = 0; i < numQueries; ++i)
+        {
+            auto& record = encoding.records[encoding.sections[firstSection + i]];
+            record.elapsedTime = elapsedTimes[i];
+            if (heaps.statistics != nullptr)
+                record.statistics = statistics[i];
+        }
+    }
+
+    /* Accumulate results into enclosing debug groups (children always succeed their parents) */
+    for (auto i = encoding.records.size(); i-- > 0;)
+    {
+        const auto parent = encoding.parents[i];
+        if (parent >= 0)
+        {
+            auto& parentRecord = encoding.records[static_cast<std::size_t>(parent)];
+            parentRecord.elapsedTime += encoding.records[i].elapsedTime;
+            AccumulateStatistics(parentRecord.statistics, encoding.records[i].statistics);
+        }
+    }
+
+    return true;
+}
+
+void DbgQueryTimer::AppendRecord(const char* annotation)
+{
+    /* Append new record as child of the current debug group */
+    ProfileTimeRecord record;
+    {
+        record.annotation   = (annotation != nullptr ? annotation : "");
+        record.level        = static_cast<std::uint32_t>(groupStack_.size());
+    }
+
+    current_.parents.push_back(groupStack_.empty() ? -1 : groupStack_.back());
+    current_.records.push_back(std::move(record));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
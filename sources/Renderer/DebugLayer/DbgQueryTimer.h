@@ -0,0 +1,114 @@
+/*
+ * DbgQueryTimer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_DBG_QUERY_TIMER_H
+#define LLGL_DBG_QUERY_TIMER_H
+
+
+#include <LLGL/RenderingProfiler.h>
+#include <vector>
+#include <deque>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class CommandQueue;
+class QueryHeap;
+
+// Helper class to measure command buffer sections with timer queries and resolve them asynchronously.
+class DbgQueryTimer
+{
+
+    public:
+
+        DbgQueryTimer(RenderSystem& renderSystem, CommandQueue& commandQueue, bool pipelineStatistics);
+        ~DbgQueryTimer();
+
+        DbgQueryTimer(const DbgQueryTimer&) = delete;
+        DbgQueryTimer& operator = (const DbgQueryTimer&) = delete;
+
+        // Starts a new command buffer encoding. The previous encoding is dropped if it has not been submitted.
+        void Start();
+
+        // Finishes the current command buffer encoding. Its results will be resolved in subsequent calls to 'Resolve' once it has been submitted.
+        void Finish();
+
+        // Marks the last finished encoding as submitted.
+        void Submit();
+
+        // Pushes a new debug group onto the section hierarchy. Debug groups are not measured directly.
+        void Push(const char* annotation);
+
+        // Pops the last debug group from the section hierarchy.
+        void Pop();
+
+        // Begins a measured section, i.e. begins the timer queries on the specified command buffer.
+        void BeginSection(CommandBuffer& commandBuffer, const char* annotation);
+
+        // Ends the current measured section.
+        void EndSection(CommandBuffer& commandBuffer);
+
+        // Appends the results of all finished encodings whose queries are available. This function does not block.
+        void Resolve(std::vector<ProfileTimeRecord>& outputRecords);
+
+    private:
+
+        struct QueryHeapPair
+        {
+            QueryHeap* timeElapsed  = nullptr;
+            QueryHeap* statistics   = nullptr;
+        };
+
+        struct Encoding
+        {
+            std::vector<ProfileTimeRecord>  records;
+            std::vector<std::int64_t>       parents;    // Index of the enclosing debug group per record, or -1.
+            std::vector<std::size_t>        sections;   // Record index per measured section.
+            std::vector<QueryHeapPair>      heaps;
+            bool                            submitted   = false;
+        };
+
+    private:
+
+        QueryHeapPair AllocQueryHeaps();
+        void ReleaseQueryHeaps(QueryHeapPair& heaps);
+
+        void DropUnsubmittedEncodings();
+
+        bool ResolveEncoding(Encoding& encoding);
+
+        void AppendRecord(const char* annotation);
+
+    private:
+
+        RenderSystem&               renderSystem_;
+        CommandQueue&               commandQueue_;
+        bool                        pipelineStatistics_ = false;
+
+        Encoding                    current_;
+        std::vector<std::int64_t>   groupStack_;
+        bool                        sectionActive_      = false;
+
+        std::deque<Encoding>        pending_;           // Finished encodings in submission order; only the last one might not be submitted yet.
+        std::vector<QueryHeapPair>  heapPool_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
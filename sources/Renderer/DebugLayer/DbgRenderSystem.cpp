@@ -37,6 +37,9 @@ DbgRenderSystem::DbgRenderSystem(
     features_ { caps_.features     },
     limits_   { caps_.limits       }
 {
+    /* Disable all validations if the debugger was configured without validation */
+    if (debugger_ != nullptr && debugger_->GetValidationMode() == ValidationMode::Off)
+        debugger_ = nullptr;
 }
 
 void DbgRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
@@ -77,6 +80,19 @@ CommandQueue* DbgRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* DbgRenderSystem::GetCommandQueue(const CommandQueueType type)
+{
+    switch (type)
+    {
+        case CommandQueueType::Compute:
+            return GetAsyncCommandQueue(computeQueue_, type);
+        case CommandQueueType::Transfer:
+            return GetAsyncCommandQueue(transferQueue_, type);
+        default:
+            return GetCommandQueue();
+    }
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
@@ -84,7 +100,13 @@ CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescripto
     return TakeOwnership(
         commandBuffers_,
         MakeUnique<DbgCommandBuffer>(
-            *instance_->CreateCommandBuffer(desc), debugger_, desc, GetRenderingCaps()
+            *instance_,
+            *instance_->GetCommandQueue(desc.queueType),
+            *instance_->CreateCommandBuffer(desc),
+            profiler_,
+            debugger_,
+            desc,
+            GetRenderingCaps()
         )
     );
 }
@@ -249,6 +271,47 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textur
         profiler_->frameProfile.textureWrites++;
 }
 
+std::uint64_t DbgRenderSystem::WriteTextureAsync(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateMipLevelLimit(textureRegion.subresource.baseMipLevel, textureRegion.subresource.numMipLevels, textureDbg.mipLevels);
+        ValidateTextureRegion(textureDbg, textureRegion);
+    }
+
+    const auto writeID = instance_->WriteTextureAsync(textureDbg.instance, textureRegion, imageDesc);
+
+    if (profiler_)
+        profiler_->frameProfile.textureWrites++;
+
+    return writeID;
+}
+
+bool DbgRenderSystem::QueryTextureWrite(std::uint64_t writeID, bool wait)
+{
+    return instance_->QueryTextureWrite(writeID, wait);
+}
+
+void DbgRenderSystem::WriteTextureStreamed(Texture& texture, const TextureRegion& textureRegion, const StreamImageDescriptor& imageDesc)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateMipLevelLimit(textureRegion.subresource.baseMipLevel, textureRegion.subresource.numMipLevels, textureDbg.mipLevels);
+        ValidateTextureRegion(textureDbg, textureRegion);
+    }
+
+    instance_->WriteTextureStreamed(textureDbg.instance, textureRegion, imageDesc);
+
+    if (profiler_)
+        profiler_->frameProfile.textureWrites++;
+}
+
 void DbgRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
 {
     auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
@@ -277,6 +340,24 @@ void DbgRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel
     instance_->ReadTexture(textureDbg.instance, mipLevel, imageDesc);
 }
 
+std::uint64_t DbgRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
+{
+    auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateMipLevelLimit(mipLevel, 1, textureDbg.mipLevels);
+    }
+
+    return instance_->ReadTextureAsync(textureDbg.instance, mipLevel, imageDesc);
+}
+
+bool DbgRenderSystem::QueryTextureRead(std::uint64_t readID, bool wait)
+{
+    return instance_->QueryTextureRead(readID, wait);
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& desc)
@@ -354,14 +435,17 @@ void DbgRenderSystem::Release(RenderPass& renderPass)
 
 RenderTarget* DbgRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
 {
-    LLGL_DBG_SOURCE;
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        for (const auto& attachment : desc.attachments)
+            ValidateAttachmentDesc(attachment);
+    }
 
     auto instanceDesc = desc;
 
     for (auto& attachment : instanceDesc.attachments)
     {
-        if (debugger_)
-            ValidateAttachmentDesc(attachment);
         if (auto texture = attachment.texture)
         {
             auto textureDbg = LLGL_CAST(DbgTexture*, texture);
@@ -425,22 +509,46 @@ void DbgRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* DbgRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return TakeOwnership(pipelineLayouts_, MakeUnique<DbgPipelineLayout>(*instance_->CreatePipelineLayout(desc), desc));
+    auto instance = instance_->CreatePipelineLayout(desc);
+
+    /* Return the same wrapper for an interned instance, so pipeline layouts can still be compared by pointer */
+    auto it = pipelineLayoutWrappers_.find(instance);
+    if (it != pipelineLayoutWrappers_.end())
+    {
+        it->second->refCount++;
+        return it->second;
+    }
+
+    auto pipelineLayoutDbg = TakeOwnership(pipelineLayouts_, MakeUnique<DbgPipelineLayout>(*instance, desc));
+    pipelineLayoutWrappers_[instance] = pipelineLayoutDbg;
+    return pipelineLayoutDbg;
 }
 
 void DbgRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
-    ReleaseDbg(pipelineLayouts_, pipelineLayout);
+    auto& pipelineLayoutDbg = LLGL_CAST(DbgPipelineLayout&, pipelineLayout);
+
+    /* Every reference of the wrapper holds one reference of the instance */
+    instance_->Release(pipelineLayoutDbg.instance);
+
+    if (--pipelineLayoutDbg.refCount == 0)
+    {
+        pipelineLayoutWrappers_.erase(&(pipelineLayoutDbg.instance));
+        RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
+    }
 }
 
 /* ----- Pipeline States ----- */
 
 GraphicsPipeline* DbgRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
-    LLGL_DBG_SOURCE;
-
     if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
         ValidateGraphicsPipelineDesc(desc);
+        if (!desc.shaderProgram)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
+    }
 
     if (desc.shaderProgram)
     {
@@ -452,15 +560,18 @@ GraphicsPipeline* DbgRenderSystem::CreateGraphicsPipeline(const GraphicsPipeline
         }
         return TakeOwnership(graphicsPipelines_, MakeUnique<DbgGraphicsPipeline>(*instance_->CreateGraphicsPipeline(instanceDesc), desc));
     }
-    else
-        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
 
     return nullptr;
 }
 
 ComputePipeline* DbgRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
 {
-    LLGL_DBG_SOURCE;
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (!desc.shaderProgram)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
+    }
 
     if (desc.shaderProgram)
     {
@@ -472,8 +583,6 @@ ComputePipeline* DbgRenderSystem::CreateComputePipeline(const ComputePipelineDes
         }
         return TakeOwnership(computePipelines_, MakeUnique<DbgComputePipeline>(*instance_->CreateComputePipeline(instanceDesc), desc));
     }
-    else
-        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
 
     return nullptr;
 }
@@ -604,7 +713,7 @@ void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& desc, std::uint
     /* Validate flags */
     ValidateBindFlags(desc.bindFlags);
     ValidateCPUAccessFlags(desc.cpuAccessFlags, CPUAccessFlags::ReadWrite, "buffer");
-    ValidateMiscFlags(desc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData), "buffer");
+    ValidateMiscFlags(desc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData | MiscFlags::SharedQueues), "buffer");
 
     /* Validate (constant-) buffer size */
     if ((desc.bindFlags & BindFlags::ConstantBuffer) != 0)
@@ -794,7 +903,7 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& desc, const S
     ValidateArrayTextureLayers(desc.type, desc.arrayLayers);
     ValidateBindFlags(desc.bindFlags);
     ValidateCPUAccessFlags(desc.cpuAccessFlags, CPUAccessFlags::ReadWrite, "texture");
-    ValidateMiscFlags(desc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData), "texture");
+    ValidateMiscFlags(desc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData | MiscFlags::SharedQueues), "texture");
 
     /* Check if MIP-map generation is requested  */
     if ((desc.miscFlags & MiscFlags::GenerateMips) != 0)
@@ -1373,8 +1482,20 @@ void DbgRenderSystem::AssertMultiSampleTextures()
         LLGL_DBG_ERROR_NOT_SUPPORTED("multi-sample textures");
 }
 
+CommandQueue* DbgRenderSystem::GetAsyncCommandQueue(HWObjectInstance<DbgCommandQueue>& commandQueue, const CommandQueueType type)
+{
+    auto commandQueueInstance = instance_->GetCommandQueue(type);
+    if (commandQueueInstance == instance_->GetCommandQueue())
+        return GetCommandQueue();
+
+    if (!commandQueue)
+        commandQueue = MakeUnique<DbgCommandQueue>(*commandQueueInstance, profiler_, debugger_);
+
+    return commandQueue.get();
+}
+
 template <typename T, typename TBase>
-void DbgRenderSystem::ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry)
+void DbgRenderSystem::ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry)
 {
     auto& entryDbg = LLGL_CAST(T&, entry);
     instance_->Release(entryDbg.instance);
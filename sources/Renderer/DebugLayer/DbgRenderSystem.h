@@ -26,6 +26,7 @@
 #include "DbgQueryHeap.h"
 
 #include "../ContainerTypes.h"
+#include <map>
 
 
 namespace LLGL
@@ -52,6 +53,7 @@ class DbgRenderSystem final : public RenderSystem
         /* ----- Command queues ----- */
 
         CommandQueue* GetCommandQueue() override;
+        CommandQueue* GetCommandQueue(const CommandQueueType type) override;
 
         /* ----- Command buffers ----- */
 
@@ -79,7 +81,12 @@ class DbgRenderSystem final : public RenderSystem
         void Release(Texture& texture) override;
 
         void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        void WriteTextureStreamed(Texture& texture, const TextureRegion& textureRegion, const StreamImageDescriptor& imageDesc) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
+        std::uint64_t WriteTextureAsync(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        bool QueryTextureWrite(std::uint64_t writeID, bool wait) override;
+        std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
+        bool QueryTextureRead(std::uint64_t readID, bool wait) override;
 
         /* ----- Sampler States ---- */
 
@@ -190,8 +197,11 @@ class DbgRenderSystem final : public RenderSystem
         void AssertCubeArrayTextures();
         void AssertMultiSampleTextures();
 
+        // Returns the debug wrapper of the command queue of the specified type, or the graphics queue if the instance has no dedicated queue for it.
+        CommandQueue* GetAsyncCommandQueue(HWObjectInstance<DbgCommandQueue>& commandQueue, const CommandQueueType type);
+
         template <typename T, typename TBase>
-        void ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry);
+        void ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry);
 
     private:
 
@@ -210,6 +220,8 @@ class DbgRenderSystem final : public RenderSystem
 
         HWObjectContainer<DbgRenderContext>     renderContexts_;
         HWObjectInstance<DbgCommandQueue>       commandQueue_;
+        HWObjectInstance<DbgCommandQueue>       computeQueue_;
+        HWObjectInstance<DbgCommandQueue>       transferQueue_;
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
         HWObjectContainer<DbgBuffer>            buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
@@ -224,6 +236,9 @@ class DbgRenderSystem final : public RenderSystem
         //HWObjectContainer<DbgSampler>           samplers_;
         HWObjectContainer<DbgQueryHeap>         queryHeaps_;
 
+        /* Debug wrappers of the pipeline layouts by their instances, since the render system interns identical layouts */
+        std::map<const PipelineLayout*, DbgPipelineLayout*> pipelineLayoutWrappers_;
+
 };
 
 
@@ -11,6 +11,7 @@
 #include "../CheckedCast.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include "../../Core/Helper.h"
+#include "../../Core/Exception.h"
 #include "../TextureUtils.h"
 #include <algorithm>
 #include <codecvt>
@@ -594,6 +595,28 @@ void D3D11CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offse
     }
 }
 
+void D3D11CommandBuffer::DrawIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, Buffer& /*countBuffer*/, std::uint64_t /*countOffset*/, std::uint32_t /*maxNumCommands*/, std::uint32_t /*stride*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "indirect draw commands with GPU-side draw count");
+}
+
+void D3D11CommandBuffer::DrawIndexedIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, Buffer& /*countBuffer*/, std::uint64_t /*countOffset*/, std::uint32_t /*maxNumCommands*/, std::uint32_t /*stride*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "indirect draw commands with GPU-side draw count");
+}
+
+void D3D11CommandBuffer::MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws)
+{
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+        context_->DrawInstanced(draws[i].numVertices, draws[i].numInstances, draws[i].firstVertex, draws[i].firstInstance);
+}
+
+void D3D11CommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+        context_->DrawIndexedInstanced(draws[i].numIndices, draws[i].numInstances, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
+}
+
 /* ----- Compute ----- */
 
 void D3D11CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
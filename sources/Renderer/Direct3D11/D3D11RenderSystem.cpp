@@ -296,38 +296,50 @@ void D3D11RenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLev
 
     /* Query MIP-level size to determine image buffer size */
     auto size           = texture.GetMipExtent(mipLevel);
-    auto numTexels      = (size.width * size.height * size.depth);
 
-    /* Check if image buffer must be converted */
-    const auto& srcTexFormat    = GetFormatAttribs(D3D11Types::Unmap(textureD3D.GetFormat()));
-    auto srcPitch               = DataTypeSize(srcTexFormat.dataType) * ImageFormatSize(srcTexFormat.format);
-    auto srcImageSize           = (numTexels * srcPitch);
+    /* Describe mapped data with the row and depth pitch of the mapped subresource */
+    const auto& srcTexFormat = GetFormatAttribs(D3D11Types::Unmap(textureD3D.GetFormat()));
 
-    if (srcTexFormat.format != imageDesc.format || srcTexFormat.dataType != imageDesc.dataType)
+    SrcImageDescriptor srcImageDesc
     {
-        /* Determine destination image size */
-        auto dstPitch       = DataTypeSize(imageDesc.dataType) * ImageFormatSize(imageDesc.format);
-        auto dstImageSize   = (numTexels * dstPitch);
-
-        /* Validate input size */
-        ValidateImageDataSize(imageDesc.dataSize, dstImageSize);
+        srcTexFormat.format,
+        srcTexFormat.dataType,
+        mappedSubresource.pData,
+        static_cast<std::size_t>(mappedSubresource.DepthPitch) * size.depth
+    };
+    srcImageDesc.rowStride      = mappedSubresource.RowPitch;
+    srcImageDesc.layerStride    = mappedSubresource.DepthPitch;
 
-        /* Convert mapped data into requested format */
-        auto tempData = ConvertImageBuffer(
-            SrcImageDescriptor{ srcTexFormat.format, srcTexFormat.dataType, mappedSubresource.pData, srcImageSize },
-            imageDesc.format, imageDesc.dataType, GetConfiguration().threadCount
-        );
-
-        /* Copy temporary data into output buffer */
-        ::memcpy(imageDesc.data, tempData.get(), dstImageSize);
+    if (srcTexFormat.format != imageDesc.format || srcTexFormat.dataType != imageDesc.dataType)
+    {
+        /* Convert mapped data into requested format and strides */
+        ConvertImageBuffer(srcImageDesc, imageDesc, size, GetConfiguration().threadCount);
     }
     else
     {
+        /* Determine destination strides */
+        const auto bytesPerRow  = DataTypeSize(imageDesc.dataType) * ImageFormatSize(imageDesc.format) * size.width;
+        const auto rowStride    = (imageDesc.rowStride   != 0 ? imageDesc.rowStride   : bytesPerRow);
+        const auto layerStride  = (imageDesc.layerStride != 0 ? imageDesc.layerStride : rowStride * size.height);
+
         /* Validate input size */
-        ValidateImageDataSize(imageDesc.dataSize, srcImageSize);
+        ValidateImageDataSize(imageDesc.dataSize, (size.depth - 1) * layerStride + (size.height - 1) * rowStride + bytesPerRow);
+
+        /* Copy mapped data row by row into the output buffer */
+        auto src = reinterpret_cast<const char*>(mappedSubresource.pData);
+        auto dst = reinterpret_cast<char*>(imageDesc.data);
 
-        /* Copy mapped data directly into the output buffer */
-        ::memcpy(imageDesc.data, mappedSubresource.pData, srcImageSize);
+        for (std::uint32_t z = 0; z < size.depth; ++z)
+        {
+            for (std::uint32_t y = 0; y < size.height; ++y)
+            {
+                ::memcpy(
+                    dst + z * layerStride + y * rowStride,
+                    src + z * mappedSubresource.DepthPitch + y * mappedSubresource.RowPitch,
+                    bytesPerRow
+                );
+            }
+        }
     }
 
     /* Unmap resource */
@@ -410,12 +422,19 @@ void D3D11RenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* D3D11RenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return TakeOwnership(pipelineLayouts_, MakeUnique<D3D11PipelineLayout>(desc));
+    /* Share pipeline layout with identical bindings */
+    if (auto pipelineLayout = pipelineLayoutCache_.Find(desc))
+        return pipelineLayout;
+
+    auto pipelineLayout = TakeOwnership(pipelineLayouts_, MakeUnique<D3D11PipelineLayout>(desc));
+    pipelineLayoutCache_.Insert(desc, pipelineLayout);
+    return pipelineLayout;
 }
 
 void D3D11RenderSystem::Release(PipelineLayout& pipelineLayout)
 {
-    RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
+    if (pipelineLayoutCache_.Release(&pipelineLayout))
+        RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
 /* ----- Pipeline States ----- */
@@ -745,7 +764,7 @@ void D3D11RenderSystem::InitializeGpuTextureWithImage(
     SrcImageDescriptor  imageDesc)
 {
     /* Update only the first MIP-map level for each array layer */
-    const auto bytesPerLayer =
+    std::size_t bytesPerLayer =
     (
         extent.width                        *
         extent.height                       *
@@ -754,11 +773,24 @@ void D3D11RenderSystem::InitializeGpuTextureWithImage(
         DataTypeSize(imageDesc.dataType)
     );
 
-    /* Remap image data size for a single array layer to update each subresource individually */
-    if (imageDesc.dataSize % arrayLayers != 0)
-        throw std::invalid_argument("image data size is not a multiple of the layer count for D3D11 texture");
+    const bool hasStrides = (!IsCompressedFormat(imageDesc.format) && (imageDesc.rowStride != 0 || imageDesc.layerStride != 0));
+
+    if (hasStrides)
+    {
+        /* Determine distance between array layers from the image strides */
+        if (imageDesc.layerStride != 0)
+            bytesPerLayer = imageDesc.layerStride * extent.depth;
+        else
+            bytesPerLayer = imageDesc.rowStride * extent.height * extent.depth;
+    }
+    else
+    {
+        /* Remap image data size for a single array layer to update each subresource individually */
+        if (imageDesc.dataSize % arrayLayers != 0)
+            throw std::invalid_argument("image data size is not a multiple of the layer count for D3D11 texture");
 
-    imageDesc.dataSize /= arrayLayers;
+        imageDesc.dataSize /= arrayLayers;
+    }
 
     for (std::uint32_t layer = 0; layer < arrayLayers; ++layer)
     {
@@ -774,6 +806,8 @@ void D3D11RenderSystem::InitializeGpuTextureWithImage(
 
         /* Move to next region of initial data */
         imageDesc.data = (reinterpret_cast<const std::int8_t*>(imageDesc.data) + bytesPerLayer);
+        if (hasStrides)
+            imageDesc.dataSize -= std::min(imageDesc.dataSize, bytesPerLayer);
     }
 }
 
@@ -36,6 +36,7 @@
 #include "Texture/D3D11RenderTarget.h"
 
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
 #include "../DXCommon/ComPtr.h"
 
 #include <dxgi.h>
@@ -64,6 +65,8 @@ class D3D11RenderSystem final : public RenderSystem
 
         /* ----- Command queues ----- */
 
+        using RenderSystem::GetCommandQueue;
+
         CommandQueue* GetCommandQueue() override;
 
         /* ----- Command buffers ----- */
@@ -257,6 +260,7 @@ class D3D11RenderSystem final : public RenderSystem
         HWObjectContainer<D3D11Shader>                  shaders_;
         HWObjectContainer<D3D11ShaderProgram>           shaderPrograms_;
         HWObjectContainer<D3D11PipelineLayout>          pipelineLayouts_;
+        PipelineLayoutCache                             pipelineLayoutCache_;
         HWObjectContainer<D3D11GraphicsPipelineBase>    graphicsPipelines_;
         HWObjectContainer<D3D11ComputePipeline>         computePipelines_;
         HWObjectContainer<D3D11ResourceHeap>            resourceHeaps_;
@@ -282,16 +282,15 @@ void D3D11Texture::UpdateSubresource(
     const auto& formatAttribs = GetFormatAttribs(format);
 
     /* Get destination subresource index */
+    const Extent3D extent
+    {
+        region.right - region.left,
+        region.bottom - region.top,
+        region.back - region.front
+    };
+
     auto dstSubresource = CalcSubresource(mipLevel, arrayLayer);
-    auto dataLayout     = CalcSubresourceLayout(
-        format,
-        Extent3D
-        {
-            region.right - region.left,
-            region.bottom - region.top,
-            region.back - region.front
-        }
-    );
+    auto dataLayout     = CalcSubresourceLayout(format, extent);
 
     ByteBuffer intermediateData;
     const void* initialData = imageDesc.data;
@@ -299,12 +298,24 @@ void D3D11Texture::UpdateSubresource(
     if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
         (formatAttribs.format != imageDesc.format || formatAttribs.dataType != imageDesc.dataType))
     {
-        /* Convert image data (e.g. from RGB to RGBA), and redirect initial data to new buffer */
-        intermediateData    = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, threadCount);
+        /* Convert image data (e.g. from RGB to RGBA) into tightly packed buffer, and redirect initial data to new buffer */
+        intermediateData    = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, extent, threadCount);
         initialData         = intermediateData.get();
     }
     else
     {
+        /* Use strides of source image if specified (only for uncompressed formats) */
+        if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 && (imageDesc.rowStride != 0 || imageDesc.layerStride != 0))
+        {
+            if (imageDesc.rowStride != 0)
+                dataLayout.rowStride = imageDesc.rowStride;
+            dataLayout.layerStride = (imageDesc.layerStride != 0 ? imageDesc.layerStride : dataLayout.rowStride * extent.height);
+
+            const auto bytesPerRow = formatAttribs.bitSize / 8 * extent.width;
+            if (extent.height > 0 && extent.depth > 0)
+                dataLayout.dataSize = (extent.depth - 1) * dataLayout.layerStride + (extent.height - 1) * dataLayout.rowStride + bytesPerRow;
+        }
+
         /* Validate input data is large enough */
         if (imageDesc.dataSize < dataLayout.dataSize)
         {
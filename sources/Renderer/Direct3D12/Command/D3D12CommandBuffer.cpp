@@ -13,6 +13,7 @@
 #include "../D3D12Types.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Helper.h"
+#include "../../../Core/Exception.h"
 
 #include "../Buffer/D3D12Buffer.h"
 #include "../Buffer/D3D12BufferArray.h"
@@ -625,6 +626,44 @@ void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offse
     }
 }
 
+void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    /* Default command signature has a fixed byte stride */
+    if (stride != sizeof(D3D12_DRAW_ARGUMENTS))
+        ThrowNotSupportedExcept(__FUNCTION__, "indirect-count draw commands with custom argument stride");
+
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& countBufferD3D = LLGL_CAST(D3D12Buffer&, countBuffer);
+    commandList_->ExecuteIndirect(
+        commandSignaturePool_->GetSignatureDrawIndirect(), maxNumCommands, bufferD3D.GetNative(), offset, countBufferD3D.GetNative(), countOffset
+    );
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    /* Default command signature has a fixed byte stride */
+    if (stride != sizeof(D3D12_DRAW_INDEXED_ARGUMENTS))
+        ThrowNotSupportedExcept(__FUNCTION__, "indirect-count draw commands with custom argument stride");
+
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& countBufferD3D = LLGL_CAST(D3D12Buffer&, countBuffer);
+    commandList_->ExecuteIndirect(
+        commandSignaturePool_->GetSignatureDrawIndexedIndirect(), maxNumCommands, bufferD3D.GetNative(), offset, countBufferD3D.GetNative(), countOffset
+    );
+}
+
+void D3D12CommandBuffer::MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws)
+{
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+        commandList_->DrawInstanced(draws[i].numVertices, draws[i].numInstances, draws[i].firstVertex, draws[i].firstInstance);
+}
+
+void D3D12CommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+        commandList_->DrawIndexedInstanced(draws[i].numIndices, draws[i].numInstances, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
+}
+
 /* ----- Compute ----- */
 
 void D3D12CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -217,12 +217,30 @@ void D3D12RenderSystem::UpdateGpuTexture(
     if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
         (formatAttribs.format != imageDesc.format || formatAttribs.dataType != imageDesc.dataType))
     {
-        /* Convert image data (e.g. from RGB to RGBA), and redirect initial data to new buffer */
-        intermediateData    = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, GetConfiguration().threadCount);
+        /* Convert image data (e.g. from RGB to RGBA) into tightly packed buffer, and redirect initial data to new buffer */
+        const Extent3D imageExtent
+        {
+            region.extent.width,
+            region.extent.height,
+            region.extent.depth * region.subresource.numArrayLayers
+        };
+        intermediateData    = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, imageExtent, GetConfiguration().threadCount);
         initialData         = intermediateData.get();
     }
     else
     {
+        /* Use strides of source image if specified (only for uncompressed formats) */
+        if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 && (imageDesc.rowStride != 0 || imageDesc.layerStride != 0))
+        {
+            if (imageDesc.rowStride != 0)
+                dataLayout.rowStride = imageDesc.rowStride;
+            dataLayout.layerStride = (imageDesc.layerStride != 0 ? imageDesc.layerStride : dataLayout.rowStride * region.extent.height);
+
+            const auto bytesPerRow = formatAttribs.bitSize / 8 * region.extent.width;
+            if (region.extent.height > 0 && region.extent.depth > 0)
+                dataLayout.dataSize = (region.extent.depth - 1) * dataLayout.layerStride + (region.extent.height - 1) * dataLayout.rowStride + bytesPerRow;
+        }
+
         /* Validate input data is large enough */
         if (imageDesc.dataSize < dataLayout.dataSize)
         {
@@ -381,13 +399,22 @@ void D3D12RenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* D3D12RenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return TakeOwnership(pipelineLayouts_, MakeUnique<D3D12PipelineLayout>(device_.GetNative(), desc));
+    /* Share pipeline layout with identical bindings */
+    if (auto pipelineLayout = pipelineLayoutCache_.Find(desc))
+        return pipelineLayout;
+
+    auto pipelineLayout = TakeOwnership(pipelineLayouts_, MakeUnique<D3D12PipelineLayout>(device_.GetNative(), desc));
+    pipelineLayoutCache_.Insert(desc, pipelineLayout);
+    return pipelineLayout;
 }
 
 void D3D12RenderSystem::Release(PipelineLayout& pipelineLayout)
 {
-    SyncGPU();
-    RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
+    if (pipelineLayoutCache_.Release(&pipelineLayout))
+    {
+        SyncGPU();
+        RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
+    }
 }
 
 /* ----- Pipeline States ----- */
@@ -611,6 +638,7 @@ void D3D12RenderSystem::QueryRenderingCaps()
         /* Set extended attributes */
         caps.features.hasConservativeRasterization  = (GetFeatureLevel() >= D3D_FEATURE_LEVEL_12_0);
         caps.features.hasTextureViewSwizzle         = true;
+        caps.features.hasIndirectCountDrawing       = true;
 
         caps.limits.maxViewports                    = D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
         caps.limits.maxViewportSize[0]              = D3D12_VIEWPORT_BOUNDS_MAX;
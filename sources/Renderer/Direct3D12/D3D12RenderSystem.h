@@ -38,6 +38,7 @@
 #include "Shader/D3D12ShaderProgram.h"
 
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <dxgi1_4.h>
@@ -65,6 +66,8 @@ class D3D12RenderSystem final : public RenderSystem
 
         /* ----- Command queues ----- */
 
+        using RenderSystem::GetCommandQueue;
+
         CommandQueue* GetCommandQueue() override;
 
         /* ----- Command buffers ----- */
@@ -248,6 +251,7 @@ class D3D12RenderSystem final : public RenderSystem
         HWObjectContainer<D3D12Shader>              shaders_;
         HWObjectContainer<D3D12ShaderProgram>       shaderPrograms_;
         HWObjectContainer<D3D12PipelineLayout>      pipelineLayouts_;
+        PipelineLayoutCache                         pipelineLayoutCache_;
         HWObjectContainer<D3D12GraphicsPipeline>    graphicsPipelines_;
         HWObjectContainer<D3D12ComputePipeline>     computePipelines_;
         HWObjectContainer<D3D12ResourceHeap>        resourceHeaps_;
@@ -147,7 +147,8 @@ void D3D12Texture::UpdateSubresource(
     numArrayLayers  = std::min(numArrayLayers, numArrayLayers_ - firstArrayLayer);
 
     /* Create the GPU upload buffer */
-    UINT64 uploadBufferSize     = GetRequiredIntermediateSize(resource_.native.Get(), 0, 1) * numArrayLayers;
+    UINT64 uploadLayerSize      = GetRequiredIntermediateSize(resource_.native.Get(), 0, 1);
+    UINT64 uploadBufferSize     = uploadLayerSize * numArrayLayers;
     UINT64 uploadBufferOffset   = 0;
 
     auto hr = device->CreateCommittedResource(
@@ -176,9 +177,9 @@ void D3D12Texture::UpdateSubresource(
             &subresourceData        // pSrcData
         );
 
-        /* Move to next buffer region */
+        /* Move to next buffer region (source slice pitch may differ from the upload buffer layout) */
         subresourceData.pData = (reinterpret_cast<const std::int8_t*>(subresourceData.pData) + subresourceData.SlicePitch);
-        uploadBufferOffset += subresourceData.SlicePitch;
+        uploadBufferOffset += uploadLayerSize;
     }
 
     /* Transition texture resource for shader access */
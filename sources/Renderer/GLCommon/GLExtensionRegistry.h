@@ -70,6 +70,7 @@ enum class GLExt
     ARB_texture_storage,
     ARB_texture_storage_multisample,
     ARB_buffer_storage,
+    ARB_map_buffer_range,               // GL 3.0
     ARB_copy_buffer,                    // GL 3.1
     ARB_copy_image,                     // GL 4.3
     ARB_polygon_offset_clamp,
@@ -78,6 +79,8 @@ enum class GLExt
     ARB_clear_buffer_object,
     ARB_draw_indirect,
     ARB_multi_draw_indirect,
+    ARB_indirect_parameters,            // GL 4.6
+    ARB_invalidate_subdata,             // GL 4.3
     ARB_direct_state_access,            // GL 4.5
 
     /* Extensions without procedures */
@@ -87,6 +90,7 @@ enum class GLExt
     ARB_geometry_shader4,
     NV_conservative_raster,
     INTEL_conservative_rasterization,
+    ARB_pixel_buffer_object,            // GL 2.1
 
     /* Enumeration entry counter */
     Count,
@@ -655,6 +655,10 @@ void GLTexImageCube(const TextureDescriptor& desc, const SrcImageDescriptor* ima
 
         if (IsCompressedFormat(desc.format))
             imageFaceStride = static_cast<std::uint32_t>(imageDesc->dataSize);
+        else if (imageDesc->layerStride != 0)
+            imageFaceStride = imageDesc->layerStride;
+        else if (imageDesc->rowStride != 0)
+            imageFaceStride = imageDesc->rowStride * desc.extent.height;
 
         auto dataFormatGL       = GLTypes::Map(imageDesc->format);
         auto dataTypeGL         = GLTypes::Map(imageDesc->dataType);
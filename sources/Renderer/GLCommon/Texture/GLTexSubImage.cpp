@@ -279,15 +279,29 @@ void GLTexSubImage3D(const TextureRegion& region, const SrcImageDescriptor& imag
 
 void GLTexSubImageCube(const TextureRegion& region, const SrcImageDescriptor& imageDesc)
 {
-    GLTexSubImageCube(
-        region.subresource.baseMipLevel,
-        region.offset.x,
-        region.offset.y,
-        region.extent.width,
-        region.extent.height,
-        region.subresource.baseArrayLayer,
-        imageDesc
-    );
+    /* Upload each cube face separately, since the faces are distinct texture targets */
+    const auto numFaces = std::max(1u, region.subresource.numArrayLayers);
+
+    SrcImageDescriptor faceImageDesc = imageDesc;
+
+    if (IsCompressedFormat(imageDesc.format))
+        faceImageDesc.dataSize = imageDesc.dataSize / numFaces;
+    else
+        faceImageDesc.dataSize = ImageDataSize(imageDesc.format, imageDesc.dataType, region.extent.width * region.extent.height);
+
+    for (std::uint32_t face = 0; face < numFaces; ++face)
+    {
+        GLTexSubImageCube(
+            region.subresource.baseMipLevel,
+            region.offset.x,
+            region.offset.y,
+            region.extent.width,
+            region.extent.height,
+            region.subresource.baseArrayLayer + face,
+            faceImageDesc
+        );
+        faceImageDesc.data = reinterpret_cast<const char*>(faceImageDesc.data) + faceImageDesc.dataSize;
+    }
 }
 
 #ifdef LLGL_OPENGL
@@ -18,6 +18,7 @@
 #include "Texture/MTRenderTarget.h"
 #include "Shader/MTShaderProgram.h"
 #include "../CheckedCast.h"
+#include "../../Core/Exception.h"
 #include <algorithm>
 #include <limits.h>
 
@@ -843,6 +844,28 @@ void MTCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
     }
 }
 
+void MTCommandBuffer::DrawIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, Buffer& /*countBuffer*/, std::uint64_t /*countOffset*/, std::uint32_t /*maxNumCommands*/, std::uint32_t /*stride*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "indirect draw commands with GPU-side draw count");
+}
+
+void MTCommandBuffer::DrawIndexedIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, Buffer& /*countBuffer*/, std::uint64_t /*countOffset*/, std::uint32_t /*maxNumCommands*/, std::uint32_t /*stride*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "indirect draw commands with GPU-side draw count");
+}
+
+void MTCommandBuffer::MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws)
+{
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+        MTCommandBuffer::DrawInstanced(draws[i].numVertices, draws[i].firstVertex, draws[i].numInstances, draws[i].firstInstance);
+}
+
+void MTCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+        MTCommandBuffer::DrawIndexedInstanced(draws[i].numIndices, draws[i].numInstances, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
+}
+
 /* ----- Compute ----- */
 
 void MTCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -13,6 +13,7 @@
 
 #include <LLGL/RenderSystem.h>
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
 
 #include "MTCommandQueue.h"
 #include "MTCommandBuffer.h"
@@ -58,6 +59,8 @@ class MTRenderSystem : public RenderSystem
 
         /* ----- Command queues ----- */
 
+        using RenderSystem::GetCommandQueue;
+
         CommandQueue* GetCommandQueue() override;
 
         /* ----- Command buffers ----- */
@@ -175,6 +178,7 @@ class MTRenderSystem : public RenderSystem
         HWObjectContainer<MTShader>             shaders_;
         HWObjectContainer<MTShaderProgram>      shaderPrograms_;
         HWObjectContainer<MTPipelineLayout>     pipelineLayouts_;
+        PipelineLayoutCache                     pipelineLayoutCache_;
         HWObjectContainer<MTGraphicsPipeline>   graphicsPipelines_;
         HWObjectContainer<MTComputePipeline>    computePipelines_;
         HWObjectContainer<MTResourceHeap>       resourceHeaps_;
@@ -232,12 +232,19 @@ void MTRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* MTRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return TakeOwnership(pipelineLayouts_, MakeUnique<MTPipelineLayout>(desc));
+    /* Share pipeline layout with identical bindings */
+    if (auto pipelineLayout = pipelineLayoutCache_.Find(desc))
+        return pipelineLayout;
+
+    auto pipelineLayout = TakeOwnership(pipelineLayouts_, MakeUnique<MTPipelineLayout>(desc));
+    pipelineLayoutCache_.Insert(desc, pipelineLayout);
+    return pipelineLayout;
 }
 
 void MTRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
-    RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
+    if (pipelineLayoutCache_.Release(&pipelineLayout))
+        RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
 /* ----- Pipeline States ----- */
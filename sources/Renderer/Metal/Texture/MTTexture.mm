@@ -161,13 +161,29 @@ void MTTexture::Write(const TextureRegion& textureRegion, SrcImageDescriptor ima
 
     if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
     {
-        /* Convert image format (will be null if no conversion is necessary) */
-        intermediateData = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, /*cfg.threadCount*/0);
+        /* Convert image format into tightly packed buffer (will be null if no conversion is necessary) */
+        const Extent3D imageExtent
+        {
+            textureRegion.extent.width,
+            textureRegion.extent.height,
+            textureRegion.extent.depth * textureRegion.subresource.numArrayLayers
+        };
+        intermediateData = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, imageExtent, /*cfg.threadCount*/0);
         if (intermediateData)
         {
             /* User converted tempoary buffer as image source */
             imageDesc.data = intermediateData.get();
         }
+        else
+        {
+            /* Use strides of source image if specified */
+            if (imageDesc.rowStride != 0)
+                bytesPerRow = imageDesc.rowStride;
+            if (imageDesc.layerStride != 0)
+                bytesPerSlice = imageDesc.layerStride;
+            else if (imageDesc.rowStride != 0)
+                bytesPerSlice = region.size.height * bytesPerRow;
+        }
     }
 
     /* Replace region of native texture with source image data */
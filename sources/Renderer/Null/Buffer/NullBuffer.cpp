@@ -0,0 +1,88 @@
+/*
+ * NullBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullBuffer.h"
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+static std::size_t ToSize(std::uint64_t size)
+{
+    return static_cast<std::size_t>(size);
+}
+
+NullBuffer::NullBuffer(const BufferDescriptor& desc, const void* initialData) :
+    Buffer { desc.bindFlags                                 },
+    desc_  { desc                                           },
+    data_  { new char[ToSize(std::max<std::uint64_t>(1u, desc.size))] }
+{
+    if (initialData != nullptr)
+        ::memcpy(data_.get(), initialData, ToSize(desc.size));
+    else
+        ::memset(data_.get(), 0, ToSize(desc.size));
+}
+
+BufferDescriptor NullBuffer::GetDesc() const
+{
+    return desc_;
+}
+
+static void ValidateBufferRange(const BufferDescriptor& desc, std::uint64_t offset, std::uint64_t size)
+{
+    if (offset + size > desc.size)
+    {
+        throw std::out_of_range(
+            "buffer range [" + std::to_string(offset) + ", " + std::to_string(offset + size) +
+            ") exceeds buffer size of " + std::to_string(desc.size) + " byte(s)"
+        );
+    }
+}
+
+void NullBuffer::Write(std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
+{
+    ValidateBufferRange(desc_, dstOffset, dataSize);
+    ::memcpy(data_.get() + dstOffset, data, ToSize(dataSize));
+}
+
+void NullBuffer::Read(std::uint64_t srcOffset, void* data, std::uint64_t dataSize) const
+{
+    ValidateBufferRange(desc_, srcOffset, dataSize);
+    ::memcpy(data, data_.get() + srcOffset, ToSize(dataSize));
+}
+
+void NullBuffer::CopyFrom(std::uint64_t dstOffset, const NullBuffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    ValidateBufferRange(desc_, dstOffset, size);
+    ValidateBufferRange(srcBuffer.desc_, srcOffset, size);
+    ::memmove(data_.get() + dstOffset, srcBuffer.data_.get() + srcOffset, ToSize(size));
+}
+
+void* NullBuffer::Map(const CPUAccess /*access*/)
+{
+    if (mapped_)
+        return nullptr;
+    mapped_ = true;
+    return data_.get();
+}
+
+void NullBuffer::Unmap()
+{
+    mapped_ = false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,74 @@
+/*
+ * NullBuffer.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_BUFFER_H
+#define LLGL_NULL_BUFFER_H
+
+
+#include <LLGL/Buffer.h>
+#include <LLGL/BufferFlags.h>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Buffer whose content is stored in host memory.
+class NullBuffer final : public Buffer
+{
+
+    public:
+
+        BufferDescriptor GetDesc() const override;
+
+    public:
+
+        NullBuffer(const BufferDescriptor& desc, const void* initialData = nullptr);
+
+        // Writes the specified data into this buffer.
+        void Write(std::uint64_t dstOffset, const void* data, std::uint64_t dataSize);
+
+        // Reads the specified region of this buffer into the output data.
+        void Read(std::uint64_t srcOffset, void* data, std::uint64_t dataSize) const;
+
+        // Copies the specified region from the source buffer into this buffer.
+        void CopyFrom(std::uint64_t dstOffset, const NullBuffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size);
+
+        void* Map(const CPUAccess access);
+        void Unmap();
+
+        // Returns the index format this buffer was created with.
+        inline Format GetIndexFormat() const
+        {
+            return desc_.indexFormat;
+        }
+
+        // Returns a pointer to the content of this buffer.
+        inline const char* GetData() const
+        {
+            return data_.get();
+        }
+
+    private:
+
+        BufferDescriptor        desc_;
+        std::unique_ptr<char[]> data_;
+        bool                    mapped_ = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,31 @@
+/*
+ * NullBufferArray.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullBufferArray.h"
+#include "NullBuffer.h"
+#include "../../CheckedCast.h"
+#include "../../../Core/Helper.h"
+
+
+namespace LLGL
+{
+
+
+NullBufferArray::NullBufferArray(long bindFlags, std::uint32_t numBuffers, Buffer* const * bufferArray) :
+    BufferArray { bindFlags }
+{
+    buffers_.reserve(numBuffers);
+    while (auto next = NextArrayResource<NullBuffer>(numBuffers, bufferArray))
+        buffers_.push_back(next);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
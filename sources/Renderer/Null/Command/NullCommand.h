@@ -0,0 +1,277 @@
+/*
+ * NullCommand.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_COMMAND_H
+#define LLGL_NULL_COMMAND_H
+
+
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/GraphicsPipelineFlags.h>
+#include <LLGL/ShaderProgramFlags.h>
+#include <LLGL/ResourceFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Format.h>
+#include <LLGL/Types.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class Resource;
+class RenderTarget;
+class RenderPass;
+class NullBuffer;
+class NullBufferArray;
+class NullTexture;
+class NullResourceHeap;
+class NullGraphicsPipeline;
+class NullComputePipeline;
+class NullQueryHeap;
+class NullCommandBuffer;
+
+
+struct NullCmdUpdateBuffer
+{
+    NullBuffer*     buffer;
+    std::uint64_t   offset;
+    std::uint16_t   size;
+//  std::int8_t     data[size];
+};
+
+struct NullCmdCopyBuffer
+{
+    NullBuffer*     dstBuffer;
+    std::uint64_t   dstOffset;
+    NullBuffer*     srcBuffer;
+    std::uint64_t   srcOffset;
+    std::uint64_t   size;
+};
+
+struct NullCmdCopyTexture
+{
+    NullTexture*    dstTexture;
+    TextureLocation dstLocation;
+    NullTexture*    srcTexture;
+    TextureLocation srcLocation;
+    Extent3D        extent;
+};
+
+struct NullCmdGenerateMips
+{
+    NullTexture*        texture;
+    TextureSubresource  subresource;
+};
+
+struct NullCmdExecute
+{
+    const NullCommandBuffer* commandBuffer;
+};
+
+struct NullCmdSetViewports
+{
+    std::uint32_t   count;
+//  Viewport        viewports[count];
+};
+
+struct NullCmdSetScissors
+{
+    std::uint32_t   count;
+//  Scissor         scissors[count];
+};
+
+struct NullCmdSetClearColor
+{
+    ColorRGBAf color;
+};
+
+struct NullCmdSetClearDepth
+{
+    float depth;
+};
+
+struct NullCmdSetClearStencil
+{
+    std::uint32_t stencil;
+};
+
+struct NullCmdClear
+{
+    long flags;
+};
+
+struct NullCmdClearAttachments
+{
+    std::uint32_t   count;
+//  AttachmentClear attachments[count];
+};
+
+struct NullCmdSetBuffer
+{
+    NullBuffer* buffer;
+};
+
+struct NullCmdSetBufferArray
+{
+    NullBufferArray* bufferArray;
+};
+
+struct NullCmdSetIndexBuffer
+{
+    NullBuffer*     buffer;
+    Format          format;
+    std::uint64_t   offset;
+};
+
+struct NullCmdBeginStreamOutput
+{
+    PrimitiveType primitiveType;
+};
+
+struct NullCmdSetResourceHeap
+{
+    NullResourceHeap*   resourceHeap;
+    std::uint32_t       firstSet;
+    bool                compute;
+};
+
+struct NullCmdSetResource
+{
+    Resource*       resource;
+    std::uint32_t   slot;
+    long            bindFlags;
+    long            stageFlags;
+};
+
+struct NullCmdResetResourceSlots
+{
+    ResourceType    resourceType;
+    std::uint32_t   firstSlot;
+    std::uint32_t   numSlots;
+    long            bindFlags;
+    long            stageFlags;
+};
+
+struct NullCmdBeginRenderPass
+{
+    RenderTarget*       renderTarget;
+    const RenderPass*   renderPass;
+    std::uint32_t       numClearValues;
+//  ClearValue          clearValues[numClearValues];
+};
+
+struct NullCmdSetGraphicsPipeline
+{
+    NullGraphicsPipeline* graphicsPipeline;
+};
+
+struct NullCmdSetComputePipeline
+{
+    NullComputePipeline* computePipeline;
+};
+
+struct NullCmdSetUniforms
+{
+    UniformLocation location;
+    std::uint32_t   count;
+    std::uint32_t   size;
+//  std::int8_t     data[size];
+};
+
+struct NullCmdQuery
+{
+    NullQueryHeap*  queryHeap;
+    std::uint32_t   query;
+};
+
+struct NullCmdBeginRenderCondition
+{
+    NullQueryHeap*      queryHeap;
+    std::uint32_t       query;
+    RenderConditionMode mode;
+};
+
+struct NullCmdDraw
+{
+    std::uint32_t   numVertices;
+    std::uint32_t   firstVertex;
+    std::uint32_t   numInstances;
+    std::uint32_t   firstInstance;
+};
+
+struct NullCmdDrawIndexed
+{
+    std::uint32_t   numIndices;
+    std::uint32_t   numInstances;
+    std::uint32_t   firstIndex;
+    std::int32_t    vertexOffset;
+    std::uint32_t   firstInstance;
+};
+
+struct NullCmdDrawIndirect
+{
+    NullBuffer*     buffer;
+    std::uint64_t   offset;
+    std::uint32_t   numCommands;
+    std::uint32_t   stride;
+};
+
+struct NullCmdDrawIndirectCount
+{
+    NullBuffer*     buffer;
+    std::uint64_t   offset;
+    NullBuffer*     countBuffer;
+    std::uint64_t   countOffset;
+    std::uint32_t   maxNumCommands;
+    std::uint32_t   stride;
+};
+
+struct NullCmdMultiDraw
+{
+    std::uint32_t           numDraws;
+//  DrawIndirectArguments   draws[numDraws];
+};
+
+struct NullCmdMultiDrawIndexed
+{
+    std::uint32_t                   numDraws;
+//  DrawIndexedIndirectArguments    draws[numDraws];
+};
+
+struct NullCmdDispatch
+{
+    std::uint32_t numWorkGroups[3];
+};
+
+struct NullCmdDispatchIndirect
+{
+    NullBuffer*     buffer;
+    std::uint64_t   offset;
+};
+
+struct NullCmdPushDebugGroup
+{
+    std::size_t length;
+//  char        name[length + 1];
+};
+
+struct NullCmdSetAPIDepState
+{
+    std::size_t size;
+//  std::int8_t data[size];
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
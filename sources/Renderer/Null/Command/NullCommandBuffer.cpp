@@ -0,0 +1,591 @@
+/*
+ * NullCommandBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullCommandBuffer.h"
+#include "NullCommand.h"
+#include "../Buffer/NullBuffer.h"
+#include "../Buffer/NullBufferArray.h"
+#include "../Texture/NullTexture.h"
+#include "../RenderState/NullResourceHeap.h"
+#include "../RenderState/NullGraphicsPipeline.h"
+#include "../RenderState/NullComputePipeline.h"
+#include "../RenderState/NullQueryHeap.h"
+#include "../../CheckedCast.h"
+#include <LLGL/IndirectArguments.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc) :
+    flags_ { desc.flags }
+{
+}
+
+/* ----- Encoding ----- */
+
+void NullCommandBuffer::Begin()
+{
+    buffer_.clear();
+}
+
+void NullCommandBuffer::End()
+{
+    // dummy
+}
+
+void NullCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
+{
+    auto cmd = AllocCommand<NullCmdExecute>(NullOpcodeExecute);
+    cmd->commandBuffer = LLGL_CAST(const NullCommandBuffer*, &deferredCommandBuffer);
+}
+
+/* ----- Blitting ----- */
+
+void NullCommandBuffer::UpdateBuffer(
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    const void*     data,
+    std::uint16_t   dataSize)
+{
+    /* Copy data into the command stream, so it can be released immediately */
+    auto cmd = AllocCommand<NullCmdUpdateBuffer>(NullOpcodeUpdateBuffer, dataSize);
+    {
+        cmd->buffer = LLGL_CAST(NullBuffer*, &dstBuffer);
+        cmd->offset = dstOffset;
+        cmd->size   = dataSize;
+        ::memcpy(cmd + 1, data, dataSize);
+    }
+}
+
+void NullCommandBuffer::CopyBuffer(
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    Buffer&         srcBuffer,
+    std::uint64_t   srcOffset,
+    std::uint64_t   size)
+{
+    auto cmd = AllocCommand<NullCmdCopyBuffer>(NullOpcodeCopyBuffer);
+    {
+        cmd->dstBuffer  = LLGL_CAST(NullBuffer*, &dstBuffer);
+        cmd->dstOffset  = dstOffset;
+        cmd->srcBuffer  = LLGL_CAST(NullBuffer*, &srcBuffer);
+        cmd->srcOffset  = srcOffset;
+        cmd->size       = size;
+    }
+}
+
+void NullCommandBuffer::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureLocation&  srcLocation,
+    const Extent3D&         extent)
+{
+    auto cmd = AllocCommand<NullCmdCopyTexture>(NullOpcodeCopyTexture);
+    {
+        cmd->dstTexture     = LLGL_CAST(NullTexture*, &dstTexture);
+        cmd->dstLocation    = dstLocation;
+        cmd->srcTexture     = LLGL_CAST(NullTexture*, &srcTexture);
+        cmd->srcLocation    = srcLocation;
+        cmd->extent         = extent;
+    }
+}
+
+void NullCommandBuffer::GenerateMips(Texture& texture)
+{
+    auto& textureNull = LLGL_CAST(NullTexture&, texture);
+    GenerateMips(texture, TextureSubresource{ 0, textureNull.GetDesc().arrayLayers, 0, textureNull.GetDesc().mipLevels });
+}
+
+void NullCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
+{
+    auto cmd = AllocCommand<NullCmdGenerateMips>(NullOpcodeGenerateMips);
+    {
+        cmd->texture        = LLGL_CAST(NullTexture*, &texture);
+        cmd->subresource    = subresource;
+    }
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void NullCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    SetViewports(1, &viewport);
+}
+
+void NullCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    auto cmd = AllocCommand<NullCmdSetViewports>(NullOpcodeSetViewports, sizeof(Viewport) * numViewports);
+    {
+        cmd->count = numViewports;
+        ::memcpy(cmd + 1, viewports, sizeof(Viewport) * numViewports);
+    }
+}
+
+void NullCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    SetScissors(1, &scissor);
+}
+
+void NullCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    auto cmd = AllocCommand<NullCmdSetScissors>(NullOpcodeSetScissors, sizeof(Scissor) * numScissors);
+    {
+        cmd->count = numScissors;
+        ::memcpy(cmd + 1, scissors, sizeof(Scissor) * numScissors);
+    }
+}
+
+/* ----- Clear ----- */
+
+void NullCommandBuffer::SetClearColor(const ColorRGBAf& color)
+{
+    auto cmd = AllocCommand<NullCmdSetClearColor>(NullOpcodeSetClearColor);
+    cmd->color = color;
+}
+
+void NullCommandBuffer::SetClearDepth(float depth)
+{
+    auto cmd = AllocCommand<NullCmdSetClearDepth>(NullOpcodeSetClearDepth);
+    cmd->depth = depth;
+}
+
+void NullCommandBuffer::SetClearStencil(std::uint32_t stencil)
+{
+    auto cmd = AllocCommand<NullCmdSetClearStencil>(NullOpcodeSetClearStencil);
+    cmd->stencil = stencil;
+}
+
+void NullCommandBuffer::Clear(long flags)
+{
+    auto cmd = AllocCommand<NullCmdClear>(NullOpcodeClear);
+    cmd->flags = flags;
+}
+
+void NullCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    auto cmd = AllocCommand<NullCmdClearAttachments>(NullOpcodeClearAttachments, sizeof(AttachmentClear) * numAttachments);
+    {
+        cmd->count = numAttachments;
+        ::memcpy(cmd + 1, attachments, sizeof(AttachmentClear) * numAttachments);
+    }
+}
+
+/* ----- Input Assembly ------ */
+
+void NullCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    auto cmd = AllocCommand<NullCmdSetBuffer>(NullOpcodeSetVertexBuffer);
+    cmd->buffer = LLGL_CAST(NullBuffer*, &buffer);
+}
+
+void NullCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    auto cmd = AllocCommand<NullCmdSetBufferArray>(NullOpcodeSetVertexBufferArray);
+    cmd->bufferArray = LLGL_CAST(NullBufferArray*, &bufferArray);
+}
+
+void NullCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    SetIndexBuffer(buffer, bufferNull.GetIndexFormat());
+}
+
+void NullCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
+{
+    auto cmd = AllocCommand<NullCmdSetIndexBuffer>(NullOpcodeSetIndexBuffer);
+    {
+        cmd->buffer = LLGL_CAST(NullBuffer*, &buffer);
+        cmd->format = format;
+        cmd->offset = offset;
+    }
+}
+
+/* ----- Stream Output Buffers ------ */
+
+void NullCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
+{
+    auto cmd = AllocCommand<NullCmdSetBuffer>(NullOpcodeSetStreamOutputBuffer);
+    cmd->buffer = LLGL_CAST(NullBuffer*, &buffer);
+}
+
+void NullCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
+{
+    auto cmd = AllocCommand<NullCmdSetBufferArray>(NullOpcodeSetStreamOutputBufferArray);
+    cmd->bufferArray = LLGL_CAST(NullBufferArray*, &bufferArray);
+}
+
+void NullCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
+{
+    auto cmd = AllocCommand<NullCmdBeginStreamOutput>(NullOpcodeBeginStreamOutput);
+    cmd->primitiveType = primitiveType;
+}
+
+void NullCommandBuffer::EndStreamOutput()
+{
+    AllocOpcode(NullOpcodeEndStreamOutput);
+}
+
+/* ----- Resources ----- */
+
+void NullCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    auto cmd = AllocCommand<NullCmdSetResourceHeap>(NullOpcodeSetResourceHeap);
+    {
+        cmd->resourceHeap   = LLGL_CAST(NullResourceHeap*, &resourceHeap);
+        cmd->firstSet       = firstSet;
+        cmd->compute        = false;
+    }
+}
+
+void NullCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    auto cmd = AllocCommand<NullCmdSetResourceHeap>(NullOpcodeSetResourceHeap);
+    {
+        cmd->resourceHeap   = LLGL_CAST(NullResourceHeap*, &resourceHeap);
+        cmd->firstSet       = firstSet;
+        cmd->compute        = true;
+    }
+}
+
+void NullCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags)
+{
+    auto cmd = AllocCommand<NullCmdSetResource>(NullOpcodeSetResource);
+    {
+        cmd->resource   = &resource;
+        cmd->slot       = slot;
+        cmd->bindFlags  = bindFlags;
+        cmd->stageFlags = stageFlags;
+    }
+}
+
+void NullCommandBuffer::ResetResourceSlots(
+    const ResourceType  resourceType,
+    std::uint32_t       firstSlot,
+    std::uint32_t       numSlots,
+    long                bindFlags,
+    long                stageFlags)
+{
+    auto cmd = AllocCommand<NullCmdResetResourceSlots>(NullOpcodeResetResourceSlots);
+    {
+        cmd->resourceType   = resourceType;
+        cmd->firstSlot      = firstSlot;
+        cmd->numSlots       = numSlots;
+        cmd->bindFlags      = bindFlags;
+        cmd->stageFlags     = stageFlags;
+    }
+}
+
+/* ----- Render Passes ----- */
+
+void NullCommandBuffer::BeginRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues)
+{
+    auto cmd = AllocCommand<NullCmdBeginRenderPass>(NullOpcodeBeginRenderPass, sizeof(ClearValue) * numClearValues);
+    {
+        cmd->renderTarget   = &renderTarget;
+        cmd->renderPass     = renderPass;
+        cmd->numClearValues = numClearValues;
+        if (numClearValues > 0)
+            ::memcpy(cmd + 1, clearValues, sizeof(ClearValue) * numClearValues);
+    }
+}
+
+void NullCommandBuffer::EndRenderPass()
+{
+    AllocOpcode(NullOpcodeEndRenderPass);
+}
+
+/* ----- Pipeline States ----- */
+
+void NullCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+{
+    auto cmd = AllocCommand<NullCmdSetGraphicsPipeline>(NullOpcodeSetGraphicsPipeline);
+    cmd->graphicsPipeline = LLGL_CAST(NullGraphicsPipeline*, &graphicsPipeline);
+}
+
+void NullCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
+{
+    auto cmd = AllocCommand<NullCmdSetComputePipeline>(NullOpcodeSetComputePipeline);
+    cmd->computePipeline = LLGL_CAST(NullComputePipeline*, &computePipeline);
+}
+
+void NullCommandBuffer::SetUniform(
+    UniformLocation location,
+    const void*     data,
+    std::uint32_t   dataSize)
+{
+    SetUniforms(location, 1, data, dataSize);
+}
+
+void NullCommandBuffer::SetUniforms(
+    UniformLocation location,
+    std::uint32_t   count,
+    const void*     data,
+    std::uint32_t   dataSize)
+{
+    auto cmd = AllocCommand<NullCmdSetUniforms>(NullOpcodeSetUniforms, dataSize);
+    {
+        cmd->location   = location;
+        cmd->count      = count;
+        cmd->size       = dataSize;
+        ::memcpy(cmd + 1, data, dataSize);
+    }
+}
+
+/* ----- Queries ----- */
+
+void NullCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
+{
+    auto cmd = AllocCommand<NullCmdQuery>(NullOpcodeBeginQuery);
+    {
+        cmd->queryHeap  = LLGL_CAST(NullQueryHeap*, &queryHeap);
+        cmd->query      = query;
+    }
+}
+
+void NullCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
+{
+    auto cmd = AllocCommand<NullCmdQuery>(NullOpcodeEndQuery);
+    {
+        cmd->queryHeap  = LLGL_CAST(NullQueryHeap*, &queryHeap);
+        cmd->query      = query;
+    }
+}
+
+void NullCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
+{
+    auto cmd = AllocCommand<NullCmdBeginRenderCondition>(NullOpcodeBeginRenderCondition);
+    {
+        cmd->queryHeap  = LLGL_CAST(NullQueryHeap*, &queryHeap);
+        cmd->query      = query;
+        cmd->mode       = mode;
+    }
+}
+
+void NullCommandBuffer::EndRenderCondition()
+{
+    AllocOpcode(NullOpcodeEndRenderCondition);
+}
+
+/* ----- Drawing ----- */
+
+void NullCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    DrawInstanced(numVertices, firstVertex, 1, 0);
+}
+
+void NullCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    DrawIndexedInstanced(numIndices, 1, firstIndex, 0, 0);
+}
+
+void NullCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    DrawIndexedInstanced(numIndices, 1, firstIndex, vertexOffset, 0);
+}
+
+void NullCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    DrawInstanced(numVertices, firstVertex, numInstances, 0);
+}
+
+void NullCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    auto cmd = AllocCommand<NullCmdDraw>(NullOpcodeDraw);
+    {
+        cmd->numVertices    = numVertices;
+        cmd->firstVertex    = firstVertex;
+        cmd->numInstances   = numInstances;
+        cmd->firstInstance  = firstInstance;
+    }
+}
+
+void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    DrawIndexedInstanced(numIndices, numInstances, firstIndex, 0, 0);
+}
+
+void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, 0);
+}
+
+void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    auto cmd = AllocCommand<NullCmdDrawIndexed>(NullOpcodeDrawIndexed);
+    {
+        cmd->numIndices     = numIndices;
+        cmd->numInstances   = numInstances;
+        cmd->firstIndex     = firstIndex;
+        cmd->vertexOffset   = vertexOffset;
+        cmd->firstInstance  = firstInstance;
+    }
+}
+
+void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    DrawIndirect(buffer, offset, 1, 0);
+}
+
+void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto cmd = AllocCommand<NullCmdDrawIndirect>(NullOpcodeDrawIndirect);
+    {
+        cmd->buffer         = LLGL_CAST(NullBuffer*, &buffer);
+        cmd->offset         = offset;
+        cmd->numCommands    = numCommands;
+        cmd->stride         = stride;
+    }
+}
+
+void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    DrawIndexedIndirect(buffer, offset, 1, 0);
+}
+
+void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto cmd = AllocCommand<NullCmdDrawIndirect>(NullOpcodeDrawIndexedIndirect);
+    {
+        cmd->buffer         = LLGL_CAST(NullBuffer*, &buffer);
+        cmd->offset         = offset;
+        cmd->numCommands    = numCommands;
+        cmd->stride         = stride;
+    }
+}
+
+void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto cmd = AllocCommand<NullCmdDrawIndirectCount>(NullOpcodeDrawIndirectCount);
+    {
+        cmd->buffer         = LLGL_CAST(NullBuffer*, &buffer);
+        cmd->offset         = offset;
+        cmd->countBuffer    = LLGL_CAST(NullBuffer*, &countBuffer);
+        cmd->countOffset    = countOffset;
+        cmd->maxNumCommands = maxNumCommands;
+        cmd->stride         = stride;
+    }
+}
+
+void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto cmd = AllocCommand<NullCmdDrawIndirectCount>(NullOpcodeDrawIndexedIndirectCount);
+    {
+        cmd->buffer         = LLGL_CAST(NullBuffer*, &buffer);
+        cmd->offset         = offset;
+        cmd->countBuffer    = LLGL_CAST(NullBuffer*, &countBuffer);
+        cmd->countOffset    = countOffset;
+        cmd->maxNumCommands = maxNumCommands;
+        cmd->stride         = stride;
+    }
+}
+
+void NullCommandBuffer::MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws)
+{
+    auto cmd = AllocCommand<NullCmdMultiDraw>(NullOpcodeMultiDraw, sizeof(DrawIndirectArguments) * numDraws);
+    {
+        cmd->numDraws = numDraws;
+        ::memcpy(cmd + 1, draws, sizeof(DrawIndirectArguments) * numDraws);
+    }
+}
+
+void NullCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    auto cmd = AllocCommand<NullCmdMultiDrawIndexed>(NullOpcodeMultiDrawIndexed, sizeof(DrawIndexedIndirectArguments) * numDraws);
+    {
+        cmd->numDraws = numDraws;
+        ::memcpy(cmd + 1, draws, sizeof(DrawIndexedIndirectArguments) * numDraws);
+    }
+}
+
+/* ----- Compute ----- */
+
+void NullCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    auto cmd = AllocCommand<NullCmdDispatch>(NullOpcodeDispatch);
+    {
+        cmd->numWorkGroups[0] = numWorkGroupsX;
+        cmd->numWorkGroups[1] = numWorkGroupsY;
+        cmd->numWorkGroups[2] = numWorkGroupsZ;
+    }
+}
+
+void NullCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto cmd = AllocCommand<NullCmdDispatchIndirect>(NullOpcodeDispatchIndirect);
+    {
+        cmd->buffer = LLGL_CAST(NullBuffer*, &buffer);
+        cmd->offset = offset;
+    }
+}
+
+/* ----- Debugging ----- */
+
+void NullCommandBuffer::PushDebugGroup(const char* name)
+{
+    /* Push debug group name into command stream including the null terminator */
+    const auto length = std::strlen(name);
+    auto cmd = AllocCommand<NullCmdPushDebugGroup>(NullOpcodePushDebugGroup, length + 1);
+    {
+        cmd->length = length;
+        ::memcpy(cmd + 1, name, length + 1);
+    }
+}
+
+void NullCommandBuffer::PopDebugGroup()
+{
+    AllocOpcode(NullOpcodePopDebugGroup);
+}
+
+/* ----- Extensions ----- */
+
+void NullCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
+{
+    auto cmd = AllocCommand<NullCmdSetAPIDepState>(NullOpcodeSetAPIDepState, stateDescSize);
+    {
+        cmd->size = stateDescSize;
+        if (stateDesc != nullptr)
+            ::memcpy(cmd + 1, stateDesc, stateDescSize);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void NullCommandBuffer::AllocOpcode(const NullOpcode opcode)
+{
+    buffer_.push_back(opcode);
+}
+
+template <typename T>
+T* NullCommandBuffer::AllocCommand(const NullOpcode opcode, std::size_t extraSize)
+{
+    /* Resize internal buffer for opcode, command structure, and extra size */
+    auto offset = buffer_.size();
+    {
+        buffer_.resize(offset + sizeof(opcode) + sizeof(T) + extraSize);
+        buffer_[offset] = opcode;
+    }
+    return reinterpret_cast<T*>(&(buffer_[offset + sizeof(opcode)]));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,223 @@
+/*
+ * NullCommandExecutor.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullCommandExecutor.h"
+#include "NullCommand.h"
+#include "NullCommandBuffer.h"
+#include "../Buffer/NullBuffer.h"
+#include "../Texture/NullTexture.h"
+#include <LLGL/IndirectArguments.h>
+
+
+namespace LLGL
+{
+
+
+static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
+{
+    switch (opcode)
+    {
+        case NullOpcodeUpdateBuffer:
+        {
+            auto cmd = reinterpret_cast<const NullCmdUpdateBuffer*>(pc);
+            cmd->buffer->Write(cmd->offset, cmd + 1, cmd->size);
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case NullOpcodeCopyBuffer:
+        {
+            auto cmd = reinterpret_cast<const NullCmdCopyBuffer*>(pc);
+            cmd->dstBuffer->CopyFrom(cmd->dstOffset, *(cmd->srcBuffer), cmd->srcOffset, cmd->size);
+            return sizeof(*cmd);
+        }
+        case NullOpcodeCopyTexture:
+        {
+            auto cmd = reinterpret_cast<const NullCmdCopyTexture*>(pc);
+            cmd->dstTexture->CopyFrom(cmd->dstLocation, *(cmd->srcTexture), cmd->srcLocation, cmd->extent);
+            return sizeof(*cmd);
+        }
+        case NullOpcodeGenerateMips:
+        {
+            return sizeof(NullCmdGenerateMips);
+        }
+        case NullOpcodeExecute:
+        {
+            auto cmd = reinterpret_cast<const NullCmdExecute*>(pc);
+            ExecuteNullCommandBuffer(*(cmd->commandBuffer));
+            return sizeof(*cmd);
+        }
+        case NullOpcodeSetViewports:
+        {
+            auto cmd = reinterpret_cast<const NullCmdSetViewports*>(pc);
+            return (sizeof(*cmd) + sizeof(Viewport) * cmd->count);
+        }
+        case NullOpcodeSetScissors:
+        {
+            auto cmd = reinterpret_cast<const NullCmdSetScissors*>(pc);
+            return (sizeof(*cmd) + sizeof(Scissor) * cmd->count);
+        }
+        case NullOpcodeSetClearColor:
+        {
+            return sizeof(NullCmdSetClearColor);
+        }
+        case NullOpcodeSetClearDepth:
+        {
+            return sizeof(NullCmdSetClearDepth);
+        }
+        case NullOpcodeSetClearStencil:
+        {
+            return sizeof(NullCmdSetClearStencil);
+        }
+        case NullOpcodeClear:
+        {
+            return sizeof(NullCmdClear);
+        }
+        case NullOpcodeClearAttachments:
+        {
+            auto cmd = reinterpret_cast<const NullCmdClearAttachments*>(pc);
+            return (sizeof(*cmd) + sizeof(AttachmentClear) * cmd->count);
+        }
+        case NullOpcodeSetVertexBuffer:
+        case NullOpcodeSetStreamOutputBuffer:
+        {
+            return sizeof(NullCmdSetBuffer);
+        }
+        case NullOpcodeSetVertexBufferArray:
+        case NullOpcodeSetStreamOutputBufferArray:
+        {
+            return sizeof(NullCmdSetBufferArray);
+        }
+        case NullOpcodeSetIndexBuffer:
+        {
+            return sizeof(NullCmdSetIndexBuffer);
+        }
+        case NullOpcodeBeginStreamOutput:
+        {
+            return sizeof(NullCmdBeginStreamOutput);
+        }
+        case NullOpcodeSetResourceHeap:
+        {
+            return sizeof(NullCmdSetResourceHeap);
+        }
+        case NullOpcodeSetResource:
+        {
+            return sizeof(NullCmdSetResource);
+        }
+        case NullOpcodeResetResourceSlots:
+        {
+            return sizeof(NullCmdResetResourceSlots);
+        }
+        case NullOpcodeBeginRenderPass:
+        {
+            auto cmd = reinterpret_cast<const NullCmdBeginRenderPass*>(pc);
+            return (sizeof(*cmd) + sizeof(ClearValue) * cmd->numClearValues);
+        }
+        case NullOpcodeSetGraphicsPipeline:
+        {
+            return sizeof(NullCmdSetGraphicsPipeline);
+        }
+        case NullOpcodeSetComputePipeline:
+        {
+            return sizeof(NullCmdSetComputePipeline);
+        }
+        case NullOpcodeSetUniforms:
+        {
+            auto cmd = reinterpret_cast<const NullCmdSetUniforms*>(pc);
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case NullOpcodeBeginQuery:
+        case NullOpcodeEndQuery:
+        {
+            return sizeof(NullCmdQuery);
+        }
+        case NullOpcodeBeginRenderCondition:
+        {
+            return sizeof(NullCmdBeginRenderCondition);
+        }
+        case NullOpcodeDraw:
+        {
+            return sizeof(NullCmdDraw);
+        }
+        case NullOpcodeDrawIndexed:
+        {
+            return sizeof(NullCmdDrawIndexed);
+        }
+        case NullOpcodeDrawIndirect:
+        case NullOpcodeDrawIndexedIndirect:
+        {
+            return sizeof(NullCmdDrawIndirect);
+        }
+        case NullOpcodeDrawIndirectCount:
+        case NullOpcodeDrawIndexedIndirectCount:
+        {
+            return sizeof(NullCmdDrawIndirectCount);
+        }
+        case NullOpcodeMultiDraw:
+        {
+            auto cmd = reinterpret_cast<const NullCmdMultiDraw*>(pc);
+            return (sizeof(*cmd) + sizeof(DrawIndirectArguments) * cmd->numDraws);
+        }
+        case NullOpcodeMultiDrawIndexed:
+        {
+            auto cmd = reinterpret_cast<const NullCmdMultiDrawIndexed*>(pc);
+            return (sizeof(*cmd) + sizeof(DrawIndexedIndirectArguments) * cmd->numDraws);
+        }
+        case NullOpcodeDispatch:
+        {
+            return sizeof(NullCmdDispatch);
+        }
+        case NullOpcodeDispatchIndirect:
+        {
+            return sizeof(NullCmdDispatchIndirect);
+        }
+        case NullOpcodePushDebugGroup:
+        {
+            auto cmd = reinterpret_cast<const NullCmdPushDebugGroup*>(pc);
+            return (sizeof(*cmd) + cmd->length + 1);
+        }
+        case NullOpcodeSetAPIDepState:
+        {
+            auto cmd = reinterpret_cast<const NullCmdSetAPIDepState*>(pc);
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case NullOpcodeEndStreamOutput:
+        case NullOpcodeEndRenderPass:
+        case NullOpcodeEndRenderCondition:
+        case NullOpcodePopDebugGroup:
+        {
+            return 0;
+        }
+    }
+    return 0;
+}
+
+void ExecuteNullCommandBuffer(const NullCommandBuffer& cmdBuffer)
+{
+    const auto& rawBuffer = cmdBuffer.GetRawBuffer();
+
+    /* Initialize program counter to execute virtual commands */
+    auto pc     = rawBuffer.data();
+    auto pcEnd  = rawBuffer.data() + rawBuffer.size();
+
+    NullOpcode opcode;
+
+    while (pc < pcEnd)
+    {
+        /* Read opcode */
+        opcode = *reinterpret_cast<const NullOpcode*>(pc);
+        pc += sizeof(NullOpcode);
+
+        /* Execute command and increment program counter */
+        pc += ExecuteNullCommand(opcode, pc);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
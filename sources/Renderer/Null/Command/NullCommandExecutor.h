@@ -0,0 +1,32 @@
+/*
+ * NullCommandExecutor.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_COMMAND_EXECUTOR_H
+#define LLGL_NULL_COMMAND_EXECUTOR_H
+
+
+namespace LLGL
+{
+
+
+class NullCommandBuffer;
+
+/*
+Executes all commands that have been recorded in the specified command buffer.
+Only commands that modify the content of buffers and textures have an effect; all other commands are skipped.
+*/
+void ExecuteNullCommandBuffer(const NullCommandBuffer& cmdBuffer);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
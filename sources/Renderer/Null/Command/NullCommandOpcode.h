@@ -0,0 +1,75 @@
+/*
+ * NullCommandOpcode.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_COMMAND_OPCODE_H
+#define LLGL_NULL_COMMAND_OPCODE_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+enum NullOpcode : std::uint8_t
+{
+    NullOpcodeUpdateBuffer = 1,
+    NullOpcodeCopyBuffer,
+    NullOpcodeCopyTexture,
+    NullOpcodeGenerateMips,
+    NullOpcodeExecute,
+    NullOpcodeSetViewports,
+    NullOpcodeSetScissors,
+    NullOpcodeSetClearColor,
+    NullOpcodeSetClearDepth,
+    NullOpcodeSetClearStencil,
+    NullOpcodeClear,
+    NullOpcodeClearAttachments,
+    NullOpcodeSetVertexBuffer,
+    NullOpcodeSetVertexBufferArray,
+    NullOpcodeSetIndexBuffer,
+    NullOpcodeSetStreamOutputBuffer,
+    NullOpcodeSetStreamOutputBufferArray,
+    NullOpcodeBeginStreamOutput,
+    NullOpcodeEndStreamOutput,
+    NullOpcodeSetResourceHeap,
+    NullOpcodeSetResource,
+    NullOpcodeResetResourceSlots,
+    NullOpcodeBeginRenderPass,
+    NullOpcodeEndRenderPass,
+    NullOpcodeSetGraphicsPipeline,
+    NullOpcodeSetComputePipeline,
+    NullOpcodeSetUniforms,
+    NullOpcodeBeginQuery,
+    NullOpcodeEndQuery,
+    NullOpcodeBeginRenderCondition,
+    NullOpcodeEndRenderCondition,
+    NullOpcodeDraw,
+    NullOpcodeDrawIndexed,
+    NullOpcodeDrawIndirect,
+    NullOpcodeDrawIndexedIndirect,
+    NullOpcodeDrawIndirectCount,
+    NullOpcodeDrawIndexedIndirectCount,
+    NullOpcodeMultiDraw,
+    NullOpcodeMultiDrawIndexed,
+    NullOpcodeDispatch,
+    NullOpcodeDispatchIndirect,
+    NullOpcodePushDebugGroup,
+    NullOpcodePopDebugGroup,
+    NullOpcodeSetAPIDepState,
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,66 @@
+/*
+ * NullCommandQueue.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullCommandQueue.h"
+#include "NullCommandBuffer.h"
+#include "NullCommandExecutor.h"
+#include "../RenderState/NullFence.h"
+#include "../../CheckedCast.h"
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Command Buffers ----- */
+
+void NullCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    auto& cmdBufferNull = LLGL_CAST(NullCommandBuffer&, commandBuffer);
+    ExecuteNullCommandBuffer(cmdBufferNull);
+}
+
+/* ----- Queries ----- */
+
+bool NullCommandQueue::QueryResult(
+    QueryHeap&      /*queryHeap*/,
+    std::uint32_t   /*firstQuery*/,
+    std::uint32_t   /*numQueries*/,
+    void*           data,
+    std::size_t     dataSize)
+{
+    /* No fragments are generated and no primitives are processed, so all query results are zero */
+    ::memset(data, 0, dataSize);
+    return true;
+}
+
+/* ----- Fences ----- */
+
+void NullCommandQueue::Submit(Fence& fence)
+{
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    fenceNull.Signal();
+}
+
+bool NullCommandQueue::WaitFence(Fence& /*fence*/, std::uint64_t /*timeout*/)
+{
+    /* All commands have already been executed on submission */
+    return true;
+}
+
+void NullCommandQueue::WaitIdle()
+{
+    // dummy
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,56 @@
+/*
+ * NullCommandQueue.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_COMMAND_QUEUE_H
+#define LLGL_NULL_COMMAND_QUEUE_H
+
+
+#include <LLGL/CommandQueue.h>
+
+
+namespace LLGL
+{
+
+
+// Command queue that executes all submitted command buffers immediately on the calling thread.
+class NullCommandQueue final : public CommandQueue
+{
+
+    public:
+
+        /* ----- Command Buffers ----- */
+
+        void Submit(CommandBuffer& commandBuffer) override;
+
+        /* ----- Queries ----- */
+
+        bool QueryResult(
+            QueryHeap&      queryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries,
+            void*           data,
+            std::size_t     dataSize
+        ) override;
+
+        /* ----- Fences ----- */
+
+        void Submit(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+        void WaitIdle() override;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
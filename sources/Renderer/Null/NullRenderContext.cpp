@@ -0,0 +1,98 @@
+/*
+ * NullRenderContext.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullRenderContext.h"
+#include "NullSurface.h"
+
+
+namespace LLGL
+{
+
+
+static Format GetDepthStencilFormatForVideoMode(const VideoModeDescriptor& videoModeDesc)
+{
+    if (videoModeDesc.stencilBits > 0)
+        return Format::D24UNormS8UInt;
+    if (videoModeDesc.depthBits > 24)
+        return Format::D32Float;
+    if (videoModeDesc.depthBits > 16)
+        return Format::D24UNormS8UInt;
+    if (videoModeDesc.depthBits > 0)
+        return Format::D16UNorm;
+    return Format::Undefined;
+}
+
+static RenderPassDescriptor MakeRenderContextRenderPassDesc(const VideoModeDescriptor& videoModeDesc)
+{
+    const auto depthStencilFormat = GetDepthStencilFormatForVideoMode(videoModeDesc);
+
+    RenderPassDescriptor renderPassDesc;
+    {
+        renderPassDesc.colorAttachments = { AttachmentFormatDescriptor{ Format::RGBA8UNorm } };
+        if (IsDepthFormat(depthStencilFormat))
+            renderPassDesc.depthAttachment.format = depthStencilFormat;
+        if (IsStencilFormat(depthStencilFormat))
+            renderPassDesc.stencilAttachment.format = depthStencilFormat;
+    }
+    return renderPassDesc;
+}
+
+NullRenderContext::NullRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface) :
+    RenderContext { desc.videoMode, desc.vsync                      },
+    renderPass_   { MakeRenderContextRenderPassDesc(desc.videoMode) }
+{
+    /* Use headless surface if no surface is specified, and never switch the display into fullscreen mode */
+    auto videoMode = desc.videoMode;
+    videoMode.fullscreen = false;
+
+    if (surface)
+        SetOrCreateSurface(surface, videoMode, nullptr);
+    else
+        SetOrCreateSurface(std::make_shared<NullSurface>(videoMode.resolution), videoMode, nullptr);
+}
+
+void NullRenderContext::Present()
+{
+    ++numPresents_;
+}
+
+Format NullRenderContext::GetColorFormat() const
+{
+    return Format::RGBA8UNorm;
+}
+
+Format NullRenderContext::GetDepthStencilFormat() const
+{
+    return GetDepthStencilFormatForVideoMode(GetVideoMode());
+}
+
+const RenderPass* NullRenderContext::GetRenderPass() const
+{
+    return &renderPass_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool NullRenderContext::OnSetVideoMode(const VideoModeDescriptor& /*videoModeDesc*/)
+{
+    return true;
+}
+
+bool NullRenderContext::OnSetVsync(const VsyncDescriptor& /*vsyncDesc*/)
+{
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,62 @@
+/*
+ * NullRenderContext.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_CONTEXT_H
+#define LLGL_NULL_RENDER_CONTEXT_H
+
+
+#include <LLGL/RenderContext.h>
+#include "RenderState/NullRenderPass.h"
+
+
+namespace LLGL
+{
+
+
+class NullRenderContext final : public RenderContext
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        NullRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface);
+
+        void Present() override;
+
+        Format GetColorFormat() const override;
+        Format GetDepthStencilFormat() const override;
+
+        const RenderPass* GetRenderPass() const override;
+
+        // Returns the number of times this render context has been presented.
+        inline std::uint64_t GetNumPresents() const
+        {
+            return numPresents_;
+        }
+
+    private:
+
+        bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
+        bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
+
+    private:
+
+        NullRenderPass  renderPass_;
+        std::uint64_t   numPresents_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
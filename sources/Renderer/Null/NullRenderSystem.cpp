@@ -0,0 +1,377 @@
+/*
+ * NullRenderSystem.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullRenderSystem.h"
+#include "../CheckedCast.h"
+#include "../../Core/Helper.h"
+#include <LLGL/Format.h>
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+/* ----- Common ----- */
+
+NullRenderSystem::NullRenderSystem(const RenderSystemDescriptor& /*renderSystemDesc*/) :
+    commandQueue_ { MakeUnique<NullCommandQueue>() }
+{
+    QueryRendererInfo();
+    QueryRenderingCaps();
+}
+
+/* ----- Render Context ----- */
+
+RenderContext* NullRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
+{
+    return TakeOwnership(renderContexts_, MakeUnique<NullRenderContext>(desc, surface));
+}
+
+void NullRenderSystem::Release(RenderContext& renderContext)
+{
+    RemoveFromUniqueSet(renderContexts_, &renderContext);
+}
+
+/* ----- Command queues ----- */
+
+CommandQueue* NullRenderSystem::GetCommandQueue()
+{
+    return commandQueue_.get();
+}
+
+/* ----- Command buffers ----- */
+
+CommandBuffer* NullRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
+{
+    return TakeOwnership(commandBuffers_, MakeUnique<NullCommandBuffer>(desc));
+}
+
+void NullRenderSystem::Release(CommandBuffer& commandBuffer)
+{
+    RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
+}
+
+/* ----- Buffers ------ */
+
+Buffer* NullRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
+{
+    AssertCreateBuffer(desc, GetRenderingCaps().limits.maxBufferSize);
+    return TakeOwnership(buffers_, MakeUnique<NullBuffer>(desc, initialData));
+}
+
+BufferArray* NullRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    AssertCreateBufferArray(numBuffers, bufferArray);
+    return TakeOwnership(bufferArrays_, MakeUnique<NullBufferArray>(bufferArray[0]->GetBindFlags(), numBuffers, bufferArray));
+}
+
+void NullRenderSystem::Release(Buffer& buffer)
+{
+    RemoveFromUniqueSet(buffers_, &buffer);
+}
+
+void NullRenderSystem::Release(BufferArray& bufferArray)
+{
+    RemoveFromUniqueSet(bufferArrays_, &bufferArray);
+}
+
+void NullRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
+{
+    auto& dstBufferNull = LLGL_CAST(NullBuffer&, dstBuffer);
+    dstBufferNull.Write(dstOffset, data, dataSize);
+}
+
+void* NullRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
+{
+    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    return bufferNull.Map(access);
+}
+
+void NullRenderSystem::UnmapBuffer(Buffer& buffer)
+{
+    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    bufferNull.Unmap();
+}
+
+/* ----- Textures ----- */
+
+Texture* NullRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
+{
+    auto textureNull = MakeUnique<NullTexture>(textureDesc);
+
+    /* Write initial image data into all array layers of the first MIP-map; MIP-maps are not generated */
+    if (imageDesc)
+    {
+        textureNull->Write(
+            TextureRegion
+            {
+                TextureSubresource{ 0, textureDesc.arrayLayers, 0, 1 },
+                Offset3D{ 0, 0, 0 },
+                textureDesc.extent
+            },
+            *imageDesc,
+            GetConfiguration().threadCount
+        );
+    }
+
+    return TakeOwnership(textures_, std::move(textureNull));
+}
+
+void NullRenderSystem::Release(Texture& texture)
+{
+    RemoveFromUniqueSet(textures_, &texture);
+}
+
+void NullRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
+{
+    auto& textureNull = LLGL_CAST(NullTexture&, texture);
+    textureNull.Write(textureRegion, imageDesc, GetConfiguration().threadCount);
+}
+
+void NullRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
+{
+    auto& textureNull = LLGL_CAST(const NullTexture&, texture);
+    textureNull.Read(mipLevel, imageDesc, GetConfiguration().threadCount);
+}
+
+/* ----- Sampler States ---- */
+
+Sampler* NullRenderSystem::CreateSampler(const SamplerDescriptor& desc)
+{
+    return TakeOwnership(samplers_, MakeUnique<NullSampler>(desc));
+}
+
+void NullRenderSystem::Release(Sampler& sampler)
+{
+    RemoveFromUniqueSet(samplers_, &sampler);
+}
+
+/* ----- Resource Heaps ----- */
+
+ResourceHeap* NullRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    return TakeOwnership(resourceHeaps_, MakeUnique<NullResourceHeap>(desc));
+}
+
+void NullRenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
+}
+
+/* ----- Render Passes ----- */
+
+RenderPass* NullRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
+{
+    AssertCreateRenderPass(desc);
+    return TakeOwnership(renderPasses_, MakeUnique<NullRenderPass>(desc));
+}
+
+void NullRenderSystem::Release(RenderPass& renderPass)
+{
+    RemoveFromUniqueSet(renderPasses_, &renderPass);
+}
+
+/* ----- Render Targets ----- */
+
+RenderTarget* NullRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
+{
+    AssertCreateRenderTarget(desc);
+    return TakeOwnership(renderTargets_, MakeUnique<NullRenderTarget>(desc));
+}
+
+void NullRenderSystem::Release(RenderTarget& renderTarget)
+{
+    RemoveFromUniqueSet(renderTargets_, &renderTarget);
+}
+
+/* ----- Shader ----- */
+
+Shader* NullRenderSystem::CreateShader(const ShaderDescriptor& desc)
+{
+    AssertCreateShader(desc);
+    return TakeOwnership(shaders_, MakeUnique<NullShader>(desc));
+}
+
+ShaderProgram* NullRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
+{
+    AssertCreateShaderProgram(desc);
+    return TakeOwnership(shaderPrograms_, MakeUnique<NullShaderProgram>(desc));
+}
+
+void NullRenderSystem::Release(Shader& shader)
+{
+    RemoveFromUniqueSet(shaders_, &shader);
+}
+
+void NullRenderSystem::Release(ShaderProgram& shaderProgram)
+{
+    RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
+}
+
+/* ----- Pipeline Layouts ----- */
+
+PipelineLayout* NullRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
+{
+    /* Share pipeline layout with identical bindings */
+    if (auto pipelineLayout = pipelineLayoutCache_.Find(desc))
+        return pipelineLayout;
+
+    auto pipelineLayout = TakeOwnership(pipelineLayouts_, MakeUnique<NullPipelineLayout>(desc));
+    pipelineLayoutCache_.Insert(desc, pipelineLayout);
+    return pipelineLayout;
+}
+
+void NullRenderSystem::Release(PipelineLayout& pipelineLayout)
+{
+    if (pipelineLayoutCache_.Release(&pipelineLayout))
+        RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
+}
+
+/* ----- Pipeline States ----- */
+
+GraphicsPipeline* NullRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
+{
+    return TakeOwnership(graphicsPipelines_, MakeUnique<NullGraphicsPipeline>(desc));
+}
+
+ComputePipeline* NullRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
+{
+    return TakeOwnership(computePipelines_, MakeUnique<NullComputePipeline>(desc));
+}
+
+void NullRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
+{
+    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+}
+
+void NullRenderSystem::Release(ComputePipeline& computePipeline)
+{
+    RemoveFromUniqueSet(computePipelines_, &computePipeline);
+}
+
+/* ----- Queries ----- */
+
+QueryHeap* NullRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& desc)
+{
+    return TakeOwnership(queryHeaps_, MakeUnique<NullQueryHeap>(desc));
+}
+
+void NullRenderSystem::Release(QueryHeap& queryHeap)
+{
+    RemoveFromUniqueSet(queryHeaps_, &queryHeap);
+}
+
+/* ----- Fences ----- */
+
+Fence* NullRenderSystem::CreateFence()
+{
+    return TakeOwnership(fences_, MakeUnique<NullFence>());
+}
+
+void NullRenderSystem::Release(Fence& fence)
+{
+    RemoveFromUniqueSet(fences_, &fence);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void NullRenderSystem::QueryRendererInfo()
+{
+    RendererInfo info;
+    {
+        info.rendererName           = "Null";
+        info.deviceName             = "Null Device";
+        info.vendorName             = "LLGL";
+        info.shadingLanguageName    = "None";
+    }
+    SetRendererInfo(info);
+}
+
+void NullRenderSystem::QueryRenderingCaps()
+{
+    RenderingCapabilities caps;
+    {
+        /* Accept shaders of all shading languages, since they are never compiled */
+        caps.screenOrigin       = ScreenOrigin::UpperLeft;
+        caps.clippingRange      = ClippingRange::ZeroToOne;
+        caps.shadingLanguages   =
+        {
+            ShadingLanguage::GLSL,  ShadingLanguage::GLSL_450,
+            ShadingLanguage::ESSL,  ShadingLanguage::ESSL_320,
+            ShadingLanguage::HLSL,  ShadingLanguage::HLSL_5_1,
+            ShadingLanguage::Metal, ShadingLanguage::Metal_2_1,
+            ShadingLanguage::SPIRV, ShadingLanguage::SPIRV_100,
+        };
+
+        /* Support all formats */
+        for (int format = static_cast<int>(Format::Undefined) + 1; format <= static_cast<int>(Format::BC5SNorm); ++format)
+            caps.textureFormats.push_back(static_cast<Format>(format));
+
+        /* Specify features */
+        caps.features.hasDirectResourceBinding      = true;
+        caps.features.hasRenderTargets              = true;
+        caps.features.has3DTextures                 = true;
+        caps.features.hasCubeTextures               = true;
+        caps.features.hasArrayTextures              = true;
+        caps.features.hasCubeArrayTextures          = true;
+        caps.features.hasMultiSampleTextures        = true;
+        caps.features.hasTextureViews               = true;
+        caps.features.hasTextureViewSwizzle         = true;
+        caps.features.hasSamplers                   = true;
+        caps.features.hasConstantBuffers            = true;
+        caps.features.hasStorageBuffers             = true;
+        caps.features.hasUniforms                   = true;
+        caps.features.hasGeometryShaders            = true;
+        caps.features.hasTessellationShaders        = true;
+        caps.features.hasComputeShaders             = true;
+        caps.features.hasInstancing                 = true;
+        caps.features.hasOffsetInstancing           = true;
+        caps.features.hasIndirectDrawing            = true;
+        caps.features.hasIndirectCountDrawing       = true;
+        caps.features.hasViewportArrays             = true;
+        caps.features.hasConservativeRasterization  = true;
+        caps.features.hasStreamOutputs              = true;
+        caps.features.hasLogicOp                    = true;
+        caps.features.hasPipelineStatistics         = true;
+        caps.features.hasRenderCondition            = true;
+
+        /* Specify limits */
+        caps.limits.lineWidthRange[0]               = 1.0f;
+        caps.limits.lineWidthRange[1]               = 1.0f;
+        caps.limits.maxTextureArrayLayers           = 2048;
+        caps.limits.maxColorAttachments             = 8;
+        caps.limits.maxPatchVertices                = 32;
+        caps.limits.max1DTextureSize                = 16384;
+        caps.limits.max2DTextureSize                = 16384;
+        caps.limits.max3DTextureSize                = 2048;
+        caps.limits.maxCubeTextureSize              = 16384;
+        caps.limits.maxAnisotropy                   = 16;
+        caps.limits.maxComputeShaderWorkGroups[0]   = 65535;
+        caps.limits.maxComputeShaderWorkGroups[1]   = 65535;
+        caps.limits.maxComputeShaderWorkGroups[2]   = 65535;
+        caps.limits.maxComputeShaderWorkGroupSize[0]= 1024;
+        caps.limits.maxComputeShaderWorkGroupSize[1]= 1024;
+        caps.limits.maxComputeShaderWorkGroupSize[2]= 64;
+        caps.limits.maxViewports                    = 16;
+        caps.limits.maxViewportSize[0]              = 16384;
+        caps.limits.maxViewportSize[1]              = 16384;
+        caps.limits.maxBufferSize                   = std::numeric_limits<std::uint32_t>::max();
+        caps.limits.maxConstantBufferSize           = 65536;
+    }
+    SetRenderingCaps(caps);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,192 @@
+/*
+ * NullRenderSystem.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_SYSTEM_H
+#define LLGL_NULL_RENDER_SYSTEM_H
+
+
+#include <LLGL/RenderSystem.h>
+#include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
+
+#include "Command/NullCommandQueue.h"
+#include "Command/NullCommandBuffer.h"
+#include "NullRenderContext.h"
+
+#include "Buffer/NullBuffer.h"
+#include "Buffer/NullBufferArray.h"
+
+#include "RenderState/NullGraphicsPipeline.h"
+#include "RenderState/NullComputePipeline.h"
+#include "RenderState/NullPipelineLayout.h"
+#include "RenderState/NullResourceHeap.h"
+#include "RenderState/NullRenderPass.h"
+#include "RenderState/NullQueryHeap.h"
+#include "RenderState/NullFence.h"
+
+#include "Shader/NullShader.h"
+#include "Shader/NullShaderProgram.h"
+
+#include "Texture/NullTexture.h"
+#include "Texture/NullSampler.h"
+#include "Texture/NullRenderTarget.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Render system that keeps all resources in host memory and executes command buffers on the CPU without rendering anything.
+This is used to measure the CPU overhead of an application and to run tests on machines without a GPU.
+*/
+class NullRenderSystem final : public RenderSystem
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
+
+        /* ----- Render Context ----- */
+
+        RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
+
+        void Release(RenderContext& renderContext) override;
+
+        /* ----- Command queues ----- */
+
+        using RenderSystem::GetCommandQueue;
+
+        CommandQueue* GetCommandQueue() override;
+
+        /* ----- Command buffers ----- */
+
+        CommandBuffer* CreateCommandBuffer(const CommandBufferDescriptor& desc = {}) override;
+
+        void Release(CommandBuffer& commandBuffer) override;
+
+        /* ----- Buffers ------ */
+
+        Buffer* CreateBuffer(const BufferDescriptor& desc, const void* initialData = nullptr) override;
+        BufferArray* CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray) override;
+
+        void Release(Buffer& buffer) override;
+        void Release(BufferArray& bufferArray) override;
+
+        void WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize) override;
+
+        void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
+        void UnmapBuffer(Buffer& buffer) override;
+
+        /* ----- Textures ----- */
+
+        Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
+
+        void Release(Texture& texture) override;
+
+        void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
+
+        /* ----- Sampler States ---- */
+
+        Sampler* CreateSampler(const SamplerDescriptor& desc) override;
+
+        void Release(Sampler& sampler) override;
+
+        /* ----- Resource Heaps ----- */
+
+        ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
+
+        void Release(ResourceHeap& resourceHeap) override;
+
+        /* ----- Render Passes ----- */
+
+        RenderPass* CreateRenderPass(const RenderPassDescriptor& desc) override;
+
+        void Release(RenderPass& renderPass) override;
+
+        /* ----- Render Targets ----- */
+
+        RenderTarget* CreateRenderTarget(const RenderTargetDescriptor& desc) override;
+
+        void Release(RenderTarget& renderTarget) override;
+
+        /* ----- Shader ----- */
+
+        Shader* CreateShader(const ShaderDescriptor& desc) override;
+        ShaderProgram* CreateShaderProgram(const ShaderProgramDescriptor& desc) override;
+
+        void Release(Shader& shader) override;
+        void Release(ShaderProgram& shaderProgram) override;
+
+        /* ----- Pipeline Layouts ----- */
+
+        PipelineLayout* CreatePipelineLayout(const PipelineLayoutDescriptor& desc) override;
+
+        void Release(PipelineLayout& pipelineLayout) override;
+
+        /* ----- Pipeline States ----- */
+
+        GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
+        ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) override;
+
+        void Release(GraphicsPipeline& graphicsPipeline) override;
+        void Release(ComputePipeline& computePipeline) override;
+
+        /* ----- Queries ----- */
+
+        QueryHeap* CreateQueryHeap(const QueryHeapDescriptor& desc) override;
+
+        void Release(QueryHeap& queryHeap) override;
+
+        /* ----- Fences ----- */
+
+        Fence* CreateFence() override;
+
+        void Release(Fence& fence) override;
+
+    private:
+
+        void QueryRendererInfo();
+        void QueryRenderingCaps();
+
+    private:
+
+        /* ----- Hardware object containers ----- */
+
+        HWObjectContainer<NullRenderContext>    renderContexts_;
+        HWObjectInstance<NullCommandQueue>      commandQueue_;
+        HWObjectContainer<NullCommandBuffer>    commandBuffers_;
+        HWObjectContainer<NullBuffer>           buffers_;
+        HWObjectContainer<NullBufferArray>      bufferArrays_;
+        HWObjectContainer<NullTexture>          textures_;
+        HWObjectContainer<NullSampler>          samplers_;
+        HWObjectContainer<NullRenderPass>       renderPasses_;
+        HWObjectContainer<NullRenderTarget>     renderTargets_;
+        HWObjectContainer<NullShader>           shaders_;
+        HWObjectContainer<NullShaderProgram>    shaderPrograms_;
+        HWObjectContainer<NullPipelineLayout>   pipelineLayouts_;
+        PipelineLayoutCache                     pipelineLayoutCache_;
+        HWObjectContainer<NullGraphicsPipeline> graphicsPipelines_;
+        HWObjectContainer<NullComputePipeline>  computePipelines_;
+        HWObjectContainer<NullResourceHeap>     resourceHeaps_;
+        HWObjectContainer<NullQueryHeap>        queryHeaps_;
+        HWObjectContainer<NullFence>            fences_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
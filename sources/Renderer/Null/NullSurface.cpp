@@ -0,0 +1,51 @@
+/*
+ * NullSurface.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullSurface.h"
+
+
+namespace LLGL
+{
+
+
+NullSurface::NullSurface(const Extent2D& size) :
+    size_ { size }
+{
+}
+
+void NullSurface::GetNativeHandle(void* /*nativeHandle*/) const
+{
+    // dummy
+}
+
+Extent2D NullSurface::GetContentSize() const
+{
+    return size_;
+}
+
+bool NullSurface::AdaptForVideoMode(VideoModeDescriptor& videoModeDesc)
+{
+    size_ = videoModeDesc.resolution;
+    return true;
+}
+
+void NullSurface::ResetPixelFormat()
+{
+    // dummy
+}
+
+bool NullSurface::ProcessEvents()
+{
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,51 @@
+/*
+ * NullSurface.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_SURFACE_H
+#define LLGL_NULL_SURFACE_H
+
+
+#include <LLGL/Surface.h>
+
+
+namespace LLGL
+{
+
+
+// Headless surface for render contexts that are created without a surface, so no window is created.
+class NullSurface final : public Surface
+{
+
+    public:
+
+        NullSurface(const Extent2D& size);
+
+        void GetNativeHandle(void* nativeHandle) const override;
+
+        Extent2D GetContentSize() const override;
+
+        bool AdaptForVideoMode(VideoModeDescriptor& videoModeDesc) override;
+
+        void ResetPixelFormat() override;
+
+        bool ProcessEvents() override;
+
+    private:
+
+        Extent2D size_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,25 @@
+/*
+ * NullComputePipeline.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullComputePipeline.h"
+
+
+namespace LLGL
+{
+
+
+NullComputePipeline::NullComputePipeline(const ComputePipelineDescriptor& desc) :
+    desc_ { desc }
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
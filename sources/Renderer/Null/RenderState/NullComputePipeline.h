@@ -0,0 +1,47 @@
+/*
+ * NullComputePipeline.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_COMPUTE_PIPELINE_H
+#define LLGL_NULL_COMPUTE_PIPELINE_H
+
+
+#include <LLGL/ComputePipeline.h>
+#include <LLGL/ComputePipelineFlags.h>
+
+
+namespace LLGL
+{
+
+
+class NullComputePipeline final : public ComputePipeline
+{
+
+    public:
+
+        NullComputePipeline(const ComputePipelineDescriptor& desc);
+
+        // Returns the descriptor this compute pipeline was created with.
+        inline const ComputePipelineDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+    private:
+
+        ComputePipelineDescriptor desc_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
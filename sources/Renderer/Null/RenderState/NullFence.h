@@ -0,0 +1,52 @@
+/*
+ * NullFence.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_FENCE_H
+#define LLGL_NULL_FENCE_H
+
+
+#include <LLGL/Fence.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Fence that is signaled immediately on submission, since all commands are executed on the CPU.
+class NullFence final : public Fence
+{
+
+    public:
+
+        // Signals the next value of this fence.
+        inline void Signal()
+        {
+            ++value_;
+        }
+
+        // Returns the number of times this fence has been signaled.
+        inline std::uint64_t GetValue() const
+        {
+            return value_;
+        }
+
+    private:
+
+        std::uint64_t value_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
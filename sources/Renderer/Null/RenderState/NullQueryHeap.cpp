@@ -0,0 +1,26 @@
+/*
+ * NullQueryHeap.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullQueryHeap.h"
+
+
+namespace LLGL
+{
+
+
+NullQueryHeap::NullQueryHeap(const QueryHeapDescriptor& desc) :
+    QueryHeap   { desc.type       },
+    numQueries_ { desc.numQueries }
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
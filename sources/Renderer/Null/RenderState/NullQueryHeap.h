@@ -0,0 +1,47 @@
+/*
+ * NullQueryHeap.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_QUERY_HEAP_H
+#define LLGL_NULL_QUERY_HEAP_H
+
+
+#include <LLGL/QueryHeap.h>
+#include <LLGL/QueryHeapFlags.h>
+
+
+namespace LLGL
+{
+
+
+class NullQueryHeap final : public QueryHeap
+{
+
+    public:
+
+        NullQueryHeap(const QueryHeapDescriptor& desc);
+
+        // Returns the number of queries in this heap.
+        inline std::uint32_t GetNumQueries() const
+        {
+            return numQueries_;
+        }
+
+    private:
+
+        std::uint32_t numQueries_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,47 @@
+/*
+ * NullRenderPass.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_PASS_H
+#define LLGL_NULL_RENDER_PASS_H
+
+
+#include <LLGL/RenderPass.h>
+#include <LLGL/RenderPassFlags.h>
+
+
+namespace LLGL
+{
+
+
+class NullRenderPass final : public RenderPass
+{
+
+    public:
+
+        NullRenderPass(const RenderPassDescriptor& desc);
+
+        // Returns the descriptor this render pass was created with.
+        inline const RenderPassDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+    private:
+
+        RenderPassDescriptor desc_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,47 @@
+/*
+ * NullResourceHeap.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RESOURCE_HEAP_H
+#define LLGL_NULL_RESOURCE_HEAP_H
+
+
+#include <LLGL/ResourceHeap.h>
+#include <LLGL/ResourceHeapFlags.h>
+
+
+namespace LLGL
+{
+
+
+class NullResourceHeap final : public ResourceHeap
+{
+
+    public:
+
+        NullResourceHeap(const ResourceHeapDescriptor& desc);
+
+        // Returns the descriptor this resource heap was created with.
+        inline const ResourceHeapDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+    private:
+
+        ResourceHeapDescriptor desc_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,37 @@
+/*
+ * NullShader.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullShader.h"
+
+
+namespace LLGL
+{
+
+
+NullShader::NullShader(const ShaderDescriptor& desc) :
+    Shader    { desc.type     },
+    vertex_   { desc.vertex   },
+    fragment_ { desc.fragment }
+{
+}
+
+bool NullShader::HasErrors() const
+{
+    return false;
+}
+
+std::string NullShader::GetReport() const
+{
+    return "";
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
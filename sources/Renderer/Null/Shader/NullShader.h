@@ -0,0 +1,61 @@
+/*
+ * NullShader.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_SHADER_H
+#define LLGL_NULL_SHADER_H
+
+
+#include <LLGL/Shader.h>
+#include <LLGL/ShaderFlags.h>
+
+
+namespace LLGL
+{
+
+
+// Shader that is never compiled; only its interface attributes are stored for reflection.
+class NullShader final : public Shader
+{
+
+    public:
+
+        bool HasErrors() const override;
+
+        std::string GetReport() const override;
+
+    public:
+
+        NullShader(const ShaderDescriptor& desc);
+
+        // Returns the vertex shader attributes of the shader descriptor.
+        inline const VertexShaderAttributes& GetVertexAttribs() const
+        {
+            return vertex_;
+        }
+
+        // Returns the fragment shader attributes of the shader descriptor.
+        inline const FragmentShaderAttributes& GetFragmentAttribs() const
+        {
+            return fragment_;
+        }
+
+    private:
+
+        VertexShaderAttributes      vertex_;
+        FragmentShaderAttributes    fragment_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,94 @@
+/*
+ * NullShaderProgram.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullShaderProgram.h"
+#include "NullShader.h"
+#include "../../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+NullShaderProgram::NullShaderProgram(const ShaderProgramDescriptor& desc)
+{
+    Shader* shaders[] =
+    {
+        desc.vertexShader,
+        desc.tessControlShader,
+        desc.tessEvaluationShader,
+        desc.geometryShader,
+        desc.fragmentShader,
+        desc.computeShader,
+    };
+
+    if (!ValidateShaderComposition(shaders, sizeof(shaders)/sizeof(shaders[0])))
+        linkError_ = LinkError::InvalidComposition;
+
+    /* Store shaders that contribute to the reflection of the interface attributes */
+    if (desc.vertexShader != nullptr)
+        vs_ = LLGL_CAST(const NullShader*, desc.vertexShader);
+    if (desc.geometryShader != nullptr)
+        gs_ = LLGL_CAST(const NullShader*, desc.geometryShader);
+    if (desc.fragmentShader != nullptr)
+        fs_ = LLGL_CAST(const NullShader*, desc.fragmentShader);
+}
+
+bool NullShaderProgram::HasErrors() const
+{
+    return (linkError_ != LinkError::NoError);
+}
+
+std::string NullShaderProgram::GetReport() const
+{
+    if (auto s = ShaderProgram::LinkErrorToString(linkError_))
+        return s;
+    else
+        return "";
+}
+
+bool NullShaderProgram::Reflect(ShaderReflection& reflection) const
+{
+    ShaderProgram::ClearShaderReflection(reflection);
+
+    /* Reflect interface attributes as they have been specified in the shader descriptors */
+    if (vs_ != nullptr)
+    {
+        reflection.vertex.inputAttribs  = vs_->GetVertexAttribs().inputAttribs;
+        reflection.vertex.outputAttribs = vs_->GetVertexAttribs().outputAttribs;
+    }
+    if (gs_ != nullptr)
+        reflection.vertex.outputAttribs = gs_->GetVertexAttribs().outputAttribs;
+    if (fs_ != nullptr)
+        reflection.fragment.outputAttribs = fs_->GetFragmentAttribs().outputAttribs;
+
+    ShaderProgram::FinalizeShaderReflection(reflection);
+
+    return true;
+}
+
+UniformLocation NullShaderProgram::FindUniformLocation(const char* /*name*/) const
+{
+    return -1;
+}
+
+bool NullShaderProgram::SetWorkGroupSize(const Extent3D& /*workGroupSize*/)
+{
+    return false; // dummy
+}
+
+bool NullShaderProgram::GetWorkGroupSize(Extent3D& /*workGroupSize*/) const
+{
+    return false; // dummy
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,59 @@
+/*
+ * NullShaderProgram.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_SHADER_PROGRAM_H
+#define LLGL_NULL_SHADER_PROGRAM_H
+
+
+#include <LLGL/ShaderProgram.h>
+#include <LLGL/ShaderProgramFlags.h>
+
+
+namespace LLGL
+{
+
+
+class NullShader;
+
+class NullShaderProgram final : public ShaderProgram
+{
+
+    public:
+
+        bool HasErrors() const override;
+
+        std::string GetReport() const override;
+
+        bool Reflect(ShaderReflection& reflection) const override;
+
+        UniformLocation FindUniformLocation(const char* name) const override;
+
+        bool SetWorkGroupSize(const Extent3D& workGroupSize) override;
+        bool GetWorkGroupSize(Extent3D& workGroupSize) const override;
+
+    public:
+
+        NullShaderProgram(const ShaderProgramDescriptor& desc);
+
+    private:
+
+        const NullShader*   vs_         = nullptr;
+        const NullShader*   gs_         = nullptr;
+        const NullShader*   fs_         = nullptr;
+        LinkError           linkError_  = LinkError::NoError;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
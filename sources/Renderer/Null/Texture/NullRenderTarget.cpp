@@ -0,0 +1,100 @@
+/*
+ * NullRenderTarget.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullRenderTarget.h"
+#include <LLGL/Texture.h>
+
+
+namespace LLGL
+{
+
+
+static Format GetAttachmentFormat(const AttachmentDescriptor& attachmentDesc)
+{
+    if (auto texture = attachmentDesc.texture)
+        return texture->GetDesc().format;
+
+    switch (attachmentDesc.type)
+    {
+        case AttachmentType::Color:         return Format::RGBA8UNorm;
+        case AttachmentType::Depth:         return Format::D32Float;
+        case AttachmentType::DepthStencil:  return Format::D24UNormS8UInt;
+        case AttachmentType::Stencil:       return Format::D24UNormS8UInt;
+    }
+
+    return Format::Undefined;
+}
+
+// Returns the descriptor of the default render pass for the specified render target attachments.
+static RenderPassDescriptor MakeDefaultRenderPassDesc(const RenderTargetDescriptor& desc)
+{
+    RenderPassDescriptor renderPassDesc;
+
+    for (const auto& attachment : desc.attachments)
+    {
+        const auto format = GetAttachmentFormat(attachment);
+        switch (attachment.type)
+        {
+            case AttachmentType::Color:
+                renderPassDesc.colorAttachments.push_back(AttachmentFormatDescriptor{ format });
+                break;
+            case AttachmentType::Depth:
+                renderPassDesc.depthAttachment.format = format;
+                break;
+            case AttachmentType::DepthStencil:
+                renderPassDesc.depthAttachment.format   = format;
+                renderPassDesc.stencilAttachment.format = format;
+                break;
+            case AttachmentType::Stencil:
+                renderPassDesc.stencilAttachment.format = format;
+                break;
+        }
+    }
+
+    return renderPassDesc;
+}
+
+NullRenderTarget::NullRenderTarget(const RenderTargetDescriptor& desc) :
+    desc_              { desc                            },
+    defaultRenderPass_ { MakeDefaultRenderPassDesc(desc) }
+{
+}
+
+Extent2D NullRenderTarget::GetResolution() const
+{
+    return desc_.resolution;
+}
+
+std::uint32_t NullRenderTarget::GetNumColorAttachments() const
+{
+    return static_cast<std::uint32_t>(defaultRenderPass_.GetDesc().colorAttachments.size());
+}
+
+bool NullRenderTarget::HasDepthAttachment() const
+{
+    return (defaultRenderPass_.GetDesc().depthAttachment.format != Format::Undefined);
+}
+
+bool NullRenderTarget::HasStencilAttachment() const
+{
+    return (defaultRenderPass_.GetDesc().stencilAttachment.format != Format::Undefined);
+}
+
+const RenderPass* NullRenderTarget::GetRenderPass() const
+{
+    if (desc_.renderPass != nullptr)
+        return desc_.renderPass;
+    else
+        return &defaultRenderPass_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
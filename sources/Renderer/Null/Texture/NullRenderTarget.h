@@ -0,0 +1,60 @@
+/*
+ * NullRenderTarget.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_TARGET_H
+#define LLGL_NULL_RENDER_TARGET_H
+
+
+#include <LLGL/RenderTarget.h>
+#include <LLGL/RenderTargetFlags.h>
+#include "../RenderState/NullRenderPass.h"
+
+
+namespace LLGL
+{
+
+
+class NullRenderTarget final : public RenderTarget
+{
+
+    public:
+
+        Extent2D GetResolution() const override;
+
+        std::uint32_t GetNumColorAttachments() const override;
+
+        bool HasDepthAttachment() const override;
+        bool HasStencilAttachment() const override;
+
+        const RenderPass* GetRenderPass() const override;
+
+    public:
+
+        NullRenderTarget(const RenderTargetDescriptor& desc);
+
+        // Returns the descriptor this render target was created with.
+        inline const RenderTargetDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+    private:
+
+        RenderTargetDescriptor  desc_;
+        NullRenderPass          defaultRenderPass_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
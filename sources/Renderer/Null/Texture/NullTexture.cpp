@@ -0,0 +1,256 @@
+/*
+ * NullTexture.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullTexture.h"
+#include "../../TextureUtils.h"
+#include <LLGL/Format.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+static std::uint32_t DivideRoundUp(std::uint32_t x, std::uint32_t y)
+{
+    return (x + y - 1) / y;
+}
+
+// Returns the extent of the specified region where the array layers are folded into the height or depth, like the MIP-map extent.
+static Extent3D CalcTextureRegionExtent(const TextureType type, const Extent3D& extent, std::uint32_t numArrayLayers)
+{
+    switch (type)
+    {
+        case TextureType::Texture1D:
+            return Extent3D{ extent.width, 1u, 1u };
+        case TextureType::Texture1DArray:
+            return Extent3D{ extent.width, numArrayLayers, 1u };
+        case TextureType::Texture2D:
+        case TextureType::Texture2DMS:
+            return Extent3D{ extent.width, extent.height, 1u };
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+        case TextureType::Texture2DMSArray:
+            return Extent3D{ extent.width, extent.height, numArrayLayers };
+        default:
+            return extent;
+    }
+}
+
+static void CopyRegionRows(
+    char*               dst,
+    std::size_t         dstRowStride,
+    std::size_t         dstLayerStride,
+    const char*         src,
+    std::size_t         srcRowStride,
+    std::size_t         srcLayerStride,
+    std::size_t         rowSize,
+    std::size_t         numRows,
+    std::size_t         numLayers)
+{
+    for (std::size_t z = 0; z < numLayers; ++z)
+    {
+        for (std::size_t y = 0; y < numRows; ++y)
+            ::memmove(dst + z * dstLayerStride + y * dstRowStride, src + z * srcLayerStride + y * srcRowStride, rowSize);
+    }
+}
+
+// Returns the required size (in bytes) of an image with the specified layout.
+static std::size_t GetRequiredImageSize(std::size_t rowSize, std::size_t numRows, std::size_t numLayers, std::size_t rowStride, std::size_t layerStride)
+{
+    if (rowSize == 0 || numRows == 0 || numLayers == 0)
+        return 0;
+    return (numLayers - 1) * layerStride + (numRows - 1) * rowStride + rowSize;
+}
+
+NullTexture::NullTexture(const TextureDescriptor& desc) :
+    Texture { desc.type },
+    desc_   { desc      }
+{
+    desc_.mipLevels = NumMipLevels(desc);
+
+    /* Allocate zero-initialized memory for each MIP-map */
+    mips_.resize(desc_.mipLevels);
+    for (std::uint32_t mipLevel = 0; mipLevel < desc_.mipLevels; ++mipLevel)
+    {
+        const auto layout = GetRegionLayout(mipLevel, Offset3D{}, GetMipExtent(mipLevel));
+        mips_[mipLevel].resize(layout.numLayers * layout.layerStride);
+    }
+}
+
+TextureDescriptor NullTexture::GetDesc() const
+{
+    return desc_;
+}
+
+Extent3D NullTexture::GetMipExtent(std::uint32_t mipLevel) const
+{
+    const auto extent = GetMipRegionExtent(desc_.extent, mipLevel);
+    switch (GetType())
+    {
+        case TextureType::Texture3D:
+            return extent;
+        default:
+            return CalcTextureRegionExtent(GetType(), extent, desc_.arrayLayers);
+    }
+}
+
+void NullTexture::Write(const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc, std::size_t threadCount)
+{
+    const auto& subresource = textureRegion.subresource;
+    const auto  offset      = CalcTextureOffset(GetType(), textureRegion.offset, subresource.baseArrayLayer);
+    const auto  extent      = CalcTextureRegionExtent(GetType(), textureRegion.extent, subresource.numArrayLayers);
+    const auto  layout      = GetRegionLayout(subresource.baseMipLevel, offset, extent);
+    const auto& formatAttribs = GetFormatAttribs(desc_.format);
+
+    auto dst = mips_[subresource.baseMipLevel].data() + layout.offset;
+    auto dstSize = mips_[subresource.baseMipLevel].size() - layout.offset;
+
+    /* Convert color images directly into the MIP-map */
+    if (!IsCompressedFormat(desc_.format) && !IsDepthStencilFormat(desc_.format))
+    {
+        DstImageDescriptor dstImageDesc{ formatAttribs.format, formatAttribs.dataType, dst, dstSize };
+        {
+            dstImageDesc.rowStride      = static_cast<std::uint32_t>(layout.rowStride);
+            dstImageDesc.layerStride    = static_cast<std::uint32_t>(layout.layerStride);
+        }
+        if (ConvertImageBuffer(imageDesc, dstImageDesc, extent, threadCount))
+            return;
+    }
+
+    /* Copy image rows without conversion; strides are ignored for compressed formats */
+    std::size_t srcRowStride    = layout.rowSize;
+    std::size_t srcLayerStride  = layout.rowSize * layout.numRows;
+
+    if (!IsCompressedFormat(desc_.format))
+    {
+        if (imageDesc.rowStride > 0)
+            srcRowStride = imageDesc.rowStride;
+        srcLayerStride = (imageDesc.layerStride > 0 ? imageDesc.layerStride : srcRowStride * layout.numRows);
+    }
+
+    if (imageDesc.data == nullptr || imageDesc.dataSize < GetRequiredImageSize(layout.rowSize, layout.numRows, layout.numLayers, srcRowStride, srcLayerStride))
+        throw std::invalid_argument("source image data size is too small for the specified texture region");
+
+    CopyRegionRows(
+        dst, layout.rowStride, layout.layerStride,
+        reinterpret_cast<const char*>(imageDesc.data), srcRowStride, srcLayerStride,
+        layout.rowSize, layout.numRows, layout.numLayers
+    );
+}
+
+void NullTexture::Read(std::uint32_t mipLevel, const DstImageDescriptor& imageDesc, std::size_t threadCount) const
+{
+    const auto  extent          = GetMipExtent(mipLevel);
+    const auto  layout          = GetRegionLayout(mipLevel, Offset3D{}, extent);
+    const auto& formatAttribs   = GetFormatAttribs(desc_.format);
+    const auto& src             = mips_[mipLevel];
+
+    /* Convert color images directly into the output image */
+    if (!IsCompressedFormat(desc_.format) && !IsDepthStencilFormat(desc_.format))
+    {
+        const SrcImageDescriptor srcImageDesc{ formatAttribs.format, formatAttribs.dataType, src.data(), src.size() };
+        if (ConvertImageBuffer(srcImageDesc, imageDesc, extent, threadCount))
+            return;
+    }
+
+    /* Copy image rows without conversion; strides are ignored for compressed formats */
+    std::size_t dstRowStride    = layout.rowSize;
+    std::size_t dstLayerStride  = layout.rowSize * layout.numRows;
+
+    if (!IsCompressedFormat(desc_.format))
+    {
+        if (imageDesc.rowStride > 0)
+            dstRowStride = imageDesc.rowStride;
+        dstLayerStride = (imageDesc.layerStride > 0 ? imageDesc.layerStride : dstRowStride * layout.numRows);
+    }
+
+    if (imageDesc.data == nullptr || imageDesc.dataSize < GetRequiredImageSize(layout.rowSize, layout.numRows, layout.numLayers, dstRowStride, dstLayerStride))
+        throw std::invalid_argument("destination image data size is too small for the specified MIP-map");
+
+    CopyRegionRows(
+        reinterpret_cast<char*>(imageDesc.data), dstRowStride, dstLayerStride,
+        src.data(), layout.rowStride, layout.layerStride,
+        layout.rowSize, layout.numRows, layout.numLayers
+    );
+}
+
+void NullTexture::CopyFrom(
+    const TextureLocation&  dstLocation,
+    const NullTexture&      srcTexture,
+    const TextureLocation&  srcLocation,
+    const Extent3D&         extent)
+{
+    if (GetFormatAttribs(desc_.format).bitSize != GetFormatAttribs(srcTexture.desc_.format).bitSize)
+        throw std::invalid_argument("cannot copy texture region between formats of different size");
+
+    const auto dstOffset = CalcTextureOffset(GetType(), dstLocation.offset, dstLocation.arrayLayer);
+    const auto srcOffset = CalcTextureOffset(srcTexture.GetType(), srcLocation.offset, srcLocation.arrayLayer);
+
+    const auto dstLayout = GetRegionLayout(dstLocation.mipLevel, dstOffset, extent);
+    const auto srcLayout = srcTexture.GetRegionLayout(srcLocation.mipLevel, srcOffset, extent);
+
+    CopyRegionRows(
+        mips_[dstLocation.mipLevel].data() + dstLayout.offset, dstLayout.rowStride, dstLayout.layerStride,
+        srcTexture.mips_[srcLocation.mipLevel].data() + srcLayout.offset, srcLayout.rowStride, srcLayout.layerStride,
+        dstLayout.rowSize, dstLayout.numRows, dstLayout.numLayers
+    );
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+NullTexture::RegionLayout NullTexture::GetRegionLayout(std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent) const
+{
+    if (mipLevel >= desc_.mipLevels)
+        throw std::out_of_range("MIP-map level " + std::to_string(mipLevel) + " exceeds number of MIP-maps in texture");
+
+    /* Validate region against MIP-map extent */
+    const auto mipExtent = GetMipExtent(mipLevel);
+
+    if (offset.x < 0 || offset.y < 0 || offset.z < 0 ||
+        static_cast<std::uint32_t>(offset.x) + extent.width  > mipExtent.width  ||
+        static_cast<std::uint32_t>(offset.y) + extent.height > mipExtent.height ||
+        static_cast<std::uint32_t>(offset.z) + extent.depth  > mipExtent.depth)
+    {
+        throw std::out_of_range("texture region exceeds extent of MIP-map level " + std::to_string(mipLevel));
+    }
+
+    /* Determine memory layout in units of pixel blocks */
+    const auto& formatAttribs   = GetFormatAttribs(desc_.format);
+    const auto  blockWidth      = std::max(1u, static_cast<std::uint32_t>(formatAttribs.blockWidth));
+    const auto  blockHeight     = std::max(1u, static_cast<std::uint32_t>(formatAttribs.blockHeight));
+    const auto  blockSize       = static_cast<std::size_t>(formatAttribs.bitSize / 8);
+
+    RegionLayout layout;
+    {
+        layout.rowStride    = DivideRoundUp(mipExtent.width, blockWidth) * blockSize;
+        layout.layerStride  = DivideRoundUp(mipExtent.height, blockHeight) * layout.rowStride;
+        layout.offset       = (
+            static_cast<std::size_t>(offset.z) * layout.layerStride +
+            static_cast<std::size_t>(offset.y / blockHeight) * layout.rowStride +
+            static_cast<std::size_t>(offset.x / blockWidth) * blockSize
+        );
+        layout.rowSize      = DivideRoundUp(extent.width, blockWidth) * blockSize;
+        layout.numRows      = DivideRoundUp(extent.height, blockHeight);
+        layout.numLayers    = extent.depth;
+    }
+    return layout;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,86 @@
+/*
+ * NullTexture.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_TEXTURE_H
+#define LLGL_NULL_TEXTURE_H
+
+
+#include <LLGL/Texture.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/ImageFlags.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Texture whose MIP-maps are stored in host memory.
+Array layers are stored in the height extent for 1D array textures and in the depth extent for 2D array and cube textures,
+just like the extent returned by 'GetMipExtent'.
+*/
+class NullTexture final : public Texture
+{
+
+    public:
+
+        TextureDescriptor GetDesc() const override;
+
+        Extent3D GetMipExtent(std::uint32_t mipLevel) const override;
+
+    public:
+
+        NullTexture(const TextureDescriptor& desc);
+
+        // Writes the specified image into the region of this texture. Color images are converted into the texture format.
+        void Write(const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc, std::size_t threadCount = 0);
+
+        // Reads the entire specified MIP-map of this texture. Color images are converted into the output image format.
+        void Read(std::uint32_t mipLevel, const DstImageDescriptor& imageDesc, std::size_t threadCount = 0) const;
+
+        // Copies the specified region from the source texture into this texture.
+        void CopyFrom(
+            const TextureLocation&  dstLocation,
+            const NullTexture&      srcTexture,
+            const TextureLocation&  srcLocation,
+            const Extent3D&         extent
+        );
+
+    private:
+
+        // Memory layout of a region within a MIP-map.
+        struct RegionLayout
+        {
+            std::size_t offset      = 0;
+            std::size_t rowSize     = 0;
+            std::size_t numRows     = 0;
+            std::size_t numLayers   = 0;
+            std::size_t rowStride   = 0;
+            std::size_t layerStride = 0;
+        };
+
+    private:
+
+        RegionLayout GetRegionLayout(std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent) const;
+
+    private:
+
+        TextureDescriptor               desc_;
+        std::vector<std::vector<char>>  mips_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
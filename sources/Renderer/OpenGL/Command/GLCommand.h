@@ -11,6 +11,7 @@
 
 #include <LLGL/CommandBufferFlags.h>
 #include <LLGL/Types.h>
+#include <LLGL/IndirectArguments.h>
 #include "../RenderState/GLState.h"
 #include "../OpenGL.h"
 #include <cstdint>
@@ -344,6 +345,46 @@ struct GLCmdMultiDrawElementsIndirect
     GLsizei         stride;
 };
 
+struct GLCmdMultiDrawArraysIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
+struct GLCmdMultiDrawElementsIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    GLenum          type;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
+struct GLCmdMultiDrawArraysInstancedBaseInstance
+{
+    GLenum                          mode;
+    GLsizei                         drawcount;
+//  DrawIndirectArguments           draws[drawcount];
+};
+
+struct GLCmdMultiDrawElementsInstancedBaseVertexBaseInstance
+{
+    GLenum                          mode;
+    GLenum                          type;
+    GLintptr                        indexOffset;
+    GLintptr                        indexStride;
+    GLsizei                         drawcount;
+//  DrawIndexedIndirectArguments    draws[drawcount];
+};
+
 struct GLCmdDispatchCompute
 {
     GLuint numgroups[3];
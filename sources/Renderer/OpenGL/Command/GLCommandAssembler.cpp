@@ -237,6 +237,11 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.CallMember(&GLStateManager::BindRenderPass, g_stateMngrArg, cmd->renderTarget, cmd->renderPass, cmd->numClearValues, (cmd + 1), &(cmd->defaultClearValue));
             return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
         }
+        case GLOpcodeEndRenderPass:
+        {
+            compiler.CallMember(&GLStateManager::EndRenderPass, g_stateMngrArg);
+            return 0;
+        }
         case GLOpcodeBindGraphicsPipeline:
         {
             auto cmd = reinterpret_cast<const GLCmdBindGraphicsPipeline*>(pc);
@@ -374,6 +379,65 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             return sizeof(*cmd);
         }
         #endif // /GL_ARB_multi_draw_indirect
+        #ifdef GL_ARB_indirect_parameters
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirectCount*>(pc);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::PARAMETER_BUFFER, cmd->countId);
+            compiler.Call(glMultiDrawArraysIndirectCountARB, cmd->mode, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirectCount*>(pc);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::PARAMETER_BUFFER, cmd->countId);
+            compiler.Call(glMultiDrawElementsIndirectCountARB, cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            return sizeof(*cmd);
+        }
+        #endif // /GL_ARB_indirect_parameters
+        #ifdef GL_ARB_base_instance
+        case GLOpcodeMultiDrawArraysInstancedBaseInstance:
+        {
+            //TODO: generate loop in ASM
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysInstancedBaseInstance*>(pc);
+            auto draws = reinterpret_cast<const DrawIndirectArguments*>(cmd + 1);
+            for (GLsizei i = 0; i < cmd->drawcount; ++i)
+            {
+                compiler.Call(
+                    glDrawArraysInstancedBaseInstance,
+                    cmd->mode,
+                    static_cast<GLint>(draws[i].firstVertex),
+                    static_cast<GLsizei>(draws[i].numVertices),
+                    static_cast<GLsizei>(draws[i].numInstances),
+                    draws[i].firstInstance
+                );
+            }
+            return (sizeof(*cmd) + sizeof(DrawIndirectArguments)*cmd->drawcount);
+        }
+        case GLOpcodeMultiDrawElementsInstancedBaseVertexBaseInstance:
+        {
+            //TODO: generate loop in ASM
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsInstancedBaseVertexBaseInstance*>(pc);
+            auto draws = reinterpret_cast<const DrawIndexedIndirectArguments*>(cmd + 1);
+            for (GLsizei i = 0; i < cmd->drawcount; ++i)
+            {
+                const GLintptr indices = (cmd->indexOffset + draws[i].firstIndex * cmd->indexStride);
+                compiler.Call(
+                    glDrawElementsInstancedBaseVertexBaseInstance,
+                    cmd->mode,
+                    static_cast<GLsizei>(draws[i].numIndices),
+                    cmd->type,
+                    reinterpret_cast<const GLvoid*>(indices),
+                    static_cast<GLsizei>(draws[i].numInstances),
+                    draws[i].vertexOffset,
+                    draws[i].firstInstance
+                );
+            }
+            return (sizeof(*cmd) + sizeof(DrawIndexedIndirectArguments)*cmd->drawcount);
+        }
+        #endif // /GL_ARB_base_instance
         #ifdef GL_ARB_compute_shader
         case GLOpcodeDispatchCompute:
         {
@@ -243,6 +243,11 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             stateMngr.BindRenderPass(*(cmd->renderTarget), cmd->renderPass, cmd->numClearValues, reinterpret_cast<const ClearValue*>(cmd + 1), cmd->defaultClearValue);
             return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
         }
+        case GLOpcodeEndRenderPass:
+        {
+            stateMngr.EndRenderPass();
+            return 0;
+        }
         case GLOpcodeBindGraphicsPipeline:
         {
             auto cmd = reinterpret_cast<const GLCmdBindGraphicsPipeline*>(pc);
@@ -376,6 +381,61 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             return sizeof(*cmd);
         }
         #endif // /GL_ARB_multi_draw_indirect
+        #ifdef GL_ARB_indirect_parameters
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirectCount*>(pc);
+            stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+            stateMngr.BindBuffer(GLBufferTarget::PARAMETER_BUFFER, cmd->countId);
+            glMultiDrawArraysIndirectCountARB(cmd->mode, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirectCount*>(pc);
+            stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+            stateMngr.BindBuffer(GLBufferTarget::PARAMETER_BUFFER, cmd->countId);
+            glMultiDrawElementsIndirectCountARB(cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            return sizeof(*cmd);
+        }
+        #endif // /GL_ARB_indirect_parameters
+        #ifdef GL_ARB_base_instance
+        case GLOpcodeMultiDrawArraysInstancedBaseInstance:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysInstancedBaseInstance*>(pc);
+            auto draws = reinterpret_cast<const DrawIndirectArguments*>(cmd + 1);
+            for (GLsizei i = 0; i < cmd->drawcount; ++i)
+            {
+                glDrawArraysInstancedBaseInstance(
+                    cmd->mode,
+                    static_cast<GLint>(draws[i].firstVertex),
+                    static_cast<GLsizei>(draws[i].numVertices),
+                    static_cast<GLsizei>(draws[i].numInstances),
+                    draws[i].firstInstance
+                );
+            }
+            return (sizeof(*cmd) + sizeof(DrawIndirectArguments)*cmd->drawcount);
+        }
+        case GLOpcodeMultiDrawElementsInstancedBaseVertexBaseInstance:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsInstancedBaseVertexBaseInstance*>(pc);
+            auto draws = reinterpret_cast<const DrawIndexedIndirectArguments*>(cmd + 1);
+            for (GLsizei i = 0; i < cmd->drawcount; ++i)
+            {
+                const GLintptr indices = (cmd->indexOffset + draws[i].firstIndex * cmd->indexStride);
+                glDrawElementsInstancedBaseVertexBaseInstance(
+                    cmd->mode,
+                    static_cast<GLsizei>(draws[i].numIndices),
+                    cmd->type,
+                    reinterpret_cast<const GLvoid*>(indices),
+                    static_cast<GLsizei>(draws[i].numInstances),
+                    draws[i].vertexOffset,
+                    draws[i].firstInstance
+                );
+            }
+            return (sizeof(*cmd) + sizeof(DrawIndexedIndirectArguments)*cmd->drawcount);
+        }
+        #endif // /GL_ARB_base_instance
         #ifdef GL_ARB_compute_shader
         case GLOpcodeDispatchCompute:
         {
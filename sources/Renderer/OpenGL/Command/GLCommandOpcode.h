@@ -45,6 +45,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeEndTransformFeedbackNV,
     GLOpcodeBindResourceHeap,
     GLOpcodeBindRenderPass,
+    GLOpcodeEndRenderPass,
     GLOpcodeBindGraphicsPipeline,
     GLOpcodeBindComputePipeline,
     GLOpcodeSetUniforms,
@@ -64,6 +65,10 @@ enum GLOpcode : std::uint8_t
     GLOpcodeDrawElementsIndirect,
     GLOpcodeMultiDrawArraysIndirect,
     GLOpcodeMultiDrawElementsIndirect,
+    GLOpcodeMultiDrawArraysIndirectCount,
+    GLOpcodeMultiDrawElementsIndirectCount,
+    GLOpcodeMultiDrawArraysInstancedBaseInstance,
+    GLOpcodeMultiDrawElementsInstancedBaseVertexBaseInstance,
     GLOpcodeDispatchCompute,
     GLOpcodeDispatchComputeIndirect,
     GLOpcodeBindTexture,
@@ -28,7 +28,7 @@ GLCommandQueue::GLCommandQueue(const std::shared_ptr<GLStateManager>& stateManag
 
 /* ----- Command Buffers ----- */
 
-void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
+static void SubmitGLCommandBuffer(const CommandBuffer& commandBuffer, GLStateManager& stateMngr)
 {
     /*
     Only deferred command buffers can be submitted multiple times (via GLDeferredCommandBuffer),
@@ -38,10 +38,23 @@ void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
     if (!cmdBufferGL.IsImmediateCmdBuffer())
     {
         auto& deferredCmdBufferGL = LLGL_CAST(const GLDeferredCommandBuffer&, cmdBufferGL);
-        ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, *stateMngr_);
+        ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, stateMngr);
     }
 }
 
+void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    SubmitGLCommandBuffer(commandBuffer, *stateMngr_);
+}
+
+void GLCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Execute all command buffers back to back with the same state manager, so redundant state changes between them are filtered out */
+    auto& stateMngr = *stateMngr_;
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+        SubmitGLCommandBuffer(*commandBuffers[i], stateMngr);
+}
+
 /* ----- Queries ----- */
 
 static bool AreQueryResultsAvailable(GLQueryHeap& queryHeapGL, std::uint32_t firstQuery, std::uint32_t numQueries)
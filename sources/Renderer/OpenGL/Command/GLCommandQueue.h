@@ -29,6 +29,7 @@ class GLCommandQueue final : public CommandQueue
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
 
         /* ----- Queries ----- */
 
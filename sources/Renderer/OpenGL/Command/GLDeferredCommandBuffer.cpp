@@ -559,7 +559,7 @@ void GLDeferredCommandBuffer::BeginRenderPass(
 
 void GLDeferredCommandBuffer::EndRenderPass()
 {
-    // dummy
+    AllocOpCode(GLOpcodeEndRenderPass);
 }
 
 /* ----- Pipeline States ----- */
@@ -844,6 +844,80 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifndef __APPLE__
+    const GLintptr indirect = static_cast<GLintptr>(offset);
+    auto cmd = AllocCommand<GLCmdMultiDrawArraysIndirectCount>(GLOpcodeMultiDrawArraysIndirectCount);
+    {
+        cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+        cmd->countId        = LLGL_CAST(GLBuffer&, countBuffer).GetID();
+        cmd->mode           = renderState_.drawMode;
+        cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+        cmd->drawcount      = static_cast<GLintptr>(countOffset);
+        cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+        cmd->stride         = static_cast<GLsizei>(stride);
+    }
+    #else
+    ErrUnsupportedGLProc("glMultiDrawArraysIndirectCountARB");
+    #endif
+}
+
+void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifndef __APPLE__
+    const GLintptr indirect = static_cast<GLintptr>(offset);
+    auto cmd = AllocCommand<GLCmdMultiDrawElementsIndirectCount>(GLOpcodeMultiDrawElementsIndirectCount);
+    {
+        cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+        cmd->countId        = LLGL_CAST(GLBuffer&, countBuffer).GetID();
+        cmd->mode           = renderState_.drawMode;
+        cmd->type           = renderState_.indexBufferDataType;
+        cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+        cmd->drawcount      = static_cast<GLintptr>(countOffset);
+        cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+        cmd->stride         = static_cast<GLsizei>(stride);
+    }
+    #else
+    ErrUnsupportedGLProc("glMultiDrawElementsIndirectCountARB");
+    #endif
+}
+
+void GLDeferredCommandBuffer::MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws)
+{
+    #ifndef __APPLE__
+    /* Store all draw arguments in a single command to avoid per-draw command overhead */
+    const std::size_t drawsSize = sizeof(DrawIndirectArguments)*numDraws;
+    auto cmd = AllocCommand<GLCmdMultiDrawArraysInstancedBaseInstance>(GLOpcodeMultiDrawArraysInstancedBaseInstance, drawsSize);
+    {
+        cmd->mode       = renderState_.drawMode;
+        cmd->drawcount  = static_cast<GLsizei>(numDraws);
+        ::memcpy(cmd + 1, draws, drawsSize);
+    }
+    #else
+    ErrUnsupportedGLProc("glDrawArraysInstancedBaseInstance");
+    #endif
+}
+
+void GLDeferredCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    #ifndef __APPLE__
+    /* Store all draw arguments in a single command to avoid per-draw command overhead */
+    const std::size_t drawsSize = sizeof(DrawIndexedIndirectArguments)*numDraws;
+    auto cmd = AllocCommand<GLCmdMultiDrawElementsInstancedBaseVertexBaseInstance>(GLOpcodeMultiDrawElementsInstancedBaseVertexBaseInstance, drawsSize);
+    {
+        cmd->mode           = renderState_.drawMode;
+        cmd->type           = renderState_.indexBufferDataType;
+        cmd->indexOffset    = static_cast<GLintptr>(renderState_.indexBufferOffset);
+        cmd->indexStride    = static_cast<GLintptr>(renderState_.indexBufferStride);
+        cmd->drawcount      = static_cast<GLsizei>(numDraws);
+        ::memcpy(cmd + 1, draws, drawsSize);
+    }
+    #else
+    ErrUnsupportedGLProc("glDrawElementsInstancedBaseVertexBaseInstance");
+    #endif
+}
+
 /* ----- Compute ----- */
 
 void GLDeferredCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -474,7 +474,7 @@ void GLImmediateCommandBuffer::BeginRenderPass(
 
 void GLImmediateCommandBuffer::EndRenderPass()
 {
-    // dummy
+    stateMngr_->EndRenderPass();
 }
 
 /* ----- Pipeline States ----- */
@@ -749,6 +749,92 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifndef __APPLE__
+    /* Bind indirect argument buffer and parameter buffer */
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
+
+    auto& countBufferGL = LLGL_CAST(GLBuffer&, countBuffer);
+    stateMngr_->BindBuffer(GLBufferTarget::PARAMETER_BUFFER, countBufferGL.GetID());
+
+    const GLintptr indirect = static_cast<GLintptr>(offset);
+    glMultiDrawArraysIndirectCountARB(
+        renderState_.drawMode,
+        reinterpret_cast<const GLvoid*>(indirect),
+        static_cast<GLintptr>(countOffset),
+        static_cast<GLsizei>(maxNumCommands),
+        static_cast<GLsizei>(stride)
+    );
+    #else
+    ErrUnsupportedGLProc("glMultiDrawArraysIndirectCountARB");
+    #endif
+}
+
+void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifndef __APPLE__
+    /* Bind indirect argument buffer and parameter buffer */
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
+
+    auto& countBufferGL = LLGL_CAST(GLBuffer&, countBuffer);
+    stateMngr_->BindBuffer(GLBufferTarget::PARAMETER_BUFFER, countBufferGL.GetID());
+
+    const GLintptr indirect = static_cast<GLintptr>(offset);
+    glMultiDrawElementsIndirectCountARB(
+        renderState_.drawMode,
+        renderState_.indexBufferDataType,
+        reinterpret_cast<const GLvoid*>(indirect),
+        static_cast<GLintptr>(countOffset),
+        static_cast<GLsizei>(maxNumCommands),
+        static_cast<GLsizei>(stride)
+    );
+    #else
+    ErrUnsupportedGLProc("glMultiDrawElementsIndirectCountARB");
+    #endif
+}
+
+void GLImmediateCommandBuffer::MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws)
+{
+    #ifndef __APPLE__
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+    {
+        glDrawArraysInstancedBaseInstance(
+            renderState_.drawMode,
+            static_cast<GLint>(draws[i].firstVertex),
+            static_cast<GLsizei>(draws[i].numVertices),
+            static_cast<GLsizei>(draws[i].numInstances),
+            draws[i].firstInstance
+        );
+    }
+    #else
+    ErrUnsupportedGLProc("glDrawArraysInstancedBaseInstance");
+    #endif
+}
+
+void GLImmediateCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    #ifndef __APPLE__
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+    {
+        const GLintptr indices = (renderState_.indexBufferOffset + draws[i].firstIndex * renderState_.indexBufferStride);
+        glDrawElementsInstancedBaseVertexBaseInstance(
+            renderState_.drawMode,
+            static_cast<GLsizei>(draws[i].numIndices),
+            renderState_.indexBufferDataType,
+            reinterpret_cast<const GLvoid*>(indices),
+            static_cast<GLsizei>(draws[i].numInstances),
+            draws[i].vertexOffset,
+            draws[i].firstInstance
+        );
+    }
+    #else
+    ErrUnsupportedGLProc("glDrawElementsInstancedBaseVertexBaseInstance");
+    #endif
+}
+
 /* ----- Compute ----- */
 
 void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -626,6 +626,13 @@ static bool Load_GL_ARB_buffer_storage(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_map_buffer_range(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMapBufferRange         );
+    LOAD_GLPROC( glFlushMappedBufferRange );
+    return true;
+}
+
 static bool Load_GL_ARB_copy_buffer(bool usePlaceholder)
 {
     LOAD_GLPROC( glCopyBufferSubData );
@@ -679,6 +686,24 @@ static bool Load_GL_ARB_multi_draw_indirect(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_indirect_parameters(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMultiDrawArraysIndirectCountARB   );
+    LOAD_GLPROC( glMultiDrawElementsIndirectCountARB );
+    return true;
+}
+
+static bool Load_GL_ARB_invalidate_subdata(bool usePlaceholder)
+{
+    LOAD_GLPROC( glInvalidateTexSubImage    );
+    LOAD_GLPROC( glInvalidateTexImage       );
+    LOAD_GLPROC( glInvalidateBufferSubData  );
+    LOAD_GLPROC( glInvalidateBufferData     );
+    LOAD_GLPROC( glInvalidateFramebuffer    );
+    LOAD_GLPROC( glInvalidateSubFramebuffer );
+    return true;
+}
+
 static bool Load_GL_ARB_direct_state_access(bool usePlaceholder)
 {
     LOAD_GLPROC( glCreateTransformFeedbacks                 );
@@ -903,6 +928,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( EXT_transform_feedback           );
     ENABLE_GLEXT( ARB_sync                         );
     ENABLE_GLEXT( ARB_polygon_offset_clamp         );
+    ENABLE_GLEXT( ARB_map_buffer_range             );
     ENABLE_GLEXT( ARB_copy_buffer                  );
     ENABLE_GLEXT( ARB_draw_indirect                );
     ENABLE_GLEXT( ARB_multi_draw_indirect          );
@@ -912,6 +938,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( EXT_texture_array                );
     ENABLE_GLEXT( ARB_texture_cube_map_array       );
     ENABLE_GLEXT( ARB_geometry_shader4             );
+    ENABLE_GLEXT( ARB_pixel_buffer_object          );
 
     #undef ENABLE_GLEXT
 
@@ -967,6 +994,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
         extensions[ "GL_ARB_vertex_shader"        ] = false;
         extensions[ "GL_EXT_texture3D"            ] = false;
         extensions[ "GL_EXT_copy_texture"         ] = false;
+        extensions[ "GL_ARB_pixel_buffer_object"  ] = false;
     }
 
     /* Load hardware buffer extensions */
@@ -1032,6 +1060,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_texture_storage              );
     LOAD_GLEXT( ARB_texture_storage_multisample  );
     LOAD_GLEXT( ARB_buffer_storage               );
+    LOAD_GLEXT( ARB_map_buffer_range             );
     LOAD_GLEXT( ARB_copy_buffer                  );
     LOAD_GLEXT( ARB_copy_image                   );
     LOAD_GLEXT( ARB_polygon_offset_clamp         );
@@ -1040,6 +1069,8 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_clear_buffer_object          );
     LOAD_GLEXT( ARB_draw_indirect                );
     LOAD_GLEXT( ARB_multi_draw_indirect          );
+    LOAD_GLEXT( ARB_indirect_parameters          );
+    LOAD_GLEXT( ARB_invalidate_subdata           );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
     #endif
@@ -1052,6 +1083,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( NV_conservative_raster           );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
     ENABLE_GLEXT( ARB_pipeline_statistics_query    );
+    ENABLE_GLEXT( ARB_pixel_buffer_object          );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
@@ -471,6 +471,11 @@ DECL_GLPROC(PFNGLTEXSTORAGE3DMULTISAMPLEPROC,                       glTexStorage
 
 DECL_GLPROC(PFNGLBUFFERSTORAGEPROC,                                 glBufferStorage,                                void,           (GLenum, GLsizeiptr, const void*, GLbitfield));
 
+/* GL_ARB_map_buffer_range */
+
+DECL_GLPROC(PFNGLMAPBUFFERRANGEPROC,                                glMapBufferRange,                               void*,          (GLenum, GLintptr, GLsizeiptr, GLbitfield));
+DECL_GLPROC(PFNGLFLUSHMAPPEDBUFFERRANGEPROC,                        glFlushMappedBufferRange,                       void,           (GLenum, GLintptr, GLsizeiptr));
+
 /* GL_ARB_copy_buffer */
 
 DECL_GLPROC(PFNGLCOPYBUFFERSUBDATAPROC,                             glCopyBufferSubData,                            void,           (GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr));
@@ -508,6 +513,20 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINDIRECTPROC,                          glDrawElemen
 DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTPROC,                       glMultiDrawArraysIndirect,                      void,           (GLenum, const void*, GLsizei, GLsizei));
 DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTPROC,                     glMultiDrawElementsIndirect,                    void,           (GLenum, GLenum, const void*, GLsizei, GLsizei));
 
+/* GL_ARB_indirect_parameters */
+
+DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC,               glMultiDrawArraysIndirectCountARB,              void,           (GLenum, const void*, GLintptr, GLsizei, GLsizei));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC,             glMultiDrawElementsIndirectCountARB,            void,           (GLenum, GLenum, const void*, GLintptr, GLsizei, GLsizei));
+
+/* GL_ARB_invalidate_subdata */
+
+DECL_GLPROC(PFNGLINVALIDATETEXSUBIMAGEPROC,                         glInvalidateTexSubImage,                        void,           (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei));
+DECL_GLPROC(PFNGLINVALIDATETEXIMAGEPROC,                            glInvalidateTexImage,                           void,           (GLuint, GLint));
+DECL_GLPROC(PFNGLINVALIDATEBUFFERSUBDATAPROC,                       glInvalidateBufferSubData,                      void,           (GLuint, GLintptr, GLsizeiptr));
+DECL_GLPROC(PFNGLINVALIDATEBUFFERDATAPROC,                          glInvalidateBufferData,                         void,           (GLuint));
+DECL_GLPROC(PFNGLINVALIDATEFRAMEBUFFERPROC,                         glInvalidateFramebuffer,                        void,           (GLenum, GLsizei, const GLenum*));
+DECL_GLPROC(PFNGLINVALIDATESUBFRAMEBUFFERPROC,                      glInvalidateSubFramebuffer,                     void,           (GLenum, GLsizei, const GLenum*, GLint, GLint, GLsizei, GLsizei));
+
 /* GL_ARB_direct_state_access */
 
 DECL_GLPROC(PFNGLCREATETRANSFORMFEEDBACKSPROC,                      glCreateTransformFeedbacks,                     void,           (GLsizei, GLuint*));
@@ -0,0 +1,205 @@
+/*
+ * GLLoaderThread.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLLoaderThread.h"
+#include "RenderState/GLStateManager.h"
+#include "Ext/GLExtensions.h"
+#include "../../Core/Helper.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Handoff functions of the task that is currently executed on the loader thread, or null on all other threads.
+thread_local static std::vector<GLLoaderThread::Handoff>* g_currentHandoffs = nullptr;
+
+GLLoaderThread::GLLoaderThread(std::unique_ptr<GLContext>&& context) :
+    context_ { std::move(context)                   },
+    thread_  { &GLLoaderThread::Run, this           }
+{
+}
+
+GLLoaderThread::~GLLoaderThread()
+{
+    /* Stop thread after the current task; remaining tasks are discarded */
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        quit_ = true;
+    }
+    taskSignal_.notify_one();
+    thread_.join();
+}
+
+std::uint64_t GLLoaderThread::Enqueue(const Task& task)
+{
+    std::uint64_t id = 0;
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        id = nextID_++;
+        PendingTask pendingTask;
+        {
+            pendingTask.id      = id;
+            pendingTask.task    = task;
+        }
+        pending_.push_back(std::move(pendingTask));
+    }
+    taskSignal_.notify_one();
+    return id;
+}
+
+bool GLLoaderThread::Query(std::uint64_t taskID, bool wait)
+{
+    auto FindFinishedTask = [this, taskID]() -> std::vector<FinishedTask>::iterator
+    {
+        return std::find_if(
+            finished_.begin(),
+            finished_.end(),
+            [taskID](const FinishedTask& entry)
+            {
+                return (entry.id == taskID);
+            }
+        );
+    };
+
+    GLFence* fence = nullptr;
+    {
+        std::unique_lock<std::mutex> lock { mutex_ };
+
+        auto IsTaskInProgress = [this, taskID]() -> bool
+        {
+            if (runningID_ == taskID)
+                return true;
+            return std::any_of(
+                pending_.begin(),
+                pending_.end(),
+                [taskID](const PendingTask& entry)
+                {
+                    return (entry.id == taskID);
+                }
+            );
+        };
+
+        /* Wait until the loader thread has finished the task */
+        if (wait)
+            finishSignal_.wait(lock, [&]() { return !IsTaskInProgress(); });
+        else if (IsTaskInProgress())
+            return false;
+
+        /* Unknown identifiers are considered to be completed */
+        auto it = FindFinishedTask();
+        if (it == finished_.end())
+            return true;
+
+        fence = it->fence.get();
+    }
+
+    /*
+    Wait until the GPU has executed the GL commands of the task without holding the lock, so the loader thread can continue with other tasks.
+    The fence remains valid, since finished tasks are only removed by this function, which is called on a single thread.
+    */
+    if (fence != nullptr && !fence->Wait(wait ? GL_TIMEOUT_IGNORED : 0))
+        return false;
+
+    FinishedTask finishedTask;
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        auto it = FindFinishedTask();
+        finishedTask = std::move(*it);
+        finished_.erase(it);
+    }
+
+    /* Hand off the objects that cannot be shared between GL contexts, then forward the exception of the task */
+    for (const auto& handoff : finishedTask.handoffs)
+        handoff();
+
+    if (finishedTask.exception)
+        std::rethrow_exception(finishedTask.exception);
+
+    return true;
+}
+
+bool GLLoaderThread::IsCurrent()
+{
+    return (g_currentHandoffs != nullptr);
+}
+
+void GLLoaderThread::DeferHandoff(const Handoff& handoff)
+{
+    if (g_currentHandoffs != nullptr)
+        g_currentHandoffs->push_back(handoff);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLLoaderThread::Run()
+{
+    GLContext::MakeCurrent(context_.get());
+    GLStateManager::Get().DetermineExtensionsAndLimits();
+
+    /* Use byte-alignment for pixel storage, just like the render contexts */
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    for (;;)
+    {
+        /* Wait for next task */
+        PendingTask pendingTask;
+        {
+            std::unique_lock<std::mutex> lock { mutex_ };
+            taskSignal_.wait(lock, [this]() { return (quit_ || !pending_.empty()); });
+
+            if (quit_)
+                break;
+
+            pendingTask = std::move(pending_.front());
+            pending_.pop_front();
+            runningID_ = pendingTask.id;
+        }
+
+        FinishedTask finishedTask;
+        finishedTask.id = pendingTask.id;
+
+        /* Objects might have been deleted or recreated by other contexts since the previous task */
+        GLStateManager::Get().ResetBindings();
+
+        /* Execute task and submit a fence, which is flushed so it can be waited on by other contexts */
+        g_currentHandoffs = &(finishedTask.handoffs);
+        try
+        {
+            pendingTask.task();
+        }
+        catch (...)
+        {
+            finishedTask.exception = std::current_exception();
+        }
+        g_currentHandoffs = nullptr;
+
+        finishedTask.fence = MakeUnique<GLFence>();
+        finishedTask.fence->Submit();
+        glFlush();
+
+        {
+            std::lock_guard<std::mutex> guard { mutex_ };
+            finished_.push_back(std::move(finishedTask));
+            runningID_ = 0;
+        }
+        finishSignal_.notify_all();
+    }
+
+    GLContext::MakeCurrent(nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
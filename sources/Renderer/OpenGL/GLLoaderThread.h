@@ -0,0 +1,112 @@
+/*
+ * GLLoaderThread.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_LOADER_THREAD_H
+#define LLGL_GL_LOADER_THREAD_H
+
+
+#include "Platform/GLContext.h"
+#include "RenderState/GLFence.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Background thread that executes resource loading tasks with a GL context that shares all objects with the render contexts.
+class GLLoaderThread
+{
+
+    public:
+
+        using Task      = std::function<void()>;
+        using Handoff   = std::function<void()>;
+
+    public:
+
+        GLLoaderThread(std::unique_ptr<GLContext>&& context);
+        ~GLLoaderThread();
+
+        GLLoaderThread(const GLLoaderThread&) = delete;
+        GLLoaderThread& operator = (const GLLoaderThread&) = delete;
+
+        // Enqueues the specified task and returns its identifier.
+        std::uint64_t Enqueue(const Task& task);
+
+        /*
+        Returns true if the specified task has been completed and its GL commands have been executed.
+        Runs the handoff functions of the task and forwards its exception on the calling thread.
+        Must always be called on the same thread (see RenderSystem::QueryLoadTask).
+        */
+        bool Query(std::uint64_t taskID, bool wait);
+
+        // Returns true if the calling thread is a loader thread.
+        static bool IsCurrent();
+
+        /*
+        Defers the specified function to the thread that queries the completion of the current task.
+        This is used for objects that cannot be shared between GL contexts, e.g. vertex array objects.
+        Must only be called on a loader thread.
+        */
+        static void DeferHandoff(const Handoff& handoff);
+
+    private:
+
+        struct PendingTask
+        {
+            std::uint64_t           id      = 0;
+            Task                    task;
+        };
+
+        struct FinishedTask
+        {
+            std::uint64_t           id      = 0;
+            std::unique_ptr<GLFence> fence;
+            std::vector<Handoff>    handoffs;
+            std::exception_ptr      exception;
+        };
+
+    private:
+
+        void Run();
+
+    private:
+
+        std::unique_ptr<GLContext>  context_;
+
+        std::mutex                  mutex_;
+        std::condition_variable     taskSignal_;
+        std::condition_variable     finishSignal_;
+
+        std::deque<PendingTask>     pending_;
+        std::vector<FinishedTask>   finished_;
+        std::uint64_t               runningID_  = 0;
+        std::uint64_t               nextID_     = 1;
+        bool                        quit_       = false;
+
+        std::thread                 thread_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
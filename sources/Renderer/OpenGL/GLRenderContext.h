@@ -60,6 +60,11 @@ class GLRenderContext final : public RenderContext
             return stateMngr_;
         }
 
+        inline GLContext& GetGLContext() const
+        {
+            return *context_;
+        }
+
     private:
 
         struct RenderState
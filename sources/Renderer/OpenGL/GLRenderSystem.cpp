@@ -23,6 +23,7 @@
 #include "GLRenderingCaps.h"
 #include "Command/GLImmediateCommandBuffer.h"
 #include "Command/GLDeferredCommandBuffer.h"
+#include <LLGL/Log.h>
 
 
 namespace LLGL
@@ -40,7 +41,12 @@ GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
 
 GLRenderSystem::~GLRenderSystem()
 {
+    /* Stop loader thread before any object it might refer to is deleted */
+    loaderThread_.reset();
+
     /* Clear all render state containers first, the rest will be deleted automatically */
+    readbackQueue_.Clear();
+    uploadRing_.Clear();
     GLMipGenerator::Get().Clear();
     GLStatePool::Get().Clear();
 }
@@ -166,8 +172,22 @@ GLBuffer* GLRenderSystem::CreateGLBuffer(const BufferDescriptor& desc, const voi
         auto bufferGL = MakeUnique<GLBufferWithVAO>(desc.bindFlags);
         {
             GLBufferStorage(*bufferGL, desc, initialData);
-            bufferGL->BuildVertexArray(desc.vertexAttribs.size(), desc.vertexAttribs.data());
+            if (GLLoaderThread::IsCurrent())
+            {
+                /* Vertex array objects are not shared between GL contexts, so build it on the thread that queries the load task */
+                auto vertexBuffer   = bufferGL.get();
+                auto vertexAttribs  = desc.vertexAttribs;
+                GLLoaderThread::DeferHandoff(
+                    [vertexBuffer, vertexAttribs]()
+                    {
+                        vertexBuffer->BuildVertexArray(vertexAttribs.size(), vertexAttribs.data());
+                    }
+                );
+            }
+            else
+                bufferGL->BuildVertexArray(desc.vertexAttribs.size(), desc.vertexAttribs.data());
         }
+        std::lock_guard<std::mutex> guard { objectMutex_ };
         return TakeOwnership(buffers_, std::move(bufferGL));
     }
     else
@@ -177,6 +197,7 @@ GLBuffer* GLRenderSystem::CreateGLBuffer(const BufferDescriptor& desc, const voi
         {
             GLBufferStorage(*bufferGL, desc, initialData);
         }
+        std::lock_guard<std::mutex> guard { objectMutex_ };
         return TakeOwnership(buffers_, std::move(bufferGL));
     }
 }
@@ -199,6 +220,7 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    std::lock_guard<std::mutex> guard { objectMutex_ };
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
@@ -235,8 +257,154 @@ static GLint GetGlTextureMinFilter(const TextureDescriptor& textureDesc)
         return GL_LINEAR;
 }
 
+// Returns the GL pixel store values (in pixels and rows) for the specified image strides (in bytes).
+static void GetGLPixelStoreStrides(
+    TextureType     textureType,
+    ImageFormat     format,
+    DataType        dataType,
+    std::uint32_t   width,
+    std::uint32_t   rowStride,
+    std::uint32_t   layerStride,
+    GLint&          rowLength,
+    GLint&          imageHeight)
+{
+    rowLength   = 0;
+    imageHeight = 0;
+
+    /* Strides are ignored for compressed formats */
+    if (IsCompressedFormat(format))
+        return;
+
+    /* Array layers of 1D array textures are stored as rows in GL */
+    if (textureType == TextureType::Texture1DArray && layerStride != 0)
+    {
+        rowStride   = layerStride;
+        layerStride = 0;
+    }
+
+    const auto bytesPerPixel = ImageDataSize(format, dataType, 1);
+
+    if (rowStride != 0)
+    {
+        if (rowStride % bytesPerPixel != 0)
+            throw std::invalid_argument("image row stride must be a multiple of the pixel size");
+        rowLength = static_cast<GLint>(rowStride / bytesPerPixel);
+    }
+
+    /* Faces of cube textures are uploaded separately, so their layer stride is handled by GLTexImageCube */
+    if (layerStride != 0 && textureType != TextureType::TextureCube)
+    {
+        const auto rowSize = (rowStride != 0 ? rowStride : bytesPerPixel * width);
+        if (rowSize == 0 || layerStride % rowSize != 0)
+            throw std::invalid_argument("image layer stride must be a multiple of the row stride");
+        imageHeight = static_cast<GLint>(layerStride / rowSize);
+    }
+}
+
+// Sets the GL unpack state for the strides of the specified source image. Returns true if the state must be reset afterwards.
+static bool GLSetUnpackStrides(TextureType textureType, std::uint32_t width, const SrcImageDescriptor& imageDesc)
+{
+    GLint rowLength = 0, imageHeight = 0;
+    GetGLPixelStoreStrides(textureType, imageDesc.format, imageDesc.dataType, width, imageDesc.rowStride, imageDesc.layerStride, rowLength, imageHeight);
+
+    if (rowLength != 0)
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+    if (imageHeight != 0)
+        glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, imageHeight);
+
+    return (rowLength != 0 || imageHeight != 0);
+}
+
+static void GLResetUnpackStrides()
+{
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+}
+
+// Sets the GL pack state for the strides of the specified destination image. Returns true if the state must be reset afterwards.
+static bool GLSetPackStrides(TextureType textureType, std::uint32_t width, const DstImageDescriptor& imageDesc)
+{
+    GLint rowLength = 0, imageHeight = 0;
+    GetGLPixelStoreStrides(textureType, imageDesc.format, imageDesc.dataType, width, imageDesc.rowStride, imageDesc.layerStride, rowLength, imageHeight);
+
+    if (rowLength != 0)
+        glPixelStorei(GL_PACK_ROW_LENGTH, rowLength);
+    if (imageHeight != 0)
+        glPixelStorei(GL_PACK_IMAGE_HEIGHT, imageHeight);
+
+    return (rowLength != 0 || imageHeight != 0);
+}
+
+static void GLResetPackStrides()
+{
+    glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_PACK_IMAGE_HEIGHT, 0);
+}
+
+// Throws an exception if the destination image is too small for the specified extent with the row and layer strides of the image.
+static void GLValidateReadImageSize(TextureType textureType, const Extent3D& extent, const DstImageDescriptor& imageDesc)
+{
+    /* Strides are ignored for compressed formats */
+    if (IsCompressedFormat(imageDesc.format) || extent.width == 0 || extent.height == 0 || extent.depth == 0)
+        return;
+
+    const std::size_t rowSize       = ImageDataSize(imageDesc.format, imageDesc.dataType, extent.width);
+    std::size_t       rowStride     = (imageDesc.rowStride > 0 ? imageDesc.rowStride : rowSize);
+    std::size_t       layerStride   = (imageDesc.layerStride > 0 ? imageDesc.layerStride : rowStride * extent.height);
+
+    /* Array layers of 1D array textures are stored as rows in GL (see GetGLPixelStoreStrides) */
+    if (textureType == TextureType::Texture1DArray && imageDesc.layerStride > 0)
+        rowStride = imageDesc.layerStride;
+
+    const auto requiredSize = (extent.depth - 1) * layerStride + (extent.height - 1) * rowStride + rowSize;
+    if (imageDesc.dataSize < requiredSize)
+        throw std::invalid_argument("image data size is too small for texture read with the specified row and layer strides");
+}
+
+// Decompresses the specified block compressed image into the image format and data type of the uncompressed fallback format.
+static SrcImageDescriptor DecompressSrcImage(
+    const SrcImageDescriptor&   imageDesc,
+    const Format                decompressedFormat,
+    const Extent3D&             extent,
+    std::size_t                 threadCount,
+    ByteBuffer&                 outputBuffer)
+{
+    const auto& formatAttribs = GetFormatAttribs(decompressedFormat);
+    outputBuffer = ConvertImageBuffer(GetDecompressionSrcDesc(imageDesc, decompressedFormat), formatAttribs.format, formatAttribs.dataType, extent, threadCount);
+    return SrcImageDescriptor
+    {
+        formatAttribs.format,
+        formatAttribs.dataType,
+        outputBuffer.get(),
+        ImageDataSize(formatAttribs.format, formatAttribs.dataType, extent.width * extent.height * extent.depth)
+    };
+}
+
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
+    /* Create texture with uncompressed format if the block compressed format is not supported by the device */
+    if (MustDecompressFormat(textureDesc.format, GetRenderingCaps().textureFormats))
+    {
+        auto fallbackDesc = textureDesc;
+        fallbackDesc.format = GetDecompressedFormat(textureDesc.format);
+
+        if (imageDesc != nullptr)
+        {
+            const Extent3D imageExtent
+            {
+                textureDesc.extent.width,
+                textureDesc.extent.height,
+                TextureSize(textureDesc) / std::max(1u, textureDesc.extent.width * textureDesc.extent.height)
+            };
+
+            ByteBuffer decompressedData;
+            auto decompressedImageDesc = DecompressSrcImage(*imageDesc, fallbackDesc.format, imageExtent, GetConfiguration().threadCount, decompressedData);
+            return CreateTexture(fallbackDesc, &decompressedImageDesc);
+        }
+
+        return CreateTexture(fallbackDesc, nullptr);
+    }
+
     auto texture = MakeUnique<GLTexture>(textureDesc);
 
     /* Bind texture */
@@ -267,6 +435,9 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     }
     #endif
 
+    /* Set pixel store strides for the initial image data */
+    const bool resetStrides = (imageDesc != nullptr && GLSetUnpackStrides(textureDesc.type, textureDesc.extent.width, *imageDesc));
+
     /* Build texture storage and upload image dataa */
     switch (textureDesc.type)
     {
@@ -318,10 +489,14 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             break;
     }
 
+    if (resetStrides)
+        GLResetUnpackStrides();
+
     /* Generate MIP-maps if enabled */
     if (imageDesc != nullptr && MustGenerateMipsOnCreate(textureDesc))
         GLMipGenerator::Get().GenerateMips(textureDesc.type);
 
+    std::lock_guard<std::mutex> guard { objectMutex_ };
     return TakeOwnership(textures_, std::move(texture));
 }
 
@@ -357,6 +532,11 @@ Texture* GLRenderSystem::CreateTextureView(Texture& sharedTexture, const Texture
 
 void GLRenderSystem::Release(Texture& texture)
 {
+    /* Issue pending uploads, since they might refer to this texture */
+    if (!GLLoaderThread::IsCurrent())
+        uploadRing_.Flush();
+
+    std::lock_guard<std::mutex> guard { objectMutex_ };
     RemoveFromUniqueSet(textures_, &texture);
 }
 
@@ -364,49 +544,47 @@ void GLRenderSystem::Release(Texture& texture)
 
 void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
 {
-    /* Bind texture and write texture sub data */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
-    GLStateManager::Get().BindGLTexture(textureGL);
 
-    /* Write data into specific texture type */
-    switch (texture.GetType())
+    /* Decompress block compressed image if the texture was created with an uncompressed fallback format */
+    const auto textureFormat = GLTypes::UnmapFormat(textureGL.GetInternalFormat());
+    if (IsCompressedFormat(imageDesc.format) && !IsCompressedFormat(textureFormat))
     {
-        case TextureType::Texture1D:
-            GLTexSubImage1D(textureRegion, imageDesc);
-            break;
-
-        case TextureType::Texture2D:
-            GLTexSubImage2D(textureRegion, imageDesc);
-            break;
+        const Extent3D imageExtent
+        {
+            textureRegion.extent.width,
+            textureRegion.extent.height,
+            textureRegion.extent.depth * textureRegion.subresource.numArrayLayers
+        };
+
+        ByteBuffer decompressedData;
+        auto decompressedImageDesc = DecompressSrcImage(imageDesc, textureFormat, imageExtent, GetConfiguration().threadCount, decompressedData);
+        WriteTexture(texture, textureRegion, decompressedImageDesc);
+        return;
+    }
 
-        case TextureType::Texture3D:
-            LLGL_ASSERT_FEATURE_SUPPORT(has3DTextures);
-            GLTexSubImage3D(textureRegion, imageDesc);
-            break;
+    /* Upload image through the pixel unpack buffer ring if possible */
+    if (auto uploadID = WriteTextureFromUploadRing(textureGL, textureRegion, imageDesc, false))
+    {
+        uploadRing_.Query(uploadID, true);
+        return;
+    }
 
-        case TextureType::TextureCube:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeTextures);
-            GLTexSubImageCube(textureRegion, imageDesc);
-            break;
+    /* Issue pending uploads of the ring first, so this upload cannot overtake them */
+    if (!GLLoaderThread::IsCurrent())
+        uploadRing_.Flush();
 
-        case TextureType::Texture1DArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexSubImage1DArray(textureRegion, imageDesc);
-            break;
+    /* Bind texture and write texture sub data */
+    GLStateManager::Get().BindGLTexture(textureGL);
 
-        case TextureType::Texture2DArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexSubImage2DArray(textureRegion, imageDesc);
-            break;
+    /* Set pixel store strides for the source image data */
+    const bool resetStrides = GLSetUnpackStrides(texture.GetType(), textureRegion.extent.width, imageDesc);
 
-        case TextureType::TextureCubeArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeArrayTextures);
-            GLTexSubImageCubeArray(textureRegion, imageDesc);
-            break;
+    /* Write data into specific texture type */
+    WriteTextureSubImage(texture.GetType(), textureRegion, imageDesc);
 
-        default:
-            break;
-    }
+    if (resetStrides)
+        GLResetUnpackStrides();
 }
 
 void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
@@ -415,6 +593,13 @@ void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel,
 
     auto& textureGL = LLGL_CAST(const GLTexture&, texture);
 
+    /* Validate output data size before the pixel store state is modified */
+    const auto extent = textureGL.GetMipExtent(mipLevel);
+    GLValidateReadImageSize(textureGL.GetType(), extent, imageDesc);
+
+    /* Set pixel store strides for the destination image data */
+    const bool resetStrides = GLSetPackStrides(textureGL.GetType(), extent.width, imageDesc);
+
     /* Read image data from texture */
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
@@ -441,6 +626,44 @@ void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel,
             imageDesc.data
         );
     }
+
+    if (resetStrides)
+        GLResetPackStrides();
+}
+
+std::uint64_t GLRenderSystem::WriteTextureAsync(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
+{
+    /* Convert source image on a worker thread if it can be uploaded through the pixel unpack buffer ring */
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    if (auto writeID = WriteTextureFromUploadRing(textureGL, textureRegion, imageDesc, true))
+        return writeID;
+
+    /* Otherwise, write texture immediately and return identifier of a completed operation */
+    WriteTexture(texture, textureRegion, imageDesc);
+    return (GLLoaderThread::IsCurrent() ? 1 : uploadRing_.GenerateCompletedID());
+}
+
+bool GLRenderSystem::QueryTextureWrite(std::uint64_t writeID, bool wait)
+{
+    /* Upload ring belongs to the render thread; the loader thread only writes textures immediately */
+    if (GLLoaderThread::IsCurrent())
+        return true;
+    return uploadRing_.Query(writeID, wait);
+}
+
+std::uint64_t GLRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
+{
+    /* Fall back to synchronous texture read if pixel pack buffers are not supported */
+    if (!HasExtension(GLExt::ARB_pixel_buffer_object))
+        return RenderSystem::ReadTextureAsync(texture, mipLevel, imageDesc);
+
+    auto& textureGL = LLGL_CAST(const GLTexture&, texture);
+    return readbackQueue_.ReadTexture(textureGL, mipLevel, imageDesc, GetConfiguration().threadCount);
+}
+
+bool GLRenderSystem::QueryTextureRead(std::uint64_t readID, bool wait)
+{
+    return readbackQueue_.Query(readID, wait);
 }
 
 /* ----- Sampler States ---- */
@@ -450,11 +673,13 @@ Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& desc)
     LLGL_ASSERT_FEATURE_SUPPORT(hasSamplers);
     auto sampler = MakeUnique<GLSampler>();
     sampler->SetDesc(desc);
+    std::lock_guard<std::mutex> guard { objectMutex_ };
     return TakeOwnership(samplers_, std::move(sampler));
 }
 
 void GLRenderSystem::Release(Sampler& sampler)
 {
+    std::lock_guard<std::mutex> guard { objectMutex_ };
     RemoveFromUniqueSet(samplers_, &sampler);
 }
 
@@ -521,22 +746,28 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& desc)
     }
 
     /* Make and return shader object */
-    return TakeOwnership(shaders_, MakeUnique<GLShader>(desc));
+    auto shader = MakeUnique<GLShader>(desc);
+    std::lock_guard<std::mutex> guard { objectMutex_ };
+    return TakeOwnership(shaders_, std::move(shader));
 }
 
 ShaderProgram* GLRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
 {
     AssertCreateShaderProgram(desc);
-    return TakeOwnership(shaderPrograms_, MakeUnique<GLShaderProgram>(desc));
+    auto shaderProgram = MakeUnique<GLShaderProgram>(desc);
+    std::lock_guard<std::mutex> guard { objectMutex_ };
+    return TakeOwnership(shaderPrograms_, std::move(shaderProgram));
 }
 
 void GLRenderSystem::Release(Shader& shader)
 {
+    std::lock_guard<std::mutex> guard { objectMutex_ };
     RemoveFromUniqueSet(shaders_, &shader);
 }
 
 void GLRenderSystem::Release(ShaderProgram& shaderProgram)
 {
+    std::lock_guard<std::mutex> guard { objectMutex_ };
     RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
 }
 
@@ -544,12 +775,19 @@ void GLRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* GLRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return TakeOwnership(pipelineLayouts_, MakeUnique<GLPipelineLayout>(desc));
+    /* Share pipeline layout with identical bindings */
+    if (auto pipelineLayout = pipelineLayoutCache_.Find(desc))
+        return pipelineLayout;
+
+    auto pipelineLayout = TakeOwnership(pipelineLayouts_, MakeUnique<GLPipelineLayout>(desc));
+    pipelineLayoutCache_.Insert(desc, pipelineLayout);
+    return pipelineLayout;
 }
 
 void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
-    RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
+    if (pipelineLayoutCache_.Release(&pipelineLayout))
+        RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
 /* ----- Pipeline States ----- */
@@ -598,6 +836,23 @@ void GLRenderSystem::Release(Fence& fence)
     RemoveFromUniqueSet(fences_, &fence);
 }
 
+/* ----- Background loading ----- */
+
+std::uint64_t GLRenderSystem::EnqueueLoadTask(const LoadTaskFunction& task)
+{
+    /* Execute task immediately if there is no loader thread */
+    if (!loaderThread_)
+        return RenderSystem::EnqueueLoadTask(task);
+    return loaderThread_->Enqueue([this, task]() { task(*this); });
+}
+
+bool GLRenderSystem::QueryLoadTask(std::uint64_t taskID, bool wait)
+{
+    if (!loaderThread_)
+        return RenderSystem::QueryLoadTask(taskID, wait);
+    return loaderThread_->Query(taskID, wait);
+}
+
 
 /*
  * ======= Protected: =======
@@ -607,7 +862,11 @@ RenderContext* GLRenderSystem::AddRenderContext(std::unique_ptr<GLRenderContext>
 {
     /* Create devices that require an active GL context */
     if (renderContexts_.empty())
+    {
         CreateGLContextDependentDevices(*renderContext);
+        if (config_.backgroundLoader)
+            CreateLoaderThread(*renderContext);
+    }
 
     /* Use uniform clipping space */
     GLStateManager::Get().DetermineExtensionsAndLimits();
@@ -637,6 +896,20 @@ void GLRenderSystem::CreateGLContextDependentDevices(GLRenderContext& renderCont
     commandQueue_ = MakeUnique<GLCommandQueue>(renderContext.GetStateManager());
 }
 
+void GLRenderSystem::CreateLoaderThread(GLRenderContext& renderContext)
+{
+    /* Create GL context that shares its objects with the first render context; fall back to synchronous loading on failure */
+    try
+    {
+        if (auto loaderContext = GLContext::CreateLoaderContext(renderContext.GetGLContext()))
+            loaderThread_ = MakeUnique<GLLoaderThread>(std::move(loaderContext));
+    }
+    catch (const std::exception& e)
+    {
+        Log::PostReport(Log::ReportType::Warning, std::string("failed to create background loader: ") + e.what());
+    }
+}
+
 void GLRenderSystem::LoadGLExtensions(bool hasGLCoreProfile)
 {
     /* Load OpenGL extensions if not already done */
@@ -716,6 +989,79 @@ void GLRenderSystem::QueryRenderingCaps()
     SetRenderingCaps(caps);
 }
 
+void GLRenderSystem::WriteTextureSubImage(const TextureType type, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
+{
+    switch (type)
+    {
+        case TextureType::Texture1D:
+            GLTexSubImage1D(textureRegion, imageDesc);
+            break;
+
+        case TextureType::Texture2D:
+            GLTexSubImage2D(textureRegion, imageDesc);
+            break;
+
+        case TextureType::Texture3D:
+            LLGL_ASSERT_FEATURE_SUPPORT(has3DTextures);
+            GLTexSubImage3D(textureRegion, imageDesc);
+            break;
+
+        case TextureType::TextureCube:
+            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeTextures);
+            GLTexSubImageCube(textureRegion, imageDesc);
+            break;
+
+        case TextureType::Texture1DArray:
+            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
+            GLTexSubImage1DArray(textureRegion, imageDesc);
+            break;
+
+        case TextureType::Texture2DArray:
+            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
+            GLTexSubImage2DArray(textureRegion, imageDesc);
+            break;
+
+        case TextureType::TextureCubeArray:
+            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeArrayTextures);
+            GLTexSubImageCubeArray(textureRegion, imageDesc);
+            break;
+
+        default:
+            break;
+    }
+}
+
+std::uint64_t GLRenderSystem::WriteTextureFromUploadRing(GLTexture& textureGL, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc, bool async)
+{
+    if (IsCompressedFormat(imageDesc.format) || IsDepthStencilFormat(imageDesc.format) || !GLUploadRing::IsSupported())
+        return 0;
+
+    /* Upload ring belongs to the render thread */
+    if (GLLoaderThread::IsCurrent())
+        return 0;
+
+    /* Convert image into the native texture format, so the GL driver does not have to convert it on the render thread */
+    ImageFormat dstFormat   = imageDesc.format;
+    DataType    dstDataType = imageDesc.dataType;
+    textureGL.GetNativeImageFormat(dstFormat, dstDataType);
+
+    const Extent3D imageExtent
+    {
+        textureRegion.extent.width,
+        textureRegion.extent.height,
+        textureRegion.extent.depth * textureRegion.subresource.numArrayLayers
+    };
+
+    /* Upload image from the ring buffer offset once the conversion has finished */
+    auto uploadCommand = [this, &textureGL, textureRegion](const SrcImageDescriptor& bufferImageDesc)
+    {
+        GLStateManager::Get().BindGLTexture(textureGL);
+        WriteTextureSubImage(textureGL.GetType(), textureRegion, bufferImageDesc);
+    };
+
+    return uploadRing_.Enqueue(imageDesc, dstFormat, dstDataType, imageExtent, GetConfiguration().threadCount, uploadCommand, async);
+}
+
 
 } // /namespace LLGL
 
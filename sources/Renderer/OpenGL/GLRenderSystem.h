@@ -12,10 +12,12 @@
 #include <LLGL/RenderSystem.h>
 #include "Ext/GLExtensionLoader.h"
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
 
 #include "Command/GLCommandQueue.h"
 #include "Command/GLCommandBuffer.h"
 #include "GLRenderContext.h"
+#include "GLLoaderThread.h"
 
 #include "Buffer/GLBuffer.h"
 #include "Buffer/GLBufferArray.h"
@@ -26,6 +28,8 @@
 #include "Texture/GLTexture.h"
 #include "Texture/GLSampler.h"
 #include "Texture/GLRenderTarget.h"
+#include "Texture/GLReadbackQueue.h"
+#include "Texture/GLUploadRing.h"
 
 #include "RenderState/GLQueryHeap.h"
 #include "RenderState/GLFence.h"
@@ -39,6 +43,7 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <mutex>
 
 
 namespace LLGL
@@ -63,6 +68,8 @@ class GLRenderSystem final : public RenderSystem
 
         /* ----- Command queues ----- */
 
+        using RenderSystem::GetCommandQueue;
+
         CommandQueue* GetCommandQueue() override;
 
         /* ----- Command buffers ----- */
@@ -92,6 +99,10 @@ class GLRenderSystem final : public RenderSystem
 
         void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
+        std::uint64_t WriteTextureAsync(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        bool QueryTextureWrite(std::uint64_t writeID, bool wait = false) override;
+        std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
+        bool QueryTextureRead(std::uint64_t readID, bool wait = false) override;
 
         /* ----- Sampler States ---- */
 
@@ -151,6 +162,11 @@ class GLRenderSystem final : public RenderSystem
 
         void Release(Fence& fence) override;
 
+        /* ----- Background loading ----- */
+
+        std::uint64_t EnqueueLoadTask(const LoadTaskFunction& task) override;
+        bool QueryLoadTask(std::uint64_t taskID, bool wait = false) override;
+
     protected:
 
         RenderContext* AddRenderContext(std::unique_ptr<GLRenderContext>&& renderContext);
@@ -158,6 +174,7 @@ class GLRenderSystem final : public RenderSystem
     private:
 
         void CreateGLContextDependentDevices(GLRenderContext& renderContext);
+        void CreateLoaderThread(GLRenderContext& renderContext);
 
         void LoadGLExtensions(bool hasGLCoreProfile);
         void SetDebugCallback(const DebugCallback& debugCallback);
@@ -169,6 +186,9 @@ class GLRenderSystem final : public RenderSystem
 
         GLBuffer* CreateGLBuffer(const BufferDescriptor& desc, const void* initialData);
 
+        void WriteTextureSubImage(const TextureType type, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc);
+        std::uint64_t WriteTextureFromUploadRing(GLTexture& textureGL, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc, bool async);
+
     private:
 
         /* ----- Hardware object containers ----- */
@@ -185,12 +205,19 @@ class GLRenderSystem final : public RenderSystem
         HWObjectContainer<GLShader>             shaders_;
         HWObjectContainer<GLShaderProgram>      shaderPrograms_;
         HWObjectContainer<GLPipelineLayout>     pipelineLayouts_;
+        PipelineLayoutCache                     pipelineLayoutCache_;
         HWObjectContainer<GLGraphicsPipeline>   graphicsPipelines_;
         HWObjectContainer<GLComputePipeline>    computePipelines_;
         HWObjectContainer<GLResourceHeap>       resourceHeaps_;
         HWObjectContainer<GLQueryHeap>          queryHeaps_;
         HWObjectContainer<GLFence>              fences_;
 
+        GLReadbackQueue                         readbackQueue_;
+        GLUploadRing                            uploadRing_;
+
+        std::unique_ptr<GLLoaderThread>         loaderThread_;
+        std::mutex                              objectMutex_;   // Guards the object containers that are modified by the loader thread
+
         RendererConfigurationOpenGL             config_;
         DebugCallback                           debugCallback_;
 
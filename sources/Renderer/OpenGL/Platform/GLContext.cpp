@@ -12,7 +12,8 @@ namespace LLGL
 {
 
 
-static GLContext* g_activeGLContext = nullptr;
+// Active GL context of the calling thread
+thread_local static GLContext* g_activeGLContext = nullptr;
 
 GLContext::GLContext(GLContext* sharedContext)
 {
@@ -35,6 +35,13 @@ class GLContext
             GLContext*                          sharedContext
         );
 
+        /*
+        Creates a platform specific GLContext that shares all GL objects with the specified context,
+        so it can be made current on a background thread. It always has its own state manager.
+        Returns null if this is not supported on the current platform.
+        */
+        static std::unique_ptr<GLContext> CreateLoaderContext(GLContext& sharedContext);
+
         // Makes the specified GLContext current. If null, the current context will be deactivated.
         static bool MakeCurrent(GLContext* context);
 
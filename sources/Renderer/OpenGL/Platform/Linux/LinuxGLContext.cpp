@@ -44,6 +44,12 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<LinuxGLContext>(desc, config, surface, sharedContextGLX);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateLoaderContext(GLContext& sharedContext)
+{
+    auto& sharedContextGLX = LLGL_CAST(LinuxGLContext&, sharedContext);
+    return MakeUnique<LinuxGLContext>(sharedContextGLX);
+}
+
 
 /*
  * LinuxGLContext class
@@ -62,9 +68,35 @@ LinuxGLContext::LinuxGLContext(
     CreateContext(desc, config, nativeHandle, sharedContext);
 }
 
+LinuxGLContext::LinuxGLContext(LinuxGLContext& sharedContext) :
+    GLContext   { nullptr                                               },
+    display_    { XOpenDisplay(DisplayString(sharedContext.display_))  },
+    wnd_        { sharedContext.wnd_                                    },
+    visual_     { sharedContext.visual_                                 },
+    ownsDisplay_{ true                                                  }
+{
+    /* Use a separate connection to the X server, since an Xlib display must not be used by multiple threads without XInitThreads */
+    if (!display_)
+        throw std::runtime_error("failed to open X11 display for shared OpenGL context of background thread");
+
+    /* Create context with the same profile as the shared context; it is made current with the same window on the background thread */
+    if (sharedContext.coreMajor_ > 0)
+        glc_ = CreateContextCoreProfile(sharedContext.glc_, sharedContext.coreMajor_, sharedContext.coreMinor_);
+    else
+        glc_ = CreateContextCompatibilityProfile(sharedContext.glc_);
+
+    if (!glc_)
+    {
+        XCloseDisplay(display_);
+        throw std::runtime_error("failed to create shared OpenGL context for background thread");
+    }
+}
+
 LinuxGLContext::~LinuxGLContext()
 {
     DeleteContext();
+    if (ownsDisplay_)
+        XCloseDisplay(display_);
 }
 
 bool LinuxGLContext::SetSwapInterval(int interval)
@@ -97,7 +129,7 @@ bool LinuxGLContext::Activate(bool activate)
     if (activate)
         return glXMakeCurrent(display_, wnd_, glc_);
     else
-        return glXMakeCurrent(nullptr, 0, 0);
+        return glXMakeCurrent(display_, None, nullptr);
 }
 
 void LinuxGLContext::CreateContext(
@@ -210,10 +242,17 @@ GLXContext LinuxGLContext::CreateContextCoreProfile(GLXContext glcShared, int ma
                 None
             };
 
-            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], nullptr, True, contextAttribs);
+            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], glcShared, True, contextAttribs);
 
             XFree(fbcList);
 
+            if (glc)
+            {
+                /* Store GL version to create shared contexts with the same profile */
+                coreMajor_ = major;
+                coreMinor_ = minor;
+            }
+
             return glc;
         }
     }
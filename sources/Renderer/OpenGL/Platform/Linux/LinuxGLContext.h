@@ -31,6 +31,10 @@ class LinuxGLContext : public GLContext
             Surface&                            surface,
             LinuxGLContext*                     sharedContext
         );
+
+        // Creates a GLX context for a background thread that shares all GL objects with the specified context.
+        LinuxGLContext(LinuxGLContext& sharedContext);
+
         ~LinuxGLContext();
 
         bool SetSwapInterval(int interval) override;
@@ -59,6 +63,11 @@ class LinuxGLContext : public GLContext
         XVisualInfo*    visual_     = nullptr;
         GLXContext      glc_        = nullptr;
 
+        int             coreMajor_  = 0;        // GL version of the core profile, or 0 for a compatibility profile
+        int             coreMinor_  = 0;
+
+        bool            ownsDisplay_ = false;   // Contexts of background threads own their display connection
+
 };
 
 
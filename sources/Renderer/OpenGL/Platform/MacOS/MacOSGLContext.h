@@ -32,6 +32,10 @@ class MacOSGLContext : public GLContext
             Surface&                            surface,
             MacOSGLContext*                     sharedContext
         );
+
+        // Creates an NSOpenGLContext for a background thread that shares all GL objects with the specified context.
+        MacOSGLContext(MacOSGLContext& sharedContext);
+
         ~MacOSGLContext();
 
         bool SetSwapInterval(int interval) override;
@@ -52,6 +56,7 @@ class MacOSGLContext : public GLContext
         NSOpenGLPixelFormat*    pixelFormat_    = nullptr;
         NSOpenGLContext*        ctx_            = nullptr;
         NSWindow*               wnd_            = nullptr;
+        bool                    isLoader_       = false;    // Context for a background thread without a view
 
 };
 
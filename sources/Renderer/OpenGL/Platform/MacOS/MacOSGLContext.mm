@@ -27,6 +27,12 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<MacOSGLContext>(desc, config, surface, sharedContextGLNS);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateLoaderContext(GLContext& sharedContext)
+{
+    auto& sharedContextGLNS = LLGL_CAST(MacOSGLContext&, sharedContext);
+    return MakeUnique<MacOSGLContext>(sharedContextGLNS);
+}
+
 MacOSGLContext::MacOSGLContext(
     const RenderContextDescriptor&      desc,
     const RendererConfigurationOpenGL&  config,
@@ -43,6 +49,17 @@ MacOSGLContext::MacOSGLContext(
     CreateNSGLContext(nativeHandle, sharedContext);
 }
 
+MacOSGLContext::MacOSGLContext(MacOSGLContext& sharedContext) :
+    LLGL::GLContext { nullptr },
+    isLoader_       { true    }
+{
+    /* Create new NS-OpenGL context with the same pixel format that shares all objects with the specified context */
+    pixelFormat_ = [sharedContext.pixelFormat_ retain];
+    ctx_ = [[NSOpenGLContext alloc] initWithFormat:pixelFormat_ shareContext:sharedContext.ctx_];
+    if (!ctx_)
+        throw std::runtime_error("failed to create shared NSOpenGLContext for background thread");
+}
+
 MacOSGLContext::~MacOSGLContext()
 {
     DeleteNSGLContext();
@@ -76,6 +93,16 @@ void MacOSGLContext::Resize(const Extent2D& resolution)
 
 bool MacOSGLContext::Activate(bool activate)
 {
+    /* Context for background thread has no view */
+    if (isLoader_)
+    {
+        if (activate)
+            [ctx_ makeCurrentContext];
+        else
+            [NSOpenGLContext clearCurrentContext];
+        return true;
+    }
+
     /* Make context current */
     [ctx_ makeCurrentContext];
 
@@ -175,8 +202,11 @@ void MacOSGLContext::CreateNSGLContext(const NativeHandle& nativeHandle, MacOSGL
 void MacOSGLContext::DeleteNSGLContext()
 {
     [pixelFormat_ release];
-    [ctx_ makeCurrentContext];
-    [ctx_ clearDrawable];
+    if (!isLoader_)
+    {
+        [ctx_ makeCurrentContext];
+        [ctx_ clearDrawable];
+    }
     [ctx_ release];
 }
 
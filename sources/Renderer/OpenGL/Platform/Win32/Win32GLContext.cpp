@@ -33,6 +33,12 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<Win32GLContext>(desc, config, surface, sharedContextWGL);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateLoaderContext(GLContext& sharedContext)
+{
+    auto& sharedContextWGL = LLGL_CAST(Win32GLContext&, sharedContext);
+    return MakeUnique<Win32GLContext>(sharedContextWGL);
+}
+
 
 /*
  * Win32GLContext class
@@ -58,6 +64,28 @@ Win32GLContext::Win32GLContext(
         CreateContext(nullptr);
 }
 
+Win32GLContext::Win32GLContext(Win32GLContext& sharedContext) :
+    GLContext    { nullptr                     },
+    pixelFormat_ { sharedContext.pixelFormat_  },
+    hDC_         { sharedContext.hDC_          },
+    desc_        { sharedContext.desc_         },
+    config_      { sharedContext.config_       },
+    surface_     { sharedContext.surface_      }
+{
+    /* Create own hardware context with the same device context, which has already the final pixel format */
+    if (config_.contextProfile != OpenGLContextProfile::CompatibilityProfile && (wglCreateContextAttribsARB || LoadCreateContextProcs()))
+        hGLRC_ = CreateExtContextProfile(sharedContext.hGLRC_);
+    else
+    {
+        hGLRC_ = CreateStdContextProfile();
+        if (hGLRC_ && !wglShareLists(sharedContext.hGLRC_, hGLRC_))
+            DeleteGLContext(hGLRC_);
+    }
+
+    if (!hGLRC_)
+        throw std::runtime_error("failed to create shared OpenGL context for background thread");
+}
+
 Win32GLContext::~Win32GLContext()
 {
     DeleteContext();
@@ -32,6 +32,10 @@ class Win32GLContext final : public GLContext
             Surface&                            surface,
             Win32GLContext*                     sharedContext
         );
+
+        // Creates a WGL context for a background thread that shares all GL objects with the specified context.
+        Win32GLContext(Win32GLContext& sharedContext);
+
         ~Win32GLContext();
 
         bool SetSwapInterval(int interval) override;
@@ -7,13 +7,32 @@
 
 #include "GLRenderPass.h"
 #include "../../DescriptorHelper.h"
+#include "../../GLCommon/GLTypes.h"
 #include <LLGL/CommandBufferFlags.h>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
+static void AppendInvalidateAttachment(GLInvalidateAttachments& dst, GLenum attachment)
+{
+    dst.attachments[dst.numAttachments++] = attachment;
+}
+
+static void AppendInvalidateAttachmentByOps(const AttachmentFormatDescriptor& desc, GLenum attachment, GLInvalidateAttachments& onBegin, GLInvalidateAttachments& onEnd)
+{
+    if (desc.format != Format::Undefined)
+    {
+        if (desc.loadOp == AttachmentLoadOp::Undefined)
+            AppendInvalidateAttachment(onBegin, attachment);
+        if (desc.storeOp == AttachmentStoreOp::Undefined)
+            AppendInvalidateAttachment(onEnd, attachment);
+    }
+}
+
+
 GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc) :
     numColorAttachments_ { static_cast<std::uint8_t>(desc.colorAttachments.size()) }
 {
@@ -28,6 +47,15 @@ GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc) :
     /* Check if stencil attachment must be cleared */
     if (desc.stencilAttachment.loadOp == AttachmentLoadOp::Clear)
         clearMask_ |= GL_STENCIL_BUFFER_BIT;
+
+    /* Determine which attachments can be invalidated when the render pass begins and ends */
+    for (std::size_t i = 0, n = std::min(desc.colorAttachments.size(), std::size_t(LLGL_MAX_NUM_COLOR_ATTACHMENTS)); i < n; ++i)
+    {
+        auto attachment = GLTypes::ToColorAttachment(static_cast<std::uint32_t>(i));
+        AppendInvalidateAttachmentByOps(desc.colorAttachments[i], attachment, invalidateOnBegin_, invalidateOnEnd_);
+    }
+    AppendInvalidateAttachmentByOps(desc.depthAttachment, GL_DEPTH_ATTACHMENT, invalidateOnBegin_, invalidateOnEnd_);
+    AppendInvalidateAttachmentByOps(desc.stencilAttachment, GL_STENCIL_ATTACHMENT, invalidateOnBegin_, invalidateOnEnd_);
 }
 
 
@@ -20,6 +20,13 @@ namespace LLGL
 {
 
 
+// List of framebuffer attachments (e.g. GL_COLOR_ATTACHMENT0 or GL_DEPTH_ATTACHMENT) whose content can be invalidated.
+struct GLInvalidateAttachments
+{
+    GLsizei numAttachments                                  = 0;
+    GLenum  attachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS + 2] = {};
+};
+
 class GLRenderPass final : public RenderPass
 {
 
@@ -45,11 +52,25 @@ class GLRenderPass final : public RenderPass
             return clearColorAttachments_;
         }
 
+        // Returns the attachments that are invalidated when a render pass begins, i.e. with AttachmentLoadOp::Undefined.
+        inline const GLInvalidateAttachments& GetInvalidateOnBegin() const
+        {
+            return invalidateOnBegin_;
+        }
+
+        // Returns the attachments that are invalidated when a render pass ends, i.e. with AttachmentStoreOp::Undefined.
+        inline const GLInvalidateAttachments& GetInvalidateOnEnd() const
+        {
+            return invalidateOnEnd_;
+        }
+
     private:
 
-        std::uint8_t    numColorAttachments_                                    = 0;
-        GLbitfield      clearMask_                                              = 0;
-        std::uint8_t    clearColorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
+        std::uint8_t            numColorAttachments_                                    = 0;
+        GLbitfield              clearMask_                                              = 0;
+        std::uint8_t            clearColorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
+        GLInvalidateAttachments invalidateOnBegin_;
+        GLInvalidateAttachments invalidateOnEnd_;
 
 };
 
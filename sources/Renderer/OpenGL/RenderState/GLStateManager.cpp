@@ -72,6 +72,7 @@ static const GLenum g_bufferTargetsEnum[] =
     GL_DISPATCH_INDIRECT_BUFFER,
     GL_DRAW_INDIRECT_BUFFER,
     GL_ELEMENT_ARRAY_BUFFER,
+    GL_PARAMETER_BUFFER,
     GL_PIXEL_PACK_BUFFER,
     GL_PIXEL_UNPACK_BUFFER,
     GL_QUERY_BUFFER,
@@ -141,7 +142,7 @@ static void InvalidateBoundGLObject(GLuint& boundId, const GLuint releasedObject
 
 static std::vector<GLStateManager*> g_GLStateManagerList;
 
-GLStateManager*             GLStateManager::active_;
+thread_local GLStateManager* GLStateManager::active_ = nullptr;
 GLStateManager::GLLimits    GLStateManager::commonLimits_;
 
 GLStateManager::GLStateManager()
@@ -212,6 +213,21 @@ void GLStateManager::Reset()
         capabilityState_.values[i] = (glIsEnabled(g_stateCapsEnum[i]) != GL_FALSE);
 }
 
+void GLStateManager::ResetBindings()
+{
+    Fill(bufferState_.boundBuffers, 0);
+    Fill(framebufferState_.boundFramebuffers, 0);
+    Fill(samplerState_.boundSamplers, 0);
+
+    for (auto& layer : textureState_.layers)
+        Fill(layer.boundTextures, 0);
+
+    renderbufferState_.boundRenderbuffer        = 0;
+    vertexArrayState_.boundVertexArray          = 0;
+    vertexArrayState_.boundElementArrayBuffer   = 0;
+    shaderState_.boundProgram                   = 0;
+}
+
 void GLStateManager::Set(GLState state, bool value)
 {
     auto idx = static_cast<std::size_t>(state);
@@ -792,6 +808,7 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
     {
         NotifyBufferRelease(id, GLBufferTarget::DRAW_INDIRECT_BUFFER);
         NotifyBufferRelease(id, GLBufferTarget::DISPATCH_INDIRECT_BUFFER);
+        NotifyBufferRelease(id, GLBufferTarget::PARAMETER_BUFFER);
     }
 
     NotifyBufferRelease(id, GLBufferTarget::COPY_READ_BUFFER);
@@ -1119,11 +1136,25 @@ void GLStateManager::BindRenderPass(
     else
         BindAndBlitRenderTarget(LLGL_CAST(GLRenderTarget&, renderTarget));
 
-    /* Clear attachments */
+    /* Invalidate attachments with undefined content and clear attachments */
     if (renderPass)
     {
         auto renderPassGL = LLGL_CAST(const GLRenderPass*, renderPass);
+        InvalidateAttachments(renderPassGL->GetInvalidateOnBegin(), false);
         ClearAttachmentsWithRenderPass(*renderPassGL, numClearValues, clearValues, defaultClearValue);
+        framebufferState_.boundRenderPass = renderPassGL;
+    }
+    else
+        framebufferState_.boundRenderPass = nullptr;
+}
+
+void GLStateManager::EndRenderPass()
+{
+    /* Invalidate attachments whose content is not stored */
+    if (auto renderPassGL = framebufferState_.boundRenderPass)
+    {
+        InvalidateAttachments(renderPassGL->GetInvalidateOnEnd(), true);
+        framebufferState_.boundRenderPass = nullptr;
     }
 }
 
@@ -1477,6 +1508,42 @@ std::uint32_t GLStateManager::ClearColorBuffers(
     return n;
 }
 
+// Converts the specified framebuffer attachment into the respective attachment of the default framebuffer
+static bool ToDefaultFramebufferAttachment(GLenum& attachment)
+{
+    switch (attachment)
+    {
+        case GL_COLOR_ATTACHMENT0:  attachment = GL_COLOR;      return true;
+        case GL_DEPTH_ATTACHMENT:   attachment = GL_DEPTH;      return true;
+        case GL_STENCIL_ATTACHMENT: attachment = GL_STENCIL;    return true;
+        default:                                                return false;
+    }
+}
+
+void GLStateManager::InvalidateAttachments(const GLInvalidateAttachments& invalidateAttachments, bool afterResolve)
+{
+    if (invalidateAttachments.numAttachments == 0)
+        return;
+
+    if (auto renderTarget = GetBoundRenderTarget())
+    {
+        /* Invalidate attachments of the render target (or after its multi-sampled attachments have been resolved) */
+        renderTarget->InvalidateAttachments(invalidateAttachments, afterResolve);
+    }
+    else
+    {
+        /* Invalidate attachments of the default framebuffer, which only has a single color buffer */
+        GLInvalidateAttachments defaultAttachments;
+        for (GLsizei i = 0; i < invalidateAttachments.numAttachments; ++i)
+        {
+            auto attachment = invalidateAttachments.attachments[i];
+            if (ToDefaultFramebufferAttachment(attachment))
+                defaultAttachments.attachments[defaultAttachments.numAttachments++] = attachment;
+        }
+        GLFramebuffer::Invalidate(0, GLFramebufferTarget::DRAW_FRAMEBUFFER, defaultAttachments.numAttachments, defaultAttachments.attachments);
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -31,6 +31,7 @@ class GLDepthStencilState;
 class GLRasterizerState;
 class GLBlendState;
 class GLRenderPass;
+struct GLInvalidateAttachments;
 
 // OpenGL state machine manager that keeps track of certain GL states.
 class GLStateManager
@@ -81,6 +82,9 @@ class GLStateManager
         // Resets all internal states by querying the values from OpenGL.
         void Reset();
 
+        // Resets all cached object bindings, so that objects which have been deleted or recreated in a shared GL context are bound again.
+        void ResetBindings();
+
         void Set(GLState state, bool value);
         void Enable(GLState state);
         void Disable(GLState state);
@@ -240,6 +244,9 @@ class GLStateManager
             const GLClearValue& defaultClearValue
         );
 
+        // Ends the current render pass and invalidates the attachments whose content is not stored.
+        void EndRenderPass();
+
         void Clear(long flags);
         void ClearBuffers(std::uint32_t numAttachments, const AttachmentClear* attachments);
 
@@ -304,6 +311,9 @@ class GLStateManager
             const GLClearValue& defaultClearValue
         );
 
+        // Invalidates the specified attachments of the bound render target or render context.
+        void InvalidateAttachments(const GLInvalidateAttachments& invalidateAttachments, bool afterResolve);
+
     private:
 
         static const std::uint32_t numTextureLayers         = 32;
@@ -390,6 +400,7 @@ class GLStateManager
             std::array<GLuint, numFramebufferTargets>   boundFramebuffers;
             std::stack<StackEntry>                      boundFramebufferStack;
             GLRenderTarget*                             boundRenderTarget       = nullptr;
+            const GLRenderPass*                         boundRenderPass         = nullptr;
         };
 
         struct GLRenderbufferState
@@ -437,7 +448,7 @@ class GLStateManager
 
         friend class GLContext;
 
-        static GLStateManager*          active_;
+        static thread_local GLStateManager* active_;            // Active state manager of the calling thread
         static GLLimits                 commonLimits_;          // Common denominator of limitations for all GL contexts
 
         GLLimits                        limits_;                // Limitations of this GL context
@@ -152,6 +152,44 @@ void GLFramebuffer::Blit(
     );
 }
 
+static GLenum ToGLFramebufferTarget(const GLFramebufferTarget target)
+{
+    switch (target)
+    {
+        case GLFramebufferTarget::FRAMEBUFFER:      return GL_FRAMEBUFFER;
+        case GLFramebufferTarget::DRAW_FRAMEBUFFER: return GL_DRAW_FRAMEBUFFER;
+        case GLFramebufferTarget::READ_FRAMEBUFFER: return GL_READ_FRAMEBUFFER;
+    }
+    return GL_FRAMEBUFFER;
+}
+
+void GLFramebuffer::Invalidate(
+    GLuint              framebufferID,
+    GLFramebufferTarget target,
+    GLsizei             numAttachments,
+    const GLenum*       attachments)
+{
+    if (numAttachments == 0)
+        return;
+
+    #ifdef GL_ARB_invalidate_subdata
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Invalidate framebuffer attachments without binding the framebuffer */
+        glInvalidateNamedFramebufferData(framebufferID, numAttachments, attachments);
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    if (HasExtension(GLExt::ARB_invalidate_subdata))
+    {
+        /* Bind framebuffer and invalidate its attachments */
+        GLStateManager::Get().BindFramebuffer(target, framebufferID);
+        glInvalidateFramebuffer(ToGLFramebufferTarget(target), numAttachments, attachments);
+    }
+    #endif // /GL_ARB_invalidate_subdata
+}
+
 
 } // /namespace LLGL
 
@@ -90,6 +90,17 @@ class GLFramebuffer
             GLenum          filter
         );
 
+        /*
+        Invalidates the specified attachments of the framebuffer with the specified ID (0 for the default framebuffer),
+        if "GL_ARB_invalidate_subdata" is supported. Without "GL_ARB_direct_state_access", the framebuffer is bound to the specified target.
+        */
+        static void Invalidate(
+            GLuint              framebufferID,
+            GLFramebufferTarget target,
+            GLsizei             numAttachments,
+            const GLenum*       attachments
+        );
+
     private:
 
         GLuint id_ = 0;
@@ -0,0 +1,300 @@
+/*
+ * GLReadbackQueue.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLReadbackQueue.h"
+#include "GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLTypes.h"
+#include "../../../Core/Helper.h"
+#include "../../../Core/Assertion.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+// Maximal number of unused pixel pack buffers that are kept for subsequent read operations.
+static const std::size_t g_maxNumPooledBuffers = 8;
+
+// Determines the image format to read the texture with. Uses the native texture format whenever the conversion can be deferred to the CPU.
+static void GetReadbackImageFormat(const GLTexture& textureGL, const DstImageDescriptor& imageDesc, ImageFormat& format, DataType& dataType)
+{
+    if (IsCompressedFormat(imageDesc.format) || IsDepthStencilFormat(imageDesc.format) || !textureGL.GetNativeImageFormat(format, dataType))
+    {
+        format      = imageDesc.format;
+        dataType    = imageDesc.dataType;
+    }
+}
+
+// Returns the size (in bytes) the destination image requires with its strides.
+static std::size_t GetReadbackDstImageSize(const DstImageDescriptor& imageDesc, const Extent3D& extent)
+{
+    if (extent.width == 0 || extent.height == 0 || extent.depth == 0)
+        return 0;
+
+    const std::size_t bytesPerPixel = ImageDataSize(imageDesc.format, imageDesc.dataType, 1);
+    const std::size_t rowStride     = (imageDesc.rowStride > 0 ? imageDesc.rowStride : bytesPerPixel * extent.width);
+    const std::size_t layerStride   = (imageDesc.layerStride > 0 ? imageDesc.layerStride : rowStride * extent.height);
+
+    return (extent.depth - 1) * layerStride + (extent.height - 1) * rowStride + extent.width * bytesPerPixel;
+}
+
+// Copies the tightly packed source image into the destination image with its strides.
+static void CopyReadbackImageRows(const SrcImageDescriptor& srcImageDesc, const DstImageDescriptor& dstImageDesc, const Extent3D& extent)
+{
+    const std::size_t rowSize       = ImageDataSize(srcImageDesc.format, srcImageDesc.dataType, extent.width);
+    const std::size_t rowStride     = (dstImageDesc.rowStride > 0 ? dstImageDesc.rowStride : rowSize);
+    const std::size_t layerStride   = (dstImageDesc.layerStride > 0 ? dstImageDesc.layerStride : rowStride * extent.height);
+
+    auto src = reinterpret_cast<const char*>(srcImageDesc.data);
+    auto dst = reinterpret_cast<char*>(dstImageDesc.data);
+
+    if (rowStride == rowSize && layerStride == rowSize * extent.height)
+    {
+        /* Copy tightly packed image in one go */
+        ::memcpy(dst, src, rowSize * extent.height * extent.depth);
+    }
+    else
+    {
+        /* Copy image row by row */
+        for (std::uint32_t z = 0; z < extent.depth; ++z)
+        {
+            for (std::uint32_t y = 0; y < extent.height; ++y)
+            {
+                ::memcpy(dst + z * layerStride + y * rowStride, src, rowSize);
+                src += rowSize;
+            }
+        }
+    }
+}
+
+// Worker thread procedure to convert the mapped pixel pack buffer into the destination image.
+static void ConvertReadbackImage(
+    SrcImageDescriptor  srcImageDesc,
+    DstImageDescriptor  dstImageDesc,
+    Extent3D            extent,
+    std::size_t         threadCount)
+{
+    if (srcImageDesc.format == dstImageDesc.format && srcImageDesc.dataType == dstImageDesc.dataType)
+        CopyReadbackImageRows(srcImageDesc, dstImageDesc, extent);
+    else
+        ConvertImageBuffer(srcImageDesc, dstImageDesc, extent, threadCount);
+}
+
+GLReadbackQueue::~GLReadbackQueue()
+{
+    Clear();
+}
+
+std::uint64_t GLReadbackQueue::ReadTexture(
+    const GLTexture&            textureGL,
+    std::uint32_t               mipLevel,
+    const DstImageDescriptor&   imageDesc,
+    std::size_t                 threadCount)
+{
+    LLGL_ASSERT_PTR(imageDesc.data);
+
+    auto readOp = MakeUnique<ReadOperation>();
+    {
+        readOp->id              = nextID_++;
+        readOp->dstImageDesc    = imageDesc;
+        readOp->extent          = textureGL.GetMipExtent(mipLevel);
+        readOp->threadCount     = threadCount;
+    }
+
+    /* Validate output data size before any command is issued */
+    if (imageDesc.dataSize < GetReadbackDstImageSize(imageDesc, readOp->extent))
+        throw std::invalid_argument("image data size is too small for asynchronous texture read");
+
+    /* Determine image format for the pixel pack buffer */
+    auto& srcImageDesc = readOp->srcImageDesc;
+    GetReadbackImageFormat(textureGL, imageDesc, srcImageDesc.format, srcImageDesc.dataType);
+
+    const auto numTexels = readOp->extent.width * readOp->extent.height * readOp->extent.depth;
+    srcImageDesc.dataSize = ImageDataSize(srcImageDesc.format, srcImageDesc.dataType, numTexels);
+
+    readOp->buffer = AllocPackBuffer(static_cast<GLsizeiptr>(srcImageDesc.dataSize));
+
+    /* Copy texture into pixel pack buffer; this command does not wait for the GPU */
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, readOp->buffer.id);
+    GLStateManager::Get().BindGLTexture(textureGL);
+    {
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glGetTexImage(
+            GLTypes::Map(textureGL.GetType()),
+            static_cast<GLint>(mipLevel),
+            GLTypes::Map(srcImageDesc.format),
+            GLTypes::Map(srcImageDesc.dataType),
+            nullptr
+        );
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    }
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+    /* Submit fence after the copy command to query its completion */
+    readOp->fence.Submit();
+
+    pending_.emplace_back(std::move(readOp));
+
+    return nextID_ - 1;
+}
+
+bool GLReadbackQueue::Query(std::uint64_t readID, bool wait)
+{
+    auto it = std::find_if(
+        pending_.begin(),
+        pending_.end(),
+        [readID](const ReadOperationPtr& readOp)
+        {
+            return (readOp->id == readID);
+        }
+    );
+
+    if (it == pending_.end())
+        return true;
+
+    auto& readOp = *(it->get());
+
+    if (!readOp.mapped)
+    {
+        /* Map pixel pack buffer as soon as the GPU has finished the copy command */
+        if (!readOp.fence.Wait(wait ? GL_TIMEOUT_IGNORED : 0))
+            return false;
+        MapAndConvert(readOp);
+    }
+
+    /* Check if the worker thread has finished the conversion */
+    if (!wait && readOp.conversion.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    readOp.conversion.wait();
+
+    /* Release pixel pack buffer and remove read operation, then forward exceptions of the worker thread */
+    Unmap(readOp);
+    ReleasePackBuffer(readOp.buffer);
+
+    auto conversion = std::move(readOp.conversion);
+    pending_.erase(it);
+    conversion.get();
+
+    return true;
+}
+
+void GLReadbackQueue::Clear()
+{
+    /* Wait for all conversions that are still in progress and delete all pixel pack buffers */
+    for (auto& readOp : pending_)
+    {
+        if (readOp->mapped)
+        {
+            readOp->conversion.wait();
+            Unmap(*readOp);
+        }
+        GLStateManager::Get().NotifyBufferRelease(readOp->buffer.id, GLBufferTarget::PIXEL_PACK_BUFFER);
+        glDeleteBuffers(1, &(readOp->buffer.id));
+    }
+    pending_.clear();
+
+    for (auto& buffer : bufferPool_)
+    {
+        GLStateManager::Get().NotifyBufferRelease(buffer.id, GLBufferTarget::PIXEL_PACK_BUFFER);
+        glDeleteBuffers(1, &(buffer.id));
+    }
+    bufferPool_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+GLReadbackQueue::PackBuffer GLReadbackQueue::AllocPackBuffer(GLsizeiptr size)
+{
+    /* Take the smallest pooled buffer that is large enough */
+    auto best = bufferPool_.end();
+    for (auto it = bufferPool_.begin(); it != bufferPool_.end(); ++it)
+    {
+        if (it->size >= size && (best == bufferPool_.end() || it->size < best->size))
+            best = it;
+    }
+
+    if (best != bufferPool_.end())
+    {
+        auto buffer = *best;
+        bufferPool_.erase(best);
+        return buffer;
+    }
+
+    /* Create new pixel pack buffer */
+    PackBuffer buffer;
+    {
+        buffer.size = size;
+        glGenBuffers(1, &(buffer.id));
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, buffer.id);
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+    }
+    return buffer;
+}
+
+void GLReadbackQueue::ReleasePackBuffer(const PackBuffer& buffer)
+{
+    if (bufferPool_.size() < g_maxNumPooledBuffers)
+        bufferPool_.push_back(buffer);
+    else
+    {
+        GLStateManager::Get().NotifyBufferRelease(buffer.id, GLBufferTarget::PIXEL_PACK_BUFFER);
+        glDeleteBuffers(1, &(buffer.id));
+    }
+}
+
+void GLReadbackQueue::MapAndConvert(ReadOperation& readOp)
+{
+    /* Map pixel pack buffer for read access */
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, readOp.buffer.id);
+    auto data = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+    if (data == nullptr)
+        throw std::runtime_error("failed to map pixel pack buffer for asynchronous texture read");
+
+    readOp.srcImageDesc.data    = data;
+    readOp.mapped               = true;
+
+    /* Convert mapped image data into destination image on a worker thread */
+    readOp.conversion = std::async(
+        std::launch::async,
+        ConvertReadbackImage,
+        readOp.srcImageDesc,
+        readOp.dstImageDesc,
+        readOp.extent,
+        readOp.threadCount
+    );
+}
+
+void GLReadbackQueue::Unmap(ReadOperation& readOp)
+{
+    if (readOp.mapped)
+    {
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, readOp.buffer.id);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+        readOp.mapped = false;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
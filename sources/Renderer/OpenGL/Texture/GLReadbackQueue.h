@@ -0,0 +1,95 @@
+/*
+ * GLReadbackQueue.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_READBACK_QUEUE_H
+#define LLGL_GL_READBACK_QUEUE_H
+
+
+#include <LLGL/ImageFlags.h>
+#include "../OpenGL.h"
+#include "../RenderState/GLFence.h"
+#include <vector>
+#include <memory>
+#include <future>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+
+// Queue of asynchronous texture read operations with a pool of pixel pack buffers (GL_PIXEL_PACK_BUFFER).
+class GLReadbackQueue
+{
+
+    public:
+
+        GLReadbackQueue() = default;
+        ~GLReadbackQueue();
+
+        GLReadbackQueue(const GLReadbackQueue&) = delete;
+        GLReadbackQueue& operator = (const GLReadbackQueue&) = delete;
+
+        // Copies the specified MIP-map level into a pixel pack buffer and returns the identifier of the new read operation.
+        std::uint64_t ReadTexture(const GLTexture& textureGL, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc, std::size_t threadCount);
+
+        // Makes progress on the specified read operation and returns true if it has been completed.
+        bool Query(std::uint64_t readID, bool wait);
+
+        // Waits for all pending read operations and releases all pixel pack buffers.
+        void Clear();
+
+    private:
+
+        struct PackBuffer
+        {
+            GLuint      id      = 0;
+            GLsizeiptr  size    = 0;
+        };
+
+        struct ReadOperation
+        {
+            std::uint64_t       id          = 0;
+            PackBuffer          buffer;
+            GLFence             fence;
+            SrcImageDescriptor  srcImageDesc;
+            DstImageDescriptor  dstImageDesc;
+            Extent3D            extent;
+            std::size_t         threadCount = 0;
+            bool                mapped      = false;
+            std::future<void>   conversion;
+        };
+
+        using ReadOperationPtr = std::unique_ptr<ReadOperation>;
+
+    private:
+
+        PackBuffer AllocPackBuffer(GLsizeiptr size);
+        void ReleasePackBuffer(const PackBuffer& buffer);
+
+        void MapAndConvert(ReadOperation& readOp);
+        void Unmap(ReadOperation& readOp);
+
+    private:
+
+        std::uint64_t                   nextID_     = 1;
+        std::vector<ReadOperationPtr>   pending_;
+        std::vector<PackBuffer>         bufferPool_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
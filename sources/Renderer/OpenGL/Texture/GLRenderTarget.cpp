@@ -63,6 +63,21 @@ static std::size_t CountColorAttachments(const std::vector<AttachmentDescriptor>
     return numColorAttachments;
 }
 
+static bool IsColorAttachment(GLenum attachment)
+{
+    return (attachment != GL_DEPTH_ATTACHMENT && attachment != GL_STENCIL_ATTACHMENT && attachment != GL_DEPTH_STENCIL_ATTACHMENT);
+}
+
+static void AppendUniqueAttachment(GLInvalidateAttachments& dst, GLenum attachment)
+{
+    for (GLsizei i = 0; i < dst.numAttachments; ++i)
+    {
+        if (dst.attachments[i] == attachment)
+            return;
+    }
+    dst.attachments[dst.numAttachments++] = attachment;
+}
+
 
 /*
  * GLRenderTarget class
@@ -145,6 +160,18 @@ void GLRenderTarget::BlitOntoFramebuffer()
             BlitFramebuffer();
         }
 
+        /* Invalidate multi-sampled attachments that have been resolved but whose content is not stored */
+        if (invalidateAfterBlit_.numAttachments > 0)
+        {
+            GLFramebuffer::Invalidate(
+                framebufferMS_.GetID(),
+                GLFramebufferTarget::READ_FRAMEBUFFER,
+                invalidateAfterBlit_.numAttachments,
+                invalidateAfterBlit_.attachments
+            );
+            invalidateAfterBlit_.numAttachments = 0;
+        }
+
         framebufferMS_.Unbind(GLFramebufferTarget::READ_FRAMEBUFFER);
         framebuffer_.Unbind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
     }
@@ -188,6 +215,41 @@ void GLRenderTarget::SetDrawBuffers()
         glDrawBuffers(static_cast<GLsizei>(colorAttachments_.size()), colorAttachments_.data());
 }
 
+void GLRenderTarget::InvalidateAttachments(const GLInvalidateAttachments& invalidateAttachments, bool afterResolve)
+{
+    if (framebufferMS_ && afterResolve)
+    {
+        /*
+        Multi-sampled color attachments must be blitted onto the framebuffer before they can be invalidated,
+        but the depth-stencil attachment is not resolved, so it can be invalidated immediately
+        */
+        GLInvalidateAttachments depthStencilAttachments;
+        for (GLsizei i = 0; i < invalidateAttachments.numAttachments; ++i)
+        {
+            auto attachment = invalidateAttachments.attachments[i];
+            if (IsColorAttachment(attachment))
+                AppendUniqueAttachment(invalidateAfterBlit_, attachment);
+            else
+                AppendUniqueAttachment(depthStencilAttachments, attachment);
+        }
+        GLFramebuffer::Invalidate(
+            framebufferMS_.GetID(),
+            GLFramebufferTarget::DRAW_FRAMEBUFFER,
+            depthStencilAttachments.numAttachments,
+            depthStencilAttachments.attachments
+        );
+    }
+    else
+    {
+        GLFramebuffer::Invalidate(
+            GetFramebuffer().GetID(),
+            GLFramebufferTarget::DRAW_FRAMEBUFFER,
+            invalidateAttachments.numAttachments,
+            invalidateAttachments.attachments
+        );
+    }
+}
+
 
 /*
  * ======= Private: =======
@@ -13,6 +13,7 @@
 #include "GLFramebuffer.h"
 #include "GLRenderbuffer.h"
 #include "GLTexture.h"
+#include "../RenderState/GLRenderPass.h"
 #include <functional>
 #include <vector>
 #include <memory>
@@ -54,6 +55,12 @@ class GLRenderTarget final : public RenderTarget
         // Sets the draw buffers for the currently bound FBO.
         void SetDrawBuffers();
 
+        /*
+        Invalidates the specified attachments of the active framebuffer.
+        If 'afterResolve' is true, multi-sampled color attachments are only invalidated after they have been blitted onto the framebuffer.
+        */
+        void InvalidateAttachments(const GLInvalidateAttachments& invalidateAttachments, bool afterResolve);
+
     private:
 
         void CreateFramebufferWithAttachments(const RenderTargetDescriptor& desc);
@@ -105,6 +112,8 @@ class GLRenderTarget final : public RenderTarget
         GLsizei                     multiSamples_       = 0;
         GLbitfield                  blitMask_           = 0;
 
+        GLInvalidateAttachments     invalidateAfterBlit_;   // multi-sampled color attachments to invalidate after the next blit
+
         const RenderPass*           renderPass_         = nullptr;
 
 };
@@ -12,6 +12,7 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
 #include "../Ext/GLExtensions.h"
+#include <LLGL/Format.h>
 
 
 namespace LLGL
@@ -304,6 +305,22 @@ GLenum GLTexture::GetInternalFormat() const
     return static_cast<GLenum>(internalFormat);
 }
 
+bool GLTexture::GetNativeImageFormat(ImageFormat& format, DataType& dataType) const
+{
+    const auto& formatAttribs       = GetFormatAttribs(GLTypes::UnmapFormat(GetInternalFormat()));
+    const long  unsupportedFlags    = (FormatFlags::IsCompressed | FormatFlags::IsPacked | FormatFlags::HasDepth | FormatFlags::HasStencil);
+    const bool  isIntegerFormat     = ((formatAttribs.flags & FormatFlags::IsInteger) != 0 && (formatAttribs.flags & FormatFlags::IsNormalized) == 0);
+
+    if (formatAttribs.bitSize > 0 && (formatAttribs.flags & unsupportedFlags) == 0 && !isIntegerFormat)
+    {
+        format      = formatAttribs.format;
+        dataType    = formatAttribs.dataType;
+        return true;
+    }
+
+    return false;
+}
+
 
 /*
  * ======= Private: =======
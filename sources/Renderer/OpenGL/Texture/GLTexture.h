@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Texture.h>
+#include <LLGL/ImageFlags.h>
 #include "../OpenGL.h"
 
 
@@ -49,6 +50,13 @@ class GLTexture final : public Texture
         // Returns the GL_TEXTURE_INTERNAL_FORMAT parameter of this texture.
         GLenum GetInternalFormat() const;
 
+        /*
+        Determines the image format and data type that match the internal format of this texture,
+        so that image data can be converted on the CPU instead of the GL driver.
+        Returns false if there is no such format, e.g. for compressed, packed, depth-stencil, or non-normalized integer formats.
+        */
+        bool GetNativeImageFormat(ImageFormat& format, DataType& dataType) const;
+
         // Returns the hardware texture ID.
         inline GLuint GetID() const
         {
@@ -0,0 +1,374 @@
+/*
+ * GLUploadRing.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLUploadRing.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../../../Core/Helper.h"
+#include <LLGL/Constants.h>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <chrono>
+
+
+namespace LLGL
+{
+
+
+// Size (in bytes) of the ring buffer. Larger images are uploaded directly from client memory.
+static const GLsizeiptr g_ringBufferSize        = (16 * 1024 * 1024);
+
+// Alignment (in bytes) of each image within the ring buffer; this satisfies the alignment of all pixel formats.
+static const GLsizeiptr g_ringBufferAlignment   = 16;
+
+// Minimal size (in bytes) of image data each worker thread copies.
+static const std::size_t g_threadMinCopySize    = (256 * 1024);
+
+static void CopyImageRowsWorker(
+    const SrcImageDescriptor&   srcImageDesc,
+    char*                       dst,
+    std::size_t                 rowSize,
+    std::uint32_t               height,
+    std::size_t                 begin,
+    std::size_t                 end)
+{
+    const std::size_t srcRowStride      = (srcImageDesc.rowStride > 0 ? srcImageDesc.rowStride : rowSize);
+    const std::size_t srcLayerStride    = (srcImageDesc.layerStride > 0 ? srcImageDesc.layerStride : srcRowStride * height);
+
+    auto src = reinterpret_cast<const char*>(srcImageDesc.data);
+
+    for (auto row = begin; row < end; ++row)
+    {
+        const auto y = row % height;
+        const auto z = row / height;
+        ::memcpy(dst + row * rowSize, src + z * srcLayerStride + y * srcRowStride, rowSize);
+    }
+}
+
+// Copies the source image with its strides into the tightly packed destination buffer.
+static void CopyImageRows(const SrcImageDescriptor& srcImageDesc, void* dstData, const Extent3D& extent, std::size_t threadCount)
+{
+    const auto rowSize = ImageDataSize(srcImageDesc.format, srcImageDesc.dataType, extent.width);
+    const auto numRows = static_cast<std::size_t>(extent.height) * extent.depth;
+    const auto dst     = reinterpret_cast<char*>(dstData);
+
+    if (threadCount >= Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    threadCount = std::min(threadCount, (rowSize * numRows) / g_threadMinCopySize);
+
+    if (threadCount > 1)
+    {
+        /* Create worker threads */
+        std::vector<std::thread> workers(threadCount);
+
+        auto workSize       = numRows / threadCount;
+        auto workSizeRemain = numRows % threadCount;
+
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            workers[i] = std::thread(
+                CopyImageRowsWorker,
+                std::cref(srcImageDesc),
+                dst,
+                rowSize,
+                extent.height,
+                offset,
+                offset + workSize
+            );
+            offset += workSize;
+        }
+
+        /* Copy remaining rows on main thread */
+        if (workSizeRemain > 0)
+            CopyImageRowsWorker(srcImageDesc, dst, rowSize, extent.height, offset, offset + workSizeRemain);
+
+        /* Join worker threads */
+        for (auto& w : workers)
+            w.join();
+    }
+    else
+    {
+        /* Copy rows only on main thread */
+        CopyImageRowsWorker(srcImageDesc, dst, rowSize, extent.height, 0, numRows);
+    }
+}
+
+// Writes the source image tightly packed into the destination image, converting it if necessary.
+static void WriteImage(const SrcImageDescriptor& srcImageDesc, const DstImageDescriptor& dstImageDesc, const Extent3D& extent, std::size_t threadCount)
+{
+    if (!ConvertImageBuffer(srcImageDesc, dstImageDesc, extent, threadCount))
+        CopyImageRows(srcImageDesc, dstImageDesc.data, extent, threadCount);
+}
+
+static bool IsConversionPending(const std::future<void>& conversion)
+{
+    return (conversion.valid() && conversion.wait_for(std::chrono::seconds(0)) != std::future_status::ready);
+}
+
+GLUploadRing::~GLUploadRing()
+{
+    Clear();
+}
+
+bool GLUploadRing::IsSupported()
+{
+    return
+    (
+        HasExtension(GLExt::ARB_buffer_storage)     &&
+        HasExtension(GLExt::ARB_map_buffer_range)   &&
+        HasExtension(GLExt::ARB_sync)
+    );
+}
+
+std::uint64_t GLUploadRing::Enqueue(
+    const SrcImageDescriptor&   srcImageDesc,
+    ImageFormat                 dstFormat,
+    DataType                    dstDataType,
+    const Extent3D&             extent,
+    std::size_t                 threadCount,
+    const UploadCommand&        command,
+    bool                        async)
+{
+    /* Check if image fits into the ring buffer */
+    const auto numTexels    = static_cast<std::size_t>(extent.width) * extent.height * extent.depth;
+    const auto dataSize     = ImageDataSize(dstFormat, dstDataType, numTexels);
+    const auto size         = GetAlignedSize(static_cast<GLsizeiptr>(dataSize), g_ringBufferAlignment);
+
+    if (dataSize == 0 || size > g_ringBufferSize)
+        return 0;
+
+    if (mappedData_ == nullptr && !CreateBuffer())
+        return 0;
+
+    /* Allocate segment with image descriptor that refers to the offset within the ring buffer */
+    auto& segment = Alloc(size);
+    {
+        segment.id          = nextID_++;
+        segment.imageDesc   = SrcImageDescriptor{ dstFormat, dstDataType, reinterpret_cast<const void*>(segment.offset), dataSize };
+        segment.command     = command;
+    }
+
+    /* Write image into ring buffer; the conversion is distributed over the worker threads */
+    const DstImageDescriptor dstImageDesc{ dstFormat, dstDataType, mappedData_ + segment.offset, dataSize };
+
+    if (async)
+        segment.conversion = std::async(std::launch::async, WriteImage, srcImageDesc, dstImageDesc, extent, threadCount);
+    else
+        WriteImage(srcImageDesc, dstImageDesc, extent, threadCount);
+
+    return segment.id;
+}
+
+bool GLUploadRing::Query(std::uint64_t uploadID, bool wait)
+{
+    /* Issue uploads in the order they were enqueued, so they cannot overtake each other for the same texture region */
+    bool issued = false;
+
+    for (auto& segment : segments_)
+    {
+        if (!segment.command)
+            continue;
+        if (!(wait && segment.id <= uploadID) && IsConversionPending(segment.conversion))
+            break;
+        Issue(segment);
+        issued = true;
+    }
+
+    if (issued)
+        SubmitFence();
+
+    /* Unknown identifiers refer to uploads whose segments have already been reused */
+    for (const auto& segment : segments_)
+    {
+        if (segment.id == uploadID)
+            return !segment.command;
+    }
+
+    return true;
+}
+
+void GLUploadRing::Flush()
+{
+    if (!segments_.empty())
+        Query(segments_.back().id, true);
+}
+
+std::uint64_t GLUploadRing::GenerateCompletedID()
+{
+    return nextID_++;
+}
+
+void GLUploadRing::Clear()
+{
+    /* Wait for all conversions that are still in progress */
+    for (auto& segment : segments_)
+    {
+        if (segment.conversion.valid())
+            segment.conversion.wait();
+    }
+
+    if (id_ != 0)
+    {
+        /* Wait for all pending uploads before the buffer is unmapped */
+        for (const auto& segment : segments_)
+        {
+            if (segment.fence)
+                segment.fence->Wait(GL_TIMEOUT_IGNORED);
+        }
+        segments_.clear();
+
+        /* Release buffer */
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, id_);
+        if (mappedData_ != nullptr)
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+
+        GLStateManager::Get().NotifyBufferRelease(id_, GLBufferTarget::PIXEL_UNPACK_BUFFER);
+        glDeleteBuffers(1, &id_);
+
+        id_         = 0;
+        mappedData_ = nullptr;
+        capacity_   = 0;
+        head_       = 0;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLUploadRing::CreateBuffer()
+{
+    #if defined GL_ARB_buffer_storage && defined GL_ARB_map_buffer_range
+
+    if (id_ == 0)
+    {
+        /* Allocate immutable buffer storage and map it persistently */
+        const GLbitfield flags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+        glGenBuffers(1, &id_);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, id_);
+        {
+            glBufferStorage(GL_PIXEL_UNPACK_BUFFER, g_ringBufferSize, nullptr, flags);
+            mappedData_ = reinterpret_cast<char*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, g_ringBufferSize, flags));
+        }
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+
+        capacity_ = g_ringBufferSize;
+    }
+
+    #endif // /GL_ARB_buffer_storage && GL_ARB_map_buffer_range
+
+    return (mappedData_ != nullptr);
+}
+
+GLUploadRing::Segment& GLUploadRing::Alloc(GLsizeiptr size)
+{
+    for (;;)
+    {
+        if (segments_.empty())
+        {
+            /* Ring buffer is unused, so start at the beginning */
+            head_ = 0;
+            break;
+        }
+
+        const auto tail = segments_.front().offset;
+
+        if (head_ > tail)
+        {
+            /* Free ranges are [head, capacity) and [0, tail) */
+            if (head_ + size <= capacity_)
+                break;
+            if (size <= tail)
+            {
+                head_ = 0;
+                break;
+            }
+        }
+        else if (head_ < tail)
+        {
+            /* Free range is [head, tail) */
+            if (head_ + size <= tail)
+                break;
+        }
+
+        /* Wait until the GPU has consumed the oldest segment, whose upload must be issued first */
+        auto& front = segments_.front();
+        if (!front.fence)
+        {
+            if (front.command)
+                Issue(front);
+            SubmitFence();
+        }
+        segments_.front().fence->Wait(GL_TIMEOUT_IGNORED);
+        segments_.pop_front();
+    }
+
+    /* Allocate new segment at the head of the ring buffer */
+    Segment segment;
+    {
+        segment.offset  = head_;
+        segment.size    = size;
+    }
+    segments_.emplace_back(std::move(segment));
+
+    head_ += size;
+
+    return segments_.back();
+}
+
+void GLUploadRing::Issue(Segment& segment)
+{
+    auto command = std::move(segment.command);
+    segment.command = nullptr;
+
+    /* Wait for the worker thread and forward its exceptions */
+    if (segment.conversion.valid())
+        segment.conversion.get();
+
+    /* Issue upload command while the ring buffer is bound */
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, id_);
+    {
+        command(segment.imageDesc);
+    }
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+}
+
+void GLUploadRing::SubmitFence()
+{
+    /* Submit one fence for all segments whose uploads have been issued since the previous submission */
+    std::shared_ptr<GLFence> fence;
+
+    for (auto& segment : segments_)
+    {
+        if (segment.fence)
+            continue;
+        if (segment.command)
+            break;
+        if (!fence)
+        {
+            fence = std::make_shared<GLFence>();
+            fence->Submit();
+        }
+        segment.fence = fence;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,116 @@
+/*
+ * GLUploadRing.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_UPLOAD_RING_H
+#define LLGL_GL_UPLOAD_RING_H
+
+
+#include <LLGL/ImageFlags.h>
+#include "../OpenGL.h"
+#include "../RenderState/GLFence.h"
+#include <deque>
+#include <memory>
+#include <future>
+#include <functional>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Ring of a persistently mapped pixel unpack buffer (GL_PIXEL_UNPACK_BUFFER) for texture uploads.
+Source images are converted into the ring buffer on worker threads, while the glTexSubImage* commands are issued on the render thread.
+*/
+class GLUploadRing
+{
+
+    public:
+
+        // Callback to issue the glTexSubImage* command for an image within the ring buffer, while the buffer is bound.
+        using UploadCommand = std::function<void(const SrcImageDescriptor& bufferImageDesc)>;
+
+    public:
+
+        GLUploadRing() = default;
+        ~GLUploadRing();
+
+        GLUploadRing(const GLUploadRing&) = delete;
+        GLUploadRing& operator = (const GLUploadRing&) = delete;
+
+        // Returns true if the upload ring is supported, i.e. persistently mapped buffers and sync objects are available.
+        static bool IsSupported();
+
+        /*
+        Allocates a segment of the ring buffer and converts the source image into the specified format, either on a worker thread or on the calling thread.
+        The upload command is issued by Query once the conversion has finished, so the source image must remain valid until then.
+        Returns the identifier of the new upload, or 0 if the image does not fit into the ring buffer.
+        */
+        std::uint64_t Enqueue(
+            const SrcImageDescriptor&   srcImageDesc,
+            ImageFormat                 dstFormat,
+            DataType                    dstDataType,
+            const Extent3D&             extent,
+            std::size_t                 threadCount,
+            const UploadCommand&        command,
+            bool                        async
+        );
+
+        // Issues the commands of all uploads whose conversion has finished in the order they were enqueued, and returns true if the specified upload has been issued.
+        bool Query(std::uint64_t uploadID, bool wait);
+
+        // Issues the commands of all pending uploads, e.g. before an upload that bypasses the ring buffer.
+        void Flush();
+
+        // Returns a new upload identifier, which refers to an upload that has already been completed.
+        std::uint64_t GenerateCompletedID();
+
+        // Waits for all pending uploads and releases the ring buffer. Uploads that have not been issued yet are discarded.
+        void Clear();
+
+    private:
+
+        struct Segment
+        {
+            std::uint64_t               id          = 0;
+            GLintptr                    offset      = 0;
+            GLsizeiptr                  size        = 0;
+            SrcImageDescriptor          imageDesc;                  // Image descriptor with the offset within the ring buffer
+            UploadCommand               command;                    // Reset once the command has been issued
+            std::future<void>           conversion;                 // Only valid for asynchronous conversions
+            std::shared_ptr<GLFence>    fence;                      // Submitted after the command has been issued
+        };
+
+    private:
+
+        bool CreateBuffer();
+        Segment& Alloc(GLsizeiptr size);
+
+        void Issue(Segment& segment);
+        void SubmitFence();
+
+    private:
+
+        GLuint              id_         = 0;
+        char*               mappedData_ = nullptr;
+        GLsizeiptr          capacity_   = 0;
+        GLintptr            head_       = 0;
+        std::deque<Segment> segments_;
+        std::uint64_t       nextID_     = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,102 @@
+/*
+ * PipelineLayoutCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "PipelineLayoutCache.h"
+#include "../Core/Helper.h"
+
+
+namespace LLGL
+{
+
+
+// Combines the specified hash value with the bytes of the specified value (FNV-1a).
+template <typename T>
+static void HashCombine(std::uint64_t& seed, const T& value)
+{
+    seed ^= HashBuffer(&value, sizeof(value));
+    seed *= 1099511628211ull;
+}
+
+static std::uint64_t HashPipelineLayoutDesc(const PipelineLayoutDescriptor& desc)
+{
+    std::uint64_t seed = 14695981039346656037ull;
+
+    for (const auto& binding : desc.bindings)
+    {
+        HashCombine(seed, binding.type);
+        HashCombine(seed, binding.bindFlags);
+        HashCombine(seed, binding.stageFlags);
+        HashCombine(seed, binding.slot);
+        HashCombine(seed, binding.arraySize);
+        HashCombine(seed, HashBuffer(binding.name.data(), binding.name.size()));
+    }
+
+    return seed;
+}
+
+PipelineLayout* PipelineLayoutCache::Find(const PipelineLayoutDescriptor& desc)
+{
+    auto range = entries_.equal_range(HashPipelineLayoutDesc(desc));
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.desc == desc)
+        {
+            ++(it->second.refCount);
+            return it->second.pipelineLayout;
+        }
+    }
+    return nullptr;
+}
+
+void PipelineLayoutCache::Insert(const PipelineLayoutDescriptor& desc, PipelineLayout* pipelineLayout)
+{
+    if (pipelineLayout != nullptr)
+    {
+        const auto hash = HashPipelineLayoutDesc(desc);
+
+        Entry entry;
+        {
+            entry.desc              = desc;
+            entry.pipelineLayout    = pipelineLayout;
+            entry.refCount          = 1;
+        }
+        entries_.insert({ hash, std::move(entry) });
+
+        hashes_[pipelineLayout] = hash;
+    }
+}
+
+bool PipelineLayoutCache::Release(const PipelineLayout* pipelineLayout)
+{
+    /* Layouts that have not been registered are destroyed immediately */
+    auto itHash = hashes_.find(pipelineLayout);
+    if (itHash == hashes_.end())
+        return true;
+
+    auto range = entries_.equal_range(itHash->second);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.pipelineLayout == pipelineLayout)
+        {
+            if (--(it->second.refCount) > 0)
+                return false;
+            entries_.erase(it);
+            break;
+        }
+    }
+
+    hashes_.erase(itHash);
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,68 @@
+/*
+ * PipelineLayoutCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_PIPELINE_LAYOUT_CACHE_H
+#define LLGL_PIPELINE_LAYOUT_CACHE_H
+
+
+#include <LLGL/PipelineLayout.h>
+#include <LLGL/PipelineLayoutFlags.h>
+#include <unordered_map>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Interning table for the pipeline layouts of a render system.
+Identical pipeline layout descriptors map to the same PipelineLayout object,
+which is reference counted and only destroyed once it has been released as often as it has been created.
+*/
+class PipelineLayoutCache
+{
+
+    public:
+
+        // Returns the cached pipeline layout for the specified descriptor and increments its reference count, or null if there is no such layout.
+        PipelineLayout* Find(const PipelineLayoutDescriptor& desc);
+
+        // Registers the specified pipeline layout that has been created with the specified descriptor.
+        void Insert(const PipelineLayoutDescriptor& desc, PipelineLayout* pipelineLayout);
+
+        /*
+        Decrements the reference count of the specified pipeline layout.
+        Returns true if the layout is no longer referenced and must be destroyed by the render system.
+        */
+        bool Release(const PipelineLayout* pipelineLayout);
+
+    private:
+
+        struct Entry
+        {
+            PipelineLayoutDescriptor    desc;
+            PipelineLayout*             pipelineLayout  = nullptr;
+            std::uint32_t               refCount        = 0;
+        };
+
+    private:
+
+        std::unordered_multimap<std::uint64_t, Entry>               entries_;
+        std::unordered_map<const PipelineLayout*, std::uint64_t>    hashes_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
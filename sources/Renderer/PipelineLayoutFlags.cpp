@@ -0,0 +1,51 @@
+/*
+ * PipelineLayoutFlags.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/PipelineLayoutFlags.h>
+#include "../Core/HelperMacros.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Operators ----- */
+
+LLGL_EXPORT bool operator == (const BindingDescriptor& lhs, const BindingDescriptor& rhs)
+{
+    return
+    (
+        LLGL_COMPARE_MEMBER_EQ( type       ) &&
+        LLGL_COMPARE_MEMBER_EQ( bindFlags  ) &&
+        LLGL_COMPARE_MEMBER_EQ( stageFlags ) &&
+        LLGL_COMPARE_MEMBER_EQ( slot       ) &&
+        LLGL_COMPARE_MEMBER_EQ( arraySize  ) &&
+        LLGL_COMPARE_MEMBER_EQ( name       )
+    );
+}
+
+LLGL_EXPORT bool operator != (const BindingDescriptor& lhs, const BindingDescriptor& rhs)
+{
+    return !(lhs == rhs);
+}
+
+LLGL_EXPORT bool operator == (const PipelineLayoutDescriptor& lhs, const PipelineLayoutDescriptor& rhs)
+{
+    return (lhs.bindings == rhs.bindings);
+}
+
+LLGL_EXPORT bool operator != (const PipelineLayoutDescriptor& lhs, const PipelineLayoutDescriptor& rhs)
+{
+    return !(lhs == rhs);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
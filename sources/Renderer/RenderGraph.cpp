@@ -0,0 +1,990 @@
+/*
+ * RenderGraph.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/RenderGraph.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Constants.h>
+#include "../Core/Assertion.h"
+#include "../Core/WorkerPool.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+
+namespace LLGL
+{
+
+
+// Number of compilations after which unused textures, buffers, and render targets are released.
+static const std::uint32_t g_maxUnusedCompiles = 3;
+
+RenderGraph::RenderGraph(RenderSystem& renderSystem) :
+    renderSystem_ { renderSystem }
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+    for (auto& entry : deferredCommandBuffers_)
+        renderSystem_.Release(*entry.commandBuffer);
+    for (auto& entry : renderTargets_)
+        renderSystem_.Release(*entry.renderTarget);
+    for (auto& entry : renderPasses_)
+        renderSystem_.Release(*entry.renderPass);
+    for (auto& entry : transientTextures_)
+        renderSystem_.Release(*entry.texture);
+    for (auto& entry : transientBuffers_)
+        renderSystem_.Release(*entry.buffer);
+}
+
+/* ----- Declaration ----- */
+
+RenderGraphResource RenderGraph::CreateTexture(const TextureDescriptor& textureDesc, const char* name)
+{
+    auto resource = AddResource(ResourceType::Texture, name, false);
+    {
+        resources_.back().descIndex = static_cast<std::uint32_t>(textureDescs_.size());
+        textureDescs_.push_back(textureDesc);
+        textureDescs_.back().miscFlags |= MiscFlags::NoInitialData;
+    }
+    return resource;
+}
+
+RenderGraphResource RenderGraph::CreateBuffer(const BufferDescriptor& bufferDesc, const char* name)
+{
+    auto resource = AddResource(ResourceType::Buffer, name, false);
+    {
+        resources_.back().descIndex = static_cast<std::uint32_t>(bufferDescs_.size());
+        bufferDescs_.push_back(bufferDesc);
+        bufferDescs_.back().miscFlags |= MiscFlags::NoInitialData;
+    }
+    return resource;
+}
+
+RenderGraphResource RenderGraph::ImportTexture(Texture& texture, const char* name)
+{
+    auto resource = AddResource(ResourceType::Texture, name, true);
+    resources_.back().texture = &texture;
+    return resource;
+}
+
+RenderGraphResource RenderGraph::ImportBuffer(Buffer& buffer, const char* name)
+{
+    auto resource = AddResource(ResourceType::Buffer, name, true);
+    resources_.back().buffer = &buffer;
+    return resource;
+}
+
+RenderGraphResource RenderGraph::ImportRenderTarget(RenderTarget& renderTarget, const char* name)
+{
+    auto resource = AddResource(ResourceType::RenderTarget, name, true);
+    resources_.back().renderTarget = &renderTarget;
+    return resource;
+}
+
+void RenderGraph::AddPass(const RenderGraphPassDescriptor& passDesc, const RenderGraphPassCallback& callback)
+{
+    /* Validate pass against all previously declared passes */
+    auto passIndex = static_cast<std::uint32_t>(passes_.size());
+
+    ValidatePassAttachments(passDesc, passIndex);
+    ValidatePassResources(passDesc, passIndex);
+
+    /* Mark all outputs as written, so subsequent passes can read them */
+    for (const auto& attachment : passDesc.attachments)
+        resources_[attachment.resource].written = true;
+    for (auto resource : passDesc.writes)
+        resources_[resource].written = true;
+
+    /* Append new pass */
+    PassEntry pass;
+    {
+        pass.desc       = passDesc;
+        pass.callback   = callback;
+    }
+    passes_.push_back(std::move(pass));
+
+    compiled_ = false;
+}
+
+void RenderGraph::Reset()
+{
+    resources_.clear();
+    textureDescs_.clear();
+    bufferDescs_.clear();
+    passes_.clear();
+    executionOrder_.clear();
+    passGroups_.clear();
+    clearValues_.clear();
+    compiled_ = false;
+}
+
+/* ----- Execution ----- */
+
+void RenderGraph::Compile()
+{
+    CullPasses();
+    ComputeLifetimes();
+    AssignTransientResources();
+    BuildPassGroups();
+    ReleaseUnusedResources();
+    UpdateStatistics();
+    compiled_ = true;
+}
+
+void RenderGraph::Execute(CommandBuffer& commandBuffer, std::size_t threadCount)
+{
+    if (!compiled_)
+        Compile();
+
+    /* Encode passes with parallel encoding into deferred command buffers first */
+    if (threadCount >= Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    std::size_t numDeferredPasses = 0, deferredPass = 0;
+
+    if (threadCount > 1)
+        numDeferredPasses = EncodeDeferredPasses(threadCount);
+
+    /* Encode all pass groups into the primary command buffer */
+    for (const auto& group : passGroups_)
+    {
+        if (group.renderTarget != nullptr)
+        {
+            commandBuffer.BeginRenderPass(
+                *group.renderTarget,
+                group.renderPass,
+                group.numClearValues,
+                (group.numClearValues > 0 ? &clearValues_[group.firstClearValue] : nullptr)
+            );
+
+            /* Clear imported render targets manually, since their render pass is not known */
+            if (group.renderPass == nullptr)
+            {
+                const auto& firstPass = passes_[executionOrder_[group.firstPass]];
+
+                long clearFlags = 0;
+
+                for (const auto& attachment : firstPass.desc.attachments)
+                {
+                    if (attachment.loadOp == AttachmentLoadOp::Clear)
+                    {
+                        switch (attachment.type)
+                        {
+                            case AttachmentType::Color:
+                                commandBuffer.SetClearColor(attachment.clearValue.color);
+                                clearFlags |= ClearFlags::Color;
+                                break;
+                            case AttachmentType::Depth:
+                                commandBuffer.SetClearDepth(attachment.clearValue.depth);
+                                clearFlags |= ClearFlags::Depth;
+                                break;
+                            case AttachmentType::DepthStencil:
+                                commandBuffer.SetClearDepth(attachment.clearValue.depth);
+                                commandBuffer.SetClearStencil(attachment.clearValue.stencil);
+                                clearFlags |= ClearFlags::DepthStencil;
+                                break;
+                            case AttachmentType::Stencil:
+                                commandBuffer.SetClearStencil(attachment.clearValue.stencil);
+                                clearFlags |= ClearFlags::Stencil;
+                                break;
+                        }
+                    }
+                }
+
+                if (clearFlags != 0)
+                    commandBuffer.Clear(clearFlags);
+            }
+
+            /* Encode passes or execute their deferred command buffers within the same render pass */
+            for (std::uint32_t i = 0; i < group.numPasses; ++i)
+            {
+                auto passIndex = executionOrder_[group.firstPass + i];
+                if (deferredPass < numDeferredPasses && deferredCommandBuffers_[deferredPass].pass == passIndex)
+                    commandBuffer.Execute(*deferredCommandBuffers_[deferredPass++].commandBuffer);
+                else
+                    EncodePass(commandBuffer, passes_[passIndex]);
+            }
+
+            commandBuffer.EndRenderPass();
+        }
+        else
+            EncodePass(commandBuffer, passes_[executionOrder_[group.firstPass]]);
+    }
+}
+
+/* ----- Resources ----- */
+
+Texture* RenderGraph::GetTexture(RenderGraphResource resource) const
+{
+    return GetResourceEntry(resource).texture;
+}
+
+Buffer* RenderGraph::GetBuffer(RenderGraphResource resource) const
+{
+    return GetResourceEntry(resource).buffer;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+static std::string GetPassLabel(const RenderGraphPassDescriptor& passDesc, std::uint32_t passIndex)
+{
+    if (passDesc.name != nullptr)
+        return ("render graph pass '" + std::string(passDesc.name) + "'");
+    else
+        return ("render graph pass #" + std::to_string(passIndex));
+}
+
+static std::string GetResourceLabel(const char* name, RenderGraphResource resource)
+{
+    if (name != nullptr)
+        return ("'" + std::string(name) + "'");
+    else
+        return ("#" + std::to_string(resource));
+}
+
+static bool Contains(const std::vector<RenderGraphResource>& resources, RenderGraphResource resource)
+{
+    return (std::find(resources.begin(), resources.end(), resource) != resources.end());
+}
+
+static bool IsEqualTextureDesc(const TextureDescriptor& lhs, const TextureDescriptor& rhs)
+{
+    return
+    (
+        lhs.type            == rhs.type             &&
+        lhs.bindFlags       == rhs.bindFlags        &&
+        lhs.cpuAccessFlags  == rhs.cpuAccessFlags   &&
+        lhs.miscFlags       == rhs.miscFlags        &&
+        lhs.format          == rhs.format           &&
+        lhs.extent.width    == rhs.extent.width     &&
+        lhs.extent.height   == rhs.extent.height    &&
+        lhs.extent.depth    == rhs.extent.depth     &&
+        lhs.arrayLayers     == rhs.arrayLayers      &&
+        lhs.mipLevels       == rhs.mipLevels        &&
+        lhs.samples         == rhs.samples
+    );
+}
+
+static bool IsEqualBufferDesc(const BufferDescriptor& lhs, const BufferDescriptor& rhs)
+{
+    return
+    (
+        lhs.vertexAttribs.empty()                                       &&
+        rhs.vertexAttribs.empty()                                       &&
+        lhs.size                        == rhs.size                     &&
+        lhs.bindFlags                   == rhs.bindFlags                &&
+        lhs.cpuAccessFlags              == rhs.cpuAccessFlags           &&
+        lhs.miscFlags                   == rhs.miscFlags                &&
+        lhs.indexFormat                 == rhs.indexFormat              &&
+        lhs.storageBuffer.storageType   == rhs.storageBuffer.storageType&&
+        lhs.storageBuffer.format        == rhs.storageBuffer.format     &&
+        lhs.storageBuffer.stride        == rhs.storageBuffer.stride
+    );
+}
+
+static bool IsEqualAttachmentFormat(const AttachmentFormatDescriptor& lhs, const AttachmentFormatDescriptor& rhs)
+{
+    return (lhs.format == rhs.format && lhs.loadOp == rhs.loadOp && lhs.storeOp == rhs.storeOp);
+}
+
+static bool IsEqualRenderPassDesc(const RenderPassDescriptor& lhs, const RenderPassDescriptor& rhs)
+{
+    if (lhs.colorAttachments.size() != rhs.colorAttachments.size())
+        return false;
+
+    for (std::size_t i = 0; i < lhs.colorAttachments.size(); ++i)
+    {
+        if (!IsEqualAttachmentFormat(lhs.colorAttachments[i], rhs.colorAttachments[i]))
+            return false;
+    }
+
+    return
+    (
+        IsEqualAttachmentFormat(lhs.depthAttachment, rhs.depthAttachment) &&
+        IsEqualAttachmentFormat(lhs.stencilAttachment, rhs.stencilAttachment)
+    );
+}
+
+static bool IsEqualAttachments(const std::vector<AttachmentDescriptor>& lhs, const std::vector<AttachmentDescriptor>& rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        if (lhs[i].type       != rhs[i].type    ||
+            lhs[i].texture    != rhs[i].texture ||
+            lhs[i].mipLevel   != rhs[i].mipLevel||
+            lhs[i].arrayLayer != rhs[i].arrayLayer)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+RenderGraphResource RenderGraph::AddResource(const ResourceType type, const char* name, bool imported)
+{
+    ResourceEntry entry;
+    {
+        entry.type      = type;
+        entry.name      = name;
+        entry.imported  = imported;
+        entry.written   = imported;
+    }
+    resources_.push_back(entry);
+    compiled_ = false;
+    return static_cast<RenderGraphResource>(resources_.size() - 1);
+}
+
+const RenderGraph::ResourceEntry& RenderGraph::GetResourceEntry(RenderGraphResource resource) const
+{
+    LLGL_ASSERT_UPPER_BOUND(resource, resources_.size());
+    return resources_[resource];
+}
+
+void RenderGraph::ValidatePassAttachments(const RenderGraphPassDescriptor& passDesc, std::uint32_t passIndex) const
+{
+    if (passDesc.attachments.empty())
+    {
+        if ((passDesc.flags & RenderGraphPassFlags::ParallelEncoding) != 0)
+            throw std::invalid_argument(GetPassLabel(passDesc, passIndex) + " cannot be encoded in parallel without attachments");
+        return;
+    }
+
+    Extent3D extent;
+
+    for (std::size_t i = 0; i < passDesc.attachments.size(); ++i)
+    {
+        const auto& attachment  = passDesc.attachments[i];
+        const auto& entry       = GetResourceEntry(attachment.resource);
+        const auto  label       = GetPassLabel(passDesc, passIndex) + " with attachment " + GetResourceLabel(entry.name, attachment.resource);
+
+        if (entry.type == ResourceType::Buffer)
+            throw std::invalid_argument(label + " refers to a buffer");
+
+        /* Imported render targets cannot be mixed with other attachments */
+        if (entry.type == ResourceType::RenderTarget || resources_[passDesc.attachments[0].resource].type == ResourceType::RenderTarget)
+        {
+            if (attachment.resource != passDesc.attachments[0].resource)
+                throw std::invalid_argument(label + " mixes an imported render target with other attachments");
+            continue;
+        }
+
+        /* Validate attachments have the same extent */
+        auto attachmentExtent = (entry.imported ? entry.texture->GetMipExtent(0) : textureDescs_[entry.descIndex].extent);
+
+        if (i == 0)
+            extent = attachmentExtent;
+        else if (attachmentExtent.width != extent.width || attachmentExtent.height != extent.height)
+            throw std::invalid_argument(label + " has a different extent than the first attachment");
+
+        /* Validate previous content is defined if it is loaded */
+        if (attachment.loadOp == AttachmentLoadOp::Load && !entry.written)
+            throw std::invalid_argument(label + " loads the content of a transient texture before it is written");
+
+        if (Contains(passDesc.reads, attachment.resource) || Contains(passDesc.writes, attachment.resource))
+            throw std::invalid_argument(label + " uses the same resource in its reads or writes");
+    }
+}
+
+void RenderGraph::ValidatePassResources(const RenderGraphPassDescriptor& passDesc, std::uint32_t passIndex) const
+{
+    for (auto resource : passDesc.reads)
+    {
+        const auto& entry = GetResourceEntry(resource);
+
+        if (entry.type == ResourceType::RenderTarget)
+            throw std::invalid_argument(GetPassLabel(passDesc, passIndex) + " reads imported render target " + GetResourceLabel(entry.name, resource));
+        if (!entry.written)
+            throw std::invalid_argument(GetPassLabel(passDesc, passIndex) + " reads transient resource " + GetResourceLabel(entry.name, resource) + " before it is written");
+    }
+
+    for (auto resource : passDesc.writes)
+    {
+        const auto& entry = GetResourceEntry(resource);
+
+        if (entry.type == ResourceType::RenderTarget)
+            throw std::invalid_argument(GetPassLabel(passDesc, passIndex) + " writes imported render target " + GetResourceLabel(entry.name, resource) + " outside of its attachments");
+    }
+}
+
+/*
+Walks the passes backwards and keeps only the passes whose outputs are needed by a later pass, by an imported resource, or by a side effect.
+A resource is no longer needed before a pass that overwrites it entirely, i.e. an attachment that is not loaded.
+*/
+void RenderGraph::CullPasses()
+{
+    for (auto& entry : resources_)
+        entry.needed = entry.imported;
+
+    for (auto passIndex = passes_.size(); passIndex-- > 0;)
+    {
+        auto& pass = passes_[passIndex];
+
+        /* Determine whether any output of this pass is needed */
+        bool alive = ((pass.desc.flags & RenderGraphPassFlags::NeverCull) != 0);
+
+        for (const auto& attachment : pass.desc.attachments)
+            alive = (alive || resources_[attachment.resource].needed);
+        for (auto resource : pass.desc.writes)
+            alive = (alive || resources_[resource].needed);
+
+        pass.culled = !alive;
+
+        if (alive)
+        {
+            /* Attachments that are not loaded hide all previous writes */
+            for (const auto& attachment : pass.desc.attachments)
+            {
+                auto& entry = resources_[attachment.resource];
+                entry.needed = (entry.imported || attachment.loadOp == AttachmentLoadOp::Load);
+            }
+
+            /* All inputs of this pass are needed by previous passes */
+            for (auto resource : pass.desc.reads)
+                resources_[resource].needed = true;
+        }
+    }
+}
+
+void RenderGraph::ComputeLifetimes()
+{
+    executionOrder_.clear();
+
+    for (auto& entry : resources_)
+    {
+        entry.firstPass = ~0u;
+        entry.lastPass  = 0;
+    }
+
+    auto UpdateLifetime = [this](RenderGraphResource resource, std::uint32_t pass)
+    {
+        auto& entry = resources_[resource];
+        entry.firstPass = std::min(entry.firstPass, pass);
+        entry.lastPass  = std::max(entry.lastPass, pass);
+    };
+
+    for (std::uint32_t passIndex = 0; passIndex < passes_.size(); ++passIndex)
+    {
+        const auto& pass = passes_[passIndex];
+        if (!pass.culled)
+        {
+            auto executionIndex = static_cast<std::uint32_t>(executionOrder_.size());
+
+            for (const auto& attachment : pass.desc.attachments)
+                UpdateLifetime(attachment.resource, executionIndex);
+            for (auto resource : pass.desc.reads)
+                UpdateLifetime(resource, executionIndex);
+            for (auto resource : pass.desc.writes)
+                UpdateLifetime(resource, executionIndex);
+
+            executionOrder_.push_back(passIndex);
+        }
+    }
+}
+
+void RenderGraph::AssignTransientResources()
+{
+    for (auto& entry : transientTextures_)
+        entry.assigned = false;
+    for (auto& entry : transientBuffers_)
+        entry.assigned = false;
+
+    for (auto& entry : resources_)
+    {
+        if (!entry.imported)
+        {
+            entry.texture   = nullptr;
+            entry.buffer    = nullptr;
+        }
+    }
+
+    /* Assign textures and buffers in the order of first use, so resources with disjoint lifetimes can share the same object */
+    auto AssignResource = [this](RenderGraphResource resource, std::uint32_t executionIndex)
+    {
+        auto& entry = resources_[resource];
+        if (!entry.imported && entry.firstPass == executionIndex)
+        {
+            if (entry.type == ResourceType::Texture && entry.texture == nullptr)
+                entry.texture = AcquireTransientTexture(textureDescs_[entry.descIndex], entry.firstPass, entry.lastPass);
+            else if (entry.type == ResourceType::Buffer && entry.buffer == nullptr)
+                entry.buffer = AcquireTransientBuffer(bufferDescs_[entry.descIndex], entry.firstPass, entry.lastPass);
+        }
+    };
+
+    for (std::uint32_t executionIndex = 0; executionIndex < executionOrder_.size(); ++executionIndex)
+    {
+        const auto& pass = passes_[executionOrder_[executionIndex]];
+
+        for (const auto& attachment : pass.desc.attachments)
+            AssignResource(attachment.resource, executionIndex);
+        for (auto resource : pass.desc.reads)
+            AssignResource(resource, executionIndex);
+        for (auto resource : pass.desc.writes)
+            AssignResource(resource, executionIndex);
+    }
+}
+
+void RenderGraph::BuildPassGroups()
+{
+    passGroups_.clear();
+    clearValues_.clear();
+
+    for (auto& entry : renderTargets_)
+        ++entry.numUnusedCompiles;
+
+    /* Merge consecutive passes with the same attachments into a single group */
+    for (std::uint32_t executionIndex = 0; executionIndex < executionOrder_.size(); ++executionIndex)
+    {
+        const auto& pass = passes_[executionOrder_[executionIndex]];
+
+        if (!passGroups_.empty() && IsMergeable(passGroups_.back(), pass))
+            passGroups_.back().numPasses++;
+        else
+        {
+            PassGroup group;
+            {
+                group.firstPass = executionIndex;
+                group.numPasses = 1;
+                group.parallel  = ((pass.desc.flags & RenderGraphPassFlags::ParallelEncoding) != 0);
+            }
+            passGroups_.push_back(group);
+        }
+    }
+
+    /* Create render passes and render targets for all groups with attachments */
+    for (auto& group : passGroups_)
+    {
+        if (!passes_[executionOrder_[group.firstPass]].desc.attachments.empty())
+            BuildRenderPass(group);
+    }
+}
+
+void RenderGraph::BuildRenderPass(PassGroup& group)
+{
+    const auto& attachments = passes_[executionOrder_[group.firstPass]].desc.attachments;
+
+    /* Use imported render targets with their own render pass */
+    const auto& firstEntry = resources_[attachments.front().resource];
+    if (firstEntry.type == ResourceType::RenderTarget)
+    {
+        group.renderTarget = firstEntry.renderTarget;
+        return;
+    }
+
+    /*
+    Determine attachment formats, clear values, and whether the content must be stored.
+    Groups with multiple passes always store their content, since the backend may split their render pass,
+    e.g. Vulkan when a pass records barriers or copies, or when inline and secondary command buffers are mixed.
+    */
+    const bool alwaysStore = (group.numPasses > 1);
+
+    RenderPassDescriptor renderPassDesc;
+    std::vector<AttachmentDescriptor> targetAttachments;
+    ClearValue depthStencilClearValue;
+    bool hasDepthStencil = false;
+    Extent3D extent;
+
+    group.firstClearValue = static_cast<std::uint32_t>(clearValues_.size());
+
+    for (const auto& attachment : attachments)
+    {
+        const auto& entry = resources_[attachment.resource];
+
+        AttachmentFormatDescriptor formatDesc;
+        {
+            formatDesc.format   = (entry.imported ? entry.texture->GetDesc().format : textureDescs_[entry.descIndex].format);
+            formatDesc.loadOp   = attachment.loadOp;
+            formatDesc.storeOp  = (alwaysStore || IsStoreRequired(attachment.resource, group) ? AttachmentStoreOp::Store : AttachmentStoreOp::Undefined);
+        }
+
+        switch (attachment.type)
+        {
+            case AttachmentType::Color:
+                renderPassDesc.colorAttachments.push_back(formatDesc);
+                clearValues_.push_back(attachment.clearValue);
+                break;
+            case AttachmentType::Depth:
+                renderPassDesc.depthAttachment = formatDesc;
+                break;
+            case AttachmentType::DepthStencil:
+                renderPassDesc.depthAttachment = formatDesc;
+                renderPassDesc.stencilAttachment = formatDesc;
+                break;
+            case AttachmentType::Stencil:
+                renderPassDesc.stencilAttachment = formatDesc;
+                break;
+        }
+
+        if (attachment.type != AttachmentType::Color)
+        {
+            depthStencilClearValue  = attachment.clearValue;
+            hasDepthStencil         = true;
+        }
+
+        if (targetAttachments.empty())
+            extent = (entry.imported ? entry.texture->GetMipExtent(0) : textureDescs_[entry.descIndex].extent);
+
+        targetAttachments.push_back(AttachmentDescriptor{ attachment.type, entry.texture });
+    }
+
+    /* Clear values are ordered by color attachments first, then depth-stencil attachment */
+    if (hasDepthStencil)
+        clearValues_.push_back(depthStencilClearValue);
+
+    group.numClearValues    = static_cast<std::uint32_t>(clearValues_.size()) - group.firstClearValue;
+    group.renderPass        = AcquireRenderPass(renderPassDesc);
+    group.renderTarget      = AcquireRenderTarget(targetAttachments, Extent2D{ extent.width, extent.height });
+}
+
+void RenderGraph::ReleaseUnusedResources()
+{
+    /* Release render targets first, since they refer to the transient textures */
+    for (auto it = renderTargets_.begin(); it != renderTargets_.end();)
+    {
+        if (it->numUnusedCompiles > g_maxUnusedCompiles)
+        {
+            renderSystem_.Release(*(it->renderTarget));
+            it = renderTargets_.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (auto it = transientTextures_.begin(); it != transientTextures_.end();)
+    {
+        it->numUnusedCompiles = (it->assigned ? 0 : it->numUnusedCompiles + 1);
+        if (it->numUnusedCompiles > g_maxUnusedCompiles)
+        {
+            renderSystem_.Release(*(it->texture));
+            it = transientTextures_.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (auto it = transientBuffers_.begin(); it != transientBuffers_.end();)
+    {
+        it->numUnusedCompiles = (it->assigned ? 0 : it->numUnusedCompiles + 1);
+        if (it->numUnusedCompiles > g_maxUnusedCompiles)
+        {
+            renderSystem_.Release(*(it->buffer));
+            it = transientBuffers_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+void RenderGraph::UpdateStatistics()
+{
+    stats_ = RenderGraphStatistics{};
+
+    stats_.numPasses        = static_cast<std::uint32_t>(passes_.size());
+    stats_.numCulledPasses  = static_cast<std::uint32_t>(passes_.size() - executionOrder_.size());
+    stats_.numMergedPasses  = static_cast<std::uint32_t>(executionOrder_.size() - passGroups_.size());
+
+    for (const auto& group : passGroups_)
+    {
+        if (group.renderTarget != nullptr)
+            stats_.numRenderPasses++;
+    }
+
+    for (const auto& entry : resources_)
+    {
+        if (!entry.imported)
+        {
+            if (entry.texture != nullptr)
+                stats_.numTransientTextures++;
+            else if (entry.buffer != nullptr)
+                stats_.numTransientBuffers++;
+        }
+    }
+
+    for (const auto& entry : transientTextures_)
+    {
+        if (entry.assigned)
+            stats_.numPhysicalTextures++;
+    }
+
+    for (const auto& entry : transientBuffers_)
+    {
+        if (entry.assigned)
+            stats_.numPhysicalBuffers++;
+    }
+
+    /* Count the usage changes of each resource between the executed passes */
+    enum class Usage : char { None, Attachment, Read, Write };
+
+    std::vector<Usage> usages(resources_.size(), Usage::None);
+
+    auto UpdateUsage = [this, &usages](RenderGraphResource resource, Usage usage)
+    {
+        if (usages[resource] != Usage::None && usages[resource] != usage)
+            stats_.numTransitions++;
+        usages[resource] = usage;
+    };
+
+    for (auto passIndex : executionOrder_)
+    {
+        const auto& pass = passes_[passIndex];
+
+        for (const auto& attachment : pass.desc.attachments)
+            UpdateUsage(attachment.resource, Usage::Attachment);
+        for (auto resource : pass.desc.reads)
+            UpdateUsage(resource, Usage::Read);
+        for (auto resource : pass.desc.writes)
+            UpdateUsage(resource, Usage::Write);
+    }
+}
+
+bool RenderGraph::IsMergeable(const PassGroup& group, const PassEntry& pass) const
+{
+    const auto& firstPass = passes_[executionOrder_[group.firstPass]];
+
+    /* Only passes with the same attachments and the same kind of encoding can share a render pass */
+    if (firstPass.desc.attachments.empty() || firstPass.desc.attachments.size() != pass.desc.attachments.size())
+        return false;
+
+    if (group.parallel != ((pass.desc.flags & RenderGraphPassFlags::ParallelEncoding) != 0))
+        return false;
+
+    for (std::size_t i = 0; i < pass.desc.attachments.size(); ++i)
+    {
+        const auto& lhs = firstPass.desc.attachments[i];
+        const auto& rhs = pass.desc.attachments[i];
+        if (lhs.resource != rhs.resource || lhs.type != rhs.type || rhs.loadOp == AttachmentLoadOp::Clear)
+            return false;
+    }
+
+    /* The pass must not read anything that is written by another pass of the group without a render pass boundary */
+    for (std::uint32_t i = 0; i < group.numPasses; ++i)
+    {
+        const auto& groupPass = passes_[executionOrder_[group.firstPass + i]];
+        for (auto resource : groupPass.desc.writes)
+        {
+            if (Contains(pass.desc.reads, resource) || Contains(pass.desc.writes, resource))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool RenderGraph::IsStoreRequired(RenderGraphResource resource, const PassGroup& group) const
+{
+    const auto& entry = resources_[resource];
+
+    /* Find the next use after this group: the content is only required if it is read before it is overwritten */
+    for (auto executionIndex = group.firstPass + group.numPasses; executionIndex < executionOrder_.size(); ++executionIndex)
+    {
+        const auto& pass = passes_[executionOrder_[executionIndex]];
+
+        if (Contains(pass.desc.reads, resource) || Contains(pass.desc.writes, resource))
+            return true;
+
+        for (const auto& attachment : pass.desc.attachments)
+        {
+            if (attachment.resource == resource)
+                return (entry.imported || attachment.loadOp == AttachmentLoadOp::Load);
+        }
+    }
+
+    return entry.imported;
+}
+
+Texture* RenderGraph::AcquireTransientTexture(const TextureDescriptor& textureDesc, std::uint32_t firstPass, std::uint32_t lastPass)
+{
+    /* Find texture whose previous resource has ended its lifetime before this one begins */
+    for (auto& entry : transientTextures_)
+    {
+        if ((!entry.assigned || entry.lastPass < firstPass) && IsEqualTextureDesc(entry.desc, textureDesc))
+        {
+            entry.lastPass  = lastPass;
+            entry.assigned  = true;
+            return entry.texture;
+        }
+    }
+
+    /* Create new texture */
+    TransientTexture entry;
+    {
+        entry.desc      = textureDesc;
+        entry.texture   = renderSystem_.CreateTexture(textureDesc);
+        entry.lastPass  = lastPass;
+        entry.assigned  = true;
+    }
+    transientTextures_.push_back(entry);
+
+    return entry.texture;
+}
+
+Buffer* RenderGraph::AcquireTransientBuffer(const BufferDescriptor& bufferDesc, std::uint32_t firstPass, std::uint32_t lastPass)
+{
+    /* Find buffer whose previous resource has ended its lifetime before this one begins */
+    for (auto& entry : transientBuffers_)
+    {
+        if ((!entry.assigned || entry.lastPass < firstPass) && IsEqualBufferDesc(entry.desc, bufferDesc))
+        {
+            entry.lastPass  = lastPass;
+            entry.assigned  = true;
+            return entry.buffer;
+        }
+    }
+
+    /* Create new buffer */
+    TransientBuffer entry;
+    {
+        entry.desc      = bufferDesc;
+        entry.buffer    = renderSystem_.CreateBuffer(bufferDesc);
+        entry.lastPass  = lastPass;
+        entry.assigned  = true;
+    }
+    transientBuffers_.push_back(entry);
+
+    return entry.buffer;
+}
+
+RenderTarget* RenderGraph::AcquireRenderTarget(const std::vector<AttachmentDescriptor>& attachments, const Extent2D& resolution)
+{
+    for (auto& entry : renderTargets_)
+    {
+        if (IsEqualAttachments(entry.attachments, attachments))
+        {
+            entry.numUnusedCompiles = 0;
+            return entry.renderTarget;
+        }
+    }
+
+    /* Create new render target with a default render pass, which is compatible to the render pass of the group */
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.resolution     = resolution;
+        renderTargetDesc.attachments    = attachments;
+    }
+    CachedRenderTarget entry;
+    {
+        entry.attachments   = attachments;
+        entry.renderTarget  = renderSystem_.CreateRenderTarget(renderTargetDesc);
+    }
+    renderTargets_.push_back(entry);
+
+    return entry.renderTarget;
+}
+
+const RenderPass* RenderGraph::AcquireRenderPass(const RenderPassDescriptor& renderPassDesc)
+{
+    for (const auto& entry : renderPasses_)
+    {
+        if (IsEqualRenderPassDesc(entry.desc, renderPassDesc))
+            return entry.renderPass;
+    }
+
+    /* Create new render pass; these are never released before the render graph, since only few combinations of formats and operations exist */
+    CachedRenderPass entry;
+    {
+        entry.desc          = renderPassDesc;
+        entry.renderPass    = renderSystem_.CreateRenderPass(renderPassDesc);
+    }
+    renderPasses_.push_back(entry);
+
+    return entry.renderPass;
+}
+
+std::size_t RenderGraph::EncodeDeferredPasses(std::size_t threadCount)
+{
+    /* Assign a deferred command buffer to each pass of the groups with parallel encoding */
+    std::size_t numDeferredPasses = 0;
+
+    for (const auto& group : passGroups_)
+    {
+        if (!group.parallel)
+            continue;
+
+        /* Deferred command buffers need a render pass to continue, which might not be available for imported render targets */
+        auto renderPass = (group.renderPass != nullptr ? group.renderPass : group.renderTarget->GetRenderPass());
+        if (renderPass == nullptr)
+            continue;
+
+        for (std::uint32_t i = 0; i < group.numPasses; ++i)
+        {
+            if (numDeferredPasses == deferredCommandBuffers_.size())
+                deferredCommandBuffers_.push_back(DeferredCommandBuffer{});
+
+            auto& entry = deferredCommandBuffers_[numDeferredPasses++];
+
+            if (entry.renderPass != renderPass)
+            {
+                if (entry.commandBuffer != nullptr)
+                    renderSystem_.Release(*entry.commandBuffer);
+
+                CommandBufferDescriptor cmdBufferDesc;
+                {
+                    cmdBufferDesc.flags         = CommandBufferFlags::DeferredSubmit;
+                    cmdBufferDesc.renderPass    = renderPass;
+                }
+                entry.commandBuffer = renderSystem_.CreateCommandBuffer(cmdBufferDesc);
+                entry.renderPass    = renderPass;
+            }
+
+            entry.pass = executionOrder_[group.firstPass + i];
+        }
+    }
+
+    if (numDeferredPasses == 0)
+        return 0;
+
+    /* Encode deferred command buffers with interleaved work distribution */
+    threadCount = std::min(threadCount, numDeferredPasses);
+
+    auto EncodeDeferredPassesWorker = [this, threadCount, numDeferredPasses](std::size_t workerIndex)
+    {
+        for (auto i = workerIndex; i < numDeferredPasses; i += threadCount)
+        {
+            auto& entry = deferredCommandBuffers_[i];
+            entry.commandBuffer->Begin();
+            {
+                EncodePass(*entry.commandBuffer, passes_[entry.pass]);
+            }
+            entry.commandBuffer->End();
+        }
+    };
+
+    /* Worker threads are kept between frames; the first share of work is encoded on the main thread */
+    if (!workerPool_)
+        workerPool_ = std::unique_ptr<WorkerPool>(new WorkerPool());
+
+    workerPool_->Run(threadCount, EncodeDeferredPassesWorker);
+
+    return numDeferredPasses;
+}
+
+void RenderGraph::EncodePass(CommandBuffer& commandBuffer, const PassEntry& pass)
+{
+    if (pass.desc.name != nullptr)
+        commandBuffer.PushDebugGroup(pass.desc.name);
+
+    if (pass.callback)
+        pass.callback(commandBuffer);
+
+    if (pass.desc.name != nullptr)
+        commandBuffer.PopDebugGroup();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
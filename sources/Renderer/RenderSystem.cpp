@@ -11,8 +11,10 @@
 #include <LLGL/Log.h>
 #include "BuildID.h"
 #include "StaticLimits.h"
+#include "TextureUtils.h"
 
 #include <LLGL/RenderSystem.h>
+#include <LLGL/ImageFlags.h>
 #include <array>
 #include <map>
 
@@ -61,6 +63,8 @@ std::vector<std::string> RenderSystem::FindModules()
         "Direct3D11",
         "Direct3D12",
         #endif
+
+        "Null",
     };
 
     std::vector<std::string> modules;
@@ -226,6 +230,105 @@ void RenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
     config_ = config;
 }
 
+CommandQueue* RenderSystem::GetCommandQueue(const CommandQueueType /*type*/)
+{
+    /* By default, all types of command buffers are submitted to the graphics queue */
+    return GetCommandQueue();
+}
+
+void RenderSystem::WriteTextureStreamed(Texture& texture, const TextureRegion& textureRegion, const StreamImageDescriptor& imageDesc)
+{
+    AssertStreamImageDesc(texture, textureRegion, imageDesc);
+
+    const auto bytesPerTexel = static_cast<std::size_t>(ImageDataSize(imageDesc.format, imageDesc.dataType, 1));
+
+    /* Intermediate buffer is only required if the tiles are read with the callback */
+    ByteBuffer  tileBuffer;
+    std::size_t tileBufferSize = 0;
+
+    ForEachStreamTile(
+        textureRegion,
+        bytesPerTexel,
+        GetStreamTileSize(imageDesc),
+        [&](const TextureRegion& tileRegion, std::size_t texelOffset)
+        {
+            const auto tileDataSize = NumStreamTexels(tileRegion) * bytesPerTexel;
+
+            SrcImageDescriptor tileImageDesc { imageDesc.format, imageDesc.dataType, nullptr, tileDataSize };
+
+            if (imageDesc.data != nullptr)
+            {
+                /* Upload tile directly from the source image data */
+                tileImageDesc.data = reinterpret_cast<const char*>(imageDesc.data) + texelOffset * bytesPerTexel;
+            }
+            else
+            {
+                /* Read tile into intermediate buffer, which is only reallocated if a tile exceeds its size */
+                if (tileBufferSize < tileDataSize)
+                {
+                    tileBuffer      = GenerateEmptyByteBuffer(tileDataSize, false);
+                    tileBufferSize  = tileDataSize;
+                }
+                imageDesc.readCallback(tileRegion, tileBuffer.get(), tileDataSize);
+                tileImageDesc.data = tileBuffer.get();
+            }
+
+            /* Write array layers separately, since not all backends can update multiple subresources at once */
+            const auto numArrayLayers   = tileRegion.subresource.numArrayLayers;
+            const auto layerDataSize    = tileDataSize / numArrayLayers;
+
+            TextureRegion layerRegion = tileRegion;
+            layerRegion.subresource.numArrayLayers = 1;
+            tileImageDesc.dataSize = layerDataSize;
+
+            for (std::uint32_t arrayLayer = 0; arrayLayer < numArrayLayers; ++arrayLayer)
+            {
+                layerRegion.subresource.baseArrayLayer = tileRegion.subresource.baseArrayLayer + arrayLayer;
+                WriteTexture(texture, layerRegion, tileImageDesc);
+                tileImageDesc.data = reinterpret_cast<const char*>(tileImageDesc.data) + layerDataSize;
+            }
+        }
+    );
+}
+
+std::uint64_t RenderSystem::WriteTextureAsync(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
+{
+    /* Write texture immediately, so any identifier refers to a completed operation */
+    WriteTexture(texture, textureRegion, imageDesc);
+    return 1;
+}
+
+bool RenderSystem::QueryTextureWrite(std::uint64_t /*writeID*/, bool /*wait*/)
+{
+    return true;
+}
+
+std::uint64_t RenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
+{
+    /* Read texture immediately, so any identifier refers to a completed operation */
+    ReadTexture(texture, mipLevel, imageDesc);
+    return 1;
+}
+
+bool RenderSystem::QueryTextureRead(std::uint64_t /*readID*/, bool /*wait*/)
+{
+    return true;
+}
+
+/* ----- Background loading ----- */
+
+std::uint64_t RenderSystem::EnqueueLoadTask(const LoadTaskFunction& task)
+{
+    /* Execute task immediately, so any identifier refers to a completed task */
+    task(*this);
+    return 1;
+}
+
+bool RenderSystem::QueryLoadTask(std::uint64_t /*taskID*/, bool /*wait*/)
+{
+    return true;
+}
+
 
 /*
  * ======= Protected: =======
@@ -387,6 +490,43 @@ void RenderSystem::AssertCreateRenderPass(const RenderPassDescriptor& desc)
         ErrTooManyColorAttachments("render pass");
 }
 
+void RenderSystem::AssertStreamImageDesc(const Texture& texture, const TextureRegion& textureRegion, const StreamImageDescriptor& imageDesc)
+{
+    if (IsCompressedFormat(imageDesc.format))
+        throw std::invalid_argument("cannot stream texture with compressed image format");
+
+    /* Validate texture region for each MIP-map level, since its offset is rounded down and its extent is clamped to 1 */
+    const auto& subresource     = textureRegion.subresource;
+    const auto  numMipLevels    = std::max(1u, subresource.numMipLevels);
+
+    if (subresource.baseMipLevel + numMipLevels > NumMipLevels(texture.GetDesc()))
+        throw std::invalid_argument("cannot stream texture with MIP-map levels exceeding the texture");
+
+    for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+    {
+        const auto offset       = GetMipRegionOffset(textureRegion.offset, mipLevel);
+        const auto extent       = GetMipRegionExtent(textureRegion.extent, mipLevel);
+        const auto mipExtent    = texture.GetMipExtent(subresource.baseMipLevel + mipLevel);
+
+        if (offset.x < 0 || static_cast<std::uint32_t>(offset.x) + extent.width  > mipExtent.width  ||
+            offset.y < 0 || static_cast<std::uint32_t>(offset.y) + extent.height > mipExtent.height ||
+            offset.z < 0 || static_cast<std::uint32_t>(offset.z) + extent.depth  > mipExtent.depth)
+        {
+            throw std::invalid_argument(
+                "cannot stream texture with region exceeding MIP-map level " + std::to_string(subresource.baseMipLevel + mipLevel)
+            );
+        }
+    }
+
+    if (imageDesc.data != nullptr)
+    {
+        const auto requiredDataSize = NumStreamTexels(textureRegion) * ImageDataSize(imageDesc.format, imageDesc.dataType, 1);
+        AssertImageDataSize(imageDesc.dataSize, requiredDataSize, "streamed texture");
+    }
+    else if (!imageDesc.readCallback)
+        throw std::invalid_argument("cannot stream texture without image data or read callback");
+}
+
 void RenderSystem::AssertImageDataSize(std::size_t dataSize, std::size_t requiredDataSize, const char* info)
 {
     if (dataSize < requiredDataSize)
@@ -8,6 +8,9 @@
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/Strings.h>
 #include <LLGL/Log.h>
+#include "../Core/Helper.h"
+#include <algorithm>
+#include <cstring>
 
 
 namespace LLGL
@@ -28,42 +31,104 @@ void RenderingDebugger::SetDebugGroup(const char* name)
     groupName_ = (name != nullptr ? name : "");
 }
 
-void RenderingDebugger::PostError(const ErrorType type, const std::string& message)
+void RenderingDebugger::PostError(const ErrorType type, const char* message)
 {
-    auto it = errors_.find(message);
-    if (it != errors_.end())
+    const auto hash = HashBuffer(message, std::strlen(message));
+    if (auto entry = FindMessage(errors_, hash, message))
     {
-        if (!it->second.IsBlocked())
+        if (!entry->IsBlocked())
         {
-            it->second.IncOccurrence();
-            OnError(type, it->second);
+            entry->IncOccurrence();
+            OnError(type, *entry);
         }
     }
     else
     {
-        errors_[message] = Message{ message, source_, groupName_ };
-        OnError(type, errors_[message]);
+        auto it = errors_.emplace(hash, Message{ message, source_, groupName_ });
+        OnError(type, it->second);
     }
 }
 
-void RenderingDebugger::PostWarning(const WarningType type, const std::string& message)
+void RenderingDebugger::PostError(const ErrorType type, const std::string& message)
+{
+    PostError(type, message.c_str());
+}
+
+void RenderingDebugger::PostWarning(const WarningType type, const char* message)
 {
-    auto it = warnings_.find(message);
-    if (it != warnings_.end())
+    const auto hash = HashBuffer(message, std::strlen(message));
+    if (auto entry = FindMessage(warnings_, hash, message))
     {
-        if (!it->second.IsBlocked())
+        if (!entry->IsBlocked())
         {
-            it->second.IncOccurrence();
-            OnWarning(type, it->second);
+            entry->IncOccurrence();
+            OnWarning(type, *entry);
         }
     }
     else
     {
-        warnings_[message] = Message{ message, source_, groupName_ };
-        OnWarning(type, warnings_[message]);
+        auto it = warnings_.emplace(hash, Message{ message, source_, groupName_ });
+        OnWarning(type, it->second);
     }
 }
 
+void RenderingDebugger::PostWarning(const WarningType type, const std::string& message)
+{
+    PostWarning(type, message.c_str());
+}
+
+void RenderingDebugger::SetValidationMode(const ValidationMode mode, std::uint32_t samplingInterval)
+{
+    validationMode_     = mode;
+    samplingInterval_   = std::max(1u, samplingInterval);
+}
+
+void RenderingDebugger::SetTimeRecording(bool enabled)
+{
+    timeRecording_ = enabled;
+}
+
+void RenderingDebugger::RecordValidationCost(const char* source, std::uint64_t elapsedTime)
+{
+    std::lock_guard<std::mutex> guard { validationCostMutex_ };
+    auto& cost = validationCosts_[source];
+    cost.invocations++;
+    cost.elapsedTime += elapsedTime;
+}
+
+std::vector<ValidationCost> RenderingDebugger::GetValidationCosts() const
+{
+    std::vector<ValidationCost> costs;
+    {
+        std::lock_guard<std::mutex> guard { validationCostMutex_ };
+
+        costs.reserve(validationCosts_.size());
+
+        for (const auto& entry : validationCosts_)
+        {
+            costs.push_back(entry.second);
+            costs.back().source = entry.first;
+        }
+    }
+
+    std::sort(
+        costs.begin(),
+        costs.end(),
+        [](const ValidationCost& lhs, const ValidationCost& rhs)
+        {
+            return (lhs.elapsedTime > rhs.elapsedTime);
+        }
+    );
+
+    return costs;
+}
+
+void RenderingDebugger::ResetValidationCosts()
+{
+    std::lock_guard<std::mutex> guard { validationCostMutex_ };
+    validationCosts_.clear();
+}
+
 
 /*
  * ====== Protected: =======
@@ -88,6 +153,23 @@ void RenderingDebugger::OnWarning(WarningType type, Message& message)
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+RenderingDebugger::Message* RenderingDebugger::FindMessage(MessageMap& messages, std::uint64_t hash, const char* text)
+{
+    /* Compare message text to distinguish hash collisions */
+    auto range = messages.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.GetText() == text)
+            return &(it->second);
+    }
+    return nullptr;
+}
+
+
 /*
  * Message class
  */
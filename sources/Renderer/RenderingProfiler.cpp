@@ -13,14 +13,19 @@ namespace LLGL
 {
 
 
-void RenderingProfiler::NextProfile(FrameProfile* outputProfile)
+void RenderingProfiler::NextProfile(FrameProfile* outputProfile, std::vector<ProfileTimeRecord>* outputTimeRecords)
 {
     /* Copy current counters to the output profile (if set) */
     if (outputProfile)
         *outputProfile = frameProfile;
 
+    /* Move resolved time records to the output container (if set) */
+    if (outputTimeRecords)
+        *outputTimeRecords = std::move(timeRecords);
+
     /* Clear values */
     frameProfile.Clear();
+    timeRecords.clear();
 }
 
 void RenderingProfiler::Accumulate(const FrameProfile& profile)
@@ -28,6 +33,81 @@ void RenderingProfiler::Accumulate(const FrameProfile& profile)
     frameProfile.Accumulate(profile);
 }
 
+// Writes the specified string as JSON string literal.
+static void WriteJSONString(std::ostream& stream, const std::string& str)
+{
+    stream << '"';
+    for (auto chr : str)
+    {
+        if (chr == '"' || chr == '\\')
+            stream << '\\' << chr;
+        else if (static_cast<unsigned char>(chr) < 0x20)
+            stream << ' ';
+        else
+            stream << chr;
+    }
+    stream << '"';
+}
+
+// Writes the specified time (in nanoseconds) as microseconds with three decimal places.
+static void WriteMicroseconds(std::ostream& stream, std::uint64_t nanoseconds)
+{
+    static const char* digits = "0123456789";
+    const auto fraction = nanoseconds % 1000;
+    stream << (nanoseconds / 1000) << '.' << digits[fraction / 100] << digits[(fraction / 10) % 10] << digits[fraction % 10];
+}
+
+void RenderingProfiler::WriteChromeTrace(std::ostream& stream, const std::vector<ProfileTimeRecord>& timeRecords)
+{
+    /* Start position of the next section for each nesting level */
+    std::vector<std::uint64_t> levelStartTimes(1, 0);
+
+    stream << "{\"traceEvents\":[";
+
+    for (std::size_t i = 0; i < timeRecords.size(); ++i)
+    {
+        const auto& record = timeRecords[i];
+
+        /* Enclosed sections start at the same position as their debug group */
+        if (record.level >= levelStartTimes.size())
+            levelStartTimes.resize(record.level + 1, levelStartTimes.back());
+
+        const auto startTime = levelStartTimes[record.level];
+        levelStartTimes[record.level] += record.elapsedTime;
+
+        levelStartTimes.resize(record.level + 2);
+        levelStartTimes[record.level + 1] = startTime;
+
+        /* Write complete event (phase "X") */
+        if (i > 0)
+            stream << ',';
+
+        stream << "\n{\"name\":";
+        WriteJSONString(stream, record.annotation);
+        stream << ",\"cat\":\"GPU\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":";
+        WriteMicroseconds(stream, startTime);
+        stream << ",\"dur\":";
+        WriteMicroseconds(stream, record.elapsedTime);
+
+        const auto& stats = record.statistics;
+        stream << ",\"args\":{";
+        stream << "\"inputAssemblyVertices\":"            << stats.inputAssemblyVertices;
+        stream << ",\"inputAssemblyPrimitives\":"         << stats.inputAssemblyPrimitives;
+        stream << ",\"vertexShaderInvocations\":"         << stats.vertexShaderInvocations;
+        stream << ",\"geometryShaderInvocations\":"       << stats.geometryShaderInvocations;
+        stream << ",\"geometryShaderPrimitives\":"        << stats.geometryShaderPrimitives;
+        stream << ",\"clippingInvocations\":"             << stats.clippingInvocations;
+        stream << ",\"clippingPrimitives\":"              << stats.clippingPrimitives;
+        stream << ",\"fragmentShaderInvocations\":"       << stats.fragmentShaderInvocations;
+        stream << ",\"tessControlShaderInvocations\":"    << stats.tessControlShaderInvocations;
+        stream << ",\"tessEvaluationShaderInvocations\":" << stats.tessEvaluationShaderInvocations;
+        stream << ",\"computeShaderInvocations\":"        << stats.computeShaderInvocations;
+        stream << "}}";
+    }
+
+    stream << "\n]}\n";
+}
+
 
 } // /namespace LLGL
 
@@ -83,6 +83,8 @@ void SPIRVParser::Parse(const void* byteCode, std::size_t byteCodeSize)
         OnParseInstruction(instr);
     }
 
+    OnParseEnd();
+
     finished_ = true;
 }
 
@@ -118,6 +120,11 @@ void SPIRVParser::OnParseInstruction(const SPIRVInstruction& instr)
     // dummy
 }
 
+void SPIRVParser::OnParseEnd()
+{
+    // dummy
+}
+
 
 } // /namespace LLGL
 
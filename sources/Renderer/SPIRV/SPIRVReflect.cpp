@@ -7,6 +7,7 @@
 
 #include "SPIRVReflect.h"
 #include "../../Core/Helper.h"
+#include <algorithm>
 #include <string>
 
 
@@ -14,6 +15,9 @@ namespace LLGL
 {
 
 
+// Index value for result IDs that do not refer to a uniform or varying.
+static const std::uint32_t g_invalidIndex = ~0u;
+
 const SPIRVReflect::SpvType* SPIRVReflect::SpvType::DereferencePtr() const
 {
     auto type = this;
@@ -44,15 +48,31 @@ bool SPIRVReflect::SpvType::RefersToType(const spv::Op opcodeType) const
 
 void SPIRVReflect::OnParseHeader(const SPIRVHeader& header)
 {
+    SPIRVParser::OnParseHeader(header);
+
+    /* Allocate flat arrays for all result IDs once, so no lookup during parsing requires a search */
     idBound_ = header.idBound;
-    if (idBound_ > 0)
-        names_.resize(idBound_);
+
+    names_.assign(idBound_, nullptr);
+    types_.clear();
+    types_.resize(idBound_);
+    constants_.clear();
+    constants_.resize(idBound_);
+    uniformIndices_.assign(idBound_, g_invalidIndex);
+    varyingIndices_.assign(idBound_, g_invalidIndex);
+
+    uniforms_.clear();
+    varyings_.clear();
+    executionMode_ = SpvExecutionMode{};
 }
 
 void SPIRVReflect::OnParseInstruction(const SPIRVInstruction& instr)
 {
     switch (instr.opcode)
     {
+        case spv::Op::OpExecutionMode:
+            OpExecutionMode(instr);
+            break;
         case spv::Op::OpName:
             OpName(instr);
             break;
@@ -87,6 +107,59 @@ void SPIRVReflect::OnParseInstruction(const SPIRVInstruction& instr)
     }
 }
 
+void SPIRVReflect::OnParseEnd()
+{
+    /* Sort uniforms and varyings by result ID, since they are appended in the order they are first referenced */
+    std::sort(
+        uniforms_.begin(),
+        uniforms_.end(),
+        [](const SpvUniform& lhs, const SpvUniform& rhs) { return (lhs.result < rhs.result); }
+    );
+    std::sort(
+        varyings_.begin(),
+        varyings_.end(),
+        [](const SpvVarying& lhs, const SpvVarying& rhs) { return (lhs.result < rhs.result); }
+    );
+
+    /* Update ID-to-index arrays */
+    for (std::size_t i = 0; i < uniforms_.size(); ++i)
+        uniformIndices_[uniforms_[i].result] = static_cast<std::uint32_t>(i);
+    for (std::size_t i = 0; i < varyings_.size(); ++i)
+        varyingIndices_[varyings_[i].result] = static_cast<std::uint32_t>(i);
+}
+
+void SPIRVReflect::OpExecutionMode(const Instr& instr)
+{
+    auto mode = static_cast<spv::ExecutionMode>(instr.GetUInt32(1));
+    switch (mode)
+    {
+        case spv::ExecutionMode::EarlyFragmentTests:
+            executionMode_.earlyFragmentTest = true;
+            break;
+
+        case spv::ExecutionMode::OriginUpperLeft:
+            executionMode_.originUpperLeft = true;
+            break;
+
+        case spv::ExecutionMode::DepthGreater:
+            executionMode_.depthGreater = true;
+            break;
+
+        case spv::ExecutionMode::DepthLess:
+            executionMode_.depthLess = true;
+            break;
+
+        case spv::ExecutionMode::LocalSize:
+            executionMode_.localSizeX = instr.GetUInt32(2);
+            executionMode_.localSizeY = instr.GetUInt32(3);
+            executionMode_.localSizeZ = instr.GetUInt32(4);
+            break;
+
+        default:
+            break;
+    }
+}
+
 void SPIRVReflect::OpName(const Instr& instr)
 {
     SetName(instr.GetUInt32(0), instr.GetASCII(1));
@@ -113,34 +186,26 @@ void SPIRVReflect::OpDecorate(const Instr& instr)
 
 void SPIRVReflect::OpDecorateBinding(const Instr& instr)
 {
-    auto id         = instr.GetUInt32(0);
-    auto& variable  = uniforms_[id];
-
-    variable.name       = GetName(id);
-    variable.binding    = instr.GetUInt32(2);
+    auto& variable = GetOrAppendUniform(instr.GetUInt32(0));
+    variable.binding = instr.GetUInt32(2);
 }
 
 void SPIRVReflect::OpDecorateLocation(const Instr& instr)
 {
-    auto id         = instr.GetUInt32(0);
-    auto& variable  = varyings_[id];
-
-    variable.name       = GetName(id);
-    variable.location   = instr.GetUInt32(2);
+    auto& variable = GetOrAppendVarying(instr.GetUInt32(0));
+    variable.location = instr.GetUInt32(2);
 }
 
 void SPIRVReflect::OpDecorateBuiltin(const Instr& instr)
 {
-    auto id         = instr.GetUInt32(0);
-    auto& variable  = varyings_[id];
-
-    variable.name       = GetName(id);
-    variable.builtin    = static_cast<spv::BuiltIn>(instr.GetUInt32(2));
+    auto& variable = GetOrAppendVarying(instr.GetUInt32(0));
+    variable.builtin = static_cast<spv::BuiltIn>(instr.GetUInt32(2));
 }
 
 void SPIRVReflect::OpType(const Instr& instr)
 {
     /* Register type and store it as current type to operate on */
+    AssertIdBound(instr.result);
     auto& type = types_[instr.result];
     {
         type.opcode = instr.opcode;
@@ -291,7 +356,7 @@ void SPIRVReflect::OpVariable(const Instr& instr)
         case spv::StorageClass::UniformConstant:
         //case spv::StorageClass::PushConstant:
         {
-            auto& var = uniforms_[instr.result];
+            auto& var = GetOrAppendUniform(instr.result);
             {
                 var.type = FindType(instr.type);
                 if (auto structType = var.type->DereferencePtr(spv::Op::OpTypeStruct))
@@ -308,7 +373,7 @@ void SPIRVReflect::OpVariable(const Instr& instr)
 
         case spv::StorageClass::Input:
         {
-            auto& var = varyings_[instr.result];
+            auto& var = GetOrAppendVarying(instr.result);
             {
                 var.type    = FindType(instr.type);
                 var.input   = true;
@@ -318,7 +383,7 @@ void SPIRVReflect::OpVariable(const Instr& instr)
 
         case spv::StorageClass::Output:
         {
-            auto& var = varyings_[instr.result];
+            auto& var = GetOrAppendVarying(instr.result);
             {
                 var.type    = FindType(instr.type);
                 var.input   = false;
@@ -333,6 +398,7 @@ void SPIRVReflect::OpVariable(const Instr& instr)
 
 void SPIRVReflect::OpConstant(const Instr& instr)
 {
+    AssertIdBound(instr.result);
     auto& val = constants_[instr.result];
     {
         val.type = FindType(instr.type);
@@ -381,18 +447,50 @@ void SPIRVReflect::AssertIdBound(spv::Id id) const
 
 const SPIRVReflect::SpvType* SPIRVReflect::FindType(spv::Id id) const
 {
-    auto it = types_.find(id);
-    if (it == types_.end())
+    if (id >= idBound_ || types_[id].opcode == spv::Op::Max)
         throw std::runtime_error("cannot find SPIR-V OpType* instruction with result ID %" + std::to_string(id));
-    return &(it->second);
+    return &(types_[id]);
 }
 
 const SPIRVReflect::SpvConstant* SPIRVReflect::FindConstant(spv::Id id) const
 {
-    auto it = constants_.find(id);
-    if (it == constants_.end())
+    if (id >= idBound_ || constants_[id].type == nullptr)
         throw std::runtime_error("cannot find SPIR-V OpConstant instruction with with result ID %" + std::to_string(id));
-    return &(it->second);
+    return &(constants_[id]);
+}
+
+SPIRVReflect::SpvUniform& SPIRVReflect::GetOrAppendUniform(spv::Id id)
+{
+    AssertIdBound(id);
+    auto& index = uniformIndices_[id];
+    if (index == g_invalidIndex)
+    {
+        index = static_cast<std::uint32_t>(uniforms_.size());
+        SpvUniform uniform;
+        {
+            uniform.result  = id;
+            uniform.name    = names_[id];
+        }
+        uniforms_.push_back(uniform);
+    }
+    return uniforms_[index];
+}
+
+SPIRVReflect::SpvVarying& SPIRVReflect::GetOrAppendVarying(spv::Id id)
+{
+    AssertIdBound(id);
+    auto& index = varyingIndices_[id];
+    if (index == g_invalidIndex)
+    {
+        index = static_cast<std::uint32_t>(varyings_.size());
+        SpvVarying varying;
+        {
+            varying.result  = id;
+            varying.name    = names_[id];
+        }
+        varyings_.push_back(varying);
+    }
+    return varyings_[index];
 }
 
 
@@ -11,14 +11,13 @@
 
 #include "SPIRVParser.h"
 #include <vector>
-#include <map>
 
 
 namespace LLGL
 {
 
 
-// SPIR-V shader module parser.
+// SPIR-V shader module parser that reflects all resources and execution modes in a single pass.
 class SPIRVReflect final : public SPIRVParser
 {
 
@@ -57,17 +56,10 @@ class SPIRVReflect final : public SPIRVParser
             };
         };
 
-        // SPIR-V structures (a.k.a. records).
-        struct SpvRecord
-        {
-            const char*     name    = nullptr;
-            std::uint32_t   size    = 0;
-            std::uint32_t   padding = 0;
-        };
-
         // Global uniform objects.
         struct SpvUniform
         {
+            spv::Id         result  = 0;        // Result ID of the variable.
             const char*     name    = nullptr;
             const SpvType*  type    = nullptr;
             std::uint32_t   set     = 0;        // Descriptor set
@@ -78,6 +70,7 @@ class SPIRVReflect final : public SPIRVParser
         // Module varyings, i.e. either input or output attributes.
         struct SpvVarying
         {
+            spv::Id         result      = 0;                    // Result ID of the variable.
             const char*     name        = nullptr;
             spv::BuiltIn    builtin     = spv::BuiltIn::Max;    // Optional built-in type
             const SpvType*  type        = nullptr;
@@ -85,21 +78,36 @@ class SPIRVReflect final : public SPIRVParser
             bool            input       = false;
         };
 
+        // Module execution modes (see OpExecutionMode).
+        struct SpvExecutionMode
+        {
+            bool            earlyFragmentTest   = false;
+            bool            originUpperLeft     = false;
+            bool            depthGreater        = false;
+            bool            depthLess           = false;
+            std::uint32_t   localSizeX          = 0;
+            std::uint32_t   localSizeY          = 0;
+            std::uint32_t   localSizeZ          = 0;
+        };
+
     public:
 
-        inline const std::map<spv::Id, SpvRecord>& GetRecords() const
+        // Returns the uniforms in ascending order of their result IDs.
+        inline const std::vector<SpvUniform>& GetUniforms() const
         {
-            return records_;
+            return uniforms_;
         }
 
-        inline const std::map<spv::Id, SpvUniform>& GetUniforms() const
+        // Returns the varyings in ascending order of their result IDs.
+        inline const std::vector<SpvVarying>& GetVaryings() const
         {
-            return uniforms_;
+            return varyings_;
         }
 
-        inline const std::map<spv::Id, SpvVarying>& GetVaryings() const
+        // Returns the execution mode of the module.
+        inline const SpvExecutionMode& GetExecutionMode() const
         {
-            return varyings_;
+            return executionMode_;
         }
 
     private:
@@ -108,7 +116,9 @@ class SPIRVReflect final : public SPIRVParser
 
         void OnParseHeader(const SPIRVHeader& header) override;
         void OnParseInstruction(const SPIRVInstruction& instr) override;
+        void OnParseEnd() override;
 
+        void OpExecutionMode(const Instr& instr);
         void OpName(const Instr& instr);
         void OpDecorate(const Instr& instr);
         void OpDecorateBinding(const Instr& instr);
@@ -143,16 +153,23 @@ class SPIRVReflect final : public SPIRVParser
         const SpvType* FindType(spv::Id id) const;
         const SpvConstant* FindConstant(spv::Id id) const;
 
+        SpvUniform& GetOrAppendUniform(spv::Id id);
+        SpvVarying& GetOrAppendVarying(spv::Id id);
+
     private:
 
-        std::uint32_t                   idBound_    = 0;
-        std::vector<const char*>        names_;
+        std::uint32_t                   idBound_        = 0;
 
-        std::map<spv::Id, SpvType>      types_;
-        std::map<spv::Id, SpvConstant>  constants_;
-        std::map<spv::Id, SpvRecord>    records_;
-        std::map<spv::Id, SpvUniform>   uniforms_;
-        std::map<spv::Id, SpvVarying>   varyings_;
+        /* Flat arrays indexed by result ID; all of them have <idBound_> elements */
+        std::vector<const char*>        names_;
+        std::vector<SpvType>            types_;
+        std::vector<SpvConstant>        constants_;
+        std::vector<std::uint32_t>      uniformIndices_;
+        std::vector<std::uint32_t>      varyingIndices_;
+
+        std::vector<SpvUniform>         uniforms_;
+        std::vector<SpvVarying>         varyings_;
+        SpvExecutionMode                executionMode_;
 
 };
 
@@ -0,0 +1,77 @@
+/*
+ * SPIRVReflectionCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SPIRVReflectionCache.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+SPIRVModuleReflectionPtr SPIRVReflectionCache::GetOrReflect(
+    const void*             byteCode,
+    std::size_t             byteCodeSize,
+    const ShaderType        type,
+    const ReflectFunction&  reflectFunc)
+{
+    const Key key{ HashBuffer128(byteCode, byteCodeSize), byteCodeSize, type };
+
+    /* Share reflection with identical byte code if it is still in use */
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        auto it = entries_.find(key);
+        if (it != entries_.end())
+        {
+            if (auto moduleReflection = it->second.lock())
+                return moduleReflection;
+        }
+    }
+
+    /* Reflect module without holding the lock, so other modules can be reflected concurrently */
+    auto moduleReflection = std::make_shared<SPIRVModuleReflection>();
+    reflectFunc(*moduleReflection);
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Store the reflection, or share the reflection of another thread that has been faster */
+    auto& entry = entries_[key];
+    if (auto sharedReflection = entry.lock())
+        return sharedReflection;
+
+    entry = moduleReflection;
+
+    /* Remove entries of released reflections whenever the cache has grown considerably */
+    if (entries_.size() >= sweepThreshold_)
+        ReleaseExpiredEntries();
+
+    return moduleReflection;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SPIRVReflectionCache::ReleaseExpiredEntries()
+{
+    for (auto it = entries_.begin(); it != entries_.end();)
+    {
+        if (it->second.expired())
+            it = entries_.erase(it);
+        else
+            ++it;
+    }
+    sweepThreshold_ = std::max<std::size_t>(64, entries_.size() * 2);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
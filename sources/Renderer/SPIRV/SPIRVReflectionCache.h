@@ -0,0 +1,87 @@
+/*
+ * SPIRVReflectionCache.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SPIRV_REFLECTION_CACHE_H
+#define LLGL_SPIRV_REFLECTION_CACHE_H
+
+
+#include <LLGL/ShaderProgramFlags.h>
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/Types.h>
+#include "../../Core/Helper.h"
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <tuple>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Reflection of a single SPIR-V shader module.
+struct SPIRVModuleReflection
+{
+    ShaderReflection    reflection;
+    Extent3D            localSize;
+};
+
+using SPIRVModuleReflectionPtr = std::shared_ptr<const SPIRVModuleReflection>;
+
+// Content-addressed cache of SPIR-V shader module reflections, i.e. identical SPIR-V byte streams share the same reflection.
+class SPIRVReflectionCache
+{
+
+    public:
+
+        using ReflectFunction = std::function<void(SPIRVModuleReflection& moduleReflection)>;
+
+    public:
+
+        SPIRVReflectionCache() = default;
+
+        SPIRVReflectionCache(const SPIRVReflectionCache&) = delete;
+        SPIRVReflectionCache& operator = (const SPIRVReflectionCache&) = delete;
+
+        /*
+        Returns the reflection of the specified shader module and shader type.
+        The reflection function is only invoked if there is no reflection of a module with the same byte code in use.
+        Reflections are released as soon as the last shader that refers to them is released.
+        */
+        SPIRVModuleReflectionPtr GetOrReflect(
+            const void*             byteCode,
+            std::size_t             byteCodeSize,
+            const ShaderType        type,
+            const ReflectFunction&  reflectFunc
+        );
+
+    private:
+
+        void ReleaseExpiredEntries();
+
+    private:
+
+        // Byte code is identified by its 128-bit hash and size, so the cache does not keep a copy of it.
+        using Key = std::tuple<Hash128, std::size_t, ShaderType>;
+
+        std::mutex                                                  mutex_;
+        std::map<Key, std::weak_ptr<const SPIRVModuleReflection>>   entries_;
+        std::size_t                                                 sweepThreshold_ = 64;   // Number of entries at which expired entries are removed
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
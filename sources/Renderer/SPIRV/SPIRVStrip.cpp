@@ -0,0 +1,76 @@
+/*
+ * SPIRVStrip.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SPIRVStrip.h"
+#include <spirv/1.2/spirv.hpp11>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+static bool IsDebugInstruction(const spv::Op opcode)
+{
+    switch (opcode)
+    {
+        case spv::Op::OpSourceContinued:
+        case spv::Op::OpSource:
+        case spv::Op::OpSourceExtension:
+        case spv::Op::OpName:
+        case spv::Op::OpMemberName:
+        case spv::Op::OpLine:
+        case spv::Op::OpNoLine:
+        case spv::Op::OpModuleProcessed:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::vector<std::uint32_t> SPIRVStripDebugInstructions(const void* byteCode, std::size_t byteCodeSize)
+{
+    if (!byteCode)
+        throw std::invalid_argument("SPIR-V shader byte code must not be a null pointer");
+    if (byteCodeSize % 4 != 0)
+        throw std::invalid_argument("size of SPIR-V shader byte code must be a multiple of 4 bytes");
+
+    auto words      = reinterpret_cast<const std::uint32_t*>(byteCode);
+    auto numWords   = byteCodeSize / 4;
+
+    if (numWords < 5)
+        throw std::invalid_argument("too few words in SPIR-V shader module");
+
+    /* Copy header */
+    std::vector<std::uint32_t> strippedWords;
+    strippedWords.reserve(numWords);
+    strippedWords.insert(strippedWords.end(), words, words + 5);
+
+    /* Copy all instructions except debug instructions */
+    for (std::size_t i = 5; i < numWords;)
+    {
+        const auto wordCount    = (words[i] >> spv::WordCountShift);
+        const auto opcode       = static_cast<spv::Op>(words[i] & spv::OpCodeMask);
+
+        if (wordCount == 0 || i + wordCount > numWords)
+            throw std::invalid_argument("invalid word count in SPIR-V shader module instruction");
+
+        if (!IsDebugInstruction(opcode))
+            strippedWords.insert(strippedWords.end(), words + i, words + i + wordCount);
+
+        i += wordCount;
+    }
+
+    return strippedWords;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
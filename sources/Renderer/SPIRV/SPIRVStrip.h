@@ -0,0 +1,37 @@
+/*
+ * SPIRVStrip.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SPIRV_STRIP_H
+#define LLGL_SPIRV_STRIP_H
+
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Returns a copy of the specified SPIR-V shader module without debug instructions,
+i.e. OpSource, OpSourceContinued, OpSourceExtension, OpName, OpMemberName, OpLine, OpNoLine, and OpModuleProcessed.
+OpString is kept, since it can also be referenced by non-debug instructions.
+Throws an std::invalid_argument exception if the byte code is invalid.
+*/
+std::vector<std::uint32_t> SPIRVStripDebugInstructions(const void* byteCode, std::size_t byteCodeSize);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,6 +6,7 @@
  */
 
 #include "TextureUtils.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -56,6 +57,176 @@ LLGL_EXPORT bool MustGenerateMipsOnCreate(const TextureDescriptor& textureDesc)
     );
 }
 
+LLGL_EXPORT Format GetDecompressedFormat(const Format format)
+{
+    switch (format)
+    {
+        case Format::BC1UNorm:      return Format::RGBA8UNorm;
+        case Format::BC1UNorm_sRGB: return Format::RGBA8UNorm_sRGB;
+        case Format::BC2UNorm:      return Format::RGBA8UNorm;
+        case Format::BC2UNorm_sRGB: return Format::RGBA8UNorm_sRGB;
+        case Format::BC3UNorm:      return Format::RGBA8UNorm;
+        case Format::BC3UNorm_sRGB: return Format::RGBA8UNorm_sRGB;
+        case Format::BC4UNorm:      return Format::R8UNorm;
+        case Format::BC4SNorm:      return Format::R8SNorm;
+        case Format::BC5UNorm:      return Format::RG8UNorm;
+        case Format::BC5SNorm:      return Format::RG8SNorm;
+        default:                    return Format::Undefined;
+    }
+}
+
+LLGL_EXPORT bool MustDecompressFormat(const Format format, const std::vector<Format>& supportedFormats)
+{
+    return
+    (
+        GetDecompressedFormat(format) != Format::Undefined &&
+        std::find(supportedFormats.begin(), supportedFormats.end(), format) == supportedFormats.end()
+    );
+}
+
+LLGL_EXPORT SrcImageDescriptor GetDecompressionSrcDesc(const SrcImageDescriptor& imageDesc, const Format decompressedFormat)
+{
+    auto compressedImageDesc = imageDesc;
+    compressedImageDesc.dataType = GetFormatAttribs(decompressedFormat).dataType;
+    return compressedImageDesc;
+}
+
+LLGL_EXPORT Extent3D GetMipRegionExtent(const Extent3D& extent, std::uint32_t mipLevel)
+{
+    return Extent3D
+    {
+        std::max(1u, extent.width  >> mipLevel),
+        std::max(1u, extent.height >> mipLevel),
+        std::max(1u, extent.depth  >> mipLevel)
+    };
+}
+
+LLGL_EXPORT Offset3D GetMipRegionOffset(const Offset3D& offset, std::uint32_t mipLevel)
+{
+    return Offset3D{ offset.x >> mipLevel, offset.y >> mipLevel, offset.z >> mipLevel };
+}
+
+LLGL_EXPORT std::size_t NumStreamTexels(const TextureRegion& textureRegion)
+{
+    const auto numMipLevels = std::max(1u, textureRegion.subresource.numMipLevels);
+
+    std::size_t numTexels = 0;
+
+    for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+    {
+        const auto extent = GetMipRegionExtent(textureRegion.extent, mipLevel);
+        numTexels += static_cast<std::size_t>(extent.width) * extent.height * extent.depth;
+    }
+
+    return numTexels * textureRegion.subresource.numArrayLayers;
+}
+
+// Default tile size (in bytes) for streaming texture uploads.
+static const std::size_t g_defaultStreamTileSize = (1u << 22);
+
+LLGL_EXPORT std::size_t GetStreamTileSize(const StreamImageDescriptor& imageDesc)
+{
+    return (imageDesc.tileSize > 0 ? imageDesc.tileSize : g_defaultStreamTileSize);
+}
+
+LLGL_EXPORT void ForEachStreamTile(
+    const TextureRegion&        textureRegion,
+    std::size_t                 bytesPerTexel,
+    std::size_t                 tileSize,
+    const StreamTileCallback&   callback)
+{
+    const auto& subresource     = textureRegion.subresource;
+    const auto  numMipLevels    = std::max(1u, subresource.numMipLevels);
+    const auto  numArrayLayers  = subresource.numArrayLayers;
+
+    /* Determine texel offsets of all MIP-map levels within the tightly packed image data */
+    std::vector<std::size_t> mipTexelOffsets(numMipLevels);
+
+    std::size_t texelOffset = 0;
+    for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+    {
+        const auto extent = GetMipRegionExtent(textureRegion.extent, mipLevel);
+        mipTexelOffsets[mipLevel] = texelOffset;
+        texelOffset += static_cast<std::size_t>(extent.width) * extent.height * extent.depth * numArrayLayers;
+    }
+
+    /* Enumerate tiles from the lowest to the highest resolution */
+    for (auto mipLevel = numMipLevels; mipLevel-- > 0;)
+    {
+        const auto extent       = GetMipRegionExtent(textureRegion.extent, mipLevel);
+        const auto offset       = GetMipRegionOffset(textureRegion.offset, mipLevel);
+        const auto rowSize      = std::max<std::size_t>(1, extent.width * bytesPerTexel);
+        const auto sliceSize    = rowSize * extent.height;
+        const auto sliceTexels  = static_cast<std::size_t>(extent.width) * extent.height;
+
+        TextureRegion tileRegion;
+        {
+            tileRegion.subresource.baseMipLevel = subresource.baseMipLevel + mipLevel;
+            tileRegion.subresource.numMipLevels = 1;
+            tileRegion.offset                   = offset;
+            tileRegion.extent                   = extent;
+        }
+
+        if (sliceSize <= tileSize)
+        {
+            const auto slicesPerTile = static_cast<std::uint32_t>(std::min<std::size_t>(tileSize / sliceSize, ~0u));
+
+            if (extent.depth > 1)
+            {
+                /* Enumerate tiles of whole depth slices */
+                tileRegion.subresource.numArrayLayers = 1;
+
+                for (std::uint32_t arrayLayer = 0; arrayLayer < numArrayLayers; ++arrayLayer)
+                {
+                    for (std::uint32_t z = 0; z < extent.depth; z += slicesPerTile)
+                    {
+                        tileRegion.subresource.baseArrayLayer   = subresource.baseArrayLayer + arrayLayer;
+                        tileRegion.offset.z                     = offset.z + static_cast<std::int32_t>(z);
+                        tileRegion.extent.depth                 = std::min(slicesPerTile, extent.depth - z);
+
+                        callback(tileRegion, mipTexelOffsets[mipLevel] + (static_cast<std::size_t>(arrayLayer) * extent.depth + z) * sliceTexels);
+                    }
+                }
+            }
+            else
+            {
+                /* Enumerate tiles of whole array layers */
+                for (std::uint32_t arrayLayer = 0; arrayLayer < numArrayLayers; arrayLayer += slicesPerTile)
+                {
+                    tileRegion.subresource.baseArrayLayer   = subresource.baseArrayLayer + arrayLayer;
+                    tileRegion.subresource.numArrayLayers   = std::min(slicesPerTile, numArrayLayers - arrayLayer);
+
+                    callback(tileRegion, mipTexelOffsets[mipLevel] + static_cast<std::size_t>(arrayLayer) * sliceTexels);
+                }
+            }
+        }
+        else
+        {
+            /* Enumerate tiles of rows within each depth slice and array layer */
+            const auto rowsPerTile = static_cast<std::uint32_t>(std::max<std::size_t>(1, tileSize / rowSize));
+
+            tileRegion.subresource.numArrayLayers   = 1;
+            tileRegion.extent.depth                 = 1;
+
+            for (std::uint32_t arrayLayer = 0; arrayLayer < numArrayLayers; ++arrayLayer)
+            {
+                for (std::uint32_t z = 0; z < extent.depth; ++z)
+                {
+                    for (std::uint32_t y = 0; y < extent.height; y += rowsPerTile)
+                    {
+                        tileRegion.subresource.baseArrayLayer   = subresource.baseArrayLayer + arrayLayer;
+                        tileRegion.offset.y                     = offset.y + static_cast<std::int32_t>(y);
+                        tileRegion.offset.z                     = offset.z + static_cast<std::int32_t>(z);
+                        tileRegion.extent.height                = std::min(rowsPerTile, extent.height - y);
+
+                        callback(tileRegion, mipTexelOffsets[mipLevel] + ((static_cast<std::size_t>(arrayLayer) * extent.depth + z) * extent.height + y) * extent.width);
+                    }
+                }
+            }
+        }
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -10,12 +10,21 @@
 
 
 #include <LLGL/TextureFlags.h>
+#include <LLGL/ImageFlags.h>
+#include <vector>
+#include <functional>
 
 
 namespace LLGL
 {
 
 
+/* ----- Types ----- */
+
+// Callback for each tile of a streaming texture upload with the first texel of the tile within the tightly packed image data.
+using StreamTileCallback = std::function<void(const TextureRegion& tileRegion, std::size_t texelOffset)>;
+
+
 /* ----- Structures ----- */
 
 // Subresource data size structure with stride per row, stride per array layer, and whole data size.
@@ -38,6 +47,41 @@ LLGL_EXPORT SubresourceLayout CalcSubresourceLayout(const Format format, const E
 // Returns true if the specified flags for texture creation require MIP-map generation at creation time.
 LLGL_EXPORT bool MustGenerateMipsOnCreate(const TextureDescriptor& textureDesc);
 
+// Returns the uncompressed format that is used as fallback for the specified block compressed format, or Format::Undefined.
+LLGL_EXPORT Format GetDecompressedFormat(const Format format);
+
+// Returns true if the specified format is block compressed but not contained in the list of supported formats.
+LLGL_EXPORT bool MustDecompressFormat(const Format format, const std::vector<Format>& supportedFormats);
+
+/*
+Returns the descriptor of the block compressed source image for decompression into the specified fallback format.
+The data type is taken from the fallback format, which selects the signed variants of BC4 and BC5 (see ConvertImageBuffer).
+*/
+LLGL_EXPORT SrcImageDescriptor GetDecompressionSrcDesc(const SrcImageDescriptor& imageDesc, const Format decompressedFormat);
+
+// Returns the extent of the specified MIP-map level for a texture region whose extent refers to the base MIP-map level.
+LLGL_EXPORT Extent3D GetMipRegionExtent(const Extent3D& extent, std::uint32_t mipLevel);
+
+// Returns the offset of the specified MIP-map level for a texture region whose offset refers to the base MIP-map level.
+LLGL_EXPORT Offset3D GetMipRegionOffset(const Offset3D& offset, std::uint32_t mipLevel);
+
+// Returns the number of texels of the specified texture region with all its MIP-map levels and array layers.
+LLGL_EXPORT std::size_t NumStreamTexels(const TextureRegion& textureRegion);
+
+// Returns the tile size (in bytes) of the specified streaming image descriptor, or the default tile size.
+LLGL_EXPORT std::size_t GetStreamTileSize(const StreamImageDescriptor& imageDesc);
+
+/*
+Calls the specified function for each tile of a streaming texture upload (see RenderSystem::WriteTextureStreamed).
+Tiles are enumerated from the lowest to the highest resolution MIP-map level and consist of whole depth slices or array layers if they fit into the tile size.
+*/
+LLGL_EXPORT void ForEachStreamTile(
+    const TextureRegion&        textureRegion,
+    std::size_t                 bytesPerTexel,
+    std::size_t                 tileSize,
+    const StreamTileCallback&   callback
+);
+
 
 } // /namespace LLGL
 
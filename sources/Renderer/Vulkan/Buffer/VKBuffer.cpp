@@ -10,6 +10,9 @@
 #include "../VKTypes.h"
 #include "../Ext/VKExtensions.h"
 #include "../Ext/VKExtensionRegistry.h"
+#include "../../../Core/Helper.h"
+#include <algorithm>
+#include <cstring>
 
 
 namespace LLGL
@@ -55,23 +58,56 @@ static VkBufferUsageFlags GetVkBufferUsageFlags(const BufferDescriptor& desc)
     return flags;
 }
 
-VKBuffer::VKBuffer(const VKPtr<VkDevice>& device, const BufferDescriptor& desc) :
+// Memory budget for the versions of a dynamic buffer, and limits for the number of versions.
+static const VkDeviceSize   g_versionsMemoryBudget  = 256 * 1024;
+static const VkDeviceSize   g_minNumVersions        = 4;
+static const VkDeviceSize   g_maxNumVersions        = 1024;
+
+static VkDeviceSize GetNumVersions(VkDeviceSize versionStride)
+{
+    return std::max(g_minNumVersions, std::min(g_versionsMemoryBudget / versionStride, g_maxNumVersions));
+}
+
+VKBuffer::VKBuffer(const VKDevice& device, const BufferDescriptor& desc, VkDeviceSize versionAlignment) :
     Buffer            { desc.bindFlags                           },
     bufferObj_        { device                                   },
     bufferObjStaging_ { device                                   },
     size_             { desc.size                                },
     indexType_        { VKTypes::ToVkIndexType(desc.indexFormat) }
 {
+    auto bufferSize = static_cast<VkDeviceSize>(desc.size);
+
+    if (versionAlignment > 0)
+    {
+        /* Allocate ring of versions for dynamic buffer */
+        versionStride_ = GetAlignedSize(bufferSize, versionAlignment);
+        versionOwners_.resize(static_cast<std::size_t>(GetNumVersions(versionStride_)));
+        bufferSize = versionStride_ * versionOwners_.size();
+    }
+
+    /* Share buffer between all queue families only on request, so it can be accessed by async compute and transfer queues without ownership transfers */
+    const auto& queueFamilies   = device.GetConcurrentQueueFamilies();
+    const bool  sharedQueues    = ((desc.miscFlags & MiscFlags::SharedQueues) != 0 && !queueFamilies.empty());
+
     VkBufferCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         createInfo.pNext                    = nullptr;
         createInfo.flags                    = 0;
-        createInfo.size                     = desc.size;
+        createInfo.size                     = bufferSize;
         createInfo.usage                    = GetVkBufferUsageFlags(desc);
-        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
-        createInfo.queueFamilyIndexCount    = 0;
-        createInfo.pQueueFamilyIndices      = nullptr;
+        if (!sharedQueues)
+        {
+            createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+            createInfo.queueFamilyIndexCount    = 0;
+            createInfo.pQueueFamilyIndices      = nullptr;
+        }
+        else
+        {
+            createInfo.sharingMode              = VK_SHARING_MODE_CONCURRENT;
+            createInfo.queueFamilyIndexCount    = static_cast<std::uint32_t>(queueFamilies.size());
+            createInfo.pQueueFamilyIndices      = queueFamilies.data();
+        }
     }
     bufferObj_.CreateVkBuffer(device, createInfo);
 }
@@ -103,12 +139,208 @@ void VKBuffer::TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer)
 void* VKBuffer::Map(VkDevice device, const CPUAccess access)
 {
     mappedCPUAccess_ = access;
+
+    /* Dynamic buffers are mapped through their CPU copy */
+    if (IsDynamic())
+        return shadowData_.data();
+
     return bufferObjStaging_.Map(device);
 }
 
 void VKBuffer::Unmap(VkDevice device)
 {
-    bufferObjStaging_.Unmap(device);
+    if (!IsDynamic())
+        bufferObjStaging_.Unmap(device);
+}
+
+/* ----- Dynamic buffer versions ----- */
+
+void VKBuffer::MapVersions(VkDevice device, const void* initialData)
+{
+    mappedVersions_ = reinterpret_cast<char*>(bufferObj_.Map(device));
+
+    shadowData_.resize(static_cast<std::size_t>(GetSize()));
+    if (initialData != nullptr)
+        ::memcpy(shadowData_.data(), initialData, shadowData_.size());
+
+    OverwriteVersion();
+}
+
+void VKBuffer::UnmapVersions(VkDevice device)
+{
+    if (mappedVersions_ != nullptr)
+    {
+        bufferObj_.Unmap(device);
+        mappedVersions_ = nullptr;
+    }
+}
+
+bool VKBuffer::WriteVersion(std::uint64_t offset, const void* data, std::uint64_t dataSize, const VKCompletionTicket& owner)
+{
+    std::lock_guard<std::mutex> guard { versionMutex_ };
+    ::memcpy(shadowData_.data() + offset, data, static_cast<std::size_t>(dataSize));
+    return PublishNextVersion(owner);
+}
+
+bool VKBuffer::PublishVersion(const VKCompletionTicket& owner)
+{
+    std::lock_guard<std::mutex> guard { versionMutex_ };
+    return PublishNextVersion(owner);
+}
+
+void VKBuffer::OverwriteVersion()
+{
+    ::memcpy(mappedVersions_ + currentVersion_ * versionStride_, shadowData_.data(), shadowData_.size());
+}
+
+std::uint32_t VKBuffer::RetainVersion(const VKCompletionTicket& owner)
+{
+    if (IsDynamic())
+    {
+        std::lock_guard<std::mutex> guard { versionMutex_ };
+        auto& owners = versionOwners_[currentVersion_];
+        if (owners.empty() || owners.back() != owner)
+        {
+            /* Drop owners that have already completed, since the current version might be retained over many frames */
+            RemoveAllFromListIf(
+                owners,
+                [](const VKCompletionTicket& ticket)
+                {
+                    return ticket.IsComplete();
+                }
+            );
+            owners.push_back(owner);
+        }
+        return GetDynamicOffset();
+    }
+    return 0;
+}
+
+bool VKBuffer::ReserveVersion(const VKCompletionTicket& owner, std::uint32_t& dynamicOffset)
+{
+    if (!IsDynamic())
+    {
+        dynamicOffset = 0;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard { versionMutex_ };
+
+    for (const auto& reservation : versionReservations_)
+    {
+        if (reservation.owner == owner)
+        {
+            dynamicOffset = static_cast<std::uint32_t>(reservation.version * versionStride_);
+            return false;
+        }
+    }
+
+    /* Reserve any version other than the current one, since the current version is shared by all recordings that haven't published a new one */
+    const auto numVersions = versionOwners_.size();
+    for (std::size_t i = 1; i < numVersions; ++i)
+    {
+        const auto version = (currentVersion_ + i) % numVersions;
+        if (IsVersionAvailable(version))
+        {
+            versionReservations_.push_back({ owner, version });
+            dynamicOffset = static_cast<std::uint32_t>(version * versionStride_);
+            return true;
+        }
+    }
+
+    /* All versions are in use, so keep the current version alive until the owner is complete */
+    auto& owners = versionOwners_[currentVersion_];
+    if (owners.empty() || owners.back() != owner)
+        owners.push_back(owner);
+    dynamicOffset = GetDynamicOffset();
+
+    return false;
+}
+
+void VKBuffer::RefreshVersion(const VKCompletionTicket& owner)
+{
+    std::lock_guard<std::mutex> guard { versionMutex_ };
+    for (const auto& reservation : versionReservations_)
+    {
+        if (reservation.owner == owner)
+        {
+            ::memcpy(mappedVersions_ + reservation.version * versionStride_, shadowData_.data(), shadowData_.size());
+            return;
+        }
+    }
+}
+
+void VKBuffer::TransitionState(VKPipelineBarrier& barrier, const VKResourceState& newState)
+{
+    VKResourceState prevState;
+    if (VKPipelineBarrier::TransitionState(state_, newState, prevState))
+        barrier.AppendBufferBarrier(GetVkBuffer(), prevState, newState);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool VKBuffer::AcquireNextVersion()
+{
+    /* Versions are acquired in order, so only the next one must be checked, except for the versions that are reserved */
+    const auto numVersions = versionOwners_.size();
+    for (std::size_t i = 1; i < numVersions; ++i)
+    {
+        const auto nextVersion = (currentVersion_ + i) % numVersions;
+        if (IsVersionAvailable(nextVersion))
+        {
+            currentVersion_ = nextVersion;
+            return true;
+        }
+        if (!versionOwners_[nextVersion].empty())
+            return false;
+    }
+    return false;
+}
+
+bool VKBuffer::IsVersionAvailable(std::size_t version)
+{
+    /* Release reservations of recordings that have been discarded */
+    RemoveAllFromListIf(
+        versionReservations_,
+        [](const VersionReservation& reservation)
+        {
+            return reservation.owner.IsComplete();
+        }
+    );
+
+    for (const auto& reservation : versionReservations_)
+    {
+        if (reservation.version == version)
+            return false;
+    }
+
+    /* Recordings that used this version are polled for their fences, so versions are retired as soon as the GPU has completed them */
+    auto& owners = versionOwners_[version];
+    for (const auto& ticket : owners)
+    {
+        if (!ticket.IsComplete())
+            return false;
+    }
+
+    owners.clear();
+
+    return true;
+}
+
+bool VKBuffer::PublishNextVersion(const VKCompletionTicket& owner)
+{
+    if (!AcquireNextVersion())
+        return false;
+
+    OverwriteVersion();
+
+    if (owner)
+        versionOwners_[currentVersion_].push_back(owner);
+
+    return true;
 }
 
 
@@ -12,12 +12,27 @@
 #include <LLGL/Buffer.h>
 #include "VKDeviceBuffer.h"
 #include "../Memory/VKDeviceMemory.h"
+#include "../VKPipelineBarrier.h"
+#include "../VKDevice.h"
+#include "../VKCompletionTimeline.h"
+#include <memory>
+#include <mutex>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+/*
+Vulkan buffer object.
+Dynamic constant buffers (see MiscFlags::DynamicUsage) hold a ring of versions in host-visible memory and a CPU copy of their content.
+Every update writes the CPU copy into the next version, which is selected with a dynamic uniform buffer offset at binding time,
+so updates inside a render pass don't require any transfer commands.
+Versions are retired as soon as the fences of the command buffer recordings that used them are signaled.
+Recordings that can be submitted multiple times (see CommandBufferFlags::MultiSubmit) reserve a version of their own instead,
+which is refreshed with the CPU copy on every submission and is not published until the recording is discarded.
+*/
 class VKBuffer : public Buffer
 {
 
@@ -27,7 +42,7 @@ class VKBuffer : public Buffer
 
     public:
 
-        VKBuffer(const VKPtr<VkDevice>& device, const BufferDescriptor& desc);
+        VKBuffer(const VKDevice& device, const BufferDescriptor& desc, VkDeviceSize versionAlignment = 0);
 
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
         void TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer);
@@ -35,6 +50,57 @@ class VKBuffer : public Buffer
         void* Map(VkDevice device, const CPUAccess access);
         void Unmap(VkDevice device);
 
+        /* ----- Dynamic buffer versions ----- */
+
+        // Maps the memory of all versions and initializes the CPU copy and the first version with the specified data.
+        void MapVersions(VkDevice device, const void* initialData);
+
+        // Unmaps the memory of all versions.
+        void UnmapVersions(VkDevice device);
+
+        // Writes the specified data into the CPU copy and publishes it as new version. Returns false if the next version is still in use.
+        bool WriteVersion(std::uint64_t offset, const void* data, std::uint64_t dataSize, const VKCompletionTicket& owner);
+
+        // Publishes the CPU copy as new version. Returns false if the next version is still in use.
+        bool PublishVersion(const VKCompletionTicket& owner);
+
+        // Copies the CPU copy into the current version. The caller must ensure the GPU doesn't access the current version anymore.
+        void OverwriteVersion();
+
+        // Keeps the current version alive until the specified command buffer recording has completed, and returns its dynamic offset.
+        std::uint32_t RetainVersion(const VKCompletionTicket& owner);
+
+        /*
+        Reserves a version that is exclusively used by the specified owner until its ticket is complete, and returns its dynamic offset.
+        Returns true if the version has been reserved by this call, or false if the owner has already reserved a version of this buffer.
+        If all versions are in use, the current version is retained instead, which is not refreshed by 'RefreshVersion'.
+        */
+        bool ReserveVersion(const VKCompletionTicket& owner, std::uint32_t& dynamicOffset);
+
+        // Copies the CPU copy into the version that is reserved by the specified owner. The caller must ensure the GPU doesn't access this version anymore.
+        void RefreshVersion(const VKCompletionTicket& owner);
+
+        // Returns true if this is a dynamic buffer with multiple versions.
+        inline bool IsDynamic() const
+        {
+            return (versionStride_ > 0);
+        }
+
+        // Returns the dynamic uniform buffer offset of the current version, or 0 if this is not a dynamic buffer.
+        inline std::uint32_t GetDynamicOffset() const
+        {
+            return static_cast<std::uint32_t>(currentVersion_ * versionStride_);
+        }
+
+        // Transitions the buffer into the new state and appends a buffer barrier if required.
+        void TransitionState(VKPipelineBarrier& barrier, const VKResourceState& newState);
+
+        // Overrides the tracked state of this buffer.
+        inline void SetState(const VKResourceState& state)
+        {
+            state_ = state;
+        }
+
         // Returns the device buffer object.
         inline VKDeviceBuffer& GetDeviceBuffer()
         {
@@ -77,6 +143,17 @@ class VKBuffer : public Buffer
             return indexType_;
         }
 
+    private:
+
+        // Switches to the next version that is neither in use nor reserved.
+        bool AcquireNextVersion();
+
+        // Returns true if the specified version is not used by any recording. The version mutex must be locked by the caller.
+        bool IsVersionAvailable(std::size_t version);
+
+        // Publishes the CPU copy as new version. The version mutex must be locked by the caller.
+        bool PublishNextVersion(const VKCompletionTicket& owner);
+
     private:
 
         VKDeviceBuffer  bufferObj_;
@@ -87,6 +164,26 @@ class VKBuffer : public Buffer
 
         VkIndexType     indexType_          = VK_INDEX_TYPE_UINT32;
 
+        VKResourceState state_              = {};
+
+        // Owners of a buffer version, i.e. the recordings that might still read it.
+        using VersionOwners = std::vector<VKCompletionTicket>;
+
+        // Buffer version that is exclusively used by a multi-submit recording.
+        struct VersionReservation
+        {
+            VKCompletionTicket  owner;
+            std::size_t         version;
+        };
+
+        VkDeviceSize                    versionStride_      = 0;
+        std::size_t                     currentVersion_     = 0;
+        std::vector<VersionOwners>      versionOwners_;
+        std::vector<VersionReservation> versionReservations_;
+        std::vector<char>               shadowData_;
+        char*                           mappedVersions_     = nullptr;
+        std::mutex                      versionMutex_;                  // deferred command buffers can be encoded by multiple threads
+
 };
 
 
@@ -20,11 +20,13 @@ VKBufferArray::VKBufferArray(long bindFlags, std::uint32_t numBuffers, Buffer* c
 {
     /* Store the object of each VKBuffer inside the array and  */
     buffers_.reserve(numBuffers);
+    bufferObjects_.reserve(numBuffers);
     offsets_.reserve(numBuffers);
 
     while (auto next = NextArrayResource<VKBuffer>(numBuffers, bufferArray))
     {
         buffers_.push_back(next->GetVkBuffer());
+        bufferObjects_.push_back(next);
         offsets_.push_back(0);//next->GetOffset()
     }
 }
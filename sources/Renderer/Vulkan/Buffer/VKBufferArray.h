@@ -20,6 +20,7 @@ namespace LLGL
 
 
 class Buffer;
+class VKBuffer;
 
 class VKBufferArray final : public BufferArray
 {
@@ -34,6 +35,12 @@ class VKBufferArray final : public BufferArray
             return buffers_;
         }
 
+        // Returns the array of buffer objects to track their states.
+        inline const std::vector<VKBuffer*>& GetBufferObjects() const
+        {
+            return bufferObjects_;
+        }
+
         // Returns the array of offsets.
         inline const std::vector<VkDeviceSize>& GetOffsets() const
         {
@@ -43,6 +50,7 @@ class VKBufferArray final : public BufferArray
     private:
 
         std::vector<VkBuffer>       buffers_;
+        std::vector<VKBuffer*>      bufferObjects_;
         std::vector<VkDeviceSize>   offsets_;
 
 };
@@ -111,7 +111,7 @@ void VKDeviceBuffer::ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr
 void* VKDeviceBuffer::Map(VkDevice device)
 {
     if (memoryRegion_)
-        return memoryRegion_->GetParentChunk()->Map(device, memoryRegion_->GetOffset(), memoryRegion_->GetSize());
+        return memoryRegion_->GetParentChunk()->Map(device, memoryRegion_->GetOffset());
     else
         return nullptr;
 }
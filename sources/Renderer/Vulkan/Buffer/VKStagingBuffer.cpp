@@ -0,0 +1,108 @@
+/*
+ * VKStagingBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKStagingBuffer.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../../../Core/Helper.h"
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+static VkBufferCreateInfo GetStagingBufferCreateInfo(VkDeviceSize size)
+{
+    VkBufferCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.size                     = size;
+        createInfo.usage                    = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+    return createInfo;
+}
+
+VKStagingBuffer::VKStagingBuffer(
+    const VKPtr<VkDevice>&  device,
+    VKDeviceMemoryManager&  deviceMemoryMngr,
+    VkDeviceSize            size)
+:
+    bufferObj_
+    {
+        device,
+        GetStagingBufferCreateInfo(size),
+        deviceMemoryMngr,
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    },
+    size_ { size }
+{
+    /* Keep buffer mapped for its entire lifetime */
+    mappedData_ = reinterpret_cast<char*>(bufferObj_.Map(device));
+}
+
+VKStagingBuffer::VKStagingBuffer(VKStagingBuffer&& rhs) :
+    bufferObj_  { std::move(rhs.bufferObj_) },
+    mappedData_ { rhs.mappedData_           },
+    size_       { rhs.size_                 },
+    offset_     { rhs.offset_               }
+{
+    rhs.mappedData_ = nullptr;
+}
+
+VKStagingBuffer& VKStagingBuffer::operator = (VKStagingBuffer&& rhs)
+{
+    if (this != &rhs)
+    {
+        bufferObj_      = std::move(rhs.bufferObj_);
+        mappedData_     = rhs.mappedData_;
+        size_           = rhs.size_;
+        offset_         = rhs.offset_;
+        rhs.mappedData_ = nullptr;
+    }
+    return *this;
+}
+
+void VKStagingBuffer::ReleaseMemoryRegion(VkDevice device, VKDeviceMemoryManager& deviceMemoryMngr)
+{
+    if (mappedData_ != nullptr)
+    {
+        bufferObj_.Unmap(device);
+        mappedData_ = nullptr;
+    }
+    bufferObj_.ReleaseMemoryRegion(deviceMemoryMngr);
+}
+
+void VKStagingBuffer::Reset()
+{
+    offset_ = 0;
+}
+
+bool VKStagingBuffer::Capacity(VkDeviceSize dataSize, VkDeviceSize alignment) const
+{
+    return (GetAlignedSize(offset_, alignment) + dataSize <= size_);
+}
+
+VkDeviceSize VKStagingBuffer::Write(const void* data, VkDeviceSize dataSize, VkDeviceSize alignment)
+{
+    /* Copy data to CPU buffer region and increase offset for next data */
+    const auto dstOffset = GetAlignedSize(offset_, alignment);
+    ::memcpy(mappedData_ + dstOffset, data, static_cast<std::size_t>(dataSize));
+    offset_ = dstOffset + dataSize;
+    return dstOffset;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
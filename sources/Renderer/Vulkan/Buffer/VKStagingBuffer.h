@@ -0,0 +1,86 @@
+/*
+ * VKStagingBuffer.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_STAGING_BUFFER_H
+#define LLGL_VK_STAGING_BUFFER_H
+
+
+#include "VKDeviceBuffer.h"
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryManager;
+
+// Host-visible buffer that stays mapped for its entire lifetime and is filled linearly.
+class VKStagingBuffer
+{
+
+    public:
+
+        VKStagingBuffer(
+            const VKPtr<VkDevice>&  device,
+            VKDeviceMemoryManager&  deviceMemoryMngr,
+            VkDeviceSize            size
+        );
+
+        VKStagingBuffer(VKStagingBuffer&& rhs);
+        VKStagingBuffer& operator = (VKStagingBuffer&& rhs);
+
+        VKStagingBuffer(const VKStagingBuffer&) = delete;
+        VKStagingBuffer& operator = (const VKStagingBuffer&) = delete;
+
+        // Unmaps the buffer and releases its device memory region.
+        void ReleaseMemoryRegion(VkDevice device, VKDeviceMemoryManager& deviceMemoryMngr);
+
+        // Resets the writing offset.
+        void Reset();
+
+        // Returns true if the remaining buffer size can fit the specified data size at the specified alignment.
+        bool Capacity(VkDeviceSize dataSize, VkDeviceSize alignment) const;
+
+        // Writes the specified data at the next aligned offset and returns that offset.
+        VkDeviceSize Write(const void* data, VkDeviceSize dataSize, VkDeviceSize alignment);
+
+        // Returns the native VkBuffer handle.
+        inline VkBuffer GetVkBuffer() const
+        {
+            return bufferObj_.GetVkBuffer();
+        }
+
+        // Returns the size of the buffer.
+        inline VkDeviceSize GetSize() const
+        {
+            return size_;
+        }
+
+        // Returns the current writing offset.
+        inline VkDeviceSize GetOffset() const
+        {
+            return offset_;
+        }
+
+    private:
+
+        VKDeviceBuffer  bufferObj_;
+        char*           mappedData_ = nullptr;
+        VkDeviceSize    size_       = 0;
+        VkDeviceSize    offset_     = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,86 @@
+/*
+ * VKStagingBufferPool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKStagingBufferPool.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKStagingBufferPool::VKStagingBufferPool(const VKPtr<VkDevice>& device, VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize chunkSize) :
+    device_           { device           },
+    deviceMemoryMngr_ { deviceMemoryMngr },
+    chunkSize_        { chunkSize        }
+{
+}
+
+VKStagingBufferPool::~VKStagingBufferPool()
+{
+    for (auto& chunk : chunks_)
+        chunk.ReleaseMemoryRegion(device_, deviceMemoryMngr_);
+}
+
+VKStagingBufferPool::VKStagingBufferPool(VKStagingBufferPool&& rhs) :
+    device_           { rhs.device_              },
+    deviceMemoryMngr_ { rhs.deviceMemoryMngr_    },
+    chunks_           { std::move(rhs.chunks_)   },
+    chunkIdx_         { rhs.chunkIdx_            },
+    chunkSize_        { rhs.chunkSize_           }
+{
+    rhs.chunks_.clear();
+    rhs.chunkIdx_ = 0;
+}
+
+void VKStagingBufferPool::Reset()
+{
+    for (auto& chunk : chunks_)
+        chunk.Reset();
+    chunkIdx_ = 0;
+}
+
+void VKStagingBufferPool::Write(
+    const void*     data,
+    VkDeviceSize    dataSize,
+    VkDeviceSize    alignment,
+    VkBuffer&       srcBuffer,
+    VkDeviceSize&   srcOffset)
+{
+    /* Check if a new chunk must be allocated */
+    if (chunkIdx_ == chunks_.size())
+        AllocChunk(dataSize);
+    else if (!chunks_[chunkIdx_].Capacity(dataSize, alignment))
+    {
+        ++chunkIdx_;
+        if (chunkIdx_ == chunks_.size() || !chunks_[chunkIdx_].Capacity(dataSize, alignment))
+            AllocChunk(dataSize);
+    }
+
+    /* Write data to current chunk */
+    auto& chunk = chunks_[chunkIdx_];
+    srcBuffer = chunk.GetVkBuffer();
+    srcOffset = chunk.Write(data, dataSize, alignment);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKStagingBufferPool::AllocChunk(VkDeviceSize minChunkSize)
+{
+    chunks_.emplace_back(device_, deviceMemoryMngr_, std::max(chunkSize_, minChunkSize));
+    chunkIdx_ = chunks_.size() - 1;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,72 @@
+/*
+ * VKStagingBufferPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_STAGING_BUFFER_POOL_H
+#define LLGL_VK_STAGING_BUFFER_POOL_H
+
+
+#include "VKStagingBuffer.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Linear allocator for transient upload data, e.g. the data of VKCommandBuffer::UpdateBuffer.
+All chunks stay mapped and are only reset once the GPU has finished all commands that read from them.
+*/
+class VKStagingBufferPool
+{
+
+    public:
+
+        VKStagingBufferPool(const VKPtr<VkDevice>& device, VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize chunkSize);
+        ~VKStagingBufferPool();
+
+        VKStagingBufferPool(VKStagingBufferPool&& rhs);
+        VKStagingBufferPool& operator = (VKStagingBufferPool&&) = delete;
+
+        VKStagingBufferPool(const VKStagingBufferPool&) = delete;
+        VKStagingBufferPool& operator = (const VKStagingBufferPool&) = delete;
+
+        // Resets the writing offsets of all chunks.
+        void Reset();
+
+        // Writes the specified data into the next chunk with enough capacity and returns the source buffer and offset for a copy command.
+        void Write(
+            const void*     data,
+            VkDeviceSize    dataSize,
+            VkDeviceSize    alignment,
+            VkBuffer&       srcBuffer,
+            VkDeviceSize&   srcOffset
+        );
+
+    private:
+
+        void AllocChunk(VkDeviceSize minChunkSize);
+
+    private:
+
+        const VKPtr<VkDevice>&          device_;
+        VKDeviceMemoryManager&          deviceMemoryMngr_;
+        std::vector<VKStagingBuffer>    chunks_;
+        std::size_t                     chunkIdx_           = 0;
+        VkDeviceSize                    chunkSize_          = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -69,6 +69,13 @@ static bool Load_VK_KHR_win32_surface(VkInstance handle)
 
 #ifdef LLGL_VK_ENABLE_EXT
 
+static bool Load_VK_KHR_draw_indirect_count(VkDevice handle)
+{
+    LOAD_VKPROC( vkCmdDrawIndirectCountKHR        );
+    LOAD_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+    return true;
+}
+
 static bool Load_VK_EXT_debug_marker(VkDevice handle)
 {
     LOAD_VKPROC( vkDebugMarkerSetObjectTagEXT  );
@@ -159,6 +166,9 @@ bool VKLoadDeviceExtensions(VkDevice device, const std::vector<const char*>& sup
     #define LOAD_VKEXT(NAME) \
         LoadExtension(VKExt::##NAME, "VK_" #NAME, Load_VK_##NAME)
 
+    /* Khronos extensions */
+    LOAD_VKEXT( KHR_draw_indirect_count   );
+
     /* Multi-vendor extensions */
     LOAD_VKEXT( EXT_debug_marker          );
     LOAD_VKEXT( EXT_conditional_rendering );
@@ -19,6 +19,7 @@ static std::array<bool, static_cast<std::size_t>(VKExt::Count)> g_registeredExte
 
 static const char* g_optionalExtensions[] =
 {
+    VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME,
     VK_EXT_DEBUG_MARKER_EXTENSION_NAME,
     VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME,
     VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME,
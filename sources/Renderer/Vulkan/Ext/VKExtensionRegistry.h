@@ -21,6 +21,7 @@ enum class VKExt
 {
     /* Khronos extensions */
     KHR_maintenance1,
+    KHR_draw_indirect_count,
 
     /* Multivendor extensions */
     EXT_debug_marker,
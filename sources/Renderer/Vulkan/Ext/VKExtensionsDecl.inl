@@ -41,6 +41,11 @@ DECL_VKPROC( vkCreateWin32SurfaceKHR );
 
 #ifdef LLGL_VK_ENABLE_EXT
 
+/* VK_KHR_draw_indirect_count */
+
+DECL_VKPROC( vkCmdDrawIndirectCountKHR        );
+DECL_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+
 /* VK_EXT_debug_marker */
 
 DECL_VKPROC( vkDebugMarkerSetObjectTagEXT  );
@@ -37,19 +37,31 @@ VKDeviceMemory::VKDeviceMemory(const VKPtr<VkDevice>& device, VkDeviceSize size,
     }
 }
 
-void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
+void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset)
 {
-    void* data = nullptr;
+    if (mapCounter_ == 0)
+    {
+        /* Map entire device memory, since a VkDeviceMemory object must not be mapped more than once */
+        auto result = vkMapMemory(device, deviceMemory_, 0, VK_WHOLE_SIZE, 0, &mappedData_);
+        VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+    }
 
-    auto result = vkMapMemory(device, deviceMemory_, offset, size, 0, &data);
-    VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+    ++mapCounter_;
 
-    return data;
+    return (reinterpret_cast<char*>(mappedData_) + offset);
 }
 
 void VKDeviceMemory::Unmap(VkDevice device)
 {
-    vkUnmapMemory(device, deviceMemory_);
+    if (mapCounter_ > 0)
+    {
+        /* Unmap device memory when the last mapped region has been unmapped */
+        if (--mapCounter_ == 0)
+        {
+            vkUnmapMemory(device, deviceMemory_);
+            mappedData_ = nullptr;
+        }
+    }
 }
 
 VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation)
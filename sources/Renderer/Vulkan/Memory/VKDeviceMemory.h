@@ -49,7 +49,11 @@ class VKDeviceMemory
         VKDeviceMemory(VKDeviceMemory&&) = default;
         VKDeviceMemory& operator = (VKDeviceMemory&&) = default;
 
-        void* Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size);
+        /*
+        Maps the device memory into CPU memory space and returns the address at the specified offset.
+        The entire chunk is mapped only once, so several regions can be mapped at the same time; each call must be paired with "Unmap".
+        */
+        void* Map(VkDevice device, VkDeviceSize offset);
         void Unmap(VkDevice device);
 
         // Tries to allocate a new block within this device memory chunk, and returns null of failure.
@@ -131,6 +135,9 @@ class VKDeviceMemory
         VkDeviceSize                                        size_                   = 0;
         std::uint32_t                                       memoryTypeIndex_        = 0;
 
+        void*                                               mappedData_             = nullptr;
+        std::uint32_t                                       mapCounter_             = 0;
+
         VkDeviceSize                                        maxNewBlockSize_        = 0;
         std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  blocks_;
 
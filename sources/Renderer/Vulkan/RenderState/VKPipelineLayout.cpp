@@ -35,8 +35,25 @@ static VkShaderStageFlags GetVkShaderStageFlags(long flags)
     return bitmask;
 }
 
+static bool IsConstantBufferBinding(const BindingDescriptor& desc)
+{
+    return (desc.type == ResourceType::Buffer && (desc.bindFlags & BindFlags::ConstantBuffer) != 0);
+}
+
+// Returns the number of descriptors for constant buffers in the specified layout.
+static std::uint32_t GetNumConstantBufferDescriptors(const PipelineLayoutDescriptor& desc)
+{
+    std::uint32_t numDescriptors = 0;
+    for (const auto& binding : desc.bindings)
+    {
+        if (IsConstantBufferBinding(binding))
+            numDescriptors += binding.arraySize;
+    }
+    return numDescriptors;
+}
+
 // Returns the appropriate VkDescriptorType enum entry for the specified binding descriptor
-static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
+static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc, bool dynamicUniformBuffers)
 {
     switch (desc.type)
     {
@@ -45,8 +62,8 @@ static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
         case ResourceType::Texture:
             return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
         case ResourceType::Buffer:
-            if ((desc.bindFlags & BindFlags::ConstantBuffer) != 0)
-                return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            if (IsConstantBufferBinding(desc))
+                return (dynamicUniformBuffers ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
             if ((desc.bindFlags & (BindFlags::Sampled | BindFlags::Storage)) != 0)
                 return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
             break;
@@ -59,10 +76,10 @@ static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
 //TODO:
 // looks like 'VkDescriptorSetLayoutBinding::descriptorCount' can only be greater than 1
 // for arrays in a shader (e.g. array of uniform buffers), but not for multiple binding points.
-static void Convert(VkDescriptorSetLayoutBinding& dst, const BindingDescriptor& src)
+static void Convert(VkDescriptorSetLayoutBinding& dst, const BindingDescriptor& src, bool dynamicUniformBuffers)
 {
     dst.binding             = src.slot;
-    dst.descriptorType      = GetVkDescriptorType(src);
+    dst.descriptorType      = GetVkDescriptorType(src, dynamicUniformBuffers);
     dst.descriptorCount     = src.arraySize;
     dst.stageFlags          = GetVkShaderStageFlags(src.stageFlags);
     dst.pImmutableSamplers  = nullptr;
@@ -79,17 +96,20 @@ TODO:
 maybe move the VkPipelineLayout object into "VKGraphicsPipeline",
 in this case the "PipelineLayout" interface might need a renaming
 */
-VKPipelineLayout::VKPipelineLayout(const VKPtr<VkDevice>& device, const PipelineLayoutDescriptor& desc) :
+VKPipelineLayout::VKPipelineLayout(const VKPtr<VkDevice>& device, const PipelineLayoutDescriptor& desc, std::uint32_t maxDynamicUniformBuffers) :
     device_              { device                               },
     pipelineLayout_      { device, vkDestroyPipelineLayout      },
     descriptorSetLayout_ { device, vkDestroyDescriptorSetLayout }
 {
+    /* Bind constant buffers with dynamic offsets, so updates of dynamic buffers only select another buffer version */
+    const bool dynamicUniformBuffers = (GetNumConstantBufferDescriptors(desc) <= maxDynamicUniformBuffers);
+
     /* Initialize all descriptor-set layout bindings */
     const auto numBindings = desc.bindings.size();
     std::vector<VkDescriptorSetLayoutBinding> layoutBindings(numBindings);
 
     for (std::size_t i = 0; i < numBindings; ++i)
-        Convert(layoutBindings[i], desc.bindings[i]);
+        Convert(layoutBindings[i], desc.bindings[i], dynamicUniformBuffers);
 
     /* Create descriptor set layout */
     VkDescriptorSetLayoutCreateInfo descSetCreateInfo;
@@ -122,7 +142,7 @@ VKPipelineLayout::VKPipelineLayout(const VKPtr<VkDevice>& device, const Pipeline
     /* Create list of binding points (for later pass to 'VkWriteDescriptorSet::dstBinding') */
     bindings_.reserve(numBindings);
     for (std::size_t i = 0; i < numBindings; ++i)
-        bindings_.push_back({ desc.bindings[i].slot, layoutBindings[i].descriptorType });
+        bindings_.push_back({ desc.bindings[i].slot, layoutBindings[i].descriptorType, layoutBindings[i].stageFlags });
 }
 
 
@@ -24,6 +24,7 @@ struct VKLayoutBinding
 {
     std::uint32_t       dstBinding;
     VkDescriptorType    descriptorType;
+    VkShaderStageFlags  stageFlags;
 };
 
 class VKPipelineLayout final : public PipelineLayout
@@ -31,7 +32,11 @@ class VKPipelineLayout final : public PipelineLayout
 
     public:
 
-        VKPipelineLayout(const VKPtr<VkDevice>& device, const PipelineLayoutDescriptor& desc);
+        /*
+        Creates the pipeline layout. Constant buffers are bound as dynamic uniform buffers,
+        unless the layout has more constant buffers than specified by 'maxDynamicUniformBuffers'.
+        */
+        VKPipelineLayout(const VKPtr<VkDevice>& device, const PipelineLayoutDescriptor& desc, std::uint32_t maxDynamicUniformBuffers);
 
         inline VkPipelineLayout GetVkPipelineLayout() const
         {
@@ -16,6 +16,7 @@
 #include "../../CheckedCast.h"
 #include "../../../Core/Helper.h"
 #include <map>
+#include <algorithm>
 
 
 namespace LLGL
@@ -58,11 +59,30 @@ VKResourceHeap::~VKResourceHeap()
     #endif
 }
 
+void VKResourceHeap::TransitionResourceStates(VKResourceStateTracker& stateTracker, VKPipelineBarrier* barrier)
+{
+    for (const auto& access : textureAccesses_)
+    {
+        const TextureSubresource subresource{ 0, access.texture->GetNumArrayLayers(), 0, access.texture->GetNumMipLevels() };
+        stateTracker.TransitionTexture(barrier, *(access.texture), subresource, access.state);
+    }
+
+    for (const auto& access : bufferAccesses_)
+        stateTracker.TransitionBuffer(barrier, *(access.buffer), access.state);
+}
+
 
 /*
  * ======= Private: =======
  */
 
+// Returns the pipeline stages a resource of the specified binding is accessed in.
+static VkPipelineStageFlags GetBindingStageMask(const VKLayoutBinding& binding)
+{
+    const auto stageMask = VKGetPipelineStageFlags(binding.stageFlags);
+    return (stageMask != 0 ? stageMask : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT));
+}
+
 static std::uint32_t AccumDescriptorPoolSizes(
     VkDescriptorType type,
     std::vector<VkDescriptorPoolSize>::iterator it,
@@ -166,6 +186,7 @@ void VKResourceHeap::UpdateDescriptorSets(const ResourceHeapDescriptor& desc, co
                 break;
 
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
                 FillWriteDescriptorForBuffer(rvDesc, bindings[i], container);
                 break;
@@ -189,6 +210,16 @@ void VKResourceHeap::UpdateDescriptorSets(const ResourceHeapDescriptor& desc, co
             nullptr
         );
     }
+
+    /* Dynamic offsets must be passed in the order of their binding slots */
+    std::sort(
+        dynamicBufferBindings_.begin(),
+        dynamicBufferBindings_.end(),
+        [](const DynamicBufferBinding& lhs, const DynamicBufferBinding& rhs)
+        {
+            return (lhs.slot < rhs.slot);
+        }
+    );
 }
 
 void VKResourceHeap::FillWriteDescriptorForSampler(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container)
@@ -229,6 +260,15 @@ void VKResourceHeap::FillWriteDescriptorForTexture(const ResourceViewDescriptor&
         imageInfo->imageLayout   = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
     }
 
+    /* Track texture to transition it into the layout of the image descriptor */
+    VKResourceState state;
+    {
+        state.layout        = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        state.accessMask    = VK_ACCESS_SHADER_READ_BIT;
+        state.stageMask     = GetBindingStageMask(binding);
+    }
+    textureAccesses_.push_back({ textureVK, state });
+
     /* Initialize write descriptor */
     auto writeDesc = container.NextWriteDescriptor();
     {
@@ -255,6 +295,23 @@ void VKResourceHeap::FillWriteDescriptorForBuffer(const ResourceViewDescriptor&
         bufferInfo->range     = bufferVK->GetSize();
     }
 
+    /* Track buffer to synchronize shader accesses with previous writes (storage buffers are assumed to be written) */
+    VKResourceState state;
+    {
+        state.layout        = VK_IMAGE_LAYOUT_UNDEFINED;
+        state.accessMask    = (
+            binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+                ? static_cast<VkAccessFlags>(VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT)
+                : static_cast<VkAccessFlags>(VK_ACCESS_UNIFORM_READ_BIT)
+        );
+        state.stageMask     = GetBindingStageMask(binding);
+    }
+    bufferAccesses_.push_back({ bufferVK, state });
+
+    /* Track uniform buffers with dynamic offsets to select the current buffer version when the heap is bound */
+    if (binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+        dynamicBufferBindings_.push_back({ binding.dstBinding, bufferVK });
+
     /* Initialize write descriptor */
     auto writeDesc = container.NextWriteDescriptor();
     {
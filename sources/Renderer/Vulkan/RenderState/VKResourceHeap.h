@@ -12,6 +12,9 @@
 #include <LLGL/ResourceHeap.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include "../VKPipelineBarrier.h"
+#include "../VKResourceStateTracker.h"
+#include "../Buffer/VKBuffer.h"
 #include <vector>
 
 
@@ -19,7 +22,7 @@ namespace LLGL
 {
 
 
-class VKBuffer;
+class VKTexture;
 struct VKWriteDescriptorContainer;
 struct VKLayoutBinding;
 
@@ -46,6 +49,27 @@ class VKResourceHeap final : public ResourceHeap
             return descriptorSets_;
         }
 
+        // Transitions all textures and buffers of this heap into the state the shaders access them with (see VKResourceStateTracker::TransitionBuffer).
+        void TransitionResourceStates(VKResourceStateTracker& stateTracker, VKPipelineBarrier* barrier);
+
+        // Returns true if this heap contains uniform buffers that are bound with dynamic offsets.
+        inline bool HasDynamicOffsets() const
+        {
+            return !dynamicBufferBindings_.empty();
+        }
+
+        // Returns the number of uniform buffers that are bound with dynamic offsets.
+        inline std::size_t GetNumDynamicBuffers() const
+        {
+            return dynamicBufferBindings_.size();
+        }
+
+        // Returns the uniform buffer that is bound with the specified dynamic offset; dynamic offsets are ordered by their binding slots.
+        inline VKBuffer& GetDynamicBuffer(std::size_t index) const
+        {
+            return *(dynamicBufferBindings_[index].buffer);
+        }
+
     private:
 
         void CreateDescriptorPool(const ResourceHeapDescriptor& desc, const std::vector<VKLayoutBinding>& bindings);
@@ -58,10 +82,37 @@ class VKResourceHeap final : public ResourceHeap
 
     private:
 
-        VkDevice                        device_         = VK_NULL_HANDLE;
-        VkPipelineLayout                pipelineLayout_ = VK_NULL_HANDLE;
-        VKPtr<VkDescriptorPool>         descriptorPool_;
-        std::vector<VkDescriptorSet>    descriptorSets_;
+        // Texture and the state it is accessed with through this heap.
+        struct TextureAccess
+        {
+            VKTexture*      texture;
+            VKResourceState state;
+        };
+
+        // Buffer and the state it is accessed with through this heap.
+        struct BufferAccess
+        {
+            VKBuffer*       buffer;
+            VKResourceState state;
+        };
+
+        // Uniform buffer that is bound with a dynamic offset.
+        struct DynamicBufferBinding
+        {
+            std::uint32_t   slot;
+            VKBuffer*       buffer;
+        };
+
+    private:
+
+        VkDevice                            device_         = VK_NULL_HANDLE;
+        VkPipelineLayout                    pipelineLayout_ = VK_NULL_HANDLE;
+        VKPtr<VkDescriptorPool>             descriptorPool_;
+        std::vector<VkDescriptorSet>        descriptorSets_;
+
+        std::vector<TextureAccess>          textureAccesses_;
+        std::vector<BufferAccess>           bufferAccesses_;
+        std::vector<DynamicBufferBinding>   dynamicBufferBindings_; // sorted by binding slot
 
 };
 
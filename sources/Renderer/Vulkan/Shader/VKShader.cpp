@@ -14,7 +14,8 @@
 
 #ifdef LLGL_ENABLE_SPIRV_REFLECT
 #   include "../../SPIRV/SPIRVReflect.h"
-#   include "../../SPIRV/SPIRVReflectExecutionMode.h"
+#   include "../../SPIRV/SPIRVReflectionCache.h"
+#   include "../../SPIRV/SPIRVStrip.h"
 #endif
 
 
@@ -22,12 +23,11 @@ namespace LLGL
 {
 
 
-VKShader::VKShader(const VKPtr<VkDevice>& device, const ShaderDescriptor& desc) :
-    Shader        { desc.type                     },
-    device_       { device                        },
-    shaderModule_ { device, vkDestroyShaderModule }
+VKShader::VKShader(VKShaderModulePool& shaderModulePool, SPIRVReflectionCache* reflectionCache, const ShaderDescriptor& desc) :
+    Shader           { desc.type       },
+    reflectionCache_ { reflectionCache }
 {
-    BuildShader(desc);
+    BuildShader(shaderModulePool, desc);
     BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
 }
 
@@ -66,7 +66,7 @@ void VKShader::FillShaderStageCreateInfo(VkPipelineShaderStageCreateInfo& create
     createInfo.pNext                = nullptr;
     createInfo.flags                = 0;
     createInfo.stage                = VKTypes::Map(GetType());
-    createInfo.module               = shaderModule_;
+    createInfo.module               = GetShaderModule();
     createInfo.pName                = entryPoint_.c_str();
     createInfo.pSpecializationInfo  = nullptr;
 }
@@ -322,17 +322,19 @@ static ShaderResource* FindOrAppendShaderResource(ShaderReflection& reflection,
     return &(reflection.resources.back());
 }
 
-bool VKShader::Reflect(ShaderReflection& reflection) const
+// Reflects the specified SPIR-V module with a single pass over all of its instructions.
+static void ReflectSpvModule(const void* byteCode, std::size_t byteCodeSize, const ShaderType type, SPIRVModuleReflection& moduleReflection)
 {
     /* Parse shader module */
     SPIRVReflect spvReflect;
-    spvReflect.Parse(shaderModuleData_.data(), shaderModuleData_.size());
+    spvReflect.Parse(byteCode, byteCodeSize);
+
+    auto& reflection = moduleReflection.reflection;
 
     /* Gather input/output attributes */
-    for (const auto& it : spvReflect.GetVaryings())
+    for (const auto& var : spvReflect.GetVaryings())
     {
-        const auto& var = it.second;
-        if (GetType() == ShaderType::Vertex)
+        if (type == ShaderType::Vertex)
         {
             std::uint32_t numVectors = 1;
 
@@ -355,7 +357,7 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
                     reflection.vertex.outputAttribs.push_back(attrib);
             }
         }
-        else if (GetType() == ShaderType::Fragment && !var.input)
+        else if (type == ShaderType::Fragment && !var.input)
         {
             /* Determine and append fragment attribute data */
             FragmentAttribute attrib;
@@ -370,12 +372,71 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
     }
 
     /* Gather resources */
-    for (const auto& it : spvReflect.GetUniforms())
+    for (const auto& var : spvReflect.GetUniforms())
     {
-        const auto& var = it.second;
         if (auto resource = FindOrAppendShaderResource(reflection, var))
-            resource->binding.stageFlags |= ShaderTypeToStageFlags(GetType());
+            resource->binding.stageFlags |= ShaderTypeToStageFlags(type);
+    }
+
+    /* Store local work group size from the execution modes, which have been gathered in the same pass */
+    const auto& mode = spvReflect.GetExecutionMode();
+    moduleReflection.localSize = Extent3D{ mode.localSizeX, mode.localSizeY, mode.localSizeZ };
+}
+
+// Returns the reflection of the specified SPIR-V module from the cache, or reflects the module if it has not been cached yet.
+static SPIRVModuleReflectionPtr GetSpvModuleReflection(
+    SPIRVReflectionCache&   reflectionCache,
+    const void*             byteCode,
+    std::size_t             byteCodeSize,
+    const ShaderType        type)
+{
+    return reflectionCache.GetOrReflect(
+        byteCode,
+        byteCodeSize,
+        type,
+        [byteCode, byteCodeSize, type](SPIRVModuleReflection& moduleReflection)
+        {
+            ReflectSpvModule(byteCode, byteCodeSize, type, moduleReflection);
+        }
+    );
+}
+
+// Merges the specified resource into the reflection, i.e. resources at the same binding slot are shared between all shader stages.
+static void MergeShaderResource(ShaderReflection& reflection, const ShaderResource& resource)
+{
+    for (auto& dstResource : reflection.resources)
+    {
+        if (dstResource.binding.slot == resource.binding.slot)
+        {
+            dstResource.binding.stageFlags |= resource.binding.stageFlags;
+            return;
+        }
     }
+    reflection.resources.push_back(resource);
+}
+
+template <typename T>
+static void AppendAttributes(std::vector<T>& dst, const std::vector<T>& src)
+{
+    dst.insert(dst.end(), src.begin(), src.end());
+}
+
+bool VKShader::Reflect(ShaderReflection& reflection) const
+{
+    auto moduleReflection = GetModuleReflection();
+    if (!moduleReflection)
+        return false;
+
+    const auto& srcReflection = moduleReflection->reflection;
+
+    /* Append input/output attributes */
+    AppendAttributes(reflection.vertex.inputAttribs, srcReflection.vertex.inputAttribs);
+    AppendAttributes(reflection.vertex.outputAttribs, srcReflection.vertex.outputAttribs);
+    AppendAttributes(reflection.fragment.outputAttribs, srcReflection.fragment.outputAttribs);
+
+    /* Merge resources with those of the other shader stages */
+    for (const auto& resource : srcReflection.resources)
+        MergeShaderResource(reflection, resource);
 
     return true;
 }
@@ -384,21 +445,21 @@ bool VKShader::ReflectLocalSize(Extent3D& localSize) const
 {
     if (GetType() == ShaderType::Compute)
     {
-        /* Parse shader module */
-        SPIRVReflectExecutionMode spvReflect;
-        spvReflect.Parse(shaderModuleData_.data(), shaderModuleData_.size());
-
-        /* Return local work group size */
-        const auto& mode = spvReflect.GetMode();
-        localSize.width     = mode.localSizeX;
-        localSize.height    = mode.localSizeY;
-        localSize.depth     = mode.localSizeZ;
-
-        return true;
+        if (auto moduleReflection = GetModuleReflection())
+        {
+            /* Return local work group size */
+            localSize = moduleReflection->localSize;
+            return true;
+        }
     }
     return false;
 }
 
+const SPIRVModuleReflection* VKShader::GetModuleReflection() const
+{
+    return (loadBinaryResult_ == LoadBinaryResult::Successful ? moduleReflection_.get() : nullptr);
+}
+
 #else
 
 bool VKShader::Reflect(ShaderReflection& /*reflection*/) const
@@ -418,12 +479,12 @@ bool VKShader::ReflectLocalSize(Extent3D& workGroupSize) const
  * ======= Private: =======
  */
 
-bool VKShader::BuildShader(const ShaderDescriptor& shaderDesc)
+bool VKShader::BuildShader(VKShaderModulePool& shaderModulePool, const ShaderDescriptor& shaderDesc)
 {
     if (IsShaderSourceCode(shaderDesc.sourceType))
         return CompileSource(shaderDesc);
     else
-        return LoadBinary(shaderDesc);
+        return LoadBinary(shaderModulePool, shaderDesc);
 }
 
 // Helper structure to build set of <VkVertexInputBindingDescription> elements
@@ -485,7 +546,7 @@ bool VKShader::CompileSource(const ShaderDescriptor& shaderDesc)
     return false; // dummy
 }
 
-bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
+bool VKShader::LoadBinary(VKShaderModulePool& shaderModulePool, const ShaderDescriptor& shaderDesc)
 {
     /* Get shader binary */
     std::vector<char>   fileContent;
@@ -506,15 +567,12 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         binaryLength = shaderDesc.sourceSize;
     }
 
-    /* Validate code size and store data */
+    /* Validate code size */
     if (binaryBuffer == nullptr || binaryLength % 4 != 0)
     {
         loadBinaryResult_ = LoadBinaryResult::InvalidCodeSize;
-        shaderModuleData_.clear();
         return false;
     }
-    else
-        shaderModuleData_ = std::vector<char>(binaryBuffer, binaryBuffer + binaryLength);
 
     /* Store shader entry point (by default "main" for GLSL) */
     if (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0')
@@ -522,17 +580,37 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
     else
         entryPoint_ = shaderDesc.entryPoint;
 
-    /* Create shader module */
-    VkShaderModuleCreateInfo createInfo;
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+
+    std::vector<std::uint32_t> strippedCode;
+    try
+    {
+        /*
+        Reflect byte code before the OpName instructions are stripped below, because they contain the names of all resources.
+        The reflection is shared between identical modules, so the byte code does not have to be kept for later reflection.
+        */
+        if (reflectionCache_ != nullptr)
+            moduleReflection_ = GetSpvModuleReflection(*reflectionCache_, binaryBuffer, binaryLength, GetType());
+
+        /* Strip debug instructions unless debug information has been requested */
+        if ((shaderDesc.flags & ShaderCompileFlags::Debug) == 0)
+        {
+            strippedCode = SPIRVStripDebugInstructions(binaryBuffer, binaryLength);
+            binaryBuffer = reinterpret_cast<const char*>(strippedCode.data());
+            binaryLength = strippedCode.size() * sizeof(std::uint32_t);
+        }
+    }
+    catch (const std::exception& e)
     {
-        createInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        createInfo.pNext    = nullptr;
-        createInfo.flags    = 0;
-        createInfo.codeSize = binaryLength;
-        createInfo.pCode    = reinterpret_cast<const std::uint32_t*>(binaryBuffer);
+        loadBinaryResult_   = LoadBinaryResult::ReflectFailed;
+        errorLog_           = e.what();
+        return false;
     }
-    auto result = vkCreateShaderModule(device_, &createInfo, nullptr, shaderModule_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan shader module");
+
+    #endif // /LLGL_ENABLE_SPIRV_REFLECT
+
+    /* Create shader module or share it with other shaders of identical byte code */
+    shaderModule_ = shaderModulePool.CreateShaderModule(reinterpret_cast<const std::uint32_t*>(binaryBuffer), binaryLength);
 
     loadBinaryResult_ = LoadBinaryResult::Successful;
 
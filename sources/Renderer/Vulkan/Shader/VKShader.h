@@ -11,8 +11,10 @@
 
 #include <LLGL/Shader.h>
 #include <vector>
+#include <memory>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include "VKShaderModulePool.h"
 
 
 namespace LLGL
@@ -21,6 +23,8 @@ namespace LLGL
 
 struct ShaderReflection;
 struct Extent3D;
+struct SPIRVModuleReflection;
+class SPIRVReflectionCache;
 
 class VKShader final : public Shader
 {
@@ -33,7 +37,8 @@ class VKShader final : public Shader
 
     public:
 
-        VKShader(const VKPtr<VkDevice>& device, const ShaderDescriptor& desc);
+        // Constructs the shader with the pools its module and reflection are shared with. The reflection cache is null if SPIR-V reflection is disabled.
+        VKShader(VKShaderModulePool& shaderModulePool, SPIRVReflectionCache* reflectionCache, const ShaderDescriptor& desc);
 
         void FillShaderStageCreateInfo(VkPipelineShaderStageCreateInfo& createInfo) const;
         void FillVertexInputStateCreateInfo(VkPipelineVertexInputStateCreateInfo& createInfo) const;
@@ -41,10 +46,10 @@ class VKShader final : public Shader
         bool Reflect(ShaderReflection& reflection) const;
         bool ReflectLocalSize(Extent3D& localSize) const;
 
-        // Returns the Vulkan shader module.
-        inline const VKPtr<VkShaderModule>& GetShaderModule() const
+        // Returns the Vulkan shader module, which might be shared with other shaders of identical byte code.
+        inline VkShaderModule GetShaderModule() const
         {
-            return shaderModule_;
+            return (shaderModule_ ? shaderModule_->Get() : VK_NULL_HANDLE);
         }
 
     private:
@@ -60,11 +65,13 @@ class VKShader final : public Shader
 
     private:
 
-        bool BuildShader(const ShaderDescriptor& shaderDesc);
+        bool BuildShader(VKShaderModulePool& shaderModulePool, const ShaderDescriptor& shaderDesc);
         void BuildInputLayout(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
 
         bool CompileSource(const ShaderDescriptor& shaderDesc);
-        bool LoadBinary(const ShaderDescriptor& shaderDesc);
+        bool LoadBinary(VKShaderModulePool& shaderModulePool, const ShaderDescriptor& shaderDesc);
+
+        const SPIRVModuleReflection* GetModuleReflection() const;
 
     private:
 
@@ -76,14 +83,15 @@ class VKShader final : public Shader
 
     private:
 
-        VkDevice                device_             = VK_NULL_HANDLE;
-        VKPtr<VkShaderModule>   shaderModule_;
-        std::vector<char>       shaderModuleData_;
-        LoadBinaryResult        loadBinaryResult_   = LoadBinaryResult::Undefined;
-        VertexInputLayout       inputLayout_;
+        VKShaderModuleSPtr                                    shaderModule_;
+        SPIRVReflectionCache*                                 reflectionCache_    = nullptr;
+        LoadBinaryResult                                      loadBinaryResult_   = LoadBinaryResult::Undefined;
+        std::shared_ptr<const SPIRVModuleReflection>          moduleReflection_;
+
+        VertexInputLayout                                     inputLayout_;
 
-        std::string             entryPoint_;
-        std::string             errorLog_;
+        std::string                                           entryPoint_;
+        std::string                                           errorLog_;
 
 };
 
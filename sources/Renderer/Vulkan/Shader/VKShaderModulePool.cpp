@@ -0,0 +1,78 @@
+/*
+ * VKShaderModulePool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKShaderModulePool.h"
+#include "../VKCore.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKShaderModulePool::VKShaderModulePool(const VKPtr<VkDevice>& device) :
+    device_ { device }
+{
+}
+
+VKShaderModuleSPtr VKShaderModulePool::CreateShaderModule(const std::uint32_t* code, std::size_t codeSize)
+{
+    const Key key{ HashBuffer128(code, codeSize), codeSize };
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Share shader module with identical byte code if it is still in use */
+    auto& entry = modules_[key];
+    if (auto shaderModule = entry.lock())
+        return shaderModule;
+
+    /* Create new shader module; the entry of an expired module with the same byte code is reused */
+    auto shaderModule = std::make_shared<VKPtr<VkShaderModule>>(device_, vkDestroyShaderModule);
+
+    VkShaderModuleCreateInfo createInfo;
+    {
+        createInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.pNext    = nullptr;
+        createInfo.flags    = 0;
+        createInfo.codeSize = codeSize;
+        createInfo.pCode    = code;
+    }
+    auto result = vkCreateShaderModule(device_, &createInfo, nullptr, shaderModule->ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan shader module");
+
+    entry = shaderModule;
+
+    /* Remove entries of released modules whenever the pool has grown considerably */
+    if (modules_.size() >= sweepThreshold_)
+        ReleaseExpiredEntries();
+
+    return shaderModule;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKShaderModulePool::ReleaseExpiredEntries()
+{
+    for (auto it = modules_.begin(); it != modules_.end();)
+    {
+        if (it->second.expired())
+            it = modules_.erase(it);
+        else
+            ++it;
+    }
+    sweepThreshold_ = std::max<std::size_t>(64, modules_.size() * 2);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
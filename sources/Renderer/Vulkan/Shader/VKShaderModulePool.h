@@ -0,0 +1,70 @@
+/*
+ * VKShaderModulePool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_SHADER_MODULE_POOL_H
+#define LLGL_VK_SHADER_MODULE_POOL_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "../../../Core/Helper.h"
+#include <memory>
+#include <mutex>
+#include <map>
+#include <utility>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+using VKShaderModuleSPtr = std::shared_ptr<VKPtr<VkShaderModule>>;
+using VKShaderModuleWPtr = std::weak_ptr<VKPtr<VkShaderModule>>;
+
+// Content-addressed pool of Vulkan shader modules, i.e. identical SPIR-V byte streams share the same VkShaderModule.
+class VKShaderModulePool
+{
+
+    public:
+
+        VKShaderModulePool(const VKPtr<VkDevice>& device);
+
+        VKShaderModulePool(const VKShaderModulePool&) = delete;
+        VKShaderModulePool& operator = (const VKShaderModulePool&) = delete;
+
+        /*
+        Returns the shader module for the specified SPIR-V byte code, or creates a new one if there is no module with the same byte code in use.
+        Modules are released as soon as the last shader that refers to them is released.
+        */
+        VKShaderModuleSPtr CreateShaderModule(const std::uint32_t* code, std::size_t codeSize);
+
+    private:
+
+        void ReleaseExpiredEntries();
+
+    private:
+
+        // Byte code is identified by its 128-bit hash and size, so the pool does not keep a copy of it.
+        using Key = std::pair<Hash128, std::size_t>;
+
+        const VKPtr<VkDevice>&                  device_;
+        std::mutex                              mutex_;
+        std::map<Key, VKShaderModuleWPtr>       modules_;
+        std::size_t                             sweepThreshold_ = 64;   // Number of entries at which expired entries are removed
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -63,15 +63,16 @@ void VKDeviceImage::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memo
 }
 
 void VKDeviceImage::CreateVkImage(
-    VkDevice                device,
-    VkImageType             imageType,
-    VkFormat                format,
-    const VkExtent3D&       extent,
-    std::uint32_t           numMipLevels,
-    std::uint32_t           numArrayLayers,
-    VkImageCreateFlags      createFlags,
-    VkSampleCountFlagBits   samplesFlags,
-    VkImageUsageFlags       usageFlags)
+    VkDevice                            device,
+    VkImageType                         imageType,
+    VkFormat                            format,
+    const VkExtent3D&                   extent,
+    std::uint32_t                       numMipLevels,
+    std::uint32_t                       numArrayLayers,
+    VkImageCreateFlags                  createFlags,
+    VkSampleCountFlagBits               samplesFlags,
+    VkImageUsageFlags                   usageFlags,
+    const std::vector<std::uint32_t>&   concurrentQueueFamilies)
 {
     /* Create image object */
     VkImageCreateInfo createInfo;
@@ -87,9 +88,18 @@ void VKDeviceImage::CreateVkImage(
         createInfo.samples                  = samplesFlags;
         createInfo.tiling                   = VK_IMAGE_TILING_OPTIMAL;
         createInfo.usage                    = usageFlags;
-        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE; // only used by graphics queue
-        createInfo.queueFamilyIndexCount    = 0;
-        createInfo.pQueueFamilyIndices      = nullptr;
+        if (concurrentQueueFamilies.empty())
+        {
+            createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE; // only used by graphics queue
+            createInfo.queueFamilyIndexCount    = 0;
+            createInfo.pQueueFamilyIndices      = nullptr;
+        }
+        else
+        {
+            createInfo.sharingMode              = VK_SHARING_MODE_CONCURRENT;
+            createInfo.queueFamilyIndexCount    = static_cast<std::uint32_t>(concurrentQueueFamilies.size());
+            createInfo.pQueueFamilyIndices      = concurrentQueueFamilies.data();
+        }
         createInfo.initialLayout            = VK_IMAGE_LAYOUT_UNDEFINED;
     }
     VkResult result = vkCreateImage(device, &createInfo, nullptr, image_.ReleaseAndGetAddressOf());
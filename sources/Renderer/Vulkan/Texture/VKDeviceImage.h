@@ -12,6 +12,7 @@
 #include <LLGL/Texture.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include <vector>
 #include <cstdint>
 
 
@@ -37,15 +38,16 @@ class VKDeviceImage
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
 
         void CreateVkImage(
-            VkDevice                device,
-            VkImageType             imageType,
-            VkFormat                format,
-            const VkExtent3D&       extent,
-            std::uint32_t           numMipLevels,
-            std::uint32_t           numArrayLayers,
-            VkImageCreateFlags      createFlags,
-            VkSampleCountFlagBits   samplesFlags,
-            VkImageUsageFlags       usageFlags
+            VkDevice                            device,
+            VkImageType                         imageType,
+            VkFormat                            format,
+            const VkExtent3D&                   extent,
+            std::uint32_t                       numMipLevels,
+            std::uint32_t                       numArrayLayers,
+            VkImageCreateFlags                  createFlags,
+            VkSampleCountFlagBits               samplesFlags,
+            VkImageUsageFlags                   usageFlags,
+            const std::vector<std::uint32_t>&   concurrentQueueFamilies = {}
         );
 
         void ReleaseVkImage();
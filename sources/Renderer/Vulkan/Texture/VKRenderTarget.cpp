@@ -240,6 +240,9 @@ void VKRenderTarget::CreateFramebuffer(const VKPtr<VkDevice>& device, VKDeviceMe
 
             /* Validate texture resolution to render target (to validate correlation between attachments) */
             ValidateMipResolution(*textureVK, attachment.mipLevel);
+
+            /* Store attachment to track the state of its texture */
+            textureAttachments_.push_back(attachment);
         }
         else
         {
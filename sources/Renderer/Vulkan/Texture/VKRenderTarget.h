@@ -63,6 +63,12 @@ class VKRenderTarget final : public RenderTarget
             return { resolution_.width, resolution_.height };
         }
 
+        // Returns the list of attachments that refer to a texture.
+        inline const std::vector<AttachmentDescriptor>& GetTextureAttachments() const
+        {
+            return textureAttachments_;
+        }
+
     private:
 
         void CreateDepthStencilForAttachment(VKDeviceMemoryManager& deviceMemoryMngr, const AttachmentDescriptor& attachmentDesc);
@@ -82,6 +88,7 @@ class VKRenderTarget final : public RenderTarget
         VKRenderPass                    secondaryRenderPass_;
 
         std::vector<VKPtr<VkImageView>> imageViews_;
+        std::vector<AttachmentDescriptor> textureAttachments_;
 
         VKDepthStencilBuffer            depthStencilBuffer_;
         VkFormat                        depthStencilFormat_     = VK_FORMAT_UNDEFINED;  // Format either from internal depth-stencil buffer or attachmed texture.
@@ -17,7 +17,7 @@ namespace LLGL
 
 
 VKTexture::VKTexture(
-    const VKPtr<VkDevice>&      device,
+    const VKDevice&             device,
     VKDeviceMemoryManager&      deviceMemoryMngr,
     const TextureDescriptor&    desc)
 :
@@ -29,6 +29,9 @@ VKTexture::VKTexture(
     /* Create Vulkan image and allocate memory region */
     CreateImage(device, desc);
     imageWrapper_.AllocateMemoryRegion(deviceMemoryMngr);
+
+    /* Initialize tracked state of all subresources with undefined layout */
+    subresourceStates_.resize(numMipLevels_ * numArrayLayers_, VKResourceState{});
 }
 
 Extent3D VKTexture::GetMipExtent(std::uint32_t mipLevel) const
@@ -144,6 +147,90 @@ void VKTexture::CreateInternalImageView(VkDevice device)
     CreateImageView(device, 0, GetNumMipLevels(), 0, GetNumArrayLayers(), imageView_.ReleaseAndGetAddressOf());
 }
 
+void VKTexture::TransitionState(VKPipelineBarrier& barrier, const TextureSubresource& subresource, const VKResourceState& newState)
+{
+    const auto mipEnd   = std::min(subresource.baseMipLevel + subresource.numMipLevels, numMipLevels_);
+    const auto layerEnd = std::min(subresource.baseArrayLayer + subresource.numArrayLayers, numArrayLayers_);
+
+    if (subresource.baseMipLevel >= mipEnd || subresource.baseArrayLayer >= layerEnd)
+        return;
+
+    VKResourceState prevState;
+
+    VkImageSubresourceRange range;
+    {
+        range.aspectMask        = GetAspectFlags();
+        range.baseMipLevel      = subresource.baseMipLevel;
+        range.levelCount        = mipEnd - subresource.baseMipLevel;
+        range.baseArrayLayer    = subresource.baseArrayLayer;
+        range.layerCount        = layerEnd - subresource.baseArrayLayer;
+    }
+
+    if (HasUniformState(subresource))
+    {
+        /* Transition all subresources with a single barrier */
+        auto state = GetSubresourceState(subresource.baseMipLevel, subresource.baseArrayLayer);
+        if (VKPipelineBarrier::TransitionState(state, newState, prevState))
+            barrier.AppendImageBarrier(GetVkImage(), range, prevState, newState);
+        SetState(subresource, state);
+    }
+    else
+    {
+        /* Transition each subresource individually; the barrier merges adjacent MIP levels */
+        range.levelCount    = 1;
+        range.layerCount    = 1;
+
+        for (auto arrayLayer = subresource.baseArrayLayer; arrayLayer < layerEnd; ++arrayLayer)
+        {
+            for (auto mipLevel = subresource.baseMipLevel; mipLevel < mipEnd; ++mipLevel)
+            {
+                if (VKPipelineBarrier::TransitionState(GetSubresourceState(mipLevel, arrayLayer), newState, prevState))
+                {
+                    range.baseMipLevel      = mipLevel;
+                    range.baseArrayLayer    = arrayLayer;
+                    barrier.AppendImageBarrier(GetVkImage(), range, prevState, newState);
+                }
+            }
+        }
+    }
+}
+
+void VKTexture::SetState(const TextureSubresource& subresource, const VKResourceState& state)
+{
+    const auto mipEnd   = std::min(subresource.baseMipLevel + subresource.numMipLevels, numMipLevels_);
+    const auto layerEnd = std::min(subresource.baseArrayLayer + subresource.numArrayLayers, numArrayLayers_);
+
+    for (auto arrayLayer = subresource.baseArrayLayer; arrayLayer < layerEnd; ++arrayLayer)
+    {
+        for (auto mipLevel = subresource.baseMipLevel; mipLevel < mipEnd; ++mipLevel)
+            GetSubresourceState(mipLevel, arrayLayer) = state;
+    }
+}
+
+static VkImageAspectFlags GetAspectFlagsByFormat(VkFormat format)
+{
+    switch (format)
+    {
+        case VK_FORMAT_D16_UNORM:
+        case VK_FORMAT_X8_D24_UNORM_PACK32:
+        case VK_FORMAT_D32_SFLOAT:
+            return VK_IMAGE_ASPECT_DEPTH_BIT;
+        case VK_FORMAT_S8_UINT:
+            return VK_IMAGE_ASPECT_STENCIL_BIT;
+        case VK_FORMAT_D16_UNORM_S8_UINT:
+        case VK_FORMAT_D24_UNORM_S8_UINT:
+        case VK_FORMAT_D32_SFLOAT_S8_UINT:
+            return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        default:
+            return VK_IMAGE_ASPECT_COLOR_BIT;
+    }
+}
+
+VkImageAspectFlags VKTexture::GetAspectFlags() const
+{
+    return GetAspectFlagsByFormat(format_);
+}
+
 
 /*
  * ======= Private: =======
@@ -286,7 +373,7 @@ static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
     return usageFlags;
 }
 
-void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
+void VKTexture::CreateImage(const VKDevice& device, const TextureDescriptor& desc)
 {
     /* Setup texture parameters */
     auto imageType  = GetVkImageType(desc.type);
@@ -295,7 +382,9 @@ void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
     numMipLevels_   = NumMipLevels(desc);
     numArrayLayers_ = GetVkImageArrayLayers(desc, imageType);
 
-    /* Create image object */
+    /* Create image object, which is shared between all queue families on request, so it can be accessed by async compute and transfer queues */
+    const auto& queueFamilies = ((desc.miscFlags & MiscFlags::SharedQueues) != 0 ? device.GetConcurrentQueueFamilies() : std::vector<std::uint32_t>{});
+
     imageWrapper_.CreateVkImage(
         device,
         imageType,
@@ -305,32 +394,32 @@ void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
         numArrayLayers_,
         GetVkImageCreateFlags(desc),
         GetVkImageSampleCountFlags(desc),
-        GetVkImageUsageFlags(desc)
+        GetVkImageUsageFlags(desc),
+        queueFamilies
     );
 }
 
-static VkImageAspectFlags GetAspectFlagsByFormat(VkFormat format)
+static bool IsEqualResourceState(const VKResourceState& lhs, const VKResourceState& rhs)
 {
-    switch (format)
-    {
-        case VK_FORMAT_D16_UNORM:
-        case VK_FORMAT_X8_D24_UNORM_PACK32:
-        case VK_FORMAT_D32_SFLOAT:
-            return VK_IMAGE_ASPECT_DEPTH_BIT;
-        case VK_FORMAT_S8_UINT:
-            return VK_IMAGE_ASPECT_STENCIL_BIT;
-        case VK_FORMAT_D16_UNORM_S8_UINT:
-        case VK_FORMAT_D24_UNORM_S8_UINT:
-        case VK_FORMAT_D32_SFLOAT_S8_UINT:
-            return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-        default:
-            return VK_IMAGE_ASPECT_COLOR_BIT;
-    }
+    return (lhs.layout == rhs.layout && lhs.accessMask == rhs.accessMask && lhs.stageMask == rhs.stageMask);
 }
 
-VkImageAspectFlags VKTexture::GetAspectFlags() const
+bool VKTexture::HasUniformState(const TextureSubresource& subresource) const
 {
-    return GetAspectFlagsByFormat(format_);
+    const auto mipEnd   = std::min(subresource.baseMipLevel + subresource.numMipLevels, numMipLevels_);
+    const auto layerEnd = std::min(subresource.baseArrayLayer + subresource.numArrayLayers, numArrayLayers_);
+    const auto& first   = subresourceStates_[subresource.baseArrayLayer * numMipLevels_ + subresource.baseMipLevel];
+
+    for (auto arrayLayer = subresource.baseArrayLayer; arrayLayer < layerEnd; ++arrayLayer)
+    {
+        for (auto mipLevel = subresource.baseMipLevel; mipLevel < mipEnd; ++mipLevel)
+        {
+            if (!IsEqualResourceState(subresourceStates_[arrayLayer * numMipLevels_ + mipLevel], first))
+                return false;
+        }
+    }
+
+    return true;
 }
 
 
@@ -13,6 +13,9 @@
 #include "VKDeviceImage.h"
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "../VKPipelineBarrier.h"
+#include "../VKDevice.h"
+#include <vector>
 #include <cstdint>
 
 
@@ -29,7 +32,7 @@ class VKTexture final : public Texture
     public:
 
         VKTexture(
-            const VKPtr<VkDevice>&      device,
+            const VKDevice&             device,
             VKDeviceMemoryManager&      deviceMemoryMngr,
             const TextureDescriptor&    desc
         );
@@ -50,6 +53,15 @@ class VKTexture final : public Texture
 
         void CreateInternalImageView(VkDevice device);
 
+        // Transitions the specified subresources into the new state and appends the required image barriers.
+        void TransitionState(VKPipelineBarrier& barrier, const TextureSubresource& subresource, const VKResourceState& newState);
+
+        // Overrides the tracked state of the specified subresources, e.g. after a render pass or an upload has transitioned the image layout.
+        void SetState(const TextureSubresource& subresource, const VKResourceState& state);
+
+        // Returns the image aspect flags of the texture format.
+        VkImageAspectFlags GetAspectFlags() const;
+
         // Returns the Vulkan image object.
         inline VkImage GetVkImage() const
         {
@@ -94,9 +106,16 @@ class VKTexture final : public Texture
 
     private:
 
-        void CreateImage(VkDevice device, const TextureDescriptor& desc);
+        void CreateImage(const VKDevice& device, const TextureDescriptor& desc);
 
-        VkImageAspectFlags GetAspectFlags() const;
+        // Returns true if all specified subresources share the same tracked state.
+        bool HasUniformState(const TextureSubresource& subresource) const;
+
+        // Returns the tracked state of the specified subresource.
+        inline VKResourceState& GetSubresourceState(std::uint32_t mipLevel, std::uint32_t arrayLayer)
+        {
+            return subresourceStates_[arrayLayer * numMipLevels_ + mipLevel];
+        }
 
     private:
 
@@ -108,6 +127,8 @@ class VKTexture final : public Texture
         std::uint32_t       numMipLevels_   = 0;
         std::uint32_t       numArrayLayers_ = 0;
 
+        std::vector<VKResourceState> subresourceStates_; // tracked state per MIP level and array layer
+
 };
 
 
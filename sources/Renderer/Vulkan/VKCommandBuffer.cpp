@@ -21,9 +21,12 @@
 #include "Texture/VKRenderTarget.h"
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
+#include "Memory/VKDeviceMemoryManager.h"
 #include "../CheckedCast.h"
 #include "../StaticLimits.h"
 #include "../../Core/Exception.h"
+#include <algorithm>
+#include <stdexcept>
 #include <cstddef>
 
 
@@ -33,6 +36,35 @@ namespace LLGL
 
 static const std::uint32_t g_maxNumViewportsPerBatch = 16;
 
+/* Default chunk size and alignment for transient upload data (see UpdateBuffer) */
+static const VkDeviceSize g_stagingChunkSize        = 65536;
+static const VkDeviceSize g_stagingDataAlignment    = 16;
+
+/* Resource states of commands outside of resource heaps (the layout of buffer states is ignored) */
+static const VKResourceState g_transferSrcBufferState   { VK_IMAGE_LAYOUT_UNDEFINED, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT };
+static const VKResourceState g_transferDstBufferState   { VK_IMAGE_LAYOUT_UNDEFINED, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT };
+static const VKResourceState g_vertexBufferState        { VK_IMAGE_LAYOUT_UNDEFINED, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT };
+static const VKResourceState g_indexBufferState         { VK_IMAGE_LAYOUT_UNDEFINED, VK_ACCESS_INDEX_READ_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT };
+static const VKResourceState g_indirectBufferState      { VK_IMAGE_LAYOUT_UNDEFINED, VK_ACCESS_INDIRECT_COMMAND_READ_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT };
+static const VKResourceState g_transferSrcImageState    { VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT };
+static const VKResourceState g_transferDstImageState    { VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT };
+
+/*
+Render passes of render targets transition their attachments into VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+At the end of a render pass, the attachments are made visible to all shader stages,
+so sampling them in the next render pass does not require to pause that render pass.
+*/
+static const VKResourceState g_sampledAttachmentState   { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT };
+static const VKResourceState g_colorAttachmentState     { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+static const VKResourceState g_depthAttachmentState     { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT };
+
+/*
+GenerateMips reads and writes all MIP levels with blit commands, which begin in transfer destination layout (see VKDevice::GenerateMips).
+Afterwards, all MIP levels are in shader-read-only layout, but they have been written by the transfer stage.
+*/
+static const VKResourceState g_generateMipsImageState   { VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT };
+static const VKResourceState g_generatedMipsImageState  { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT };
+
 static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDevice)
 {
     if (physicalDevice.GetFeatures().multiDrawIndirect != VK_FALSE)
@@ -41,31 +73,82 @@ static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDev
         return 1;
 }
 
+// Returns the pipeline stages that are supported by a dedicated queue of the specified type.
+static VkPipelineStageFlags GetSupportedVkPipelineStages(const CommandQueueType type)
+{
+    VkPipelineStageFlags stageMask =
+    (
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT       |
+        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT    |
+        VK_PIPELINE_STAGE_TRANSFER_BIT          |
+        VK_PIPELINE_STAGE_HOST_BIT              |
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+    );
+
+    if (type == CommandQueueType::Compute)
+        stageMask |= (VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+    return stageMask;
+}
+
 VKCommandBuffer::VKCommandBuffer(
     const VKPhysicalDevice&         physicalDevice,
     VKDevice&                       device,
-    VkQueue                         graphicsQueue,
+    VKDeviceMemoryManager&          deviceMemoryMngr,
+    VkQueue                         queue,
     const QueueFamilyIndices&       queueFamilyIndices,
-    const CommandBufferDescriptor&  desc)
+    const CommandBufferDescriptor&  desc,
+    std::uint32_t                   numFramesInFlight)
 :
     device_               { device                                  },
-    commandPool_          { device, vkDestroyCommandPool            },
     queuePresentFamily_   { queueFamilyIndices.presentFamily        },
     maxDrawIndirectCount_ { GetMaxDrawIndirectCount(physicalDevice) }
 {
-    std::size_t bufferCount = std::max(1u, desc.numNativeBuffers);
+    /*
+    Use at least one native command buffer per frame in flight, so Begin only waits for the recording
+    of the frame whose render context synchronization objects have already been waited for
+    */
+    std::size_t bufferCount = std::max({ 1u, desc.numNativeBuffers, numFramesInFlight });
 
     /* Translate creation flags */
     if ((desc.flags & CommandBufferFlags::DeferredSubmit) != 0)
     {
         usageFlags_     = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
         bufferLevel_    = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+
+        /* Continue the render pass of the primary command buffer if a render pass is specified */
+        if (desc.renderPass != nullptr)
+        {
+            auto renderPassVK = LLGL_CAST(const VKRenderPass*, desc.renderPass);
+            inheritanceRenderPass_  = renderPassVK->GetVkRenderPass();
+            usageFlags_             |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+
+            /* Framebuffer is unknown at encoding time, so the default scissor covers the maximal framebuffer extent */
+            const auto& limits = physicalDevice.GetProperties().limits;
+            framebufferExtent_ = { limits.maxFramebufferWidth, limits.maxFramebufferHeight };
+        }
+    }
+
+    if ((desc.flags & CommandBufferFlags::MultiSubmit) != 0)
+    {
+        /* Primary command buffers that are submitted multiple times must not be recorded for a single submission */
+        multiSubmit_ = true;
+        if (!IsSecondaryCmdBuffer())
+            usageFlags_ = 0;
     }
 
-    /* Create native command buffer objects */
-    CreateCommandPool(queueFamilyIndices.graphicsFamily);
+    /* Create native command buffer objects for the queue family of the command queue this command buffer is submitted to */
+    CreateCommandPools(device.GetQueueFamily(desc.queueType), bufferCount);
     CreateCommandBuffers(bufferCount);
-    CreateRecordingFences(graphicsQueue, bufferCount);
+    CreateRecordingFences(queue, bufferCount);
+    CreateStagingBufferPools(deviceMemoryMngr, bufferCount);
+
+    /* Barriers on dedicated compute and transfer queues must not refer to graphics pipeline stages */
+    if (queue != device.GetVkQueue())
+    {
+        pipelineBarrier_.SetSupportedStages(GetSupportedVkPipelineStages(desc.queueType));
+        submitBarrier_.SetSupportedStages(GetSupportedVkPipelineStages(desc.queueType));
+    }
 
     /* Acquire first native command buffer */
     AcquireNextBuffer();
@@ -73,24 +156,65 @@ VKCommandBuffer::VKCommandBuffer(
 
 VKCommandBuffer::~VKCommandBuffer()
 {
-    vkFreeCommandBuffers(
-        device_,
-        commandPool_,
-        static_cast<std::uint32_t>(commandBufferList_.size()),
-        commandBufferList_.data()
-    );
+    /* Release all buffer versions that are still owned by this command buffer before its fences are destroyed */
+    for (const auto& timeline : completionTimelines_)
+        timeline->Retire();
+    for (const auto& timeline : recordingTimelines_)
+        timeline->Retire();
+
+    for (std::size_t i = 0; i < commandPoolList_.size(); ++i)
+    {
+        vkFreeCommandBuffers(device_, commandPoolList_[i], 1, &commandBufferList_[i]);
+        if (!prologueBufferList_.empty())
+            vkFreeCommandBuffers(device_, commandPoolList_[i], 1, &prologueBufferList_[i]);
+        if (!transitionBufferList_.empty())
+            vkFreeCommandBuffers(device_, commandPoolList_[i], 1, &transitionBufferList_[i]);
+    }
 }
 
 /* ----- Encoding ----- */
 
 void VKCommandBuffer::Begin()
 {
+    /* Buffer versions reserved by the previous recording are released once the GPU has completed it, since it won't be submitted again */
+    if (recordingTicket_)
+        recordingTicket_.timeline->SetDependency(completionTicket_);
+
     /* Use next internal VkCommandBuffer object to reduce latency */
     AcquireNextBuffer();
 
-    /* Wait for fence before recording */
-    vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
-    vkResetFences(device_, 1, &recordingFence_);
+    /*
+    Wait until the previous recording of this native command buffer has completed; secondary command buffers wait for the primary command buffer
+    they were executed in, and command buffers that were submitted in a batch wait for the last command buffer of that batch
+    */
+    completionTicket_.timeline  = completionTimelines_[commandBufferIndex_];
+    completionTicket_.value     = completionTicket_.timeline->BeginRecording();
+    submitted_                  = false;
+
+    if (multiSubmit_)
+    {
+        recordingTicket_.timeline   = recordingTimelines_[commandBufferIndex_];
+        recordingTicket_.value      = recordingTicket_.timeline->BeginRecording();
+    }
+
+    /* Release transient upload data of the previous recording */
+    stagingBufferPools_[commandBufferIndex_].Reset();
+
+    /* Reset transient command pool of the current command buffer, which also resets the command buffer itself */
+    vkResetCommandPool(device_, commandPoolList_[commandBufferIndex_], 0);
+
+    /* Secondary command buffers inherit the render pass; the framebuffer is left unspecified */
+    VkCommandBufferInheritanceInfo inheritanceInfo;
+    {
+        inheritanceInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.pNext                   = nullptr;
+        inheritanceInfo.renderPass              = inheritanceRenderPass_;
+        inheritanceInfo.subpass                 = 0;
+        inheritanceInfo.framebuffer             = VK_NULL_HANDLE;
+        inheritanceInfo.occlusionQueryEnable    = VK_FALSE;
+        inheritanceInfo.queryFlags              = 0;
+        inheritanceInfo.pipelineStatistics      = 0;
+    }
 
     /* Begin recording of current command buffer */
     VkCommandBufferBeginInfo beginInfo;
@@ -98,7 +222,7 @@ void VKCommandBuffer::Begin()
         beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         beginInfo.pNext             = nullptr;
         beginInfo.flags             = usageFlags_;
-        beginInfo.pInheritanceInfo  = nullptr;
+        beginInfo.pInheritanceInfo  = (IsSecondaryCmdBuffer() ? &inheritanceInfo : nullptr);
     }
     auto result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
     VKThrowIfFailed(result, "failed to begin Vulkan command buffer");
@@ -108,16 +232,42 @@ void VKCommandBuffer::Begin()
     ResetQueryPoolsInFlight();
     #endif
 
+    /* Reset bound resource heaps, pending barriers, and tracked resource states */
+    pipelineBarrier_.Reset();
+    stateTracker_.Reset();
+    graphicsResourceHeap_   = nullptr;
+    computeResourceHeap_    = nullptr;
+    renderContext_          = nullptr;
+
+    graphicsDynamicOffsetsDirty_    = false;
+    computeDynamicOffsetsDirty_     = false;
+    scissorRectInvalidated_         = true;
+
+    reservedBuffers_.clear();
+    executedCmdBuffers_.clear();
+    prologueRecording_ = false;
+
     /* Store new record state */
     recordState_ = RecordState::OutsideRenderPass;
 }
 
 void VKCommandBuffer::End()
 {
+    /* Make uploads of the prologue visible to all commands of this recording */
+    if (prologueRecording_)
+        EndPrologue();
+
     /* End encoding of current command buffer */
     auto result = vkEndCommandBuffer(commandBuffer_);
     VKThrowIfFailed(result, "failed to end Vulkan command buffer");
 
+    /* Deferred command buffers can be executed by multiple submissions at once, so their reserved buffer versions keep the content at the end of encoding */
+    if (IsSecondaryCmdBuffer())
+    {
+        for (auto bufferVK : reservedBuffers_)
+            bufferVK->RefreshVersion(recordingTicket_);
+    }
+
     /* Store new record state */
     recordState_ = RecordState::ReadyForSubmit;
 }
@@ -125,8 +275,28 @@ void VKCommandBuffer::End()
 void VKCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
     auto& cmdBufferVK = LLGL_CAST(VKCommandBuffer&, deferredCommandBuffer);
+
+    /* Transition the resources into the states the secondary command buffer begins with, and continue with the states it leaves them in */
+    stateTracker_.Append(pipelineBarrier_, cmdBufferVK.GetStateTracker());
+    InvalidateResourceHeapStates();
+
+    if (IsInsideRenderPass())
+    {
+        /* Pending barriers must be recorded outside of the render pass, which is only paused if it has already begun */
+        if (!pipelineBarrier_.IsEmpty())
+            PauseRenderPass();
+        BeginSubpassContents(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+    }
+    else
+        pipelineBarrier_.Submit(commandBuffer_);
+
     VkCommandBuffer cmdBuffers[] = { cmdBufferVK.GetVkCommandBuffer() };
     vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+
+    /* Secondary command buffer must not be reset until this command buffer has been completed */
+    cmdBufferVK.NotifyExecution(completionTicket_);
+    if (multiSubmit_)
+        executedCmdBuffers_.push_back(&cmdBufferVK);
 }
 
 /* ----- Blitting ----- */
@@ -142,14 +312,24 @@ void VKCommandBuffer::UpdateBuffer(
     auto size   = static_cast<VkDeviceSize>(dataSize);
     auto offset = static_cast<VkDeviceSize>(dstOffset);
 
-    if (IsInsideRenderPass())
+    if (dstBufferVK.IsDynamic())
     {
-        PauseRenderPass();
-        vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, data);
-        ResumeRenderPass();
+        /*
+        Publish a new version of the dynamic buffer, which doesn't require any commands.
+        Multi-submit recordings don't publish versions, since the update must be repeated with every submission.
+        */
+        if (!multiSubmit_ && dstBufferVK.WriteVersion(offset, data, size, completionTicket_))
+        {
+            graphicsDynamicOffsetsDirty_    = true;
+            computeDynamicOffsetsDirty_     = true;
+            return;
+        }
+
+        /* Update the version of this recording within the command stream */
+        offset += RetainBufferVersion(dstBufferVK);
     }
-    else
-        vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, data);
+
+    UploadBuffer(dstBufferVK, offset, data, size);
 }
 
 void VKCommandBuffer::CopyBuffer(
@@ -162,21 +342,24 @@ void VKCommandBuffer::CopyBuffer(
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
     auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
 
+    /* Dynamic buffers are copied from and into the version this recording accesses */
     VkBufferCopy region;
     {
-        region.srcOffset    = static_cast<VkDeviceSize>(srcOffset);
-        region.dstOffset    = static_cast<VkDeviceSize>(dstOffset);
+        region.srcOffset    = static_cast<VkDeviceSize>(srcOffset + RetainBufferVersion(srcBufferVK));
+        region.dstOffset    = static_cast<VkDeviceSize>(dstOffset + RetainBufferVersion(dstBufferVK));
         region.size         = static_cast<VkDeviceSize>(size);
     }
 
+    TransitionBufferState(srcBufferVK, g_transferSrcBufferState);
+    TransitionBufferState(dstBufferVK, g_transferDstBufferState);
+    InvalidateResourceHeapStates();
+
+    /* Copy commands are recorded outside of the render pass, which is resumed with the next command inside the render pass */
     if (IsInsideRenderPass())
-    {
         PauseRenderPass();
-        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
-        ResumeRenderPass();
-    }
-    else
-        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
+
+    pipelineBarrier_.Submit(commandBuffer_);
+    vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
 }
 
 void VKCommandBuffer::CopyTexture(
@@ -186,18 +369,45 @@ void VKCommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
-    //TODO
+    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+
+    VkImageCopy region;
+    {
+        region.srcSubresource.aspectMask        = srcTextureVK.GetAspectFlags();
+        region.srcSubresource.mipLevel          = srcLocation.mipLevel;
+        region.srcSubresource.baseArrayLayer    = srcLocation.arrayLayer;
+        region.srcSubresource.layerCount        = 1;
+        region.srcOffset                        = { srcLocation.offset.x, srcLocation.offset.y, srcLocation.offset.z };
+        region.dstSubresource.aspectMask        = dstTextureVK.GetAspectFlags();
+        region.dstSubresource.mipLevel          = dstLocation.mipLevel;
+        region.dstSubresource.baseArrayLayer    = dstLocation.arrayLayer;
+        region.dstSubresource.layerCount        = 1;
+        region.dstOffset                        = { dstLocation.offset.x, dstLocation.offset.y, dstLocation.offset.z };
+        region.extent                           = { extent.width, extent.height, extent.depth };
+    }
+
+    /* Transition source and destination subresources into transfer layouts */
+    stateTracker_.TransitionTexture(&pipelineBarrier_, srcTextureVK, TextureSubresource{ srcLocation.arrayLayer, 1, srcLocation.mipLevel, 1 }, g_transferSrcImageState);
+    stateTracker_.TransitionTexture(&pipelineBarrier_, dstTextureVK, TextureSubresource{ dstLocation.arrayLayer, 1, dstLocation.mipLevel, 1 }, g_transferDstImageState);
+    InvalidateResourceHeapStates();
+
+    if (IsInsideRenderPass())
+        PauseRenderPass();
+
+    pipelineBarrier_.Submit(commandBuffer_);
+    vkCmdCopyImage(
+        commandBuffer_,
+        srcTextureVK.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        dstTextureVK.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        1, &region
+    );
 }
 
 void VKCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
-    device_.GenerateMips(
-        commandBuffer_,
-        textureVK.GetVkImage(),
-        textureVK.GetVkExtent(),
-        TextureSubresource{ 0, textureVK.GetNumArrayLayers(), 0, textureVK.GetNumMipLevels() }
-    );
+    VKCommandBuffer::GenerateMips(texture, TextureSubresource{ 0, textureVK.GetNumArrayLayers(), 0, textureVK.GetNumMipLevels() });
 }
 
 void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
@@ -210,12 +420,20 @@ void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& s
     if (subresource.baseMipLevel   < maxNumMipLevels   && subresource.numMipLevels   > 0 &&
         subresource.baseArrayLayer < maxNumArrayLayers && subresource.numArrayLayers > 0)
     {
+        /* Wait for previous accesses to all MIP levels and transition them into transfer layout, which keeps the content of the base MIP level */
+        stateTracker_.TransitionTexture(&pipelineBarrier_, textureVK, subresource, g_generateMipsImageState);
+        InvalidateResourceHeapStates();
+        FlushPipelineBarriers();
+
         device_.GenerateMips(
             commandBuffer_,
             textureVK.GetVkImage(),
             textureVK.GetVkExtent(),
-            subresource
+            subresource,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
         );
+
+        stateTracker_.SetTextureState(textureVK, subresource, g_generatedMipsImageState);
     }
 }
 
@@ -438,6 +656,7 @@ void VKCommandBuffer::SetVertexBuffer(Buffer& buffer)
     VkDeviceSize offsets[] = { 0 };
 
     vkCmdBindVertexBuffers(commandBuffer_, 0, 1, buffers, offsets);
+    TransitionBufferState(bufferVK, g_vertexBufferState);
 }
 
 void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
@@ -450,18 +669,23 @@ void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         bufferArrayVK.GetBuffers().data(),
         bufferArrayVK.GetOffsets().data()
     );
+
+    for (auto bufferVK : bufferArrayVK.GetBufferObjects())
+        TransitionBufferState(*bufferVK, g_vertexBufferState);
 }
 
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), 0, bufferVK.GetIndexType());
+    TransitionBufferState(bufferVK, g_indexBufferState);
 }
 
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), offset, VKTypes::ToVkIndexType(format));
+    TransitionBufferState(bufferVK, g_indexBufferState);
 }
 
 /* ----- Stream Output Buffers ------ */
@@ -509,6 +733,11 @@ void VKCommandBuffer::EndStreamOutput()
 //private
 void VKCommandBuffer::BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelineBindPoint bindingPoint, std::uint32_t firstSet)
 {
+    /* Gather dynamic offsets of the buffer versions this recording accesses */
+    dynamicOffsets_.clear();
+    for (std::size_t i = 0, n = resourceHeapVK.GetNumDynamicBuffers(); i < n; ++i)
+        dynamicOffsets_.push_back(RetainBufferVersion(resourceHeapVK.GetDynamicBuffer(i)));
+
     vkCmdBindDescriptorSets(
         commandBuffer_,
         bindingPoint,
@@ -516,21 +745,47 @@ void VKCommandBuffer::BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelin
         firstSet,
         static_cast<std::uint32_t>(resourceHeapVK.GetVkDescriptorSets().size()),
         resourceHeapVK.GetVkDescriptorSets().data(),
-        0,
-        nullptr
+        static_cast<std::uint32_t>(dynamicOffsets_.size()),
+        (dynamicOffsets_.empty() ? nullptr : dynamicOffsets_.data())
     );
 }
 
+//private
+std::uint32_t VKCommandBuffer::RetainBufferVersion(VKBuffer& bufferVK)
+{
+    if (multiSubmit_)
+    {
+        /* Dynamic offsets are baked into this recording, so reserve a version that is not published to other recordings until this one is discarded */
+        std::uint32_t dynamicOffset = 0;
+        if (bufferVK.ReserveVersion(recordingTicket_, dynamicOffset))
+            reservedBuffers_.push_back(&bufferVK);
+        return dynamicOffset;
+    }
+    return bufferVK.RetainVersion(completionTicket_);
+}
+
 void VKCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
 {
     auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
     BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_GRAPHICS, firstSet);
+
+    /* Transition resources of this heap with the next draw command */
+    graphicsResourceHeap_           = &resourceHeapVK;
+    graphicsResourceHeapSet_        = firstSet;
+    graphicsResourcesDirty_         = true;
+    graphicsDynamicOffsetsDirty_    = false;
 }
 
 void VKCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
 {
     auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
     BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_COMPUTE, firstSet);
+
+    /* Transition resources of this heap with the next dispatch command */
+    computeResourceHeap_            = &resourceHeapVK;
+    computeResourceHeapSet_         = firstSet;
+    computeResourcesDirty_          = true;
+    computeDynamicOffsetsDirty_     = false;
 }
 
 void VKCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags)
@@ -560,6 +815,8 @@ void VKCommandBuffer::BeginRenderPass(
     {
         /* Get Vulkan render context object */
         auto& renderContextVK = LLGL_CAST(VKRenderContext&, renderTarget);
+        renderTarget_   = nullptr;
+        renderContext_  = (&renderContextVK);
 
         /* Store information about framebuffer attachments */
         renderPass_             = renderContextVK.GetSwapChainRenderPass().GetVkRenderPass();
@@ -581,13 +838,24 @@ void VKCommandBuffer::BeginRenderPass(
         framebufferExtent_      = renderTargetVK.GetVkExtent();
         numColorAttachments_    = renderTargetVK.GetNumColorAttachments();
         hasDSVAttachment_       = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
+
+        /* Wait for previous accesses to the attachment textures */
+        renderTarget_ = &renderTargetVK;
+        TransitionRenderTargetAttachments(renderTargetVK, g_colorAttachmentState, g_depthAttachmentState);
+    }
+
+    /* Record all pending barriers before the render pass begins, including the resources of an already bound heap */
+    if (graphicsResourcesDirty_ && graphicsResourceHeap_ != nullptr)
+    {
+        TransitionResourceHeapStates(*graphicsResourceHeap_);
+        graphicsResourcesDirty_ = false;
     }
+    pipelineBarrier_.Submit(commandBuffer_);
 
     scissorRectInvalidated_ = true;
 
-    /* Declare array or clear values */
-    VkClearValue clearValuesVK[LLGL_MAX_NUM_ATTACHMENTS];
-    std::uint32_t numClearValuesVK = 0;
+    /* Reset clear values */
+    numClearValuesVK_ = 0;
 
     /* Get native render pass object either from RenderTarget or RenderPass interface */
     if (renderPass != nullptr)
@@ -597,16 +865,16 @@ void VKCommandBuffer::BeginRenderPass(
         renderPass_ = renderPassVK->GetVkRenderPass();
 
         /* Fill array of clear values */
-        numClearValuesVK        = renderPassVK->GetNumClearValues();
+        numClearValuesVK_       = renderPassVK->GetNumClearValues();
         auto clearValuesMask    = renderPassVK->GetClearValuesMask();
         auto depthStencilIndex  = renderPassVK->GetDepthStencilIndex();
 
-        for (std::uint32_t i = 0; i < numClearValuesVK; ++i)
+        for (std::uint32_t i = 0; i < numClearValuesVK_; ++i)
         {
             /* Check if current attachment index requires a clear value */
             if (((clearValuesMask >> i) & 0x1ull) != 0)
             {
-                auto& dst = clearValuesVK[i];
+                auto& dst = clearValuesVK_[i];
 
                 if (numClearValues > 0)
                 {
@@ -635,19 +903,12 @@ void VKCommandBuffer::BeginRenderPass(
         }
     }
 
-    /* Record begin of render pass */
-    VkRenderPassBeginInfo beginInfo;
-    {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.renderPass        = renderPass_;
-        beginInfo.framebuffer       = framebuffer_;
-        beginInfo.renderArea.offset = { 0, 0 };
-        beginInfo.renderArea.extent = framebufferExtent_;
-        beginInfo.clearValueCount   = numClearValuesVK;
-        beginInfo.pClearValues      = clearValuesVK;
-    }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    /*
+    Defer begin of render pass until the first command inside the render pass is recorded,
+    so the subpass contents are known, i.e. either inline commands or secondary command buffers
+    */
+    pendingRenderPass_  = renderPass_;
+    renderPassPending_  = true;
 
     /* Store new record state */
     recordState_ = RecordState::InsideRenderPass;
@@ -655,13 +916,25 @@ void VKCommandBuffer::BeginRenderPass(
 
 void VKCommandBuffer::EndRenderPass()
 {
-    /* Record and of render pass */
+    /* Begin render pass if no commands have been recorded inside of it, then record end of render pass */
+    BeginSubpassContents(subpassContents_);
     vkCmdEndRenderPass(commandBuffer_);
 
+    /* Make attachment textures visible for sampling */
+    if (renderTarget_ != nullptr)
+    {
+        TransitionRenderTargetAttachments(*renderTarget_, g_sampledAttachmentState, g_sampledAttachmentState);
+        pipelineBarrier_.Submit(commandBuffer_);
+        renderTarget_ = nullptr;
+    }
+
     /* Reset render pass and framebuffer attributes */
     renderPass_     = VK_NULL_HANDLE;
     framebuffer_    = VK_NULL_HANDLE;
 
+    /* Attachments might be sampled by the bound resource heaps */
+    InvalidateResourceHeapStates();
+
     /* Store new record state */
     recordState_ = RecordState::OutsideRenderPass;
 }
@@ -728,12 +1001,20 @@ void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
     if (queryHeapVK.GetType() == QueryType::SamplesPassed)
         flags |= VK_QUERY_CONTROL_PRECISE_BIT;
 
+    /* Queries that are begun inside a render pass must be ended within the same render pass instance */
+    if (IsInsideRenderPass())
+        BeginSubpassContents(VK_SUBPASS_CONTENTS_INLINE);
+
     vkCmdBeginQuery(commandBuffer_, queryHeapVK.GetVkQueryPool(), query, flags);
 }
 
 void VKCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
     auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
+
+    if (IsInsideRenderPass())
+        BeginSubpassContents(VK_SUBPASS_CONTENTS_INLINE);
+
     vkCmdEndQuery(commandBuffer_, queryHeapVK.GetVkQueryPool(), query);
     AppendQueryPoolInFlight(queryHeapVK.GetVkQueryPool());
 }
@@ -773,53 +1054,65 @@ void VKCommandBuffer::EndRenderCondition()
 
 void VKCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
+    PrepareDraw();
     vkCmdDraw(commandBuffer_, numVertices, 1, firstVertex, 0);
 }
 
 void VKCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
+    PrepareDraw();
     vkCmdDrawIndexed(commandBuffer_, numIndices, 1, firstIndex, 0, 0);
 }
 
 void VKCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    PrepareDraw();
     vkCmdDrawIndexed(commandBuffer_, numIndices, 1, firstIndex, vertexOffset, 0);
 }
 
 void VKCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
+    PrepareDraw();
     vkCmdDraw(commandBuffer_, numVertices, numInstances, firstVertex, 0);
 }
 
 void VKCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    PrepareDraw();
     vkCmdDraw(commandBuffer_, numVertices, numInstances, firstVertex, firstInstance);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
+    PrepareDraw();
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, 0, 0);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    PrepareDraw();
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, vertexOffset, 0);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    PrepareDraw();
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
 void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TransitionBufferState(bufferVK, g_indirectBufferState);
+    PrepareDraw();
     vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
 
 void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TransitionBufferState(bufferVK, g_indirectBufferState);
+    PrepareDraw();
     if (maxDrawIndirectCount_ < numCommands)
     {
         while (numCommands > 0)
@@ -837,12 +1130,16 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::ui
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TransitionBufferState(bufferVK, g_indirectBufferState);
+    PrepareDraw();
     vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
 
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TransitionBufferState(bufferVK, g_indirectBufferState);
+    PrepareDraw();
     if (maxDrawIndirectCount_ < numCommands)
     {
         while (numCommands > 0)
@@ -857,16 +1154,85 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
         vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
 }
 
+void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifdef LLGL_VK_ENABLE_EXT
+    /* Ensure "VK_KHR_draw_indirect_count" is supported */
+    LLGL_ASSERT_VK_EXTENSION(VKExt::KHR_draw_indirect_count, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+    TransitionBufferState(bufferVK, g_indirectBufferState);
+    TransitionBufferState(countBufferVK, g_indirectBufferState);
+    PrepareDraw();
+
+    vkCmdDrawIndirectCountKHR(
+        commandBuffer_,
+        bufferVK.GetVkBuffer(),
+        offset,
+        countBufferVK.GetVkBuffer(),
+        countOffset,
+        maxNumCommands,
+        stride
+    );
+    #else
+    ThrowVKExtensionNotSupportedExcept(__FUNCTION__, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    #endif
+}
+
+void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifdef LLGL_VK_ENABLE_EXT
+    /* Ensure "VK_KHR_draw_indirect_count" is supported */
+    LLGL_ASSERT_VK_EXTENSION(VKExt::KHR_draw_indirect_count, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+    TransitionBufferState(bufferVK, g_indirectBufferState);
+    TransitionBufferState(countBufferVK, g_indirectBufferState);
+    PrepareDraw();
+
+    vkCmdDrawIndexedIndirectCountKHR(
+        commandBuffer_,
+        bufferVK.GetVkBuffer(),
+        offset,
+        countBufferVK.GetVkBuffer(),
+        countOffset,
+        maxNumCommands,
+        stride
+    );
+    #else
+    ThrowVKExtensionNotSupportedExcept(__FUNCTION__, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    #endif
+}
+
+void VKCommandBuffer::MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws)
+{
+    PrepareDraw();
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+        vkCmdDraw(commandBuffer_, draws[i].numVertices, draws[i].numInstances, draws[i].firstVertex, draws[i].firstInstance);
+}
+
+void VKCommandBuffer::MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws)
+{
+    PrepareDraw();
+    for (std::uint32_t i = 0; i < numDraws; ++i)
+        vkCmdDrawIndexed(commandBuffer_, draws[i].numIndices, draws[i].numInstances, draws[i].firstIndex, draws[i].vertexOffset, draws[i].firstInstance);
+}
+
 /* ----- Compute ----- */
 
 void VKCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    PrepareDispatch();
     vkCmdDispatch(commandBuffer_, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 }
 
 void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TransitionBufferState(bufferVK, g_indirectBufferState);
+    PrepareDispatch();
     vkCmdDispatchIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset);
 }
 
@@ -914,6 +1280,60 @@ void VKCommandBuffer::AcquireNextBuffer()
     commandBufferIndex_ = (commandBufferIndex_ + 1) % commandBufferList_.size();
     commandBuffer_      = commandBufferList_[commandBufferIndex_];
     recordingFence_     = recordingFenceList_[commandBufferIndex_].Get();
+    prologueBuffer_     = (prologueBufferList_.empty() ? VK_NULL_HANDLE : prologueBufferList_[commandBufferIndex_]);
+    transitionBuffer_   = (transitionBufferList_.empty() ? VK_NULL_HANDLE : transitionBufferList_[commandBufferIndex_]);
+}
+
+void VKCommandBuffer::NotifyExecution(const VKCompletionTicket& primaryTicket)
+{
+    if (completionTicket_)
+        completionTicket_.timeline->SetDependency(primaryTicket);
+}
+
+void VKCommandBuffer::NotifyBatchSubmission(const VKCompletionTicket& batchTicket)
+{
+    /*
+    The own fence of this command buffer is not signaled by a batch submission, so this recording completes with the last command buffer of the batch.
+    Deferred command buffers executed by this one depend on this recording, so they complete with the batch as well.
+    */
+    NotifyExecution(batchTicket);
+}
+
+std::uint32_t VKCommandBuffer::PrepareSubmission(VkCommandBuffer* cmdBuffers)
+{
+    if (submitted_)
+    {
+        /* The fence must not be signaled for another submission, so wait for the previous submission of this recording and renew its ticket */
+        completionTicket_.value = completionTicket_.timeline->BeginRecording();
+
+        /* Deferred command buffers are executed by this submission again */
+        for (auto cmdBufferVK : executedCmdBuffers_)
+            cmdBufferVK->NotifyExecution(completionTicket_);
+    }
+
+    /* Reserved buffer versions are only accessed by this recording, which is not in flight anymore, so they take over the latest buffer content */
+    for (auto bufferVK : reservedBuffers_)
+        bufferVK->RefreshVersion(recordingTicket_);
+
+    submitted_ = true;
+
+    /* Transition the resources from the states that previous submissions have left them in, which are only known now */
+    std::uint32_t numCmdBuffers = 0;
+
+    stateTracker_.Resolve(submitBarrier_);
+    if (!submitBarrier_.IsEmpty())
+    {
+        RecordTransitionPrologue();
+        cmdBuffers[numCmdBuffers++] = transitionBuffer_;
+    }
+
+    /* Uploads of the prologue are executed right before the command buffer */
+    if (prologueRecording_)
+        cmdBuffers[numCmdBuffers++] = prologueBuffer_;
+
+    cmdBuffers[numCmdBuffers++] = commandBuffer_;
+
+    return numCmdBuffers;
 }
 
 
@@ -921,38 +1341,68 @@ void VKCommandBuffer::AcquireNextBuffer()
  * ======= Private: =======
  */
 
-void VKCommandBuffer::CreateCommandPool(std::uint32_t queueFamilyIndex)
+void VKCommandBuffer::CreateCommandPools(std::uint32_t queueFamilyIndex, std::size_t numPools)
 {
-    /* Create command pool */
+    commandPoolList_.reserve(numPools);
+
+    /* Create transient command pools, which are reset as a whole when encoding begins; transition prologues are reset individually on each submission */
     VkCommandPoolCreateInfo createInfo;
     {
         createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
         createInfo.pNext            = nullptr;
-        createInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        createInfo.flags            = (VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
         createInfo.queueFamilyIndex = queueFamilyIndex;
     }
-    auto result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan command pool");
+
+    for (std::size_t i = 0; i < numPools; ++i)
+    {
+        VKPtr<VkCommandPool> commandPool { device_, vkDestroyCommandPool };
+        auto result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan command pool");
+        commandPoolList_.emplace_back(std::move(commandPool));
+    }
 }
 
 void VKCommandBuffer::CreateCommandBuffers(std::size_t bufferCount)
 {
-    /* Allocate command buffers */
+    /* Allocate one command buffer from each command pool */
     commandBufferList_.resize(bufferCount);
 
-    VkCommandBufferAllocateInfo allocInfo;
+    /*
+    Allocate one prologue command buffer from each command pool for uploads that must not interrupt a render pass (see UploadBuffer),
+    and one for the resource transitions that are recorded when the command buffer is submitted (see PrepareSubmission)
+    */
+    if (!IsSecondaryCmdBuffer())
+    {
+        prologueBufferList_.resize(bufferCount);
+        transitionBufferList_.resize(bufferCount);
+    }
+
+    for (std::size_t i = 0; i < bufferCount; ++i)
     {
-        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.pNext                 = nullptr;
-        allocInfo.commandPool           = commandPool_;
-        allocInfo.level                 = bufferLevel_;
-        allocInfo.commandBufferCount    = static_cast<std::uint32_t>(bufferCount);
+        VkCommandBufferAllocateInfo allocInfo;
+        {
+            allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.pNext                 = nullptr;
+            allocInfo.commandPool           = commandPoolList_[i];
+            allocInfo.level                 = bufferLevel_;
+            allocInfo.commandBufferCount    = 1;
+        }
+        auto result = vkAllocateCommandBuffers(device_, &allocInfo, &commandBufferList_[i]);
+        VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
+
+        if (!prologueBufferList_.empty())
+        {
+            result = vkAllocateCommandBuffers(device_, &allocInfo, &prologueBufferList_[i]);
+            VKThrowIfFailed(result, "failed to allocate Vulkan prologue command buffers");
+
+            result = vkAllocateCommandBuffers(device_, &allocInfo, &transitionBufferList_[i]);
+            VKThrowIfFailed(result, "failed to allocate Vulkan transition command buffers");
+        }
     }
-    auto result = vkAllocateCommandBuffers(device_, &allocInfo, commandBufferList_.data());
-    VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
 }
 
-void VKCommandBuffer::CreateRecordingFences(VkQueue graphicsQueue, std::size_t numFences)
+void VKCommandBuffer::CreateRecordingFences(VkQueue queue, std::size_t numFences)
 {
     recordingFenceList_.reserve(numFences);
 
@@ -972,16 +1422,34 @@ void VKCommandBuffer::CreateRecordingFences(VkQueue graphicsQueue, std::size_t n
             VKThrowIfFailed(result, "failed to create Vulkan fence");
 
             /* Initial fence signal */
-            vkQueueSubmit(graphicsQueue, 0, nullptr, fence);
+            vkQueueSubmit(queue, 0, nullptr, fence);
         }
+
+        /* Secondary command buffers are never submitted with their own fence, so they only complete with the primary command buffer they were executed in */
+        auto timelineFence = (IsSecondaryCmdBuffer() ? VK_NULL_HANDLE : fence.Get());
+        completionTimelines_.emplace_back(std::make_shared<VKCompletionTimeline>(device_, timelineFence));
+
+        /* Recordings that are submitted multiple times own their reserved buffer versions until they are discarded */
+        if (multiSubmit_)
+            recordingTimelines_.emplace_back(std::make_shared<VKCompletionTimeline>(device_, VK_NULL_HANDLE));
+
         recordingFenceList_.emplace_back(std::move(fence));
     }
 }
 
+void VKCommandBuffer::CreateStagingBufferPools(VKDeviceMemoryManager& deviceMemoryMngr, std::size_t numPools)
+{
+    stagingBufferPools_.reserve(numPools);
+    for (std::size_t i = 0; i < numPools; ++i)
+        stagingBufferPools_.emplace_back(device_, deviceMemoryMngr, g_stagingChunkSize);
+}
+
 void VKCommandBuffer::ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments)
 {
     if (numAttachments > 0)
     {
+        BeginSubpassContents(VK_SUBPASS_CONTENTS_INLINE);
+
         /* Clear framebuffer attachments at the entire image region */
         VkClearRect clearRect;
         {
@@ -997,24 +1465,47 @@ void VKCommandBuffer::ClearFramebufferAttachments(std::uint32_t numAttachments,
 
 void VKCommandBuffer::PauseRenderPass()
 {
-    vkCmdEndRenderPass(commandBuffer_);
+    if (!renderPassPending_)
+    {
+        vkCmdEndRenderPass(commandBuffer_);
+
+        /* Continue with the secondary render pass (load and store content) once the next command inside the render pass is recorded */
+        pendingRenderPass_  = secondaryRenderPass_;
+        numClearValuesVK_   = 0;
+        renderPassPending_  = true;
+    }
 }
 
-void VKCommandBuffer::ResumeRenderPass()
+void VKCommandBuffer::BeginSubpassContents(VkSubpassContents contents)
 {
-    /* Record begin of render pass */
-    VkRenderPassBeginInfo beginInfo;
+    if (renderPassPending_)
     {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.renderPass        = secondaryRenderPass_;
-        beginInfo.framebuffer       = framebuffer_;
-        beginInfo.renderArea.offset = { 0, 0 };
-        beginInfo.renderArea.extent = framebufferExtent_;
-        beginInfo.clearValueCount   = 0;
-        beginInfo.pClearValues      = nullptr;
+        /* Record all pending barriers before the render pass begins */
+        pipelineBarrier_.Submit(commandBuffer_);
+
+        /* Record begin of render pass with the first command that is recorded inside the render pass */
+        VkRenderPassBeginInfo beginInfo;
+        {
+            beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+            beginInfo.pNext             = nullptr;
+            beginInfo.renderPass        = pendingRenderPass_;
+            beginInfo.framebuffer       = framebuffer_;
+            beginInfo.renderArea.offset = { 0, 0 };
+            beginInfo.renderArea.extent = framebufferExtent_;
+            beginInfo.clearValueCount   = numClearValuesVK_;
+            beginInfo.pClearValues      = clearValuesVK_;
+        }
+        vkCmdBeginRenderPass(commandBuffer_, &beginInfo, contents);
+
+        subpassContents_    = contents;
+        renderPassPending_  = false;
+    }
+    else if (subpassContents_ != contents)
+    {
+        /* Restart render pass to switch between inline commands and secondary command buffers */
+        PauseRenderPass();
+        BeginSubpassContents(contents);
     }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
 }
 
 bool VKCommandBuffer::IsInsideRenderPass() const
@@ -1022,86 +1513,197 @@ bool VKCommandBuffer::IsInsideRenderPass() const
     return (recordState_ == RecordState::InsideRenderPass);
 }
 
-//TODO: current unused; previously used for 'Clear' function
-#if 0
+void VKCommandBuffer::FlushPipelineBarriers()
+{
+    if (!pipelineBarrier_.IsEmpty())
+    {
+        if (IsInsideRenderPass())
+            PauseRenderPass();
+        pipelineBarrier_.Submit(commandBuffer_);
+    }
+}
 
-void VKCommandBuffer::BeginClearImage(
-    VkImageMemoryBarrier&           clearToPresentBarrier,
-    VkImage                         image,
-    const VkImageAspectFlags        clearFlags,
-    const VkClearColorValue*        clearColor,
-    const VkClearDepthStencilValue* clearDepthStencil)
+void VKCommandBuffer::UploadBuffer(VKBuffer& dstBufferVK, VkDeviceSize dstOffset, const void* data, VkDeviceSize dataSize)
 {
-    /* Initialize image subresource range */
-    VkImageSubresourceRange subresourceRange;
+    /* Write data into staging pool of the current native command buffer */
+    VkBufferCopy region;
+    VkBuffer srcBuffer = VK_NULL_HANDLE;
+    stagingBufferPools_[commandBufferIndex_].Write(data, dataSize, g_stagingDataAlignment, srcBuffer, region.srcOffset);
     {
-        subresourceRange.aspectMask     = clearFlags;
-        subresourceRange.baseMipLevel   = 0;
-        subresourceRange.levelCount     = 1;
-        subresourceRange.baseArrayLayer = 0;
-        subresourceRange.layerCount     = 1;
+        region.dstOffset    = dstOffset;
+        region.size         = dataSize;
     }
 
-    /* Initialize pre-barrier */
-    VkImageMemoryBarrier presentToClearBarrier;
+    /*
+    Record the copy into the prologue if the render pass has already begun and no command of this recording has referenced the buffer yet,
+    since the prologue is executed before this command buffer and the render pass doesn't need to be interrupted then
+    */
+    if (IsInsideRenderPass() && !renderPassPending_ && !prologueBufferList_.empty() && !stateTracker_.HasBuffer(dstBufferVK))
     {
-        presentToClearBarrier.sType                 = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        presentToClearBarrier.pNext                 = nullptr;
-        presentToClearBarrier.srcAccessMask         = VK_ACCESS_MEMORY_READ_BIT;
-        presentToClearBarrier.dstAccessMask         = VK_ACCESS_TRANSFER_WRITE_BIT;
-        presentToClearBarrier.oldLayout             = VK_IMAGE_LAYOUT_UNDEFINED;
-        presentToClearBarrier.newLayout             = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        presentToClearBarrier.srcQueueFamilyIndex   = queuePresentFamily_;
-        presentToClearBarrier.dstQueueFamilyIndex   = queuePresentFamily_;
-        presentToClearBarrier.image                 = image;
-        presentToClearBarrier.subresourceRange      = subresourceRange;
+        if (!prologueRecording_)
+            BeginPrologue();
+        vkCmdCopyBuffer(prologueBuffer_, srcBuffer, dstBufferVK.GetVkBuffer(), 1, &region);
+        return;
     }
 
-    /* Initialize post-barrier */
+    TransitionBufferState(dstBufferVK, g_transferDstBufferState);
+    InvalidateResourceHeapStates();
+
+    if (IsInsideRenderPass())
+        PauseRenderPass();
+
+    pipelineBarrier_.Submit(commandBuffer_);
+    vkCmdCopyBuffer(commandBuffer_, srcBuffer, dstBufferVK.GetVkBuffer(), 1, &region);
+}
+
+void VKCommandBuffer::BeginPrologue()
+{
+    VkCommandBufferBeginInfo beginInfo;
     {
-        clearToPresentBarrier.sType                 = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        clearToPresentBarrier.pNext                 = nullptr;
-        clearToPresentBarrier.srcAccessMask         = VK_ACCESS_TRANSFER_WRITE_BIT;
-        clearToPresentBarrier.dstAccessMask         = VK_ACCESS_MEMORY_READ_BIT;
-        clearToPresentBarrier.oldLayout             = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        clearToPresentBarrier.newLayout             = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-        clearToPresentBarrier.srcQueueFamilyIndex   = queuePresentFamily_;
-        clearToPresentBarrier.dstQueueFamilyIndex   = queuePresentFamily_;
-        clearToPresentBarrier.image                 = image;
-        clearToPresentBarrier.subresourceRange      = subresourceRange;
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = usageFlags_;
+        beginInfo.pInheritanceInfo  = nullptr;
     }
+    auto result = vkBeginCommandBuffer(prologueBuffer_, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin Vulkan prologue command buffer");
 
-    /* Record barrier and clear color commands */
+    /* Uploads of the prologue must wait for all previous accesses, since the tracked resource states don't include the prologue */
+    VkMemoryBarrier memoryBarrier;
+    {
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.pNext         = nullptr;
+        memoryBarrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    }
     vkCmdPipelineBarrier(
-        commandBuffer_,
-        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        prologueBuffer_,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
         VK_PIPELINE_STAGE_TRANSFER_BIT,
         0,
+        1, &memoryBarrier,
         0, nullptr,
-        0, nullptr,
-        1, &presentToClearBarrier
+        0, nullptr
     );
 
-    if ((clearFlags & VK_IMAGE_ASPECT_COLOR_BIT) != 0)
-        vkCmdClearColorImage(commandBuffer_, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, clearColor, 1, &subresourceRange);
-    if ((clearFlags & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) != 0)
-        vkCmdClearDepthStencilImage(commandBuffer_, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, clearDepthStencil, 1, &subresourceRange);
+    prologueRecording_ = true;
 }
 
-void VKCommandBuffer::EndClearImage(VkImageMemoryBarrier& clearToPresentBarrier)
+void VKCommandBuffer::EndPrologue()
 {
+    /* Make the uploads visible to all commands that follow the prologue */
+    VkMemoryBarrier memoryBarrier;
+    {
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.pNext         = nullptr;
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+    }
     vkCmdPipelineBarrier(
-        commandBuffer_,                         // VkCommandBuffer
-        VK_PIPELINE_STAGE_TRANSFER_BIT,         // source stage
-        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,   // destination stage
-        0,                                      // no dependencie flags
-        0, nullptr,                             // no memory barriers
-        0, nullptr,                             // no buffer memory barriers
-        1, &clearToPresentBarrier               // image memory barriers
+        prologueBuffer_,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0,
+        1, &memoryBarrier,
+        0, nullptr,
+        0, nullptr
     );
+
+    auto result = vkEndCommandBuffer(prologueBuffer_);
+    VKThrowIfFailed(result, "failed to end Vulkan prologue command buffer");
 }
 
-#endif
+void VKCommandBuffer::RecordTransitionPrologue()
+{
+    /* Beginning the command buffer implicitly resets it, since it is recorded again when the same recording is submitted again */
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    auto result = vkBeginCommandBuffer(transitionBuffer_, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin Vulkan transition command buffer");
+
+    submitBarrier_.Submit(transitionBuffer_);
+
+    result = vkEndCommandBuffer(transitionBuffer_);
+    VKThrowIfFailed(result, "failed to end Vulkan transition command buffer");
+}
+
+void VKCommandBuffer::PrepareDraw()
+{
+    if (graphicsResourcesDirty_ && graphicsResourceHeap_ != nullptr)
+    {
+        TransitionResourceHeapStates(*graphicsResourceHeap_);
+        graphicsResourcesDirty_ = false;
+    }
+
+    /* Re-bind resource heap if its dynamic buffers have published new versions */
+    if (graphicsDynamicOffsetsDirty_ && graphicsResourceHeap_ != nullptr && graphicsResourceHeap_->HasDynamicOffsets())
+        BindResourceHeap(*graphicsResourceHeap_, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsResourceHeapSet_);
+    graphicsDynamicOffsetsDirty_ = false;
+
+    FlushPipelineBarriers();
+
+    if (IsInsideRenderPass())
+        BeginSubpassContents(VK_SUBPASS_CONTENTS_INLINE);
+
+    /* Draw commands might write storage buffers that are read by the next dispatch */
+    computeResourcesDirty_ = true;
+}
+
+void VKCommandBuffer::PrepareDispatch()
+{
+    if (computeResourcesDirty_ && computeResourceHeap_ != nullptr)
+    {
+        TransitionResourceHeapStates(*computeResourceHeap_);
+        computeResourcesDirty_ = false;
+    }
+
+    if (computeDynamicOffsetsDirty_ && computeResourceHeap_ != nullptr && computeResourceHeap_->HasDynamicOffsets())
+        BindResourceHeap(*computeResourceHeap_, VK_PIPELINE_BIND_POINT_COMPUTE, computeResourceHeapSet_);
+    computeDynamicOffsetsDirty_ = false;
+
+    FlushPipelineBarriers();
+
+    /* Dispatch commands might write storage buffers that are read by the next draw or dispatch */
+    InvalidateResourceHeapStates();
+}
+
+void VKCommandBuffer::InvalidateResourceHeapStates()
+{
+    graphicsResourcesDirty_ = true;
+    computeResourcesDirty_  = true;
+}
+
+void VKCommandBuffer::TransitionBufferState(VKBuffer& bufferVK, const VKResourceState& state)
+{
+    /* Secondary command buffers might be executed inside a render pass, so the primary command buffer records their barriers (see Execute) */
+    stateTracker_.TransitionBuffer((IsSecondaryCmdBuffer() ? nullptr : &pipelineBarrier_), bufferVK, state);
+}
+
+void VKCommandBuffer::TransitionResourceHeapStates(VKResourceHeap& resourceHeapVK)
+{
+    resourceHeapVK.TransitionResourceStates(stateTracker_, (IsSecondaryCmdBuffer() ? nullptr : &pipelineBarrier_));
+}
+
+void VKCommandBuffer::TransitionRenderTargetAttachments(
+    const VKRenderTarget&   renderTargetVK,
+    const VKResourceState&  colorState,
+    const VKResourceState&  depthStencilState)
+{
+    for (const auto& attachment : renderTargetVK.GetTextureAttachments())
+    {
+        auto textureVK = LLGL_CAST(VKTexture*, attachment.texture);
+        const TextureSubresource subresource{ attachment.arrayLayer, 1, attachment.mipLevel, 1 };
+        if (attachment.type == AttachmentType::Color)
+            stateTracker_.TransitionTexture(&pipelineBarrier_, *textureVK, subresource, colorState);
+        else
+            stateTracker_.TransitionTexture(&pipelineBarrier_, *textureVK, subresource, depthStencilState);
+    }
+}
 
 void VKCommandBuffer::ResetQueryPoolsInFlight()
 {
@@ -13,7 +13,14 @@
 #include "Vulkan.h"
 #include "VKPtr.h"
 #include "VKCore.h"
-
+#include "VKPipelineBarrier.h"
+#include "VKResourceStateTracker.h"
+#include "VKCompletionTimeline.h"
+#include "Buffer/VKBuffer.h"
+#include "Buffer/VKStagingBufferPool.h"
+#include "../StaticLimits.h"
+
+#include <memory>
 #include <vector>
 
 
@@ -23,8 +30,22 @@ namespace LLGL
 
 class VKDevice;
 class VKPhysicalDevice;
+class VKDeviceMemoryManager;
 class VKResourceHeap;
+class VKRenderTarget;
+class VKRenderContext;
 
+/*
+Vulkan command buffer with one transient command pool per native command buffer.
+Deferred command buffers (see CommandBufferFlags::DeferredSubmit) are secondary command buffers that can be encoded by worker threads.
+They don't record any barriers for buffers and resource heaps, but the primary command buffer that executes them transitions these resources.
+
+Each recording tracks the states of the resources it accesses on its own (see VKResourceStateTracker).
+The transitions from the states previous submissions have left the resources in are recorded into a prologue when the recording is submitted,
+so recordings can be submitted in any order, submitted repeatedly (see CommandBufferFlags::MultiSubmit), or discarded without being submitted.
+Command buffers that access the same resources must not be submitted concurrently, and render system functions that write resources directly
+(e.g. WriteTexture) must not be used for resources that are accessed by submitted command buffers which have not completed yet.
+*/
 class VKCommandBuffer final : public CommandBuffer
 {
 
@@ -35,9 +56,11 @@ class VKCommandBuffer final : public CommandBuffer
         VKCommandBuffer(
             const VKPhysicalDevice&         physicalDevice,
             VKDevice&                       device,
-            VkQueue                         graphicsQueue,
+            VKDeviceMemoryManager&          deviceMemoryMngr,
+            VkQueue                         queue,
             const QueueFamilyIndices&       queueFamilyIndices,
-            const CommandBufferDescriptor&  desc
+            const CommandBufferDescriptor&  desc,
+            std::uint32_t                   numFramesInFlight
         );
         ~VKCommandBuffer();
 
@@ -181,6 +204,12 @@ class VKCommandBuffer final : public CommandBuffer
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
 
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void MultiDraw(std::uint32_t numDraws, const DrawIndirectArguments* draws) override;
+        void MultiDrawIndexed(std::uint32_t numDraws, const DrawIndexedIndirectArguments* draws) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ) override;
@@ -214,6 +243,50 @@ class VKCommandBuffer final : public CommandBuffer
             return recordingFence_;
         }
 
+        // Returns the ticket of the current recording, which is complete once the GPU has completed this recording.
+        inline const VKCompletionTicket& GetCompletionTicket() const
+        {
+            return completionTicket_;
+        }
+
+        // Returns the render context whose swap-chain this command buffer has rendered into since encoding began, or null if there is none.
+        inline VKRenderContext* GetRenderContext() const
+        {
+            return renderContext_;
+        }
+
+        // Returns the resource states the current recording has tracked.
+        inline const VKResourceStateTracker& GetStateTracker() const
+        {
+            return stateTracker_;
+        }
+
+        // Notifies this deferred command buffer that it was executed by the specified recording of a primary command buffer.
+        void NotifyExecution(const VKCompletionTicket& primaryTicket);
+
+        // Notifies this command buffer that it was submitted in a batch, which is signaled with the fence of the specified recording of another command buffer.
+        void NotifyBatchSubmission(const VKCompletionTicket& batchTicket);
+
+        /*
+        Prepares the current recording for its submission, which must be called right before the command buffer is submitted to the queue.
+        If the recording has already been submitted (see CommandBufferFlags::MultiSubmit), this waits until the previous submission has completed
+        and renews the completion ticket. Buffer versions reserved by this recording are refreshed with the current content of their buffers.
+        Records the transitions of all resources this recording accesses into a prologue and stores the states the recording leaves them in.
+        Writes the native command buffers that must be submitted in this order into 'cmdBuffers' and returns their number (see maxNumSubmitBuffers).
+        */
+        std::uint32_t PrepareSubmission(VkCommandBuffer* cmdBuffers);
+
+        // Returns true if this is a secondary command buffer, i.e. it has been created with the CommandBufferFlags::DeferredSubmit flag.
+        inline bool IsSecondaryCmdBuffer() const
+        {
+            return (bufferLevel_ == VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+        }
+
+    public:
+
+        // Maximum number of native command buffers that are submitted for a single recording, i.e. the transition and upload prologues and the command buffer itself.
+        static const std::uint32_t maxNumSubmitBuffers = 3;
+
     private:
 
         enum class RecordState
@@ -224,31 +297,58 @@ class VKCommandBuffer final : public CommandBuffer
             ReadyForSubmit,     // after "End"
         };
 
-        void CreateCommandPool(std::uint32_t queueFamilyIndex);
+        void CreateCommandPools(std::uint32_t queueFamilyIndex, std::size_t numPools);
         void CreateCommandBuffers(std::size_t bufferCount);
-        void CreateRecordingFences(VkQueue graphicsQueue, std::size_t numFences);
+        void CreateRecordingFences(VkQueue queue, std::size_t numFences);
+        void CreateStagingBufferPools(VKDeviceMemoryManager& deviceMemoryMngr, std::size_t numPools);
 
         void ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments);
 
+        // Ends the active render pass, which is resumed with the secondary render pass by the next command inside the render pass.
         void PauseRenderPass();
-        void ResumeRenderPass();
+
+        // Begins the pending render pass with the specified subpass contents, or restarts the active render pass if its subpass contents differ.
+        void BeginSubpassContents(VkSubpassContents contents);
 
         bool IsInsideRenderPass() const;
 
-        //TODO: current unused; previously used for 'Clear' function
-        #if 0
-        void BeginClearImage(
-            VkImageMemoryBarrier&           clearToPresentBarrier,
-            VkImage                         image,
-            const VkImageAspectFlags        clearFlags,
-            const VkClearColorValue*        clearColor,
-            const VkClearDepthStencilValue* clearDepthStencil
+        // Records all pending pipeline barriers. An active render pass is paused for this.
+        void FlushPipelineBarriers();
+
+        // Transitions the resources of the bound resource heap if their states have been invalidated, then flushes all pending barriers.
+        void PrepareDraw();
+        void PrepareDispatch();
+
+        // Invalidates the states of the resources in the bound resource heaps, after other commands have accessed any resources.
+        void InvalidateResourceHeapStates();
+
+        // Transitions the buffer into the new state, or only tracks this transition for the primary command buffer if this is a secondary command buffer.
+        void TransitionBufferState(VKBuffer& bufferVK, const VKResourceState& state);
+        void TransitionResourceHeapStates(VKResourceHeap& resourceHeapVK);
+
+        // Transitions all texture attachments of the render target into the specified states.
+        void TransitionRenderTargetAttachments(
+            const VKRenderTarget&   renderTargetVK,
+            const VKResourceState&  colorState,
+            const VKResourceState&  depthStencilState
         );
-        void EndClearImage(VkImageMemoryBarrier& clearToPresentBarrier);
-        #endif
 
+        // Binds the descriptor sets of the resource heap with the dynamic offsets of the current buffer versions.
         void BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelineBindPoint bindingPoint, std::uint32_t firstSet);
 
+        // Keeps the buffer version this recording accesses alive and returns its dynamic offset, or 0 if the buffer is not dynamic.
+        std::uint32_t RetainBufferVersion(VKBuffer& bufferVK);
+
+        // Writes the data into the staging pool of the current native command buffer and records a copy command into the destination buffer.
+        void UploadBuffer(VKBuffer& dstBufferVK, VkDeviceSize dstOffset, const void* data, VkDeviceSize dataSize);
+
+        // Begins and ends the prologue of the current recording, which holds uploads that are executed before this command buffer.
+        void BeginPrologue();
+        void EndPrologue();
+
+        // Records the barriers of the submission into the transition prologue, which is executed before the upload prologue.
+        void RecordTransitionPrologue();
+
         #if 1//TODO: optimize
         void ResetQueryPoolsInFlight();
         void AppendQueryPoolInFlight(VkQueryPool queryPool);
@@ -257,7 +357,7 @@ class VKCommandBuffer final : public CommandBuffer
     private:
 
         VKDevice&                       device_;
-        VKPtr<VkCommandPool>            commandPool_;
+        std::vector<VKPtr<VkCommandPool>> commandPoolList_;                     // transient command pool per native command buffer
 
         std::vector<VkCommandBuffer>    commandBufferList_;
         VkCommandBuffer                 commandBuffer_;
@@ -266,18 +366,46 @@ class VKCommandBuffer final : public CommandBuffer
         std::vector<VKPtr<VkFence>>     recordingFenceList_;
         VkFence                         recordingFence_;
 
+        std::vector<VkCommandBuffer>    prologueBufferList_;                    // primary command buffers only
+        VkCommandBuffer                 prologueBuffer_             = VK_NULL_HANDLE;
+        bool                            prologueRecording_          = false;
+
+        std::vector<VkCommandBuffer>    transitionBufferList_;                  // primary command buffers only; recorded on each submission
+        VkCommandBuffer                 transitionBuffer_           = VK_NULL_HANDLE;
+        VKPipelineBarrier               submitBarrier_;                         // barriers from the states of previous submissions
+
+        std::vector<VKStagingBufferPool> stagingBufferPools_;                   // transient upload data per native command buffer
+
+        std::vector<std::shared_ptr<VKCompletionTimeline>> completionTimelines_; // completion timeline per native command buffer
+        VKCompletionTicket              completionTicket_;                      // ticket of the current recording
+        bool                            submitted_                  = false;    // current recording has already been submitted
+
+        std::vector<std::shared_ptr<VKCompletionTimeline>> recordingTimelines_; // timeline without fence per native command buffer (multi-submit only)
+        VKCompletionTicket              recordingTicket_;                       // ticket that is complete once the current recording is discarded (multi-submit only)
+        std::vector<VKBuffer*>          reservedBuffers_;                       // dynamic buffers whose versions are reserved by the current recording
+        std::vector<VKCommandBuffer*>   executedCmdBuffers_;                    // deferred command buffers executed by the current recording (multi-submit only)
+
         RecordState                     recordState_                = RecordState::Undefined;
 
         VkCommandBufferUsageFlags       usageFlags_                 = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
         VkCommandBufferLevel            bufferLevel_                = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        bool                            multiSubmit_                = false;    // recordings can be submitted multiple times
 
         VkClearColorValue               clearColor_                 = { 0.0f, 0.0f, 0.0f, 0.0f };
         VkClearDepthStencilValue        clearDepthStencil_          = { 1.0f, 0 };
 
         VkRenderPass                    renderPass_                 = VK_NULL_HANDLE; // primary render pass
         VkRenderPass                    secondaryRenderPass_        = VK_NULL_HANDLE; // to pause/resume render pass (load and store content)
+        VkRenderPass                    inheritanceRenderPass_      = VK_NULL_HANDLE; // render pass a secondary command buffer is executed in
+        VkRenderPass                    pendingRenderPass_          = VK_NULL_HANDLE; // render pass that is begun with the next command inside the render pass
+        bool                            renderPassPending_          = false;
+        VkSubpassContents               subpassContents_            = VK_SUBPASS_CONTENTS_INLINE;
+        VkClearValue                    clearValuesVK_[LLGL_MAX_NUM_ATTACHMENTS];
+        std::uint32_t                   numClearValuesVK_           = 0;
         VkFramebuffer                   framebuffer_                = VK_NULL_HANDLE; // active framebuffer handle
         VkExtent2D                      framebufferExtent_          = { 0, 0 };
+        const VKRenderTarget*           renderTarget_               = nullptr; // active render target; null for render contexts
+        VKRenderContext*                renderContext_              = nullptr; // render context rendered into since "Begin"
         std::uint32_t                   numColorAttachments_        = 0;
         bool                            hasDSVAttachment_           = false;
 
@@ -288,6 +416,18 @@ class VKCommandBuffer final : public CommandBuffer
 
         std::uint32_t                   maxDrawIndirectCount_       = 0;
 
+        VKPipelineBarrier               pipelineBarrier_;                       // pending barriers for the next command
+        VKResourceStateTracker          stateTracker_;                          // resource states of the current recording
+        VKResourceHeap*                 graphicsResourceHeap_       = nullptr;
+        VKResourceHeap*                 computeResourceHeap_        = nullptr;
+        std::uint32_t                   graphicsResourceHeapSet_    = 0;
+        std::uint32_t                   computeResourceHeapSet_     = 0;
+        bool                            graphicsResourcesDirty_     = false;
+        bool                            computeResourcesDirty_      = false;
+        bool                            graphicsDynamicOffsetsDirty_ = false;   // dynamic buffers have published new versions
+        bool                            computeDynamicOffsetsDirty_ = false;
+        std::vector<std::uint32_t>      dynamicOffsets_;
+
         #if 1//TODO: optimize usage of query pools
         std::vector<VkQueryPool>        queryPoolsInFlight_;
         std::size_t                     numQueryPoolsInFlight_      = 0;
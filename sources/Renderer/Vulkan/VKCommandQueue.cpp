@@ -7,6 +7,7 @@
 
 #include "VKCommandQueue.h"
 #include "VKCommandBuffer.h"
+#include "VKRenderContext.h"
 #include "RenderState/VKFence.h"
 #include "RenderState/VKQueryHeap.h"
 #include "../CheckedCast.h"
@@ -29,23 +30,161 @@ void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
 
-    VkCommandBuffer commandBuffers[] = { commandBufferVK.GetVkCommandBuffer() };
+    /* Gather the prologues with the resource transitions and uploads, which are executed right before the command buffer */
+    VkCommandBuffer commandBuffers[VKCommandBuffer::maxNumSubmitBuffers];
+    const auto numCommandBuffers = commandBufferVK.PrepareSubmission(commandBuffers);
 
-    /* Submit command buffer to graphics queue */
+    /* Semaphores of other queues this queue waits on (see WaitQueue) are followed by the presentation semaphores */
+    const auto numQueueSemaphores = waitSemaphores_.size();
+
+    /* Chain the presentation semaphores into this submission if the command buffer renders into a swap-chain */
+    VkSemaphore             waitSemaphore   = VK_NULL_HANDLE;
+    VkPipelineStageFlags    waitStage       = 0;
+    VkSemaphore             signalSemaphore = VK_NULL_HANDLE;
+
+    if (auto renderContextVK = commandBufferVK.GetRenderContext())
+        renderContextVK->GetSubmitSemaphores(waitSemaphore, waitStage, signalSemaphore);
+
+    if (waitSemaphore != VK_NULL_HANDLE)
+    {
+        waitSemaphores_.push_back(waitSemaphore);
+        waitStages_.push_back(waitStage);
+    }
+
+    /* Submit command buffer to queue */
     VkSubmitInfo submitInfo;
     {
         submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 0;
-        submitInfo.pWaitSemaphores      = nullptr;
-        submitInfo.pWaitDstStageMask    = 0;
-        submitInfo.commandBufferCount   = 1;
+        submitInfo.waitSemaphoreCount   = static_cast<std::uint32_t>(waitSemaphores_.size());
+        submitInfo.pWaitSemaphores      = waitSemaphores_.data();
+        submitInfo.pWaitDstStageMask    = waitStages_.data();
+        submitInfo.commandBufferCount   = numCommandBuffers;
         submitInfo.pCommandBuffers      = commandBuffers;
-        submitInfo.signalSemaphoreCount = 0;
-        submitInfo.pSignalSemaphores    = nullptr;
+        submitInfo.signalSemaphoreCount = (signalSemaphore != VK_NULL_HANDLE ? 1 : 0);
+        submitInfo.pSignalSemaphores    = &signalSemaphore;
     }
     auto result = vkQueueSubmit(native_, 1, &submitInfo, commandBufferVK.GetQueueSubmitFence());
-    VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+    VKThrowIfFailed(result, "failed to submit command buffer to Vulkan queue");
+
+    /* The frame of the swap-chain is complete once this command buffer has completed */
+    if (auto renderContextVK = commandBufferVK.GetRenderContext())
+        renderContextVK->NotifySubmission(commandBufferVK.GetCompletionTicket());
+
+    /* Semaphores of other queues can be reused once this command buffer has completed */
+    for (std::size_t i = 0; i < numQueueSemaphores; ++i)
+        inFlightSemaphores_.push_back({ waitSemaphores_[i], commandBufferVK.GetCompletionTicket() });
+
+    waitSemaphores_.clear();
+    waitStages_.clear();
+}
+
+void VKCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    if (numCommandBuffers == 0)
+        return;
+
+    batchSubmitInfos_.resize(numCommandBuffers);
+    batchCmdBuffers_.resize(numCommandBuffers * VKCommandBuffer::maxNumSubmitBuffers);
+    batchWaitSemaphores_.resize(numCommandBuffers);
+    batchWaitStages_.resize(numCommandBuffers);
+    batchSignalSemaphores_.resize(numCommandBuffers);
+
+    /*
+    Gather native command buffers with their prologues and chain the presentation semaphores of each command buffer that renders into a swap-chain.
+    Resource transitions are resolved in the order of the command buffers in this batch
+    */
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, *commandBuffers[i]);
+
+        auto& submitInfo = batchSubmitInfos_[i];
+        submitInfo.pCommandBuffers      = &batchCmdBuffers_[i * VKCommandBuffer::maxNumSubmitBuffers];
+        submitInfo.commandBufferCount   = commandBufferVK.PrepareSubmission(&batchCmdBuffers_[i * VKCommandBuffer::maxNumSubmitBuffers]);
+
+        batchWaitSemaphores_[i]     = VK_NULL_HANDLE;
+        batchWaitStages_[i]         = 0;
+        batchSignalSemaphores_[i]   = VK_NULL_HANDLE;
+
+        if (auto renderContextVK = commandBufferVK.GetRenderContext())
+            renderContextVK->GetSubmitSemaphores(batchWaitSemaphores_[i], batchWaitStages_[i], batchSignalSemaphores_[i]);
+    }
+
+    /* Semaphores of other queues this queue waits on (see WaitQueue) are waited on by the first command buffer */
+    const auto numQueueSemaphores = waitSemaphores_.size();
+
+    if (batchWaitSemaphores_[0] != VK_NULL_HANDLE)
+    {
+        waitSemaphores_.push_back(batchWaitSemaphores_[0]);
+        waitStages_.push_back(batchWaitStages_[0]);
+    }
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto& submitInfo = batchSubmitInfos_[i];
+        {
+            submitInfo.sType                    = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                    = nullptr;
+            if (i == 0)
+            {
+                submitInfo.waitSemaphoreCount   = static_cast<std::uint32_t>(waitSemaphores_.size());
+                submitInfo.pWaitSemaphores      = waitSemaphores_.data();
+                submitInfo.pWaitDstStageMask    = waitStages_.data();
+            }
+            else
+            {
+                submitInfo.waitSemaphoreCount   = (batchWaitSemaphores_[i] != VK_NULL_HANDLE ? 1 : 0);
+                submitInfo.pWaitSemaphores      = &batchWaitSemaphores_[i];
+                submitInfo.pWaitDstStageMask    = &batchWaitStages_[i];
+            }
+            submitInfo.signalSemaphoreCount     = (batchSignalSemaphores_[i] != VK_NULL_HANDLE ? 1 : 0);
+            submitInfo.pSignalSemaphores        = &batchSignalSemaphores_[i];
+        }
+    }
+
+    /* Submit all command buffers at once, which is signaled with the fence of the last command buffer */
+    auto& lastCommandBufferVK = LLGL_CAST(VKCommandBuffer&, *commandBuffers[numCommandBuffers - 1]);
+
+    auto result = vkQueueSubmit(native_, numCommandBuffers, batchSubmitInfos_.data(), lastCommandBufferVK.GetQueueSubmitFence());
+    VKThrowIfFailed(result, "failed to submit batch of command buffers to Vulkan queue");
+
+    /*
+    All other command buffers of this batch must wait for the fence of the last command buffer before they can be encoded again,
+    and so do the frames of the swap-chains they rendered into
+    */
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, *commandBuffers[i]);
+
+        if (i + 1 < numCommandBuffers)
+            commandBufferVK.NotifyBatchSubmission(lastCommandBufferVK.GetCompletionTicket());
+
+        if (auto renderContextVK = commandBufferVK.GetRenderContext())
+            renderContextVK->NotifySubmission(lastCommandBufferVK.GetCompletionTicket());
+    }
+
+    /* Semaphores of other queues can be reused once the batch has completed */
+    for (std::size_t i = 0; i < numQueueSemaphores; ++i)
+        inFlightSemaphores_.push_back({ waitSemaphores_[i], lastCommandBufferVK.GetCompletionTicket() });
+
+    waitSemaphores_.clear();
+    waitStages_.clear();
+}
+
+void VKCommandQueue::WaitQueue(CommandQueue& signalQueue)
+{
+    auto& signalQueueVK = LLGL_CAST(VKCommandQueue&, signalQueue);
+
+    /* Command buffers of the same native queue are executed in submission order */
+    if (signalQueueVK.native_ == native_)
+        return;
+
+    /* Signal semaphore after the work of the other queue and wait on it with the next command buffer of this queue */
+    auto semaphore = AcquireSemaphore();
+    signalQueueVK.SignalSemaphore(semaphore);
+
+    waitSemaphores_.push_back(semaphore);
+    waitStages_.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
 }
 
 /* ----- Queries ----- */
@@ -132,6 +271,67 @@ void VKCommandQueue::WaitIdle()
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+VkSemaphore VKCommandQueue::AcquireSemaphore()
+{
+    /* Recycle semaphores whose waiting command buffers have completed */
+    for (auto it = inFlightSemaphores_.begin(); it != inFlightSemaphores_.end();)
+    {
+        if (it->ticket.IsComplete())
+        {
+            freeSemaphores_.push_back(it->semaphore);
+            it = inFlightSemaphores_.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    if (!freeSemaphores_.empty())
+    {
+        auto semaphore = freeSemaphores_.back();
+        freeSemaphores_.pop_back();
+        return semaphore;
+    }
+
+    /* Create new semaphore */
+    VkSemaphoreCreateInfo createInfo;
+    {
+        createInfo.sType    = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext    = nullptr;
+        createInfo.flags    = 0;
+    }
+    VKPtr<VkSemaphore> semaphore { device_, vkDestroySemaphore };
+    {
+        auto result = vkCreateSemaphore(device_, &createInfo, nullptr, semaphore.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan semaphore for queue dependency");
+    }
+    semaphores_.emplace_back(std::move(semaphore));
+
+    return semaphores_.back();
+}
+
+void VKCommandQueue::SignalSemaphore(VkSemaphore semaphore)
+{
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = nullptr;
+        submitInfo.pWaitDstStageMask    = nullptr;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = &semaphore;
+    }
+    auto result = vkQueueSubmit(native_, 1, &submitInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to submit semaphore signal to Vulkan queue");
+}
+
+
 } // /namespace LLGL
 
 
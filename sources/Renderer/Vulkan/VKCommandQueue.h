@@ -14,6 +14,8 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "RenderState/VKFence.h"
+#include "Buffer/VKBuffer.h"
+#include <vector>
 
 
 namespace LLGL
@@ -32,6 +34,9 @@ class VKCommandQueue final : public CommandQueue
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        void WaitQueue(CommandQueue& signalQueue) override;
 
         /* ----- Queries ----- */
 
@@ -46,8 +51,36 @@ class VKCommandQueue final : public CommandQueue
 
     private:
 
-        VkDevice    device_;
-        VkQueue     native_ = VK_NULL_HANDLE;
+        // Returns a semaphore that is not in use, either a recycled one or a new one.
+        VkSemaphore AcquireSemaphore();
+
+        // Submits an empty batch that signals the specified semaphore once all previously submitted work of this queue has completed.
+        void SignalSemaphore(VkSemaphore semaphore);
+
+    private:
+
+        // Semaphore that can be reused once the command buffer recording that waited on it has completed.
+        struct InFlightSemaphore
+        {
+            VkSemaphore         semaphore;
+            VKCompletionTicket  ticket;
+        };
+
+        const VKPtr<VkDevice>&              device_;
+        VkQueue                             native_             = VK_NULL_HANDLE;
+
+        std::vector<VKPtr<VkSemaphore>>     semaphores_;        // all semaphores for dependencies between queues
+        std::vector<VkSemaphore>            freeSemaphores_;
+        std::vector<InFlightSemaphore>      inFlightSemaphores_;
+        std::vector<VkSemaphore>            waitSemaphores_;    // semaphores the next command buffer submission waits on
+        std::vector<VkPipelineStageFlags>   waitStages_;
+
+        // Intermediate arrays for batched submissions, one entry per command buffer.
+        std::vector<VkSubmitInfo>           batchSubmitInfos_;
+        std::vector<VkCommandBuffer>        batchCmdBuffers_;   // prologue and command buffer for each command buffer
+        std::vector<VkSemaphore>            batchWaitSemaphores_;
+        std::vector<VkPipelineStageFlags>   batchWaitStages_;
+        std::vector<VkSemaphore>            batchSignalSemaphores_;
 
 };
 
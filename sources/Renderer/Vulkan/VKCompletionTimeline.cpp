@@ -0,0 +1,154 @@
+/*
+ * VKCompletionTimeline.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKCompletionTimeline.h"
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+// Timeout for waiting on a fence that might be reset by its owner in the meantime.
+static const std::uint64_t g_fenceWaitTimeout = 1000000ull; // 1 ms
+
+bool VKCompletionTicket::IsComplete() const
+{
+    return (!timeline || timeline->IsComplete(value));
+}
+
+void VKCompletionTicket::Wait() const
+{
+    if (timeline)
+        timeline->Wait(value);
+}
+
+VKCompletionTimeline::VKCompletionTimeline(VkDevice device, VkFence fence) :
+    device_    { device },
+    fence_     { fence  },
+    completed_ { 0      }
+{
+}
+
+std::uint64_t VKCompletionTimeline::BeginRecording()
+{
+    /* Only the owner of the timeline begins new recordings, so the current value can be read without lock */
+    const auto previous = current_;
+    Wait(previous);
+    StoreCompleted(previous);
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+    {
+        if (fence_ != VK_NULL_HANDLE)
+            vkResetFences(device_, 1, &fence_);
+        dependency_ = VKCompletionTicket{};
+        current_    = previous + 1;
+    }
+    return current_;
+}
+
+void VKCompletionTimeline::SetDependency(const VKCompletionTicket& dependency)
+{
+    if (dependency.timeline.get() != this)
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        dependency_ = dependency;
+    }
+}
+
+bool VKCompletionTimeline::IsComplete(std::uint64_t value)
+{
+    if (value <= completed_.load())
+        return true;
+
+    VKCompletionTicket dependency;
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+
+        /* Previous recordings are complete once a new recording has begun */
+        if (value != current_)
+            return (value < current_);
+
+        if (!dependency_)
+        {
+            /* Poll the fence, which is only signaled by the submission of the current recording */
+            if (fence_ == VK_NULL_HANDLE || vkGetFenceStatus(device_, fence_) != VK_SUCCESS)
+                return false;
+            StoreCompleted(value);
+            return true;
+        }
+
+        dependency = dependency_;
+    }
+
+    /* Query dependency without lock, since it might refer to a timeline that waits on this one */
+    if (!dependency.IsComplete())
+        return false;
+
+    StoreCompleted(value);
+    return true;
+}
+
+void VKCompletionTimeline::Wait(std::uint64_t value)
+{
+    while (!IsComplete(value))
+    {
+        VKCompletionTicket dependency;
+        {
+            std::lock_guard<std::mutex> guard { mutex_ };
+
+            if (value != current_)
+                continue;
+
+            if (!dependency_)
+            {
+                /* Recordings without fence and dependency have never been submitted */
+                if (fence_ == VK_NULL_HANDLE)
+                    return;
+
+                /* Wait with timeout, since the fence must not be reset while it is waited on */
+                vkWaitForFences(device_, 1, &fence_, VK_TRUE, g_fenceWaitTimeout);
+                continue;
+            }
+
+            dependency = dependency_;
+        }
+        dependency.Wait();
+    }
+}
+
+void VKCompletionTimeline::Retire()
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    {
+        completed_.store(std::numeric_limits<std::uint64_t>::max());
+        fence_      = VK_NULL_HANDLE;
+        dependency_ = VKCompletionTicket{};
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKCompletionTimeline::StoreCompleted(std::uint64_t value)
+{
+    /* Completion only moves forward, but might be observed by multiple threads at once */
+    auto completed = completed_.load();
+    while (completed < value && !completed_.compare_exchange_weak(completed, value))
+    {
+        // retry with updated value
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
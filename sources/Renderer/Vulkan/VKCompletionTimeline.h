@@ -0,0 +1,108 @@
+/*
+ * VKCompletionTimeline.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_COMPLETION_TIMELINE_H
+#define LLGL_VK_COMPLETION_TIMELINE_H
+
+
+#include "Vulkan.h"
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKCompletionTimeline;
+
+// Identifies a recording of a native command buffer, whose completion can be queried from any thread.
+struct VKCompletionTicket
+{
+    std::shared_ptr<VKCompletionTimeline>   timeline;
+    std::uint64_t                           value       = 0;
+
+    // Returns true if the GPU has completed the recording. Empty tickets are always complete.
+    bool IsComplete() const;
+
+    // Blocks until the GPU has completed the recording.
+    void Wait() const;
+
+    inline explicit operator bool() const
+    {
+        return (timeline != nullptr);
+    }
+};
+
+inline bool operator == (const VKCompletionTicket& lhs, const VKCompletionTicket& rhs)
+{
+    return (lhs.timeline == rhs.timeline && lhs.value == rhs.value);
+}
+
+inline bool operator != (const VKCompletionTicket& lhs, const VKCompletionTicket& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/*
+Completion timeline of a native command buffer, whose fence is reused for all of its recordings.
+Each recording is identified by an increasing ticket value and is complete as soon as its fence is observed as signaled,
+or as soon as the submission it was executed in has completed (i.e. secondary command buffers and batch submissions).
+*/
+class VKCompletionTimeline
+{
+
+    public:
+
+        // Constructs the timeline with the fence its recordings are submitted with. The fence must be initially signaled, or null for secondary command buffers.
+        VKCompletionTimeline(VkDevice device, VkFence fence);
+
+        VKCompletionTimeline(const VKCompletionTimeline&) = delete;
+        VKCompletionTimeline& operator = (const VKCompletionTimeline&) = delete;
+
+        // Waits until the previous recording has completed, resets the fence, and returns the ticket value of the new recording.
+        std::uint64_t BeginRecording();
+
+        // Specifies that the current recording is completed by the submission of another recording instead of its own fence.
+        void SetDependency(const VKCompletionTicket& dependency);
+
+        // Returns true if the specified recording has completed.
+        bool IsComplete(std::uint64_t value);
+
+        // Blocks until the specified recording has completed. Returns immediately if the recording has no fence and was not executed by another submission.
+        void Wait(std::uint64_t value);
+
+        // Marks all recordings as complete and releases the fence. Must be called before the fence is destroyed.
+        void Retire();
+
+    private:
+
+        void StoreCompleted(std::uint64_t value);
+
+    private:
+
+        VkDevice                    device_     = VK_NULL_HANDLE;
+        VkFence                     fence_      = VK_NULL_HANDLE;
+
+        std::mutex                  mutex_;                     // fence must not be accessed while it is reset
+        std::uint64_t               current_    = 0;            // ticket value of the current recording
+        std::atomic<std::uint64_t>  completed_;                 // ticket value of the last recording known to be complete
+        VKCompletionTicket          dependency_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
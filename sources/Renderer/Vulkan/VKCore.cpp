@@ -235,6 +235,26 @@ QueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFla
         ++i;
     }
 
+    /* Find dedicated queue families for asynchronous compute and transfer commands */
+    i = 0;
+    for (const auto& family : queueFamilies)
+    {
+        if (family.queueCount > 0 && (family.queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0)
+        {
+            if ((family.queueFlags & VK_QUEUE_COMPUTE_BIT) != 0)
+            {
+                if (indices.computeFamily == QueueFamilyIndices::invalidIndex)
+                    indices.computeFamily = i;
+            }
+            else if ((family.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0)
+            {
+                if (indices.transferFamily == QueueFamilyIndices::invalidIndex)
+                    indices.transferFamily = i;
+            }
+        }
+        ++i;
+    }
+
     return indices;
 }
 
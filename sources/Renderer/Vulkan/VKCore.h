@@ -28,18 +28,21 @@ struct QueueFamilyIndices
 
     QueueFamilyIndices() :
         graphicsFamily { invalidIndex },
-        presentFamily  { invalidIndex }
+        presentFamily  { invalidIndex },
+        computeFamily  { invalidIndex },
+        transferFamily { invalidIndex }
     {
     }
 
     union
     {
-        std::uint32_t indices[2];
+        std::uint32_t indices[4];
         struct
         {
             std::uint32_t graphicsFamily;
             std::uint32_t presentFamily;
-            //std::uint32_t transferFamily;
+            std::uint32_t computeFamily;    // Dedicated compute family without graphics support, or invalidIndex if there is none
+            std::uint32_t transferFamily;   // Dedicated transfer family without graphics and compute support, or invalidIndex if there is none
         };
     };
 
@@ -26,19 +26,25 @@ VKDevice::VKDevice() :
 }
 
 VKDevice::VKDevice(VKDevice&& device) :
-    device_             { std::move(device.device_)      },
-    queueFamilyIndices_ { device.queueFamilyIndices_     },
-    graphicsQueue_      { device.graphicsQueue_          },
-    commandPool_        { std::move(device.commandPool_) }
+    device_                  { std::move(device.device_)                  },
+    queueFamilyIndices_      { device.queueFamilyIndices_                 },
+    graphicsQueue_           { device.graphicsQueue_                      },
+    computeQueue_            { device.computeQueue_                       },
+    transferQueue_           { device.transferQueue_                      },
+    concurrentQueueFamilies_ { std::move(device.concurrentQueueFamilies_) },
+    commandPool_             { std::move(device.commandPool_)             }
 {
 }
 
 VKDevice& VKDevice::operator = (VKDevice&& device)
 {
-    device_             = std::move(device.device_);
-    queueFamilyIndices_ = device.queueFamilyIndices_;
-    graphicsQueue_      = device.graphicsQueue_;
-    commandPool_        = std::move(device.commandPool_);
+    device_                     = std::move(device.device_);
+    queueFamilyIndices_         = device.queueFamilyIndices_;
+    graphicsQueue_              = device.graphicsQueue_;
+    computeQueue_               = device.computeQueue_;
+    transferQueue_              = device.transferQueue_;
+    concurrentQueueFamilies_    = std::move(device.concurrentQueueFamilies_);
+    commandPool_                = std::move(device.commandPool_);
     return *this;
 }
 
@@ -61,6 +67,11 @@ void VKDevice::CreateLogicalDevice(
     std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
     std::set<std::uint32_t> uniqueQueueFamilies = { queueFamilyIndices_.graphicsFamily, queueFamilyIndices_.presentFamily };
 
+    if (queueFamilyIndices_.computeFamily != QueueFamilyIndices::invalidIndex)
+        uniqueQueueFamilies.insert(queueFamilyIndices_.computeFamily);
+    if (queueFamilyIndices_.transferFamily != QueueFamilyIndices::invalidIndex)
+        uniqueQueueFamilies.insert(queueFamilyIndices_.transferFamily);
+
     float queuePriority = 1.0f;
     for (auto family : uniqueQueueFamilies)
     {
@@ -96,10 +107,64 @@ void VKDevice::CreateLogicalDevice(
     /* Query device graphics queue */
     vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
 
+    /* Query dedicated compute and transfer queues; resources are shared concurrently between all used queue families */
+    concurrentQueueFamilies_ = { queueFamilyIndices_.graphicsFamily };
+
+    if (queueFamilyIndices_.computeFamily != QueueFamilyIndices::invalidIndex)
+    {
+        vkGetDeviceQueue(device_, queueFamilyIndices_.computeFamily, 0, &computeQueue_);
+        concurrentQueueFamilies_.push_back(queueFamilyIndices_.computeFamily);
+    }
+
+    if (queueFamilyIndices_.transferFamily != QueueFamilyIndices::invalidIndex)
+    {
+        vkGetDeviceQueue(device_, queueFamilyIndices_.transferFamily, 0, &transferQueue_);
+        concurrentQueueFamilies_.push_back(queueFamilyIndices_.transferFamily);
+    }
+
+    if (concurrentQueueFamilies_.size() < 2)
+        concurrentQueueFamilies_.clear();
+
     /* Create default command pool */
     commandPool_ = CreateCommandPool();
 }
 
+VkQueue VKDevice::GetVkQueue(const CommandQueueType type) const
+{
+    switch (type)
+    {
+        case CommandQueueType::Compute:
+            if (computeQueue_ != VK_NULL_HANDLE)
+                return computeQueue_;
+            break;
+        case CommandQueueType::Transfer:
+            if (transferQueue_ != VK_NULL_HANDLE)
+                return transferQueue_;
+            break;
+        default:
+            break;
+    }
+    return graphicsQueue_;
+}
+
+std::uint32_t VKDevice::GetQueueFamily(const CommandQueueType type) const
+{
+    switch (type)
+    {
+        case CommandQueueType::Compute:
+            if (computeQueue_ != VK_NULL_HANDLE)
+                return queueFamilyIndices_.computeFamily;
+            break;
+        case CommandQueueType::Transfer:
+            if (transferQueue_ != VK_NULL_HANDLE)
+                return queueFamilyIndices_.transferFamily;
+            break;
+        default:
+            break;
+    }
+    return queueFamilyIndices_.graphicsFamily;
+}
+
 VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
 {
     VKPtr<VkCommandPool> commandPool;
@@ -224,6 +289,13 @@ void VKDevice::TransitionImageLayout(
         srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
         dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     }
+    else if (oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+    {
+        barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    }
 
     /* Record image barrier command */
     vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
@@ -268,13 +340,16 @@ void VKDevice::CopyBufferToImage(
     const VkExtent3D&   extent,
     std::uint32_t       baseArrayLayer,
     std::uint32_t       numArrayLayers,
-    std::uint32_t       mipLevel)
+    std::uint32_t       mipLevel,
+    std::uint32_t       bufferRowLength,
+    std::uint32_t       bufferImageHeight,
+    VkDeviceSize        bufferOffset)
 {
     VkBufferImageCopy region;
     {
-        region.bufferOffset                     = 0;
-        region.bufferRowLength                  = 0;
-        region.bufferImageHeight                = 0;
+        region.bufferOffset                     = bufferOffset;
+        region.bufferRowLength                  = bufferRowLength;
+        region.bufferImageHeight                = bufferImageHeight;
         region.imageSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
         region.imageSubresource.mipLevel        = mipLevel;
         region.imageSubresource.baseArrayLayer  = baseArrayLayer;
@@ -289,16 +364,21 @@ void VKDevice::GenerateMips(
     VkCommandBuffer             commandBuffer,
     VkImage                     image,
     const VkExtent3D&           imageExtent,
-    const TextureSubresource&   subresource)
+    const TextureSubresource&   subresource,
+    VkImageLayout               oldLayout)
 {
-    TransitionImageLayout(
-        commandBuffer,
-        image,
-        VK_FORMAT_UNDEFINED,
-        VK_IMAGE_LAYOUT_UNDEFINED,
-        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        subresource
-    );
+    /* Transition from the actual layout, since an undefined layout would discard the content of the base MIP level */
+    if (oldLayout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+    {
+        TransitionImageLayout(
+            commandBuffer,
+            image,
+            VK_FORMAT_UNDEFINED,
+            oldLayout,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            subresource
+        );
+    }
 
     /* Initialize image memory barrier */
     VkImageMemoryBarrier barrier;
@@ -399,7 +479,7 @@ void VKDevice::GenerateMips(
         barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
         barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
         barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.subresourceRange.baseMipLevel   = subresource.numMipLevels - 1;
+        barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel + subresource.numMipLevels - 1;
 
         vkCmdPipelineBarrier(
             commandBuffer,
@@ -417,7 +497,7 @@ void VKDevice::WriteBuffer(VKDeviceBuffer& buffer, const void* data, VkDeviceSiz
     {
         /* Map buffer memory to host memory */
         auto deviceMemory = region->GetParentChunk();
-        if (auto memory = deviceMemory->Map(device_, region->GetOffset() + offset, size))
+        if (auto memory = deviceMemory->Map(device_, region->GetOffset() + offset))
         {
             /* Copy data to buffer object */
             ::memcpy(memory, data, static_cast<std::size_t>(size));
@@ -10,10 +10,12 @@
 
 
 #include <LLGL/TextureFlags.h>
+#include <LLGL/CommandBufferFlags.h>
 #include "Vulkan.h"
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "Buffer/VKDeviceBuffer.h"
+#include <vector>
 
 
 namespace LLGL
@@ -85,16 +87,21 @@ class VKDevice
             VkImage             dstImage,
             const VkOffset3D&   offset,
             const VkExtent3D&   extent,
-            std::uint32_t       baseArrayLayer  = 0,
-            std::uint32_t       numArrayLayers  = 1,
-            std::uint32_t       mipLevel        = 0
+            std::uint32_t       baseArrayLayer      = 0,
+            std::uint32_t       numArrayLayers      = 1,
+            std::uint32_t       mipLevel            = 0,
+            std::uint32_t       bufferRowLength     = 0,
+            std::uint32_t       bufferImageHeight   = 0,
+            VkDeviceSize        bufferOffset        = 0
         );
 
+        // Generates the MIP-maps of the subresource from its base MIP level. All MIP levels must be in the old layout and are left in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
         void GenerateMips(
             VkCommandBuffer             commandBuffer,
             VkImage                     image,
             const VkExtent3D&           imageExtent,
-            const TextureSubresource&   subresource
+            const TextureSubresource&   subresource,
+            VkImageLayout               oldLayout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
         );
 
         void WriteBuffer(VKDeviceBuffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
@@ -132,6 +139,18 @@ class VKDevice
             return graphicsQueue_;
         }
 
+        // Returns the native VkQueue handle of the specified type, or the graphics queue if there is no dedicated queue of that type.
+        VkQueue GetVkQueue(const CommandQueueType type) const;
+
+        // Returns the queue family index of the specified type, or the graphics family if there is no dedicated queue family of that type.
+        std::uint32_t GetQueueFamily(const CommandQueueType type) const;
+
+        // Returns the queue families resources must be shared with, or an empty list if all queues belong to the graphics family.
+        inline const std::vector<std::uint32_t>& GetConcurrentQueueFamilies() const
+        {
+            return concurrentQueueFamilies_;
+        }
+
         // Returns the native VkCommandPool handle.
         inline const VKPtr<VkCommandPool>& GetVkCommandPool() const
         {
@@ -140,10 +159,13 @@ class VKDevice
 
     private:
 
-        VKPtr<VkDevice>         device_;
-        QueueFamilyIndices      queueFamilyIndices_;
-        VkQueue                 graphicsQueue_      = VK_NULL_HANDLE;
-        VKPtr<VkCommandPool>    commandPool_;
+        VKPtr<VkDevice>             device_;
+        QueueFamilyIndices          queueFamilyIndices_;
+        VkQueue                     graphicsQueue_              = VK_NULL_HANDLE;
+        VkQueue                     computeQueue_               = VK_NULL_HANDLE;
+        VkQueue                     transferQueue_              = VK_NULL_HANDLE;
+        std::vector<std::uint32_t>  concurrentQueueFamilies_;
+        VKPtr<VkCommandPool>        commandPool_;
 
 };
 
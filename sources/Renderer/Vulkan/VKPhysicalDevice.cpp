@@ -185,6 +185,9 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.features.hasInstancing                     = true;
     caps.features.hasOffsetInstancing               = true;
     caps.features.hasIndirectDrawing                = (features_.drawIndirectFirstInstance != VK_FALSE);
+    #ifdef LLGL_VK_ENABLE_EXT
+    caps.features.hasIndirectCountDrawing           = SupportsExtension(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    #endif
     caps.features.hasViewportArrays                 = (features_.multiViewport != VK_FALSE);
     caps.features.hasConservativeRasterization      = SupportsExtension(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME);
     caps.features.hasStreamOutputs                  = SupportsExtension(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME);
@@ -0,0 +1,204 @@
+/*
+ * VKPipelineBarrier.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKPipelineBarrier.h"
+
+
+namespace LLGL
+{
+
+
+static const VkAccessFlags g_writeAccessMask =
+(
+    VK_ACCESS_SHADER_WRITE_BIT                  |
+    VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT        |
+    VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT|
+    VK_ACCESS_TRANSFER_WRITE_BIT                |
+    VK_ACCESS_HOST_WRITE_BIT                    |
+    VK_ACCESS_MEMORY_WRITE_BIT
+);
+
+bool VKHasWriteAccess(VkAccessFlags accessMask)
+{
+    return ((accessMask & g_writeAccessMask) != 0);
+}
+
+VkPipelineStageFlags VKGetPipelineStageFlags(VkShaderStageFlags stageFlags)
+{
+    VkPipelineStageFlags bitmask = 0;
+
+    if ((stageFlags & VK_SHADER_STAGE_VERTEX_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_GEOMETRY_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_FRAGMENT_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_COMPUTE_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+    return bitmask;
+}
+
+bool VKPipelineBarrier::TransitionState(VKResourceState& state, const VKResourceState& newState, VKResourceState& prevState)
+{
+    if (state.layout == newState.layout && !VKHasWriteAccess(state.accessMask) && !VKHasWriteAccess(newState.accessMask))
+    {
+        /* Read-after-read does not require a barrier, but subsequent writes must wait for all readers */
+        state.accessMask    |= newState.accessMask;
+        state.stageMask     |= newState.stageMask;
+        return false;
+    }
+
+    prevState   = state;
+    state       = newState;
+
+    return true;
+}
+
+void VKPipelineBarrier::AppendBufferBarrier(VkBuffer buffer, const VKResourceState& prevState, const VKResourceState& newState)
+{
+    VkBufferMemoryBarrier barrier;
+    {
+        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.pNext               = nullptr;
+        barrier.srcAccessMask       = AppendSrcState(prevState);
+        barrier.dstAccessMask       = newState.accessMask;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer              = buffer;
+        barrier.offset              = 0;
+        barrier.size                = VK_WHOLE_SIZE;
+    }
+    bufferBarriers_.push_back(barrier);
+
+    dstStageMask_ |= newState.stageMask;
+}
+
+// Returns true if the subresource range directly follows the range of the previous barrier and can be merged into it.
+static bool MergeSubresourceRange(VkImageSubresourceRange& dst, const VkImageSubresourceRange& src)
+{
+    if (dst.aspectMask != src.aspectMask)
+        return false;
+
+    if (dst.baseArrayLayer == src.baseArrayLayer && dst.layerCount == src.layerCount &&
+        dst.baseMipLevel + dst.levelCount == src.baseMipLevel)
+    {
+        dst.levelCount += src.levelCount;
+        return true;
+    }
+
+    if (dst.baseMipLevel == src.baseMipLevel && dst.levelCount == src.levelCount &&
+        dst.baseArrayLayer + dst.layerCount == src.baseArrayLayer)
+    {
+        dst.layerCount += src.layerCount;
+        return true;
+    }
+
+    return false;
+}
+
+void VKPipelineBarrier::AppendImageBarrier(
+    VkImage                         image,
+    const VkImageSubresourceRange&  subresourceRange,
+    const VKResourceState&          prevState,
+    const VKResourceState&          newState)
+{
+    const auto srcAccessMask = AppendSrcState(prevState);
+
+    dstStageMask_ |= newState.stageMask;
+
+    /* Try to merge subresource range into previous barrier of the same transition */
+    if (!imageBarriers_.empty())
+    {
+        auto& prevBarrier = imageBarriers_.back();
+        if (prevBarrier.image         == image              &&
+            prevBarrier.oldLayout     == prevState.layout   &&
+            prevBarrier.newLayout     == newState.layout    &&
+            prevBarrier.srcAccessMask == srcAccessMask      &&
+            prevBarrier.dstAccessMask == newState.accessMask)
+        {
+            if (MergeSubresourceRange(prevBarrier.subresourceRange, subresourceRange))
+                return;
+        }
+    }
+
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext               = nullptr;
+        barrier.srcAccessMask       = srcAccessMask;
+        barrier.dstAccessMask       = newState.accessMask;
+        barrier.oldLayout           = prevState.layout;
+        barrier.newLayout           = newState.layout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image               = image;
+        barrier.subresourceRange    = subresourceRange;
+    }
+    imageBarriers_.push_back(barrier);
+}
+
+void VKPipelineBarrier::Submit(VkCommandBuffer commandBuffer)
+{
+    if (!IsEmpty())
+    {
+        /* Resources that have not been used before only need to wait for the top of the pipe */
+        vkCmdPipelineBarrier(
+            commandBuffer,
+            (srcStageMask_ != 0 ? srcStageMask_ : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT)),
+            (dstStageMask_ != 0 ? dstStageMask_ : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT)),
+            0,
+            0, nullptr,
+            static_cast<std::uint32_t>(bufferBarriers_.size()), bufferBarriers_.data(),
+            static_cast<std::uint32_t>(imageBarriers_.size()), imageBarriers_.data()
+        );
+        Reset();
+    }
+}
+
+void VKPipelineBarrier::Reset()
+{
+    srcStageMask_ = 0;
+    dstStageMask_ = 0;
+    bufferBarriers_.clear();
+    imageBarriers_.clear();
+}
+
+void VKPipelineBarrier::SetSupportedStages(VkPipelineStageFlags stageMask)
+{
+    supportedStageMask_ = stageMask;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VkAccessFlags VKPipelineBarrier::AppendSrcState(const VKResourceState& prevState)
+{
+    if ((prevState.stageMask & ~supportedStageMask_) != 0)
+    {
+        /* Previous accesses were made by another queue, whose memory accesses are already made visible by the semaphore wait */
+        srcStageMask_ |= (prevState.stageMask & supportedStageMask_);
+        return 0;
+    }
+
+    /* Only previous write accesses must be made available; read accesses only need an execution dependency */
+    srcStageMask_ |= prevState.stageMask;
+    return (prevState.accessMask & g_writeAccessMask);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
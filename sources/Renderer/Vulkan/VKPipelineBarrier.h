@@ -0,0 +1,102 @@
+/*
+ * VKPipelineBarrier.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_PIPELINE_BARRIER_H
+#define LLGL_VK_PIPELINE_BARRIER_H
+
+
+#include "Vulkan.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Image layout, access mask, and pipeline stages a resource was last used with. Value initialization denotes an unused resource.
+struct VKResourceState
+{
+    VkImageLayout           layout;
+    VkAccessFlags           accessMask;
+    VkPipelineStageFlags    stageMask;
+};
+
+// Returns true if the specified access mask contains any write access.
+bool VKHasWriteAccess(VkAccessFlags accessMask);
+
+// Returns the pipeline stages the specified shader stages are executed in.
+VkPipelineStageFlags VKGetPipelineStageFlags(VkShaderStageFlags stageFlags);
+
+/*
+Collects the buffer and image memory barriers that are required before the next command is recorded,
+and records all of them with a single 'vkCmdPipelineBarrier' command.
+*/
+class VKPipelineBarrier
+{
+
+    public:
+
+        /*
+        Transitions the tracked state of a resource into the new state and returns true if this requires a barrier.
+        In that case, 'prevState' receives the state the barrier must wait on.
+        Read accesses that keep the image layout are merged into the tracked state without a barrier.
+        */
+        static bool TransitionState(VKResourceState& state, const VKResourceState& newState, VKResourceState& prevState);
+
+        // Appends a memory barrier for the entire buffer.
+        void AppendBufferBarrier(VkBuffer buffer, const VKResourceState& prevState, const VKResourceState& newState);
+
+        // Appends a memory barrier for the image subresource range. Adjacent MIP levels or array layers are merged into the previous barrier.
+        void AppendImageBarrier(
+            VkImage                         image,
+            const VkImageSubresourceRange&  subresourceRange,
+            const VKResourceState&          prevState,
+            const VKResourceState&          newState
+        );
+
+        // Records all pending barriers with a single 'vkCmdPipelineBarrier' command and resets this batch.
+        void Submit(VkCommandBuffer commandBuffer);
+
+        // Discards all pending barriers.
+        void Reset();
+
+        /*
+        Limits the barriers to the pipeline stages that are supported by the queue family of the command buffer, e.g. for dedicated transfer queues.
+        Previous accesses in other stages were made by another queue, which is synchronized with semaphores, so only the layout transition is recorded for them.
+        */
+        void SetSupportedStages(VkPipelineStageFlags stageMask);
+
+        // Returns true if there are no pending barriers.
+        inline bool IsEmpty() const
+        {
+            return (bufferBarriers_.empty() && imageBarriers_.empty());
+        }
+
+    private:
+
+        // Returns the source access mask of a barrier from the previous state and accumulates its source stages.
+        VkAccessFlags AppendSrcState(const VKResourceState& prevState);
+
+    private:
+
+        VkPipelineStageFlags                srcStageMask_       = 0;
+        VkPipelineStageFlags                dstStageMask_       = 0;
+        VkPipelineStageFlags                supportedStageMask_ = VK_PIPELINE_STAGE_FLAG_BITS_MAX_ENUM;
+        std::vector<VkBufferMemoryBarrier>  bufferBarriers_;
+        std::vector<VkImageMemoryBarrier>   imageBarriers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
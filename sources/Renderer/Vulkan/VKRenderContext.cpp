@@ -42,12 +42,13 @@ VKRenderContext::VKRenderContext(
     swapChain_           { device, vkDestroySwapchainKHR },
     swapChainRenderPass_ { device                        },
     secondaryRenderPass_ { device                        },
-    depthStencilBuffer_  { device                        }
+    depthStencilBuffer_  { device                        },
+    numFramesInFlight_   { std::max(1u, desc.maxFramesInFlight) }
 {
     SetOrCreateSurface(surface, desc.videoMode, nullptr);
     desc.videoMode = GetVideoMode();
 
-    CreatePresentSemaphores();
+    CreateFrameSyncObjects();
     CreateGpuSurface();
 
     if (desc.videoMode.depthBits > 0 || desc.videoMode.stencilBits > 0)
@@ -66,26 +67,40 @@ VKRenderContext::~VKRenderContext()
 
 void VKRenderContext::Present()
 {
-    /* Initialize semaphores */
-    VkSemaphore waitSemaphorse[] = { imageAvailableSemaphore_ };
-    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    VkSemaphore signalSemaphores[] = { renderFinishedSemaphore_ };
+    VkSemaphore renderFinishedSemaphore = renderFinishedSemaphores_[currentFrame_];
 
-    /* Submit signal semaphore to graphics queue */
-    VkSubmitInfo submitInfo;
+    /* Semaphores have already been chained by the submitted command buffers, whose fences track the completion of this frame */
+    if (!frameSubmitted_)
     {
-        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 1;
-        submitInfo.pWaitSemaphores      = waitSemaphorse;
-        submitInfo.pWaitDstStageMask    = waitStages;
-        submitInfo.commandBufferCount   = 0;
-        submitInfo.pCommandBuffers      = nullptr;
-        submitInfo.signalSemaphoreCount = 1;
-        submitInfo.pSignalSemaphores    = signalSemaphores;
+        /* No command buffer rendered into the swap-chain in this frame, so submit the semaphores on their own with the fence of this frame */
+        VkFence inFlightFence = inFlightFences_[currentFrame_];
+        vkResetFences(device_, 1, &inFlightFence);
+
+        VkSemaphore waitSemaphore = VK_NULL_HANDLE;
+        VkPipelineStageFlags waitStage = 0;
+        GetSubmitSemaphores(waitSemaphore, waitStage, renderFinishedSemaphore);
+
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = nullptr;
+            submitInfo.waitSemaphoreCount   = 1;
+            submitInfo.pWaitSemaphores      = &waitSemaphore;
+            submitInfo.pWaitDstStageMask    = &waitStage;
+            submitInfo.commandBufferCount   = 0;
+            submitInfo.pCommandBuffers      = nullptr;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = &renderFinishedSemaphore;
+        }
+        auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFence);
+        VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
+
+        auto& submission = frameSubmissions_[currentFrame_];
+        {
+            submission.ticket   = VKCompletionTicket{};
+            submission.fence    = inFlightFence;
+        }
     }
-    auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
-    VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
 
     /* Present result on screen */
     VkSwapchainKHR swapChains[] = { swapChain_ };
@@ -95,16 +110,17 @@ void VKRenderContext::Present()
         presentInfo.sType               = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
         presentInfo.pNext               = nullptr;
         presentInfo.waitSemaphoreCount  = 1;
-        presentInfo.pWaitSemaphores     = signalSemaphores;
+        presentInfo.pWaitSemaphores     = &renderFinishedSemaphore;
         presentInfo.swapchainCount      = 1;
         presentInfo.pSwapchains         = swapChains;
         presentInfo.pImageIndices       = &presentImageIndex_;
         presentInfo.pResults            = nullptr;
     }
-    result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+    auto result = vkQueuePresentKHR(presentQueue_, &presentInfo);
     VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 
-    /* Get image index for next presentation */
+    /* Move on to next frame in flight and get image index for next presentation */
+    currentFrame_ = (currentFrame_ + 1) % numFramesInFlight_;
     AcquireNextPresentImage();
 }
 
@@ -130,6 +146,31 @@ bool VKRenderContext::HasDepthStencilBuffer() const
     return (depthStencilBuffer_.GetVkFormat() != VK_FORMAT_UNDEFINED);
 }
 
+void VKRenderContext::GetSubmitSemaphores(VkSemaphore& waitSemaphore, VkPipelineStageFlags& waitStage, VkSemaphore& signalSemaphore)
+{
+    /*
+    Binary semaphores can only be signaled once before they are waited on,
+    so every submission after the first one consumes the signal of its predecessor and signals again
+    */
+    if (frameSubmitted_)
+        waitSemaphore = renderFinishedSemaphores_[currentFrame_];
+    else
+        waitSemaphore = imageAvailableSemaphores_[currentFrame_];
+
+    waitStage       = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    signalSemaphore = renderFinishedSemaphores_[currentFrame_];
+    frameSubmitted_ = true;
+}
+
+void VKRenderContext::NotifySubmission(const VKCompletionTicket& ticket)
+{
+    auto& submission = frameSubmissions_[currentFrame_];
+    {
+        submission.ticket   = ticket;
+        submission.fence    = VK_NULL_HANDLE;
+    }
+}
+
 
 /*
  * ======= Private: =======
@@ -140,10 +181,10 @@ bool VKRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
     const auto& prevVideoMode = GetVideoMode();
 
     /* Wait until graphics queue is idle before resources are destroyed and recreated */
-    vkQueueWaitIdle(graphicsQueue_);
+    WaitIdleAndRetireSemaphores();
 
-    /* Recreate presenting semaphores and Vulkan surface */
-    CreatePresentSemaphores();
+    /* Recreate frame synchronization objects and Vulkan surface */
+    CreateFrameSyncObjects();
     CreateGpuSurface();
 
     /* Recreate (or just release) depth-stencil buffer */
@@ -163,6 +204,10 @@ bool VKRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
 
 bool VKRenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
 {
+    /* Wait until graphics queue is idle, since the current image has already been acquired with the frame's semaphore */
+    WaitIdleAndRetireSemaphores();
+    CreateFrameSyncObjects();
+
     /* Recreate swap-chain with new vsnyc settings */
     CreateSwapChain(GetVideoMode(), vsyncDesc);
     return true;
@@ -181,11 +226,42 @@ void VKRenderContext::CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore)
     VKThrowIfFailed(result, "failed to create Vulkan semaphore");
 }
 
-void VKRenderContext::CreatePresentSemaphores()
+void VKRenderContext::CreateGpuFence(VKPtr<VkFence>& fence)
+{
+    /* Create fence in signaled state, so the first wait for each frame in flight returns immediately */
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+    }
+    auto result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence");
+}
+
+void VKRenderContext::CreateFrameSyncObjects()
 {
-    /* Create presentation semaphorse */
-    CreateGpuSemaphore(imageAvailableSemaphore_);
-    CreateGpuSemaphore(renderFinishedSemaphore_);
+    imageAvailableSemaphores_.clear();
+    renderFinishedSemaphores_.clear();
+    inFlightFences_.clear();
+    frameSubmissions_.clear();
+
+    /* Create presentation semaphores and fence for each frame in flight */
+    for (std::uint32_t i = 0; i < numFramesInFlight_; ++i)
+    {
+        imageAvailableSemaphores_.emplace_back(device_, vkDestroySemaphore);
+        CreateGpuSemaphore(imageAvailableSemaphores_.back());
+
+        renderFinishedSemaphores_.emplace_back(device_, vkDestroySemaphore);
+        CreateGpuSemaphore(renderFinishedSemaphores_.back());
+
+        inFlightFences_.emplace_back(device_, vkDestroyFence);
+        CreateGpuFence(inFlightFences_.back());
+    }
+
+    frameSubmissions_.resize(numFramesInFlight_);
+
+    currentFrame_ = 0;
 }
 
 void VKRenderContext::CreateGpuSurface()
@@ -515,15 +591,65 @@ VkFormat VKRenderContext::PickDepthFormat() const
 
 void VKRenderContext::AcquireNextPresentImage()
 {
-    /* Get next image for presentation */
-    vkAcquireNextImageKHR(
+    /* Wait until the GPU has finished the frame that previously used the synchronization objects of the current frame */
+    WaitForFrame(currentFrame_);
+
+    /* Get next image for presentation; the semaphore is only signaled if an image has been acquired */
+    auto result = vkAcquireNextImageKHR(
         device_,
         swapChain_,
         UINT64_MAX,
-        imageAvailableSemaphore_,
+        imageAvailableSemaphores_[currentFrame_],
         VK_NULL_HANDLE,
         &presentImageIndex_
     );
+
+    imageAcquired_  = (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR);
+    frameSubmitted_ = false;
+}
+
+void VKRenderContext::WaitForFrame(std::uint32_t frame)
+{
+    auto& submission = frameSubmissions_[frame];
+
+    if (submission.ticket)
+        submission.ticket.Wait();
+    else if (submission.fence != VK_NULL_HANDLE)
+        vkWaitForFences(device_, 1, &(submission.fence), VK_TRUE, UINT64_MAX);
+
+    submission = FrameSubmission{};
+}
+
+void VKRenderContext::WaitIdleAndRetireSemaphores()
+{
+    /* The image-available semaphore must not be destroyed while its signal is pending, so consume it with an empty submission */
+    if (imageAcquired_ && !frameSubmitted_)
+    {
+        VkSemaphore             waitSemaphore   = imageAvailableSemaphores_[currentFrame_];
+        VkPipelineStageFlags    waitStage       = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = nullptr;
+            submitInfo.waitSemaphoreCount   = 1;
+            submitInfo.pWaitSemaphores      = &waitSemaphore;
+            submitInfo.pWaitDstStageMask    = &waitStage;
+            submitInfo.commandBufferCount   = 0;
+            submitInfo.pCommandBuffers      = nullptr;
+            submitInfo.signalSemaphoreCount = 0;
+            submitInfo.pSignalSemaphores    = nullptr;
+        }
+        auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
+        VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
+
+        imageAcquired_ = false;
+    }
+
+    /* Pending presentations still wait for the render-finished semaphores */
+    vkQueueWaitIdle(graphicsQueue_);
+    if (presentQueue_ != graphicsQueue_)
+        vkQueueWaitIdle(presentQueue_);
 }
 
 
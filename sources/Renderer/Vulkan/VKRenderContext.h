@@ -13,6 +13,7 @@
 #include <LLGL/RenderContext.h>
 #include "VKCore.h"
 #include "VKPtr.h"
+#include "VKCompletionTimeline.h"
 #include "RenderState/VKRenderPass.h"
 #include "Texture/VKDepthStencilBuffer.h"
 #include <memory>
@@ -80,13 +81,39 @@ class VKRenderContext final : public RenderContext
         // Returns true if this render context has a depth-stencil buffer.
         bool HasDepthStencilBuffer() const;
 
+        // Returns the index of the current frame within the ring of frames in flight, i.e. in the range [0, GetNumFramesInFlight()).
+        inline std::uint32_t GetCurrentFrame() const
+        {
+            return currentFrame_;
+        }
+
+        // Returns the number of frames that can be in flight at the same time.
+        inline std::uint32_t GetNumFramesInFlight() const
+        {
+            return numFramesInFlight_;
+        }
+
+        /*
+        Returns the semaphores for a queue submission that renders into the current swap-chain image.
+        The first submission of a frame waits until the image is available, every following submission waits for the previous one.
+        Each of them signals the semaphore the presentation waits for, so no extra submission is required in Present().
+        */
+        void GetSubmitSemaphores(VkSemaphore& waitSemaphore, VkPipelineStageFlags& waitStage, VkSemaphore& signalSemaphore);
+
+        /*
+        Notifies this render context about a queue submission that rendered into the current swap-chain image with the semaphores from GetSubmitSemaphores.
+        The synchronization objects of this frame are reused once the last of these submissions has completed, so Present() doesn't need to signal a fence on its own.
+        */
+        void NotifySubmission(const VKCompletionTicket& ticket);
+
     private:
 
         bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
         bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
 
         void CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore);
-        void CreatePresentSemaphores();
+        void CreateGpuFence(VKPtr<VkFence>& fence);
+        void CreateFrameSyncObjects();
         void CreateGpuSurface();
 
         void CreateRenderPass(VKRenderPass& renderPass, bool isSecondary);
@@ -108,6 +135,12 @@ class VKRenderContext final : public RenderContext
 
         void AcquireNextPresentImage();
 
+        // Waits until the last submission of the specified frame in flight has completed.
+        void WaitForFrame(std::uint32_t frame);
+
+        // Waits until the graphics and present queues are idle, after the pending signal of the image-available semaphore has been consumed.
+        void WaitIdleAndRetireSemaphores();
+
     private:
 
         VkInstance                          instance_                   = VK_NULL_HANDLE;
@@ -134,8 +167,23 @@ class VKRenderContext final : public RenderContext
         VkQueue                             graphicsQueue_              = VK_NULL_HANDLE;
         VkQueue                             presentQueue_               = VK_NULL_HANDLE;
 
-        VKPtr<VkSemaphore>                  imageAvailableSemaphore_;
-        VKPtr<VkSemaphore>                  renderFinishedSemaphore_;
+        std::uint32_t                       numFramesInFlight_          = 1;
+        std::uint32_t                       currentFrame_               = 0;
+        bool                                frameSubmitted_             = false;
+
+        bool                                imageAcquired_              = false;
+
+        // Last queue submission of a frame in flight; either a command buffer recording or a submission with the fence of this render context.
+        struct FrameSubmission
+        {
+            VKCompletionTicket  ticket;
+            VkFence             fence           = VK_NULL_HANDLE;
+        };
+
+        std::vector<VKPtr<VkSemaphore>>     imageAvailableSemaphores_;
+        std::vector<VKPtr<VkSemaphore>>     renderFinishedSemaphores_;
+        std::vector<VKPtr<VkFence>>         inFlightFences_;            // only used for frames that no command buffer rendered into
+        std::vector<FrameSubmission>        frameSubmissions_;
 
 };
 
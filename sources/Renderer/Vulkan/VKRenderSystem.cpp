@@ -57,7 +57,8 @@ static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long cpuAccessFlags)
 
 VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     instance_            { vkDestroyInstance                        },
-    debugReportCallback_ { instance_, DestroyDebugReportCallbackEXT }
+    debugReportCallback_ { instance_, DestroyDebugReportCallbackEXT },
+    shaderModulePool_    { device_.GetVkDevice()                    }
 {
     /* Extract optional renderer configuartion */
     auto rendererConfigVK = GetRendererConfiguration<RendererConfigurationVulkan>(renderSystemDesc);
@@ -110,13 +111,31 @@ CommandQueue* VKRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* VKRenderSystem::GetCommandQueue(const CommandQueueType type)
+{
+    /* Return dedicated queue if the device exposes one for this type, otherwise fall back to the graphics queue */
+    if (type == CommandQueueType::Compute && computeQueue_)
+        return computeQueue_.get();
+    if (type == CommandQueueType::Transfer && transferQueue_)
+        return transferQueue_.get();
+    return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
     return TakeOwnership(
         commandBuffers_,
-        MakeUnique<VKCommandBuffer>(physicalDevice_, device_, device_.GetVkQueue(), device_.GetQueueFamilyIndices(), desc)
+        MakeUnique<VKCommandBuffer>(
+            physicalDevice_,
+            device_,
+            *deviceMemoryMngr_,
+            device_.GetVkQueue(desc.queueType),
+            device_.GetQueueFamilyIndices(),
+            desc,
+            GetMaxNumFramesInFlight()
+        )
     );
 }
 
@@ -127,10 +146,23 @@ void VKRenderSystem::Release(CommandBuffer& commandBuffer)
 
 /* ----- Buffers ------ */
 
+// Returns true if the specified buffer is a dynamic constant buffer, whose updates are written into a new version instead of a transfer command.
+static bool IsDynamicConstantBuffer(const BufferDescriptor& desc)
+{
+    return
+    (
+        desc.bindFlags == BindFlags::ConstantBuffer &&
+        (desc.miscFlags & MiscFlags::DynamicUsage) != 0
+    );
+}
+
 Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
 {
     AssertCreateBuffer(desc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
 
+    if (IsDynamicConstantBuffer(desc))
+        return CreateDynamicBuffer(desc, initialData);
+
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
     BuildVkBufferCreateInfo(
@@ -179,6 +211,7 @@ void VKRenderSystem::Release(Buffer& buffer)
 {
     /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    bufferVK.UnmapVersions(device_);
     bufferVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     bufferVK.GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     RemoveFromUniqueSet(buffers_, &buffer);
@@ -193,7 +226,13 @@ void VKRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, con
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
 
-    if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
+    if (bufferVK.IsDynamic())
+    {
+        /* Write data into new version of dynamic buffer */
+        if (!bufferVK.WriteVersion(dstOffset, data, dataSize, VKCompletionTicket{}))
+            OverwriteDynamicBuffer(bufferVK);
+    }
+    else if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy data to staging buffer memory */
         device_.WriteBuffer(bufferVK.GetStagingDeviceBuffer(), data, dataSize, dstOffset);
@@ -225,6 +264,10 @@ void* VKRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
+    /* Map CPU copy of dynamic buffer */
+    if (bufferVK.IsDynamic())
+        return bufferVK.Map(device_, access);
+
     if (auto stagingBuffer = bufferVK.GetStagingVkBuffer())
     {
         /* Copy GPU local buffer into staging buffer for read accces */
@@ -242,7 +285,13 @@ void VKRenderSystem::UnmapBuffer(Buffer& buffer)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
-    if (auto stagingBuffer = bufferVK.GetStagingVkBuffer())
+    if (bufferVK.IsDynamic())
+    {
+        /* Publish CPU copy of dynamic buffer as new version for write access */
+        if (bufferVK.GetMappedCPUAccess() != CPUAccess::ReadOnly && !bufferVK.PublishVersion(VKCompletionTicket{}))
+            OverwriteDynamicBuffer(bufferVK);
+    }
+    else if (auto stagingBuffer = bufferVK.GetStagingVkBuffer())
     {
         /* Unmap staging buffer */
         bufferVK.Unmap(device_);
@@ -255,6 +304,9 @@ void VKRenderSystem::UnmapBuffer(Buffer& buffer)
 
 /* ----- Textures ----- */
 
+// Uploads are complete when the functions return, so the uploaded subresources are only left in the sampling-ready layout
+static const VKResourceState g_uploadedTextureState { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, 0 };
+
 // Returns the extent for the specified texture dimensionality (used for the dimension of 'VK_IMAGE_TYPE_1D/ 2D/ 3D')
 static VkExtent3D GetTextureVkExtent(const TextureDescriptor& desc)
 {
@@ -281,17 +333,86 @@ static std::uint32_t GetTextureLayertCount(const TextureDescriptor& desc)
         return 1;
 }
 
+/*
+Returns the size (in bytes) of the staging data for the specified source image that is uploaded without conversion,
+and determines the buffer row length and image height (in texels) for its row and layer strides.
+*/
+static VkDeviceSize GetStagingImageDataSize(
+    const SrcImageDescriptor&   imageDesc,
+    const Format                format,
+    const Extent3D&             extent,
+    std::uint32_t&              bufferRowLength,
+    std::uint32_t&              bufferImageHeight)
+{
+    bufferRowLength     = 0;
+    bufferImageHeight   = 0;
+
+    /* Strides are ignored for compressed formats */
+    const auto& formatAttribs = GetFormatAttribs(format);
+    const auto  numTexels     = extent.width * extent.height * extent.depth;
+
+    if ((imageDesc.rowStride == 0 && imageDesc.layerStride == 0) || formatAttribs.bitSize == 0 || (formatAttribs.flags & FormatFlags::IsCompressed) != 0)
+        return static_cast<VkDeviceSize>(TextureBufferSize(format, numTexels));
+
+    /* Determine strides in texels */
+    const VkDeviceSize bytesPerTexel    = formatAttribs.bitSize / 8;
+    const VkDeviceSize rowStride        = (imageDesc.rowStride   != 0 ? imageDesc.rowStride   : bytesPerTexel * extent.width);
+    const VkDeviceSize layerStride      = (imageDesc.layerStride != 0 ? imageDesc.layerStride : rowStride * extent.height);
+
+    if (rowStride % bytesPerTexel != 0 || rowStride < bytesPerTexel * extent.width)
+        throw std::invalid_argument("image row stride must be a multiple of the texel size and must not be less than the image width");
+    if (layerStride % rowStride != 0 || layerStride < rowStride * extent.height)
+        throw std::invalid_argument("image layer stride must be a multiple of the row stride and must not be less than the image height");
+
+    bufferRowLength     = static_cast<std::uint32_t>(rowStride / bytesPerTexel);
+    bufferImageHeight   = static_cast<std::uint32_t>(layerStride / rowStride);
+
+    /* Return size from the first to the last texel of the strided image */
+    if (numTexels == 0)
+        return 0;
+
+    return (extent.depth - 1) * layerStride + (extent.height - 1) * rowStride + extent.width * bytesPerTexel;
+}
+
 Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
+    /*
+    Create texture with uncompressed format if the block compressed format is not supported by the device.
+    The initial image data is then decompressed by the image conversion below.
+    */
+    if (MustDecompressFormat(textureDesc.format, GetRenderingCaps().textureFormats))
+    {
+        auto fallbackDesc = textureDesc;
+        fallbackDesc.format = GetDecompressedFormat(textureDesc.format);
+
+        if (imageDesc != nullptr && IsCompressedFormat(imageDesc->format))
+        {
+            auto compressedImageDesc = GetDecompressionSrcDesc(*imageDesc, fallbackDesc.format);
+            return CreateTexture(fallbackDesc, &compressedImageDesc);
+        }
+
+        return CreateTexture(fallbackDesc, imageDesc);
+    }
+
     const auto& cfg = GetConfiguration();
 
     /* Determine size of image for staging buffer */
     const auto imageSize        = TextureSize(textureDesc);
-    const auto initialDataSize  = static_cast<VkDeviceSize>(TextureBufferSize(textureDesc.format, imageSize));
+    auto       initialDataSize  = static_cast<VkDeviceSize>(TextureBufferSize(textureDesc.format, imageSize));
+
+    /* Determine extent of initial image data with all array layers */
+    const Extent3D imageExtent
+    {
+        textureDesc.extent.width,
+        textureDesc.extent.height,
+        imageSize / std::max(1u, textureDesc.extent.width * textureDesc.extent.height)
+    };
 
     /* Set up initial image data */
-    const void* initialData = nullptr;
-    ByteBuffer intermediateData;
+    const void*     initialData         = nullptr;
+    std::uint32_t   bufferRowLength     = 0;
+    std::uint32_t   bufferImageHeight   = 0;
+    ByteBuffer      intermediateData;
 
     if (imageDesc)
     {
@@ -300,7 +421,7 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
         {
             /* Convert image format (will be null if no conversion is necessary) */
-            intermediateData = ConvertImageBuffer(*imageDesc, formatAttribs.format, formatAttribs.dataType, cfg.threadCount);
+            intermediateData = ConvertImageBuffer(*imageDesc, formatAttribs.format, formatAttribs.dataType, imageExtent, cfg.threadCount);
         }
 
         if (intermediateData)
@@ -316,9 +437,10 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         else
         {
             /*
-            Validate that image data is large enough,
+            Validate that image data (with its strides) is large enough,
             then use input data as source for initial data
             */
+            initialDataSize = GetStagingImageDataSize(*imageDesc, textureDesc.format, imageExtent, bufferRowLength, bufferImageHeight);
             AssertImageDataSize(imageDesc->dataSize, static_cast<std::size_t>(initialDataSize));
             initialData = imageDesc->data;
         }
@@ -358,10 +480,10 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
     auto formatVK = VKTypes::Map(textureDesc.format);
 
+    const TextureSubresource subresource{ 0, arrayLayers, 0, mipLevels };
+
     auto cmdBuffer = device_.AllocCommandBuffer();
     {
-        const TextureSubresource subresource{ 0, arrayLayers, 0, mipLevels };
-
         device_.TransitionImageLayout(
             cmdBuffer,
             image,
@@ -378,7 +500,10 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             VkOffset3D{ 0, 0, 0 },
             GetTextureVkExtent(textureDesc),
             0,
-            GetTextureLayertCount(textureDesc)
+            GetTextureLayertCount(textureDesc),
+            0,
+            bufferRowLength,
+            bufferImageHeight
         );
 
         device_.TransitionImageLayout(
@@ -402,6 +527,7 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         }
     }
     device_.FlushCommandBuffer(cmdBuffer);
+    textureVK->SetState(subresource, g_uploadedTextureState);
 
     /* Release staging buffer */
     stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
@@ -435,7 +561,13 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
     auto        image           = textureVK.GetVkImage();
     const auto  imageSize       = extent.width * extent.height * extent.depth;
     const void* imageData       = nullptr;
-    const auto  imageDataSize   = static_cast<VkDeviceSize>(TextureBufferSize(format, imageSize));
+    auto        imageDataSize   = static_cast<VkDeviceSize>(TextureBufferSize(format, imageSize));
+
+    /* Determine extent of image data with all array layers */
+    const Extent3D imageExtent { extent.width, extent.height, extent.depth * subresource.numArrayLayers };
+
+    std::uint32_t bufferRowLength   = 0;
+    std::uint32_t bufferImageHeight = 0;
 
     /* Check if image data must be converted */
     ByteBuffer intermediateData;
@@ -443,8 +575,11 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
     const auto& formatAttribs = GetFormatAttribs(format);
     if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
     {
-        /* Convert image format (will be null if no conversion is necessary) */
-        intermediateData = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, cfg.threadCount);
+        /* Convert image format (will be null if no conversion is necessary), and decompress block compressed images with the signedness of the texture format */
+        if (IsCompressedFormat(imageDesc.format))
+            intermediateData = ConvertImageBuffer(GetDecompressionSrcDesc(imageDesc, format), formatAttribs.format, formatAttribs.dataType, imageExtent, cfg.threadCount);
+        else
+            intermediateData = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, imageExtent, cfg.threadCount);
     }
 
     if (intermediateData)
@@ -460,9 +595,10 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
     else
     {
         /*
-        Validate that image data is large enough,
+        Validate that image data (with its strides) is large enough,
         then use input data as source for initial data
         */
+        imageDataSize = GetStagingImageDataSize(imageDesc, format, imageExtent, bufferRowLength, bufferImageHeight);
         AssertImageDataSize(imageDesc.dataSize, static_cast<std::size_t>(imageDataSize));
         imageData = imageDesc.data;
     }
@@ -497,7 +633,9 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
             VkExtent3D{ extent.width, extent.height, extent.depth },
             subresource.baseArrayLayer,
             subresource.numArrayLayers,
-            subresource.baseMipLevel
+            subresource.baseMipLevel,
+            bufferRowLength,
+            bufferImageHeight
         );
 
         device_.TransitionImageLayout(
@@ -510,11 +648,183 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
         );
     }
     device_.FlushCommandBuffer(cmdBuffer);
+    textureVK.SetState(subresource, g_uploadedTextureState);
 
     /* Release staging buffer */
     stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
 }
 
+// Number of tiles the staging buffer of a streaming texture upload can hold before the copies must be submitted.
+static const std::size_t g_numStreamStagingTiles = 4;
+
+void VKRenderSystem::WriteTextureStreamed(Texture& texture, const TextureRegion& textureRegion, const StreamImageDescriptor& imageDesc)
+{
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+
+    /* Compressed, packed, and depth-stencil formats are uploaded tile by tile with the default implementation */
+    const auto& formatAttribs = GetFormatAttribs(VKTypes::Unmap(textureVK.GetVkFormat()));
+    const long  defaultFlags  = (FormatFlags::IsCompressed | FormatFlags::IsPacked | FormatFlags::HasDepth | FormatFlags::HasStencil);
+
+    if (formatAttribs.bitSize == 0 || (formatAttribs.flags & defaultFlags) != 0)
+    {
+        RenderSystem::WriteTextureStreamed(texture, textureRegion, imageDesc);
+        return;
+    }
+
+    AssertStreamImageDesc(texture, textureRegion, imageDesc);
+
+    const auto& cfg = GetConfiguration();
+
+    const auto  srcBytesPerTexel    = static_cast<std::size_t>(ImageDataSize(imageDesc.format, imageDesc.dataType, 1));
+    const auto  dstBytesPerTexel    = static_cast<std::size_t>(formatAttribs.bitSize / 8);
+    const bool  convertImage        = (imageDesc.format != formatAttribs.format || imageDesc.dataType != formatAttribs.dataType);
+    const auto  tileSize            = GetStreamTileSize(imageDesc);
+
+    /* Buffer offsets of the tiles must be a multiple of the texel size and of 4 (see vkCmdCopyBufferToImage) */
+    const auto  tileAlignment       = static_cast<VkDeviceSize>(dstBytesPerTexel * 4);
+
+    /* Transition entire texture region into transfer destination */
+    TextureSubresource subresource = textureRegion.subresource;
+    subresource.numMipLevels = std::max(1u, subresource.numMipLevels);
+
+    auto image = textureVK.GetVkImage();
+
+    auto cmdBuffer = device_.AllocCommandBuffer();
+    device_.TransitionImageLayout(
+        cmdBuffer,
+        image,
+        textureVK.GetVkFormat(),
+        VK_IMAGE_LAYOUT_UNDEFINED,
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        subresource
+    );
+
+    /*
+    Staging buffer holds multiple tiles and stays mapped for all tiles.
+    All copies are recorded into the same command buffer, which is only submitted when the staging buffer is exhausted.
+    */
+    VKDeviceBuffer  stagingBuffer       { device_ };
+    VkDeviceSize    stagingBufferSize   = 0;
+    VkDeviceSize    stagingOffset       = 0;
+    char*           stagingBufferData   = nullptr;
+
+    const auto      maxStagingSize      = static_cast<VkDeviceSize>(
+        std::min(tileSize * g_numStreamStagingTiles, NumStreamTexels(textureRegion) * dstBytesPerTexel)
+    );
+
+    /* Intermediate buffer is only required if the tiles are read with the callback and must be converted */
+    ByteBuffer      tileBuffer;
+    std::size_t     tileBufferSize      = 0;
+
+    ForEachStreamTile(
+        textureRegion,
+        std::max(srcBytesPerTexel, dstBytesPerTexel),
+        tileSize,
+        [&](const TextureRegion& tileRegion, std::size_t texelOffset)
+        {
+            const auto numTexels        = NumStreamTexels(tileRegion);
+            const auto srcTileDataSize  = numTexels * srcBytesPerTexel;
+            const auto dstTileDataSize  = numTexels * dstBytesPerTexel;
+
+            auto tileOffset = ((stagingOffset + tileAlignment - 1) / tileAlignment) * tileAlignment;
+
+            if (tileOffset + dstTileDataSize > stagingBufferSize)
+            {
+                /* Submit copies of all staged tiles before the staging buffer is reused */
+                if (stagingOffset > 0)
+                {
+                    device_.FlushCommandBuffer(cmdBuffer);
+                    cmdBuffer = device_.AllocCommandBuffer();
+                }
+                tileOffset = 0;
+
+                /* Reallocate staging buffer if the tile exceeds its size (i.e. only for the first tile or for single rows larger than the tile size) */
+                if (stagingBufferSize < dstTileDataSize)
+                {
+                    if (stagingBufferData != nullptr)
+                    {
+                        stagingBuffer.Unmap(device_);
+                        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+                    }
+
+                    const auto newStagingBufferSize = std::max(maxStagingSize, static_cast<VkDeviceSize>(dstTileDataSize));
+
+                    VkBufferCreateInfo stagingCreateInfo;
+                    BuildVkBufferCreateInfo(stagingCreateInfo, newStagingBufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+                    stagingBuffer       = CreateStagingBuffer(stagingCreateInfo);
+                    stagingBufferSize   = newStagingBufferSize;
+                    stagingBufferData   = reinterpret_cast<char*>(stagingBuffer.Map(device_));
+                }
+            }
+
+            /* Read or convert tile directly into mapped staging memory */
+            auto tileData = stagingBufferData + tileOffset;
+
+            if (convertImage)
+            {
+                SrcImageDescriptor srcTileDesc { imageDesc.format, imageDesc.dataType, nullptr, srcTileDataSize };
+
+                if (imageDesc.data != nullptr)
+                    srcTileDesc.data = reinterpret_cast<const char*>(imageDesc.data) + texelOffset * srcBytesPerTexel;
+                else
+                {
+                    if (tileBufferSize < srcTileDataSize)
+                    {
+                        tileBuffer      = GenerateEmptyByteBuffer(srcTileDataSize, false);
+                        tileBufferSize  = srcTileDataSize;
+                    }
+                    imageDesc.readCallback(tileRegion, tileBuffer.get(), srcTileDataSize);
+                    srcTileDesc.data = tileBuffer.get();
+                }
+
+                const DstImageDescriptor dstTileDesc { formatAttribs.format, formatAttribs.dataType, tileData, dstTileDataSize };
+                ConvertImageBuffer(srcTileDesc, dstTileDesc, cfg.threadCount);
+            }
+            else if (imageDesc.data != nullptr)
+                ::memcpy(tileData, reinterpret_cast<const char*>(imageDesc.data) + texelOffset * srcBytesPerTexel, dstTileDataSize);
+            else
+                imageDesc.readCallback(tileRegion, tileData, dstTileDataSize);
+
+            /* Record copy of tile into hardware texture */
+            device_.CopyBufferToImage(
+                cmdBuffer,
+                stagingBuffer.GetVkBuffer(),
+                image,
+                VkOffset3D{ tileRegion.offset.x, tileRegion.offset.y, tileRegion.offset.z },
+                VkExtent3D{ tileRegion.extent.width, tileRegion.extent.height, tileRegion.extent.depth },
+                tileRegion.subresource.baseArrayLayer,
+                tileRegion.subresource.numArrayLayers,
+                tileRegion.subresource.baseMipLevel,
+                0,
+                0,
+                tileOffset
+            );
+
+            stagingOffset = tileOffset + dstTileDataSize;
+        }
+    );
+
+    /* Transfer image into sampling-ready state and submit remaining copies */
+    device_.TransitionImageLayout(
+        cmdBuffer,
+        image,
+        textureVK.GetVkFormat(),
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        subresource
+    );
+    device_.FlushCommandBuffer(cmdBuffer);
+    textureVK.SetState(subresource, g_uploadedTextureState);
+
+    /* Release staging buffer */
+    if (stagingBufferData != nullptr)
+    {
+        stagingBuffer.Unmap(device_);
+        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    }
+}
+
 void VKRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
 {
     //todo
@@ -578,7 +888,11 @@ void VKRenderSystem::Release(RenderTarget& renderTarget)
 Shader* VKRenderSystem::CreateShader(const ShaderDescriptor& desc)
 {
     AssertCreateShader(desc);
-    return TakeOwnership(shaders_, MakeUnique<VKShader>(device_, desc));
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+    return TakeOwnership(shaders_, MakeUnique<VKShader>(shaderModulePool_, &reflectionCache_, desc));
+    #else
+    return TakeOwnership(shaders_, MakeUnique<VKShader>(shaderModulePool_, nullptr, desc));
+    #endif
 }
 
 ShaderProgram* VKRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
@@ -601,12 +915,20 @@ void VKRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* VKRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return TakeOwnership(pipelineLayouts_, MakeUnique<VKPipelineLayout>(device_, desc));
+    /* Share pipeline layout with identical bindings */
+    if (auto pipelineLayout = pipelineLayoutCache_.Find(desc))
+        return pipelineLayout;
+
+    const auto maxDynamicUniformBuffers = physicalDevice_.GetProperties().limits.maxDescriptorSetUniformBuffersDynamic;
+    auto pipelineLayout = TakeOwnership(pipelineLayouts_, MakeUnique<VKPipelineLayout>(device_, desc, maxDynamicUniformBuffers));
+    pipelineLayoutCache_.Insert(desc, pipelineLayout);
+    return pipelineLayout;
 }
 
 void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
-    RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
+    if (pipelineLayoutCache_.Release(&pipelineLayout))
+        RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
 /* ----- Pipeline States ----- */
@@ -831,9 +1153,14 @@ void VKRenderSystem::CreateLogicalDevice()
     /* Create logical device with all supported physical device feature */
     device_ = physicalDevice_.CreateLogicalDevice();
 
-    /* Create command queue interface */
+    /* Create command queue interfaces; the compute and transfer queues are only created for dedicated queue families */
     commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
 
+    if (device_.GetVkQueue(CommandQueueType::Compute) != device_.GetVkQueue())
+        computeQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue(CommandQueueType::Compute));
+    if (device_.GetVkQueue(CommandQueueType::Transfer) != device_.GetVkQueue())
+        transferQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue(CommandQueueType::Transfer));
+
     /* Load Vulkan device extensions */
     VKLoadDeviceExtensions(device_, physicalDevice_.GetExtensionNames());
 }
@@ -909,6 +1236,38 @@ VKDeviceBuffer VKRenderSystem::CreateStagingBuffer(
     return stagingBuffer;
 }
 
+Buffer* VKRenderSystem::CreateDynamicBuffer(const BufferDescriptor& desc, const void* initialData)
+{
+    /* Create buffer with a ring of versions, aligned for dynamic uniform buffer offsets */
+    const auto versionAlignment = std::max(VkDeviceSize(1), physicalDevice_.GetProperties().limits.minUniformBufferOffsetAlignment);
+    auto buffer = TakeOwnership(buffers_, MakeUnique<VKBuffer>(device_, desc, versionAlignment));
+
+    /* Allocate host-visible device memory that stays mapped for the lifetime of the buffer */
+    auto memoryRegion = deviceMemoryMngr_->Allocate(
+        buffer->GetDeviceBuffer().GetRequirements(),
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    );
+    buffer->BindMemoryRegion(device_, memoryRegion);
+    buffer->MapVersions(device_, initialData);
+
+    return buffer;
+}
+
+void VKRenderSystem::OverwriteDynamicBuffer(VKBuffer& bufferVK)
+{
+    /* All versions are still in use, so wait for the GPU before the current version is overwritten */
+    device_.WaitIdle();
+    bufferVK.OverwriteVersion();
+}
+
+std::uint32_t VKRenderSystem::GetMaxNumFramesInFlight() const
+{
+    std::uint32_t numFramesInFlight = 0;
+    for (const auto& renderContext : renderContexts_)
+        numFramesInFlight = std::max(numFramesInFlight, renderContext->GetNumFramesInFlight());
+    return (numFramesInFlight > 0 ? numFramesInFlight : RenderContextDescriptor{}.maxFramesInFlight);
+}
+
 
 } // /namespace LLGL
 
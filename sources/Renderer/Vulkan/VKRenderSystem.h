@@ -13,6 +13,7 @@
 #include "VKPhysicalDevice.h"
 #include "VKDevice.h"
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
 #include "Memory/VKDeviceMemoryManager.h"
 
 #include "VKCommandQueue.h"
@@ -24,6 +25,11 @@
 
 #include "Shader/VKShader.h"
 #include "Shader/VKShaderProgram.h"
+#include "Shader/VKShaderModulePool.h"
+
+#ifdef LLGL_ENABLE_SPIRV_REFLECT
+#   include "../SPIRV/SPIRVReflectionCache.h"
+#endif
 
 #include "Texture/VKTexture.h"
 #include "Texture/VKSampler.h"
@@ -67,6 +73,7 @@ class VKRenderSystem final : public RenderSystem
         /* ----- Command queues ----- */
 
         CommandQueue* GetCommandQueue() override;
+        CommandQueue* GetCommandQueue(const CommandQueueType type) override;
 
         /* ----- Command buffers ----- */
 
@@ -94,6 +101,7 @@ class VKRenderSystem final : public RenderSystem
         void Release(Texture& texture) override;
 
         void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        void WriteTextureStreamed(Texture& texture, const TextureRegion& textureRegion, const StreamImageDescriptor& imageDesc) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
         /* ----- Sampler States ---- */
@@ -173,6 +181,12 @@ class VKRenderSystem final : public RenderSystem
             VkDeviceSize                dataSize
         );
 
+        Buffer* CreateDynamicBuffer(const BufferDescriptor& desc, const void* initialData);
+        void OverwriteDynamicBuffer(VKBuffer& bufferVK);
+
+        // Returns the maximal number of frames in flight of all render contexts, or the default number if there is no render context yet.
+        std::uint32_t GetMaxNumFramesInFlight() const;
+
     private:
 
         /* ----- Common objects ----- */
@@ -191,10 +205,18 @@ class VKRenderSystem final : public RenderSystem
 
         VKGraphicsPipelineLimits                gfxPipelineLimits_;
 
+        VKShaderModulePool                      shaderModulePool_;
+
+        #ifdef LLGL_ENABLE_SPIRV_REFLECT
+        SPIRVReflectionCache                    reflectionCache_;
+        #endif
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<VKRenderContext>      renderContexts_;
         HWObjectInstance<VKCommandQueue>        commandQueue_;
+        HWObjectInstance<VKCommandQueue>        computeQueue_;
+        HWObjectInstance<VKCommandQueue>        transferQueue_;
         HWObjectContainer<VKCommandBuffer>      commandBuffers_;
         HWObjectContainer<VKBuffer>             buffers_;
         HWObjectContainer<VKBufferArray>        bufferArrays_;
@@ -205,6 +227,7 @@ class VKRenderSystem final : public RenderSystem
         HWObjectContainer<VKShader>             shaders_;
         HWObjectContainer<VKShaderProgram>      shaderPrograms_;
         HWObjectContainer<VKPipelineLayout>     pipelineLayouts_;
+        PipelineLayoutCache                     pipelineLayoutCache_;
         HWObjectContainer<VKGraphicsPipeline>   graphicsPipelines_;
         HWObjectContainer<VKComputePipeline>    computePipelines_;
         HWObjectContainer<VKResourceHeap>       resourceHeaps_;
@@ -0,0 +1,249 @@
+/*
+ * VKResourceStateTracker.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKResourceStateTracker.h"
+#include "Buffer/VKBuffer.h"
+#include "Texture/VKTexture.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Returns true if the specified state denotes an access, i.e. it is not value-initialized.
+static bool IsAccessedState(const VKResourceState& state)
+{
+    return (state.layout != VK_IMAGE_LAYOUT_UNDEFINED || state.accessMask != 0 || state.stageMask != 0);
+}
+
+static bool IsEqualState(const VKResourceState& lhs, const VKResourceState& rhs)
+{
+    return (lhs.layout == rhs.layout && lhs.accessMask == rhs.accessMask && lhs.stageMask == rhs.stageMask);
+}
+
+/*
+Transitions the last state of a resource into the new state and returns true if this requires a barrier, which must wait on 'prevState'.
+The first access only stores the first state, which is transitioned when the recording is submitted.
+*/
+static bool TransitionTrackedState(VKResourceState& first, VKResourceState& last, const VKResourceState& newState, VKResourceState& prevState)
+{
+    if (!IsAccessedState(first))
+    {
+        first   = newState;
+        last    = newState;
+        return false;
+    }
+
+    const bool firstAccessOnly = IsEqualState(first, last);
+
+    if (VKPipelineBarrier::TransitionState(last, newState, prevState))
+        return true;
+
+    /* Read accesses that are merged into the first access must be waited for by the barrier of the submission as well */
+    if (firstAccessOnly)
+        first = last;
+
+    return false;
+}
+
+void VKResourceStateTracker::TransitionBuffer(VKPipelineBarrier* barrier, VKBuffer& buffer, const VKResourceState& newState)
+{
+    auto& state = GetBufferState(buffer);
+    VKResourceState prevState;
+    if (TransitionTrackedState(state.first, state.last, newState, prevState) && barrier != nullptr)
+        barrier->AppendBufferBarrier(buffer.GetVkBuffer(), prevState, newState);
+}
+
+void VKResourceStateTracker::TransitionTexture(
+    VKPipelineBarrier*          barrier,
+    VKTexture&                  texture,
+    const TextureSubresource&   subresource,
+    const VKResourceState&      newState)
+{
+    auto& trackedTexture = GetTextureStates(texture);
+
+    const auto numMipLevels = texture.GetNumMipLevels();
+    const auto mipEnd       = std::min(subresource.baseMipLevel + subresource.numMipLevels, numMipLevels);
+    const auto layerEnd     = std::min(subresource.baseArrayLayer + subresource.numArrayLayers, texture.GetNumArrayLayers());
+
+    /* Transition each subresource individually; the barrier merges adjacent MIP levels */
+    VkImageSubresourceRange range;
+    {
+        range.aspectMask    = texture.GetAspectFlags();
+        range.levelCount    = 1;
+        range.layerCount    = 1;
+    }
+
+    VKResourceState prevState;
+
+    for (auto arrayLayer = subresource.baseArrayLayer; arrayLayer < layerEnd; ++arrayLayer)
+    {
+        for (auto mipLevel = subresource.baseMipLevel; mipLevel < mipEnd; ++mipLevel)
+        {
+            auto& state = trackedTexture.subresourceStates[arrayLayer * numMipLevels + mipLevel];
+            if (TransitionTrackedState(state.first, state.last, newState, prevState) && barrier != nullptr)
+            {
+                range.baseMipLevel      = mipLevel;
+                range.baseArrayLayer    = arrayLayer;
+                barrier->AppendImageBarrier(texture.GetVkImage(), range, prevState, newState);
+            }
+        }
+    }
+}
+
+void VKResourceStateTracker::SetTextureState(VKTexture& texture, const TextureSubresource& subresource, const VKResourceState& state)
+{
+    auto& trackedTexture = GetTextureStates(texture);
+
+    const auto numMipLevels = texture.GetNumMipLevels();
+    const auto mipEnd       = std::min(subresource.baseMipLevel + subresource.numMipLevels, numMipLevels);
+    const auto layerEnd     = std::min(subresource.baseArrayLayer + subresource.numArrayLayers, texture.GetNumArrayLayers());
+
+    for (auto arrayLayer = subresource.baseArrayLayer; arrayLayer < layerEnd; ++arrayLayer)
+    {
+        for (auto mipLevel = subresource.baseMipLevel; mipLevel < mipEnd; ++mipLevel)
+        {
+            auto& trackedState = trackedTexture.subresourceStates[arrayLayer * numMipLevels + mipLevel];
+            if (!IsAccessedState(trackedState.first))
+                trackedState.first = state;
+            trackedState.last = state;
+        }
+    }
+}
+
+void VKResourceStateTracker::Append(VKPipelineBarrier& barrier, const VKResourceStateTracker& other)
+{
+    VKResourceState prevState;
+
+    for (const auto& trackedBuffer : other.buffers_)
+    {
+        /* Transition into the state the deferred command buffer begins with, then continue with the state it leaves the buffer in */
+        const auto& otherState = trackedBuffer.state;
+        auto& state = GetBufferState(*trackedBuffer.buffer);
+        if (TransitionTrackedState(state.first, state.last, otherState.first, prevState))
+            barrier.AppendBufferBarrier(trackedBuffer.buffer->GetVkBuffer(), prevState, otherState.first);
+        if (!IsEqualState(otherState.first, otherState.last))
+            state.last = otherState.last;
+    }
+
+    for (const auto& otherTexture : other.textures_)
+    {
+        auto texture = otherTexture.texture;
+        auto& trackedTexture = GetTextureStates(*texture);
+
+        const auto numMipLevels = texture->GetNumMipLevels();
+
+        VkImageSubresourceRange range;
+        {
+            range.aspectMask    = texture->GetAspectFlags();
+            range.levelCount    = 1;
+            range.layerCount    = 1;
+        }
+
+        for (std::size_t i = 0; i < otherTexture.subresourceStates.size(); ++i)
+        {
+            const auto& otherState = otherTexture.subresourceStates[i];
+            if (!IsAccessedState(otherState.first))
+                continue;
+
+            auto& state = trackedTexture.subresourceStates[i];
+            if (TransitionTrackedState(state.first, state.last, otherState.first, prevState))
+            {
+                range.baseMipLevel      = static_cast<std::uint32_t>(i % numMipLevels);
+                range.baseArrayLayer    = static_cast<std::uint32_t>(i / numMipLevels);
+                barrier.AppendImageBarrier(texture->GetVkImage(), range, prevState, otherState.first);
+            }
+            if (!IsEqualState(otherState.first, otherState.last))
+                state.last = otherState.last;
+        }
+    }
+}
+
+void VKResourceStateTracker::Resolve(VKPipelineBarrier& barrier) const
+{
+    /* Resources that have only been read keep the accesses of previous submissions, so later writes wait for all of them */
+    for (const auto& trackedBuffer : buffers_)
+    {
+        const auto& state = trackedBuffer.state;
+        trackedBuffer.buffer->TransitionState(barrier, state.first);
+        if (!IsEqualState(state.first, state.last))
+            trackedBuffer.buffer->SetState(state.last);
+    }
+
+    for (const auto& trackedTexture : textures_)
+    {
+        const auto numMipLevels = trackedTexture.texture->GetNumMipLevels();
+
+        for (std::size_t i = 0; i < trackedTexture.subresourceStates.size(); ++i)
+        {
+            const auto& state = trackedTexture.subresourceStates[i];
+            if (!IsAccessedState(state.first))
+                continue;
+
+            const TextureSubresource subresource
+            {
+                static_cast<std::uint32_t>(i / numMipLevels), 1,
+                static_cast<std::uint32_t>(i % numMipLevels), 1
+            };
+            trackedTexture.texture->TransitionState(barrier, subresource, state.first);
+            if (!IsEqualState(state.first, state.last))
+                trackedTexture.texture->SetState(subresource, state.last);
+        }
+    }
+}
+
+bool VKResourceStateTracker::HasBuffer(const VKBuffer& buffer) const
+{
+    return (bufferIndices_.find(&buffer) != bufferIndices_.end());
+}
+
+void VKResourceStateTracker::Reset()
+{
+    buffers_.clear();
+    textures_.clear();
+    bufferIndices_.clear();
+    textureIndices_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKResourceStateTracker::TrackedState& VKResourceStateTracker::GetBufferState(VKBuffer& buffer)
+{
+    auto it = bufferIndices_.find(&buffer);
+    if (it != bufferIndices_.end())
+        return buffers_[it->second].state;
+
+    bufferIndices_[&buffer] = buffers_.size();
+    buffers_.push_back({ &buffer, TrackedState{} });
+
+    return buffers_.back().state;
+}
+
+VKResourceStateTracker::TrackedTexture& VKResourceStateTracker::GetTextureStates(VKTexture& texture)
+{
+    auto it = textureIndices_.find(&texture);
+    if (it != textureIndices_.end())
+        return textures_[it->second];
+
+    const auto numSubresources = static_cast<std::size_t>(texture.GetNumMipLevels()) * texture.GetNumArrayLayers();
+
+    textureIndices_[&texture] = textures_.size();
+    textures_.push_back({ &texture, std::vector<TrackedState>(numSubresources) });
+
+    return textures_.back();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
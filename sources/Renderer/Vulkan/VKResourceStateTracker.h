@@ -0,0 +1,111 @@
+/*
+ * VKResourceStateTracker.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_RESOURCE_STATE_TRACKER_H
+#define LLGL_VK_RESOURCE_STATE_TRACKER_H
+
+
+#include <LLGL/TextureFlags.h>
+#include "VKPipelineBarrier.h"
+#include <unordered_map>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKBuffer;
+class VKTexture;
+
+/*
+Tracks the states of all resources a single command buffer recording accesses.
+The first access of each resource (or texture subresource) does not record a barrier, but is resolved when the recording is submitted,
+since the state a resource is left in by previous submissions is unknown at encoding time (see Resolve).
+All further accesses are transitioned from the state the recording has left the resource in.
+*/
+class VKResourceStateTracker
+{
+
+    public:
+
+        /*
+        Transitions the buffer into the new state and appends a barrier if required.
+        If 'barrier' is null, the transition is only tracked, which is used by deferred command buffers that must not record barriers.
+        */
+        void TransitionBuffer(VKPipelineBarrier* barrier, VKBuffer& buffer, const VKResourceState& newState);
+
+        // Transitions the texture subresources into the new state and appends the required image barriers.
+        void TransitionTexture(
+            VKPipelineBarrier*          barrier,
+            VKTexture&                  texture,
+            const TextureSubresource&   subresource,
+            const VKResourceState&      newState
+        );
+
+        // Overrides the tracked state of the specified texture subresources, e.g. after a command has transitioned their image layout.
+        void SetTextureState(VKTexture& texture, const TextureSubresource& subresource, const VKResourceState& state);
+
+        // Appends the states of a deferred command buffer that is executed after all commands that have been tracked so far.
+        void Append(VKPipelineBarrier& barrier, const VKResourceStateTracker& other);
+
+        /*
+        Transitions the states of all tracked resources, which were left by previous submissions, into the states this recording begins with,
+        and then stores the states this recording leaves them in. Must be called in the order the recordings are submitted.
+        */
+        void Resolve(VKPipelineBarrier& barrier) const;
+
+        // Returns true if the specified buffer has been accessed by this recording.
+        bool HasBuffer(const VKBuffer& buffer) const;
+
+        // Clears all tracked states.
+        void Reset();
+
+    private:
+
+        // States of a resource at its first and last access within the recording.
+        struct TrackedState
+        {
+            VKResourceState first;
+            VKResourceState last;
+        };
+
+        struct TrackedBuffer
+        {
+            VKBuffer*       buffer;
+            TrackedState    state;
+        };
+
+        struct TrackedTexture
+        {
+            VKTexture*                  texture;
+            std::vector<TrackedState>   subresourceStates; // tracked state per MIP level and array layer
+        };
+
+    private:
+
+        TrackedState& GetBufferState(VKBuffer& buffer);
+        TrackedTexture& GetTextureStates(VKTexture& texture);
+
+    private:
+
+        std::vector<TrackedBuffer>                          buffers_;
+        std::vector<TrackedTexture>                         textures_;
+        std::unordered_map<const VKBuffer*, std::size_t>    bufferIndices_;
+        std::unordered_map<const VKTexture*, std::size_t>   textureIndices_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
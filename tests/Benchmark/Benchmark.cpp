@@ -0,0 +1,203 @@
+/*
+ * Benchmark.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+
+
+/*
+ * Benchmark class
+ */
+
+Benchmark::Benchmark(const BenchmarkConfig& config, BenchmarkRun& run) :
+    config_ { config },
+    run_    { run    }
+{
+}
+
+bool Benchmark::IsEnabled(const std::string& name) const
+{
+    return (config_.filter.empty() || name.find(config_.filter) != std::string::npos);
+}
+
+void Benchmark::Measure(
+    const std::string&      name,
+    std::uint64_t           iterations,
+    const BodyCallback&     body,
+    const SampleCallback&   beginSample,
+    const SampleCallback&   endSample)
+{
+    if (!IsEnabled(name))
+        return;
+
+    iterations = std::max<std::uint64_t>(1, iterations);
+
+    std::vector<double> nsPerCall;
+    nsPerCall.reserve(config_.samples);
+
+    try
+    {
+        /* Run one warm-up sample that is not recorded, then all measured samples */
+        for (std::uint32_t i = 0; i <= config_.samples; ++i)
+        {
+            if (beginSample)
+                beginSample();
+
+            const auto startTime = std::chrono::high_resolution_clock::now();
+            {
+                body(iterations);
+            }
+            const auto endTime = std::chrono::high_resolution_clock::now();
+
+            if (endSample)
+                endSample();
+
+            if (i > 0)
+            {
+                const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+                nsPerCall.push_back(static_cast<double>(duration) / static_cast<double>(iterations));
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Skip(name, e.what());
+        return;
+    }
+
+    if (nsPerCall.empty())
+        return;
+
+    /* Store median, minimum, and maximum of all samples */
+    std::sort(nsPerCall.begin(), nsPerCall.end());
+
+    BenchmarkResult result;
+    {
+        result.name         = name;
+        result.iterations   = iterations;
+        result.samples      = static_cast<std::uint32_t>(nsPerCall.size());
+        result.nsPerCall    = nsPerCall[nsPerCall.size() / 2];
+        result.minNsPerCall = nsPerCall.front();
+        result.maxNsPerCall = nsPerCall.back();
+    }
+    run_.results.push_back(result);
+}
+
+void Benchmark::Skip(const std::string& name, const std::string& reason)
+{
+    if (IsEnabled(name))
+        run_.skipped.push_back({ name, reason });
+}
+
+
+/*
+ * Global functions
+ */
+
+void PrintBenchmarkRun(std::ostream& s, const BenchmarkRun& run)
+{
+    s << run.module;
+    if (!run.rendererName.empty())
+        s << " (" << run.rendererName << ", " << run.deviceName << ')';
+    s << (run.debugLayer ? " with debug layer" : "") << '\n';
+
+    /* Determine width of the name column */
+    std::size_t nameWidth = 0;
+    for (const auto& result : run.results)
+        nameWidth = std::max(nameWidth, result.name.size());
+
+    for (const auto& result : run.results)
+    {
+        s << "  " << std::left << std::setw(static_cast<int>(nameWidth)) << result.name;
+        s << std::right << std::fixed << std::setprecision(1);
+        s << std::setw(12) << result.nsPerCall << " ns/call";
+        s << "  (min " << result.minNsPerCall << ", max " << result.maxNsPerCall << ")\n";
+    }
+
+    for (const auto& skip : run.skipped)
+        s << "  " << std::left << std::setw(static_cast<int>(nameWidth)) << skip.name << "  skipped: " << skip.reason << '\n';
+
+    s << std::endl;
+}
+
+static void WriteJSONString(std::ostream& s, const std::string& str)
+{
+    s << '\"';
+    for (auto c : str)
+    {
+        switch (c)
+        {
+            case '\"':  s << "\\\""; break;
+            case '\\':  s << "\\\\"; break;
+            case '\n':  s << "\\n";  break;
+            case '\r':  s << "\\r";  break;
+            case '\t':  s << "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    s << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+                else
+                    s << c;
+                break;
+        }
+    }
+    s << '\"';
+}
+
+void WriteBenchmarkJSON(std::ostream& s, const BenchmarkConfig& config, const std::vector<BenchmarkRun>& runs)
+{
+    s << std::fixed << std::setprecision(3);
+    s << "{\n";
+    s << "  \"iterations\": " << config.iterations << ",\n";
+    s << "  \"samples\": " << config.samples << ",\n";
+    s << "  \"runs\": [";
+
+    for (std::size_t i = 0; i < runs.size(); ++i)
+    {
+        const auto& run = runs[i];
+
+        s << (i > 0 ? ",\n" : "\n") << "    {\n";
+        s << "      \"module\": "; WriteJSONString(s, run.module); s << ",\n";
+        s << "      \"renderer\": "; WriteJSONString(s, run.rendererName); s << ",\n";
+        s << "      \"device\": "; WriteJSONString(s, run.deviceName); s << ",\n";
+        s << "      \"debugLayer\": " << (run.debugLayer ? "true" : "false") << ",\n";
+        s << "      \"results\": [";
+
+        for (std::size_t j = 0; j < run.results.size(); ++j)
+        {
+            const auto& result = run.results[j];
+            s << (j > 0 ? ",\n" : "\n") << "        { \"name\": "; WriteJSONString(s, result.name);
+            s << ", \"iterations\": " << result.iterations;
+            s << ", \"samples\": " << result.samples;
+            s << ", \"nsPerCall\": " << result.nsPerCall;
+            s << ", \"minNsPerCall\": " << result.minNsPerCall;
+            s << ", \"maxNsPerCall\": " << result.maxNsPerCall << " }";
+        }
+
+        s << (run.results.empty() ? "],\n" : "\n      ],\n");
+        s << "      \"skipped\": [";
+
+        for (std::size_t j = 0; j < run.skipped.size(); ++j)
+        {
+            const auto& skip = run.skipped[j];
+            s << (j > 0 ? ",\n" : "\n") << "        { \"name\": "; WriteJSONString(s, skip.name);
+            s << ", \"reason\": "; WriteJSONString(s, skip.reason); s << " }";
+        }
+
+        s << (run.skipped.empty() ? "]\n" : "\n      ]\n");
+        s << "    }";
+    }
+
+    s << (runs.empty() ? "]\n" : "\n  ]\n");
+    s << "}\n";
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,113 @@
+/*
+ * Benchmark.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_BENCHMARK_H
+#define LLGL_BENCHMARK_H
+
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+// Configuration of all benchmarks, specified by the command line.
+struct BenchmarkConfig
+{
+    std::uint64_t   iterations  = 10000;    // Number of calls per sample for command buffer benchmarks.
+    std::uint32_t   samples     = 5;        // Number of measured samples per benchmark (after one warm-up sample).
+    std::string     filter;                 // Only run benchmarks whose names contain this string.
+    std::string     shaderPath;             // Directory of the shader files, which are copied next to the benchmark executable.
+};
+
+// Result of a single benchmark. All timings are given in nanoseconds per call.
+struct BenchmarkResult
+{
+    std::string     name;
+    std::uint64_t   iterations      = 0;
+    std::uint32_t   samples         = 0;
+    double          nsPerCall       = 0.0;  // Median over all samples.
+    double          minNsPerCall    = 0.0;
+    double          maxNsPerCall    = 0.0;
+};
+
+// Benchmark that could not be run, e.g. due to a missing renderer feature.
+struct BenchmarkSkip
+{
+    std::string     name;
+    std::string     reason;
+};
+
+// All benchmark results of a single render system module, either with or without the debug layer.
+struct BenchmarkRun
+{
+    std::string                     module;
+    std::string                     rendererName;
+    std::string                     deviceName;
+    bool                            debugLayer  = false;
+    std::vector<BenchmarkResult>    results;
+    std::vector<BenchmarkSkip>      skipped;
+};
+
+/*
+Micro-benchmark harness that measures the CPU time per call of the specified callbacks.
+Each sample is preceded by 'beginSample' and followed by 'endSample', which are not included in the measured time.
+*/
+class Benchmark
+{
+
+    public:
+
+        // Callback that must perform the specified number of calls.
+        using BodyCallback   = std::function<void(std::uint64_t iterations)>;
+        using SampleCallback = std::function<void()>;
+
+    public:
+
+        Benchmark(const BenchmarkConfig& config, BenchmarkRun& run);
+
+        // Returns true if the specified benchmark passes the filter of the configuration.
+        bool IsEnabled(const std::string& name) const;
+
+        // Measures the specified benchmark. Exceptions thrown by any of the callbacks are recorded as skipped benchmark.
+        void Measure(
+            const std::string&      name,
+            std::uint64_t           iterations,
+            const BodyCallback&     body,
+            const SampleCallback&   beginSample = nullptr,
+            const SampleCallback&   endSample   = nullptr
+        );
+
+        // Records the specified benchmark as skipped.
+        void Skip(const std::string& name, const std::string& reason);
+
+        // Returns the benchmark configuration.
+        inline const BenchmarkConfig& GetConfig() const
+        {
+            return config_;
+        }
+
+    private:
+
+        const BenchmarkConfig&  config_;
+        BenchmarkRun&           run_;
+
+};
+
+// Prints the results of the specified benchmark run as human readable table.
+void PrintBenchmarkRun(std::ostream& s, const BenchmarkRun& run);
+
+// Writes all benchmark runs in the JSON format.
+void WriteBenchmarkJSON(std::ostream& s, const BenchmarkConfig& config, const std::vector<BenchmarkRun>& runs);
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,938 @@
+/*
+ * Main.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Benchmark.h"
+#include "../../sources/Core/WorkerPool.h"
+#include <LLGL/LLGL.h>
+#include <LLGL/Utility.h>
+#include <LLGL/VertexFormat.h>
+#include <LLGL/IndirectArguments.h>
+#include <LLGL/RenderGraph.h>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <cstdlib>
+#include <cstring>
+
+
+/*
+ * Renderer benchmarks
+ */
+
+// GLSL shaders that are used if the renderer supports GLSL. Otherwise, the pre-compiled SPIR-V modules of 'Test_Vulkan' are used.
+static const char* g_vertexShaderGLSL =
+    "#version 330\n"
+    "uniform vec4 color;\n"
+    "in vec2 coord;\n"
+    "in vec2 texCoord;\n"
+    "in vec3 vertColor;\n"
+    "out vec4 vColor;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(coord + texCoord * 0.0, 0.0, 1.0);\n"
+    "    vColor = vec4(vertColor, 1.0) * color;\n"
+    "}\n";
+
+static const char* g_fragmentShaderGLSL =
+    "#version 330\n"
+    "in vec4 vColor;\n"
+    "out vec4 fColor;\n"
+    "void main() {\n"
+    "    fColor = vColor;\n"
+    "}\n";
+
+class RendererBenchmark
+{
+
+    public:
+
+        RendererBenchmark(const std::string& module, bool debugLayer, const BenchmarkConfig& config, BenchmarkRun& run) :
+            benchmark_  { config, run },
+            debugLayer_ { debugLayer  }
+        {
+            /* Load render system, optionally with the debug layer */
+            LLGL::RenderSystemDescriptor renderSystemDesc;
+            renderSystemDesc.moduleName = module;
+
+            if (debugLayer)
+                renderer_ = LLGL::RenderSystem::Load(renderSystemDesc, &profiler_, &debugger_);
+            else
+                renderer_ = LLGL::RenderSystem::Load(renderSystemDesc);
+
+            run.rendererName    = renderer_->GetRendererInfo().rendererName;
+            run.deviceName      = renderer_->GetRendererInfo().deviceName;
+
+            /* Create render context and command buffer */
+            LLGL::RenderContextDescriptor contextDesc;
+            {
+                contextDesc.videoMode.resolution = { 640, 480 };
+            }
+            context_        = renderer_->CreateRenderContext(contextDesc);
+            commandQueue_   = renderer_->GetCommandQueue();
+            commands_       = renderer_->CreateCommandBuffer();
+
+            CreateResources();
+        }
+
+        ~RendererBenchmark()
+        {
+            LLGL::RenderSystem::Unload(std::move(renderer_));
+        }
+
+        void Run()
+        {
+            RunCommandBufferBenchmarks();
+            RunParallelEncodingBenchmarks();
+            RunCommandQueueBenchmarks();
+            RunRenderGraphBenchmarks();
+            RunRenderSystemBenchmarks();
+            RunShaderReflectionBenchmarks();
+        }
+
+    private:
+
+        void CreateResources()
+        {
+            const auto& caps = renderer_->GetRenderingCaps();
+
+            /* Create vertex, index, constant, and indirect argument buffers */
+            vertexFormat_.AppendAttribute({ "coord",     LLGL::Format::RG32Float  });
+            vertexFormat_.AppendAttribute({ "texCoord",  LLGL::Format::RG32Float  });
+            vertexFormat_.AppendAttribute({ "vertColor", LLGL::Format::RGB32Float });
+
+            const float vertices[] =
+            {
+                 0.0f,  0.5f,   0.0f, 0.0f,   1.0f, 0.0f, 0.0f,
+                 0.5f, -0.5f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+                -0.5f, -0.5f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+            };
+            vertexBuffer_ = renderer_->CreateBuffer(LLGL::VertexBufferDesc(sizeof(vertices), vertexFormat_), vertices);
+
+            const std::uint32_t indices[] = { 0, 1, 2 };
+            indexBuffer_ = renderer_->CreateBuffer(LLGL::IndexBufferDesc(sizeof(indices), LLGL::Format::R32UInt), indices);
+
+            constantBuffer_ = renderer_->CreateBuffer(LLGL::ConstantBufferDesc(256));
+
+            if (caps.features.hasIndirectDrawing)
+            {
+                const LLGL::DrawIndexedIndirectArguments args = { 3, 1, 0, 0, 0 };
+                LLGL::BufferDescriptor indirectBufferDesc;
+                {
+                    indirectBufferDesc.size         = sizeof(args);
+                    indirectBufferDesc.bindFlags    = LLGL::BindFlags::IndirectBuffer;
+                }
+                indirectBuffer_ = renderer_->CreateBuffer(indirectBufferDesc, &args);
+            }
+
+            /* Create texture and sampler */
+            texture_ = renderer_->CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA8UNorm, 4, 4));
+            sampler_ = renderer_->CreateSampler({});
+
+            /* Create pipeline layout with the same binding points as the SPIR-V shaders */
+            pipelineLayoutDesc_ = LLGL::PipelineLayoutDesc("cbuffer(2):vert, sampler(3):frag, texture(4):frag, cbuffer(5):frag");
+            pipelineLayout_     = renderer_->CreatePipelineLayout(pipelineLayoutDesc_);
+
+            resourceHeapDesc_.pipelineLayout    = pipelineLayout_;
+            resourceHeapDesc_.resourceViews     = { constantBuffer_, sampler_, texture_, constantBuffer_ };
+            resourceHeap_                       = renderer_->CreateResourceHeap(resourceHeapDesc_);
+
+            /* Create shader program and graphics pipeline */
+            CreateShaderProgram();
+
+            pipelineDesc_.shaderProgram     = shaderProgram_;
+            pipelineDesc_.renderPass        = context_->GetRenderPass();
+            pipelineDesc_.pipelineLayout    = pipelineLayout_;
+            pipeline_                       = renderer_->CreateGraphicsPipeline(pipelineDesc_);
+        }
+
+        void CreateShaderProgram()
+        {
+            const auto& languages = renderer_->GetRenderingCaps().shadingLanguages;
+            auto IsSupported = [&languages](LLGL::ShadingLanguage language)
+            {
+                return (std::find(languages.begin(), languages.end(), language) != languages.end());
+            };
+
+            LLGL::ShaderDescriptor vertShaderDesc, fragShaderDesc;
+
+            const auto vertShaderFilename = benchmark_.GetConfig().shaderPath + "Triangle.vert.spv";
+            const auto fragShaderFilename = benchmark_.GetConfig().shaderPath + "Triangle.frag.spv";
+
+            if (IsSupported(LLGL::ShadingLanguage::GLSL))
+            {
+                vertShaderDesc = { LLGL::ShaderType::Vertex,   g_vertexShaderGLSL   };
+                fragShaderDesc = { LLGL::ShaderType::Fragment, g_fragmentShaderGLSL };
+                vertShaderDesc.sourceType = LLGL::ShaderSourceType::CodeString;
+                fragShaderDesc.sourceType = LLGL::ShaderSourceType::CodeString;
+            }
+            else if (IsSupported(LLGL::ShadingLanguage::SPIRV))
+            {
+                vertShaderDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   vertShaderFilename.c_str());
+                fragShaderDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, fragShaderFilename.c_str());
+            }
+            else
+                throw std::runtime_error("renderer supports neither GLSL nor SPIR-V");
+
+            vertShaderDesc.vertex.inputAttribs      = vertexFormat_.attributes;
+            fragShaderDesc.fragment.outputAttribs   = { { "fColor", LLGL::Format::RGBA8UNorm, 0 } };
+
+            auto vertShader = renderer_->CreateShader(vertShaderDesc);
+            auto fragShader = renderer_->CreateShader(fragShaderDesc);
+
+            for (auto shader : { vertShader, fragShader })
+            {
+                if (shader->HasErrors())
+                    throw std::runtime_error(shader->GetReport());
+            }
+
+            shaderProgram_ = renderer_->CreateShaderProgram(LLGL::ShaderProgramDesc({ vertShader, fragShader }));
+            if (shaderProgram_->HasErrors())
+                throw std::runtime_error(shaderProgram_->GetReport());
+        }
+
+        // Measures the specified command buffer calls, optionally inside a render pass with all resources bound.
+        void MeasureCommands(const std::string& name, bool insideRenderPass, const Benchmark::BodyCallback& body)
+        {
+            benchmark_.Measure(
+                "CommandBuffer." + name,
+                benchmark_.GetConfig().iterations,
+                body,
+                [this, insideRenderPass]()
+                {
+                    commands_->Begin();
+                    if (insideRenderPass)
+                    {
+                        commands_->BeginRenderPass(*context_);
+                        commands_->SetViewport(context_->GetResolution());
+                        commands_->SetGraphicsPipeline(*pipeline_);
+                        commands_->SetVertexBuffer(*vertexBuffer_);
+                        commands_->SetIndexBuffer(*indexBuffer_);
+                        commands_->SetGraphicsResourceHeap(*resourceHeap_);
+                    }
+                },
+                [this, insideRenderPass]()
+                {
+                    if (insideRenderPass)
+                        commands_->EndRenderPass();
+                    commands_->End();
+                    commandQueue_->Submit(*commands_);
+                    commandQueue_->WaitIdle();
+                }
+            );
+        }
+
+        void RunCommandBufferBenchmarks()
+        {
+            const auto& features = renderer_->GetRenderingCaps().features;
+            const LLGL::Viewport viewport{ 0.0f, 0.0f, 640.0f, 480.0f };
+            const LLGL::Scissor scissor{ 0, 0, 640, 480 };
+            const float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+            /* Binding commands */
+            MeasureCommands("SetViewport", true, [&](std::uint64_t n) { while (n--) commands_->SetViewport(viewport); });
+            MeasureCommands("SetScissor", true, [&](std::uint64_t n) { while (n--) commands_->SetScissor(scissor); });
+            MeasureCommands("SetVertexBuffer", true, [&](std::uint64_t n) { while (n--) commands_->SetVertexBuffer(*vertexBuffer_); });
+            MeasureCommands("SetIndexBuffer", true, [&](std::uint64_t n) { while (n--) commands_->SetIndexBuffer(*indexBuffer_); });
+            MeasureCommands("SetGraphicsPipeline", true, [&](std::uint64_t n) { while (n--) commands_->SetGraphicsPipeline(*pipeline_); });
+            MeasureCommands("SetGraphicsResourceHeap", true, [&](std::uint64_t n) { while (n--) commands_->SetGraphicsResourceHeap(*resourceHeap_); });
+
+            if (features.hasDirectResourceBinding)
+            {
+                MeasureCommands(
+                    "SetResource", true,
+                    [&](std::uint64_t n)
+                    {
+                        while (n--)
+                            commands_->SetResource(*constantBuffer_, 2, LLGL::BindFlags::ConstantBuffer, LLGL::StageFlags::VertexStage);
+                    }
+                );
+            }
+            else
+                benchmark_.Skip("CommandBuffer.SetResource", "direct resource binding not supported");
+
+            if (features.hasUniforms)
+            {
+                const auto location = std::max(0, shaderProgram_->FindUniformLocation("color"));
+                MeasureCommands("SetUniforms", true, [&](std::uint64_t n) { while (n--) commands_->SetUniforms(location, 1, color, sizeof(color)); });
+            }
+            else
+                benchmark_.Skip("CommandBuffer.SetUniforms", "uniforms not supported");
+
+            /* Buffer update commands; these must be encoded outside of a render pass */
+            MeasureCommands("UpdateBuffer", false, [&](std::uint64_t n) { while (n--) commands_->UpdateBuffer(*constantBuffer_, 0, color, sizeof(color)); });
+
+            /* Clear commands */
+            MeasureCommands("SetClearColor", true, [&](std::uint64_t n) { while (n--) commands_->SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f }); });
+            MeasureCommands("Clear", true, [&](std::uint64_t n) { while (n--) commands_->Clear(LLGL::ClearFlags::Color); });
+
+            /* Draw commands */
+            MeasureCommands("Draw", true, [&](std::uint64_t n) { while (n--) commands_->Draw(3, 0); });
+            MeasureCommands("DrawIndexed", true, [&](std::uint64_t n) { while (n--) commands_->DrawIndexed(3, 0); });
+            MeasureCommands("DrawInstanced", true, [&](std::uint64_t n) { while (n--) commands_->DrawInstanced(3, 0, 2); });
+            MeasureCommands("DrawIndexedInstanced", true, [&](std::uint64_t n) { while (n--) commands_->DrawIndexedInstanced(3, 2, 0); });
+
+            if (indirectBuffer_ != nullptr)
+            {
+                MeasureCommands("DrawIndirect", true, [&](std::uint64_t n) { while (n--) commands_->DrawIndirect(*indirectBuffer_, 0); });
+                MeasureCommands("DrawIndexedIndirect", true, [&](std::uint64_t n) { while (n--) commands_->DrawIndexedIndirect(*indirectBuffer_, 0); });
+            }
+            else
+            {
+                benchmark_.Skip("CommandBuffer.DrawIndirect", "indirect drawing not supported");
+                benchmark_.Skip("CommandBuffer.DrawIndexedIndirect", "indirect drawing not supported");
+            }
+
+            /* Debug groups */
+            MeasureCommands(
+                "PushPopDebugGroup", true,
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                    {
+                        commands_->PushDebugGroup("Benchmark");
+                        commands_->PopDebugGroup();
+                    }
+                }
+            );
+
+            /* Encoding of an entire command buffer (without any commands) */
+            benchmark_.Measure(
+                "CommandBuffer.BeginEnd",
+                benchmark_.GetConfig().iterations / 10,
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                    {
+                        commands_->Begin();
+                        commands_->End();
+                    }
+                }
+            );
+        }
+
+        // Encodes the specified number of draw commands into a deferred command buffer that continues the render pass of the primary command buffer.
+        void EncodeDeferredDraws(LLGL::CommandBuffer& commands, std::uint64_t numDraws)
+        {
+            commands.Begin();
+            {
+                commands.SetViewport(context_->GetResolution());
+                commands.SetGraphicsPipeline(*pipeline_);
+                commands.SetVertexBuffer(*vertexBuffer_);
+                commands.SetIndexBuffer(*indexBuffer_);
+                commands.SetGraphicsResourceHeap(*resourceHeap_);
+
+                while (numDraws--)
+                    commands.DrawIndexed(3, 0);
+            }
+            commands.End();
+        }
+
+        // Measures the encoding of a render pass that is split into deferred command buffers, which are encoded by 1, 2, 4, and 8 threads.
+        void RunParallelEncodingBenchmarks()
+        {
+            const std::uint32_t maxNumThreads = 8;
+            const std::string name = "CommandBuffer.ParallelEncoding.DrawIndexed";
+
+            if (debugLayer_)
+            {
+                benchmark_.Skip(name, "debug layer does not support encoding from multiple threads");
+                return;
+            }
+
+            /* Create one deferred command buffer per thread */
+            LLGL::CommandBufferDescriptor deferredCmdBufferDesc;
+            {
+                deferredCmdBufferDesc.flags         = LLGL::CommandBufferFlags::DeferredSubmit;
+                deferredCmdBufferDesc.renderPass    = context_->GetRenderPass();
+            }
+
+            std::vector<LLGL::CommandBuffer*> deferredCommands;
+            for (std::uint32_t i = 0; i < maxNumThreads; ++i)
+                deferredCommands.push_back(renderer_->CreateCommandBuffer(deferredCmdBufferDesc));
+
+            /* Use the same worker pool as the render graph, so thread creation is not included in the measured time */
+            LLGL::WorkerPool workers;
+
+            for (std::uint32_t numThreads = 1; numThreads <= maxNumThreads; numThreads *= 2)
+            {
+                benchmark_.Measure(
+                    name + "." + std::to_string(numThreads) + "Threads",
+                    benchmark_.GetConfig().iterations,
+                    [&](std::uint64_t n)
+                    {
+                        /* Distribute draw commands over all threads and execute the deferred command buffers in order */
+                        workers.Run(
+                            numThreads,
+                            [&](std::size_t workerIndex)
+                            {
+                                EncodeDeferredDraws(*deferredCommands[workerIndex], (n + workerIndex) / numThreads);
+                            }
+                        );
+                        for (std::uint32_t i = 0; i < numThreads; ++i)
+                            commands_->Execute(*deferredCommands[i]);
+                    },
+                    [this]()
+                    {
+                        commands_->Begin();
+                        commands_->BeginRenderPass(*context_);
+                    },
+                    [this]()
+                    {
+                        commands_->EndRenderPass();
+                        commands_->End();
+                        commandQueue_->Submit(*commands_);
+                        commandQueue_->WaitIdle();
+                    }
+                );
+            }
+
+            for (auto cmdBuffer : deferredCommands)
+                renderer_->Release(*cmdBuffer);
+        }
+
+        // Measures the submission of several command buffers, one at a time and as a single batch.
+        void RunCommandQueueBenchmarks()
+        {
+            const std::uint32_t numCmdBuffers = 8;
+            const std::string suffix = "." + std::to_string(numCmdBuffers) + "CommandBuffers";
+            const auto iterations = std::max<std::uint64_t>(1, benchmark_.GetConfig().iterations / 100);
+
+            std::vector<LLGL::CommandBuffer*> cmdBuffers(numCmdBuffers);
+            for (auto& cmdBuffer : cmdBuffers)
+                cmdBuffer = renderer_->CreateCommandBuffer();
+
+            /* Command buffers must be encoded again before each submission */
+            auto encodeCmdBuffers = [&]()
+            {
+                for (auto cmdBuffer : cmdBuffers)
+                {
+                    cmdBuffer->Begin();
+                    cmdBuffer->End();
+                }
+            };
+
+            benchmark_.Measure(
+                "CommandQueue.Submit" + suffix,
+                iterations,
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                    {
+                        encodeCmdBuffers();
+                        for (auto cmdBuffer : cmdBuffers)
+                            commandQueue_->Submit(*cmdBuffer);
+                    }
+                },
+                nullptr,
+                [this]() { commandQueue_->WaitIdle(); }
+            );
+
+            benchmark_.Measure(
+                "CommandQueue.SubmitBatched" + suffix,
+                iterations,
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                    {
+                        encodeCmdBuffers();
+                        commandQueue_->Submit(numCmdBuffers, cmdBuffers.data());
+                    }
+                },
+                nullptr,
+                [this]() { commandQueue_->WaitIdle(); }
+            );
+
+            for (auto cmdBuffer : cmdBuffers)
+                renderer_->Release(*cmdBuffer);
+        }
+
+        // Declares a deferred shading frame with a culled debug pass, two merged G-buffer passes, and a bloom chain with aliased textures.
+        void DeclareRenderGraph(LLGL::RenderGraph& renderGraph)
+        {
+            const auto resolution = context_->GetResolution();
+            const auto depthBindFlags = (LLGL::BindFlags::DepthStencilAttachment | LLGL::BindFlags::Sampled);
+
+            renderGraph.Reset();
+
+            auto shadowMap  = renderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::D32Float, 1024, 1024, depthBindFlags), "ShadowMap");
+            auto gBuffer    = renderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA8UNorm, resolution.width, resolution.height), "GBuffer");
+            auto depth      = renderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::D32Float, resolution.width, resolution.height, depthBindFlags), "Depth");
+            auto hdr        = renderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA16Float, resolution.width, resolution.height), "HDR");
+            auto debugView  = renderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA8UNorm, resolution.width, resolution.height), "DebugView");
+            auto bloom0     = renderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA16Float, resolution.width / 2, resolution.height / 2), "Bloom0");
+            auto bloom1     = renderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA16Float, resolution.width / 2, resolution.height / 2), "Bloom1");
+            auto bloom2     = renderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA16Float, resolution.width / 2, resolution.height / 2), "Bloom2");
+            auto screen     = renderGraph.ImportRenderTarget(*context_, "Screen");
+
+            auto AddPass = [&renderGraph](
+                const char*                                         name,
+                const std::vector<LLGL::RenderGraphAttachment>&     attachments,
+                const std::vector<LLGL::RenderGraphResource>&       reads)
+            {
+                LLGL::RenderGraphPassDescriptor passDesc;
+                {
+                    passDesc.name           = name;
+                    passDesc.attachments    = attachments;
+                    passDesc.reads          = reads;
+                }
+                renderGraph.AddPass(passDesc, [](LLGL::CommandBuffer& /*commands*/) {});
+            };
+
+            const auto clear = LLGL::AttachmentLoadOp::Clear;
+
+            AddPass("Shadow",       { { LLGL::AttachmentType::Depth, shadowMap, clear } },                                  {});
+            AddPass("GBuffer",      { { LLGL::AttachmentType::Color, gBuffer, clear }, { LLGL::AttachmentType::Depth, depth, clear } }, {});
+            AddPass("Decals",       { { LLGL::AttachmentType::Color, gBuffer }, { LLGL::AttachmentType::Depth, depth } },   {});
+            AddPass("Lighting",     { { LLGL::AttachmentType::Color, hdr, clear } },                                        { gBuffer, depth, shadowMap });
+            AddPass("DebugView",    { { LLGL::AttachmentType::Color, debugView, clear } },                                  { gBuffer });
+            AddPass("BloomDown",    { { LLGL::AttachmentType::Color, bloom0, clear } },                                     { hdr });
+            AddPass("BloomBlurH",   { { LLGL::AttachmentType::Color, bloom1, clear } },                                     { bloom0 });
+            AddPass("BloomBlurV",   { { LLGL::AttachmentType::Color, bloom2, clear } },                                     { bloom1 });
+            AddPass("Tonemap",      { { LLGL::AttachmentType::Color, screen, clear } },                                     { hdr, bloom2 });
+        }
+
+        // Measures the declaration and compilation of a render graph, and the encoding of the compiled graph.
+        void RunRenderGraphBenchmarks()
+        {
+            LLGL::RenderGraph renderGraph{ *renderer_ };
+
+            DeclareRenderGraph(renderGraph);
+            renderGraph.Compile();
+
+            const std::string suffix = "." + std::to_string(renderGraph.GetStatistics().numPasses) + "Passes";
+            const auto iterations = std::max<std::uint64_t>(1, benchmark_.GetConfig().iterations / 100);
+
+            benchmark_.Measure(
+                "RenderGraph.DeclareCompile" + suffix,
+                iterations,
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                    {
+                        DeclareRenderGraph(renderGraph);
+                        renderGraph.Compile();
+                    }
+                }
+            );
+
+            benchmark_.Measure(
+                "RenderGraph.Execute" + suffix,
+                iterations,
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                        renderGraph.Execute(*commands_);
+                },
+                [this]()
+                {
+                    commands_->Begin();
+                },
+                [this]()
+                {
+                    commands_->End();
+                    commandQueue_->Submit(*commands_);
+                    commandQueue_->WaitIdle();
+                }
+            );
+        }
+
+        // Measures the creation and release of a render system object.
+        template <typename TCreate>
+        void MeasureCreateRelease(const std::string& name, TCreate create)
+        {
+            benchmark_.Measure(
+                "RenderSystem.CreateRelease." + name,
+                std::max<std::uint64_t>(1, benchmark_.GetConfig().iterations / 100),
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                        renderer_->Release(*create());
+                }
+            );
+        }
+
+        void RunRenderSystemBenchmarks()
+        {
+            /* Create and release objects */
+            MeasureCreateRelease(
+                "Buffer",
+                [&]() { return renderer_->CreateBuffer(LLGL::ConstantBufferDesc(256)); }
+            );
+            MeasureCreateRelease(
+                "Texture",
+                [&]() { return renderer_->CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA8UNorm, 16, 16)); }
+            );
+            MeasureCreateRelease(
+                "Sampler",
+                [&]() { return renderer_->CreateSampler({}); }
+            );
+            MeasureCreateRelease(
+                "PipelineLayout",
+                [&]() { return LLGL::CreatePipelineLayout(*renderer_, "cbuffer(0):vert, texture(1):frag"); }
+            );
+            MeasureCreateRelease(
+                "ResourceHeap",
+                [&]() { return renderer_->CreateResourceHeap(resourceHeapDesc_); }
+            );
+            MeasureCreateRelease(
+                "GraphicsPipeline",
+                [&]() { return renderer_->CreateGraphicsPipeline(pipelineDesc_); }
+            );
+
+            /* Write buffer from CPU */
+            const char data[256] = {};
+            benchmark_.Measure(
+                "RenderSystem.WriteBuffer",
+                benchmark_.GetConfig().iterations / 10,
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                        renderer_->WriteBuffer(*constantBuffer_, 0, data, sizeof(data));
+                }
+            );
+        }
+
+        // Creates a compute shader from the specified SPIR-V module, which is made distinct from all previous modules if 'unique' is true.
+        LLGL::Shader* CreateReflectionShader(std::vector<char>& byteCode, bool unique)
+        {
+            if (unique)
+            {
+                /* Modify the generator word of the module header, so the reflection cannot be served by the reflection cache */
+                const auto generatorWord = static_cast<std::uint32_t>(reflectionModuleCounter_++);
+                std::memcpy(&byteCode[8], &generatorWord, sizeof(generatorWord));
+            }
+
+            LLGL::ShaderDescriptor shaderDesc;
+            {
+                shaderDesc.type         = LLGL::ShaderType::Compute;
+                shaderDesc.source       = byteCode.data();
+                shaderDesc.sourceSize   = byteCode.size();
+                shaderDesc.sourceType   = LLGL::ShaderSourceType::BinaryBuffer;
+            }
+            auto shader = renderer_->CreateShader(shaderDesc);
+            reflectionShaders_.push_back(shader);
+            return shader;
+        }
+
+        void ReleaseReflectionShaders()
+        {
+            for (auto program : reflectionPrograms_)
+                renderer_->Release(*program);
+            for (auto shader : reflectionShaders_)
+                renderer_->Release(*shader);
+            reflectionPrograms_.clear();
+            reflectionShaders_.clear();
+        }
+
+        // Returns true if the render system reflects the specified SPIR-V module.
+        bool IsReflectionSupported(std::vector<char>& byteCode)
+        {
+            auto program = renderer_->CreateShaderProgram(LLGL::ShaderProgramDesc({ CreateReflectionShader(byteCode, false) }));
+            reflectionPrograms_.push_back(program);
+
+            LLGL::ShaderReflection reflection;
+            const bool supported = (program->Reflect(reflection) && !reflection.resources.empty());
+
+            ReleaseReflectionShaders();
+            return supported;
+        }
+
+        /*
+        Measures the creation of SPIR-V shaders, which are reflected on creation, with distinct modules (uncached) and identical modules (cached),
+        as well as the reflection of shader programs.
+        */
+        void RunShaderReflectionBenchmarks()
+        {
+            const std::string names[] = { "Shader.CreateSPIRV.Uncached", "Shader.CreateSPIRV.Cached", "ShaderProgram.Reflect" };
+
+            auto skipAll = [&](const std::string& reason)
+            {
+                for (const auto& name : names)
+                    benchmark_.Skip(name, reason);
+            };
+
+            const auto& languages = renderer_->GetRenderingCaps().shadingLanguages;
+            if (std::find(languages.begin(), languages.end(), LLGL::ShadingLanguage::SPIRV) == languages.end())
+            {
+                skipAll("SPIR-V not supported");
+                return;
+            }
+
+            const auto byteCodeFilename = benchmark_.GetConfig().shaderPath + "SpirvReflectTest.comp.spv";
+            std::ifstream byteCodeFile{ byteCodeFilename, std::ios::binary };
+            std::vector<char> byteCode{ std::istreambuf_iterator<char>(byteCodeFile), std::istreambuf_iterator<char>() };
+
+            if (byteCode.size() < 20)
+            {
+                skipAll("missing shader module '" + byteCodeFilename + "'");
+                return;
+            }
+
+            if (!IsReflectionSupported(byteCode))
+            {
+                skipAll("render system does not reflect SPIR-V shader modules");
+                return;
+            }
+
+            const auto iterations = std::max<std::uint64_t>(1, benchmark_.GetConfig().iterations / 10);
+
+            benchmark_.Measure(
+                names[0],
+                iterations,
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                        CreateReflectionShader(byteCode, true);
+                },
+                nullptr,
+                [this]()
+                {
+                    ReleaseReflectionShaders();
+                }
+            );
+
+            benchmark_.Measure(
+                names[1],
+                iterations,
+                [&](std::uint64_t n)
+                {
+                    while (n--)
+                        CreateReflectionShader(byteCode, false);
+                },
+                [&]()
+                {
+                    /* Keep one shader with the same module alive, so all shaders share its reflection */
+                    CreateReflectionShader(byteCode, false);
+                },
+                [this]()
+                {
+                    ReleaseReflectionShaders();
+                }
+            );
+
+            benchmark_.Measure(
+                names[2],
+                iterations,
+                [this](std::uint64_t n)
+                {
+                    for (std::uint64_t i = 0; i < n; ++i)
+                    {
+                        LLGL::ShaderReflection reflection;
+                        reflectionPrograms_[i]->Reflect(reflection);
+                    }
+                },
+                [&]()
+                {
+                    for (std::uint64_t i = 0; i < iterations; ++i)
+                        reflectionPrograms_.push_back(renderer_->CreateShaderProgram(LLGL::ShaderProgramDesc({ CreateReflectionShader(byteCode, true) })));
+                },
+                [this]()
+                {
+                    ReleaseReflectionShaders();
+                }
+            );
+        }
+
+    private:
+
+        Benchmark                               benchmark_;
+        bool                                    debugLayer_         = false;
+
+        LLGL::RenderingProfiler                 profiler_;
+        LLGL::RenderingDebugger                 debugger_;
+
+        std::unique_ptr<LLGL::RenderSystem>     renderer_;
+        LLGL::RenderContext*                    context_            = nullptr;
+        LLGL::CommandQueue*                     commandQueue_       = nullptr;
+        LLGL::CommandBuffer*                    commands_           = nullptr;
+
+        LLGL::VertexFormat                      vertexFormat_;
+        LLGL::Buffer*                           vertexBuffer_       = nullptr;
+        LLGL::Buffer*                           indexBuffer_        = nullptr;
+        LLGL::Buffer*                           constantBuffer_     = nullptr;
+        LLGL::Buffer*                           indirectBuffer_     = nullptr;
+        LLGL::Texture*                          texture_            = nullptr;
+        LLGL::Sampler*                          sampler_            = nullptr;
+
+        LLGL::PipelineLayoutDescriptor          pipelineLayoutDesc_;
+        LLGL::PipelineLayout*                   pipelineLayout_     = nullptr;
+        LLGL::ResourceHeapDescriptor            resourceHeapDesc_;
+        LLGL::ResourceHeap*                     resourceHeap_       = nullptr;
+
+        LLGL::ShaderProgram*                    shaderProgram_      = nullptr;
+        LLGL::GraphicsPipelineDescriptor        pipelineDesc_;
+        LLGL::GraphicsPipeline*                 pipeline_           = nullptr;
+
+        std::vector<LLGL::Shader*>              reflectionShaders_;
+        std::vector<LLGL::ShaderProgram*>       reflectionPrograms_;
+        std::uint64_t                           reflectionModuleCounter_ = 0;
+
+};
+
+
+/*
+ * Image conversion benchmarks
+ */
+
+static void RunImageConversionBenchmarks(const BenchmarkConfig& config, BenchmarkRun& run)
+{
+    Benchmark benchmark{ config, run };
+
+    const LLGL::Extent3D extent{ 256, 256, 1 };
+    const auto numPixels = static_cast<std::size_t>(extent.width * extent.height);
+
+    std::vector<std::uint8_t> srcImage(numPixels * 4, 0x7f);
+    std::vector<float> dstImageFloat(numPixels * 4);
+    std::vector<std::uint8_t> dstImageUByte(numPixels * 4);
+
+    const LLGL::SrcImageDescriptor srcImageDesc{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, srcImage.data(), srcImage.size() };
+    const LLGL::DstImageDescriptor dstImageDescFloat{ LLGL::ImageFormat::RGBA, LLGL::DataType::Float32, dstImageFloat.data(), dstImageFloat.size() * sizeof(float) };
+    const LLGL::DstImageDescriptor dstImageDescBGRA{ LLGL::ImageFormat::BGRA, LLGL::DataType::UInt8, dstImageUByte.data(), dstImageUByte.size() };
+
+    const auto iterations = std::max<std::uint64_t>(1, config.iterations / 1000);
+
+    benchmark.Measure(
+        "ConvertImageBuffer.RGBA8UInt8ToRGBA32Float.256x256",
+        iterations,
+        [&](std::uint64_t n) { while (n--) LLGL::ConvertImageBuffer(srcImageDesc, dstImageDescFloat); }
+    );
+    benchmark.Measure(
+        "ConvertImageBuffer.RGBA8UInt8ToRGBA32Float.256x256.Threaded",
+        iterations,
+        [&](std::uint64_t n) { while (n--) LLGL::ConvertImageBuffer(srcImageDesc, dstImageDescFloat, LLGL::Constants::maxThreadCount); }
+    );
+    benchmark.Measure(
+        "ConvertImageBuffer.RGBA8UInt8ToBGRA8UInt8.256x256",
+        iterations,
+        [&](std::uint64_t n) { while (n--) LLGL::ConvertImageBuffer(srcImageDesc, dstImageDescBGRA); }
+    );
+}
+
+
+/*
+ * Main
+ */
+
+static void PrintHelp()
+{
+    std::cout << "usage: Benchmark [MODULE...] [OPTIONS]\n";
+    std::cout << "  MODULE              render system modules to benchmark (all available modules by default)\n";
+    std::cout << "  --debug             additionally run all renderer benchmarks with the debug layer\n";
+    std::cout << "  --json FILE         write results in the JSON format to FILE ('-' for standard output)\n";
+    std::cout << "  --iterations N      number of calls per sample for command buffer benchmarks (default 10000)\n";
+    std::cout << "  --samples N         number of measured samples per benchmark (default 5)\n";
+    std::cout << "  --filter NAME       only run benchmarks whose names contain NAME\n";
+}
+
+// Returns the directory of the shader files next to the specified executable, so the benchmarks do not depend on the working directory.
+static std::string GetShaderPath(const std::string& executablePath)
+{
+    const auto pos = executablePath.find_last_of("/\\");
+    return (pos != std::string::npos ? executablePath.substr(0, pos + 1) : std::string()) + "Shaders/";
+}
+
+int main(int argc, char* argv[])
+{
+    BenchmarkConfig             config;
+    std::vector<std::string>    modules;
+    std::string                 jsonFilename;
+    bool                        withDebugLayer  = false;
+
+    config.shaderPath = GetShaderPath(argv[0]);
+
+    /* Parse command line arguments */
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--debug")
+            withDebugLayer = true;
+        else if (arg == "--json" && i + 1 < argc)
+            jsonFilename = argv[++i];
+        else if (arg == "--iterations" && i + 1 < argc)
+            config.iterations = std::max<std::uint64_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        else if (arg == "--samples" && i + 1 < argc)
+            config.samples = std::max<std::uint32_t>(1, static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10)));
+        else if (arg == "--filter" && i + 1 < argc)
+            config.filter = argv[++i];
+        else if (arg == "--help" || arg == "-h")
+        {
+            PrintHelp();
+            return 0;
+        }
+        else if (!arg.empty() && arg[0] != '-')
+            modules.push_back(arg);
+        else
+        {
+            std::cerr << "invalid argument: " << arg << std::endl;
+            PrintHelp();
+            return 1;
+        }
+    }
+
+    if (modules.empty())
+        modules = LLGL::RenderSystem::FindModules();
+
+    /* Human readable output is written to the error stream if the JSON output is written to the standard output */
+    auto& log = (jsonFilename == "-" ? std::cerr : std::cout);
+
+    std::vector<BenchmarkRun> runs;
+
+    /* Run module independent benchmarks */
+    {
+        BenchmarkRun run;
+        run.module = "Core";
+        RunImageConversionBenchmarks(config, run);
+        PrintBenchmarkRun(log, run);
+        runs.push_back(run);
+    }
+
+    /* Run renderer benchmarks for each module that can be loaded */
+    for (const auto& module : modules)
+    {
+        for (int debugLayer = 0; debugLayer <= (withDebugLayer ? 1 : 0); ++debugLayer)
+        {
+            BenchmarkRun run;
+            run.module      = module;
+            run.debugLayer  = (debugLayer != 0);
+
+            try
+            {
+                RendererBenchmark benchmark{ module, run.debugLayer, config, run };
+                benchmark.Run();
+            }
+            catch (const std::exception& e)
+            {
+                log << "failed to run benchmarks for module \"" << module << "\": " << e.what() << "\n\n";
+                continue;
+            }
+
+            PrintBenchmarkRun(log, run);
+            runs.push_back(run);
+        }
+    }
+
+    /* Write JSON output */
+    if (jsonFilename == "-")
+        WriteBenchmarkJSON(std::cout, config, runs);
+    else if (!jsonFilename.empty())
+    {
+        std::ofstream file{ jsonFilename };
+        if (!file.good())
+        {
+            std::cerr << "failed to write file: \"" << jsonFilename << "\"" << std::endl;
+            return 1;
+        }
+        WriteBenchmarkJSON(file, config, runs);
+    }
+
+    return 0;
+}
+
+
+
+// ================================================================================
@@ -7,6 +7,12 @@
 
 #include <LLGL/Image.h>
 #include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb/stb_image.h>
@@ -15,6 +21,8 @@
 #include <stb/stb_image_write.h>
 
 
+static int g_numFailures = 0;
+
 LLGL::Image LoadImage(const std::string& filename, const LLGL::ImageFormat format = LLGL::ImageFormat::RGB)
 {
     int requiredComp = static_cast<int>(LLGL::ImageFormatSize(format));
@@ -108,6 +116,286 @@ void Test_Resize()
     SaveImagePNG(img1, "Output/img1-resize-smaller.png");
 }
 
+// Returns the peak signal-to-noise ratio (in dB) between two RGBA8 images for the first 'numComponents' components.
+double ComputePSNR(const std::uint8_t* lhs, const std::uint8_t* rhs, std::size_t numPixels, std::size_t numComponents)
+{
+    double sqErrorSum = 0.0;
+    for (std::size_t i = 0; i < numPixels; ++i)
+    {
+        for (std::size_t c = 0; c < numComponents; ++c)
+        {
+            const double diff = static_cast<double>(lhs[i*4 + c]) - static_cast<double>(rhs[i*4 + c]);
+            sqErrorSum += diff*diff;
+        }
+    }
+    const double mse = sqErrorSum / static_cast<double>(numPixels * numComponents);
+    return (mse > 0.0 ? 10.0 * std::log10(255.0*255.0 / mse) : 99.0);
+}
+
+void Test_BlockCompression()
+{
+    auto img1 = LoadImage("Media/Textures/Grid.png", LLGL::ImageFormat::RGBA);
+
+    const auto& extent      = img1.GetExtent();
+    const auto  numPixels   = extent.width * extent.height * extent.depth;
+    const auto  megaPixels  = static_cast<double>(numPixels) / 1.0e6;
+    const int   numRuns     = 10;
+
+    struct BCTestCase
+    {
+        LLGL::ImageFormat   format;
+        const char*         name;
+        std::size_t         blockSize;
+        std::size_t         numComponents;
+        double              minPSNR;
+    };
+
+    /* Minimal PSNR values are regression thresholds for the fast encoder with the high-frequency grid texture */
+    const BCTestCase testCases[] =
+    {
+        { LLGL::ImageFormat::BC1, "BC1",  8, 3, 22.0 },
+        { LLGL::ImageFormat::BC2, "BC2", 16, 4, 22.0 },
+        { LLGL::ImageFormat::BC3, "BC3", 16, 4, 22.0 },
+        { LLGL::ImageFormat::BC4, "BC4",  8, 1, 32.0 },
+        { LLGL::ImageFormat::BC5, "BC5", 16, 2, 32.0 },
+    };
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (const auto& testCase : testCases)
+    {
+        LLGL::ByteBuffer compressedImage, decompressedImage;
+
+        /* Measure throughput of encoder */
+        auto startTime = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < numRuns; ++i)
+            compressedImage = LLGL::ConvertImageBuffer(img1.GetSrcDesc(), testCase.format, LLGL::DataType::UInt8, extent, LLGL::Constants::maxThreadCount);
+        auto encodeTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        /* Measure throughput of decoder */
+        const LLGL::SrcImageDescriptor compressedImageDesc
+        {
+            testCase.format,
+            LLGL::DataType::UInt8,
+            compressedImage.get(),
+            ((extent.width + 3) / 4) * ((extent.height + 3) / 4) * testCase.blockSize
+        };
+
+        startTime = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < numRuns; ++i)
+            decompressedImage = LLGL::ConvertImageBuffer(compressedImageDesc, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, extent, LLGL::Constants::maxThreadCount);
+        auto decodeTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        /* Compare decompressed image with original image */
+        const auto psnr = ComputePSNR(
+            reinterpret_cast<const std::uint8_t*>(img1.GetData()),
+            reinterpret_cast<const std::uint8_t*>(decompressedImage.get()),
+            numPixels,
+            testCase.numComponents
+        );
+
+        std::cout << testCase.name << ": ";
+        std::cout << "encode = " << (megaPixels * numRuns / encodeTime) << " MP/s, ";
+        std::cout << "decode = " << (megaPixels * numRuns / decodeTime) << " MP/s, ";
+        std::cout << "PSNR = " << psnr << " dB";
+        std::cout << (psnr >= testCase.minPSNR ? "" : " (FAILED)") << std::endl;
+
+        if (psnr < testCase.minPSNR)
+            ++g_numFailures;
+
+        /* Save decompressed image for visual inspection */
+        LLGL::Image decompressedImg { extent, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, std::move(decompressedImage) };
+        SaveImagePNG(decompressedImg, std::string("Output/img1-") + testCase.name + ".png");
+    }
+
+    /* Check round trip of signed BC4 image, which must keep the sign of each texel */
+    const LLGL::Extent3D snormExtent { 64, 64, 1 };
+
+    std::vector<std::int8_t> snormImage(snormExtent.width * snormExtent.height);
+    for (std::uint32_t y = 0; y < snormExtent.height; ++y)
+    {
+        for (std::uint32_t x = 0; x < snormExtent.width; ++x)
+            snormImage[y * snormExtent.width + x] = static_cast<std::int8_t>(static_cast<int>(x * 4) - 127);
+    }
+
+    const LLGL::SrcImageDescriptor snormImageDesc { LLGL::ImageFormat::R, LLGL::DataType::Int8, snormImage.data(), snormImage.size() };
+    auto snormCompressed = LLGL::ConvertImageBuffer(snormImageDesc, LLGL::ImageFormat::BC4, LLGL::DataType::Int8, snormExtent, 1);
+
+    const LLGL::SrcImageDescriptor snormCompressedDesc { LLGL::ImageFormat::BC4, LLGL::DataType::Int8, snormCompressed.get(), (snormExtent.width / 4) * (snormExtent.height / 4) * 8 };
+    auto snormDecompressed = LLGL::ConvertImageBuffer(snormCompressedDesc, LLGL::ImageFormat::R, LLGL::DataType::Int8, snormExtent, 1);
+
+    int maxError = 0;
+    for (std::size_t i = 0; i < snormImage.size(); ++i)
+    {
+        const int error = std::abs(static_cast<int>(reinterpret_cast<const std::int8_t*>(snormDecompressed.get())[i]) - snormImage[i]);
+        maxError = std::max(maxError, error);
+    }
+
+    std::cout << "BC4 (signed): max error = " << maxError;
+    if (maxError > 4)
+    {
+        std::cout << " (FAILED)";
+        ++g_numFailures;
+    }
+    std::cout << std::endl;
+}
+
+void Test_Float16Conversion()
+{
+    /* Check rounding and denormal handling with reference values */
+    struct Float16TestCase
+    {
+        float           value;
+        std::uint16_t   bits;
+    };
+
+    const Float16TestCase testCases[] =
+    {
+        { 1.0f,                                             0x3C00 },
+        { -2.0f,                                            0xC000 },
+        { 65504.0f,                                         0x7BFF }, // max normal
+        { 65520.0f,                                         0x7C00 }, // rounds up to infinity
+        { 1.0e10f,                                          0x7C00 },
+        { std::ldexp(1.0f, -24),                            0x0001 }, // min subnormal
+        { std::ldexp(1.0f, -25),                            0x0000 }, // tie rounds to even
+        { std::ldexp(3.0f, -25),                            0x0002 }, // tie rounds to even
+        { std::ldexp(1023.0f, -24),                         0x03FF }, // max subnormal
+        { 1.0f + std::ldexp(1.0f, -11),                     0x3C00 }, // tie rounds to even
+        { 1.0f + std::ldexp(3.0f, -11),                     0x3C02 }, // tie rounds to even
+        { 1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20), 0x3C01 },
+    };
+
+    const auto numTestCases = sizeof(testCases) / sizeof(testCases[0]);
+
+    float           testValues[numTestCases];
+    std::uint16_t   testResults[numTestCases];
+    float           testResultsInv[numTestCases];
+
+    for (std::size_t i = 0; i < numTestCases; ++i)
+        testValues[i] = testCases[i].value;
+
+    LLGL::ConvertImageBuffer(
+        LLGL::SrcImageDescriptor{ LLGL::ImageFormat::R, LLGL::DataType::Float32, testValues, sizeof(testValues) },
+        LLGL::DstImageDescriptor{ LLGL::ImageFormat::R, LLGL::DataType::Float16, testResults, sizeof(testResults) }
+    );
+
+    LLGL::ConvertImageBuffer(
+        LLGL::SrcImageDescriptor{ LLGL::ImageFormat::R, LLGL::DataType::Float16, testResults, sizeof(testResults) },
+        LLGL::DstImageDescriptor{ LLGL::ImageFormat::R, LLGL::DataType::Float32, testResultsInv, sizeof(testResultsInv) }
+    );
+
+    std::cout << std::hex << std::setfill('0');
+
+    for (std::size_t i = 0; i < numTestCases; ++i)
+    {
+        if (testResults[i] != testCases[i].bits)
+        {
+            std::cout << "Float16 conversion of " << testCases[i].value << ": ";
+            std::cout << "0x" << std::setw(4) << testResults[i] << " (expected 0x" << std::setw(4) << testCases[i].bits << ") (FAILED)" << std::endl;
+            ++g_numFailures;
+        }
+        else if (testCases[i].bits != 0x7C00 && std::abs(testResultsInv[i] - testValues[i]) > std::abs(testValues[i]) * 0.001f + std::ldexp(1.0f, -24))
+        {
+            std::cout << "Float16 round trip of " << testCases[i].value << ": " << testResultsInv[i] << " (FAILED)" << std::endl;
+            ++g_numFailures;
+        }
+    }
+
+    std::cout << std::dec << std::setfill(' ');
+
+    /* Measure throughput of bulk conversion with HDR image data */
+    const LLGL::Extent3D extent { 2048, 2048, 1 };
+    const auto  numPixels   = extent.width * extent.height * extent.depth;
+    const auto  megaPixels  = static_cast<double>(numPixels) / 1.0e6;
+    const int   numRuns     = 10;
+
+    std::vector<float> hdrImage(numPixels * 4);
+    for (std::size_t i = 0; i < hdrImage.size(); ++i)
+        hdrImage[i] = std::sin(static_cast<float>(i) * 0.001f) * 1000.0f;
+
+    std::vector<std::uint16_t> halfImage(hdrImage.size());
+
+    const LLGL::SrcImageDescriptor hdrImageSrcDesc  { LLGL::ImageFormat::RGBA, LLGL::DataType::Float32, hdrImage.data(), hdrImage.size() * sizeof(float) };
+    const LLGL::DstImageDescriptor hdrImageDstDesc  { LLGL::ImageFormat::RGBA, LLGL::DataType::Float32, hdrImage.data(), hdrImage.size() * sizeof(float) };
+    const LLGL::SrcImageDescriptor halfImageSrcDesc { LLGL::ImageFormat::RGBA, LLGL::DataType::Float16, halfImage.data(), halfImage.size() * sizeof(std::uint16_t) };
+    const LLGL::DstImageDescriptor halfImageDstDesc { LLGL::ImageFormat::RGBA, LLGL::DataType::Float16, halfImage.data(), halfImage.size() * sizeof(std::uint16_t) };
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < numRuns; ++i)
+        LLGL::ConvertImageBuffer(hdrImageSrcDesc, halfImageDstDesc);
+    auto compressTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+    startTime = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < numRuns; ++i)
+        LLGL::ConvertImageBuffer(halfImageSrcDesc, hdrImageDstDesc);
+    auto decompressTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Float16: ";
+    std::cout << "compress = " << (megaPixels * numRuns / compressTime) << " MP/s, ";
+    std::cout << "decompress = " << (megaPixels * numRuns / decompressTime) << " MP/s" << std::endl;
+}
+
+void Test_StridedConversion()
+{
+    /* Source image with padded rows, whose data size ends with the last pixel of the last row */
+    const LLGL::Extent3D    extent          { 5, 2, 1 };
+    const std::uint32_t     srcRowStride    = 16;
+
+    std::vector<std::uint8_t> srcImage(srcRowStride + extent.width * 3, 0xFF);
+    for (std::uint32_t y = 0; y < extent.height; ++y)
+    {
+        for (std::uint32_t x = 0; x < extent.width; ++x)
+        {
+            for (std::uint32_t c = 0; c < 3; ++c)
+                srcImage[y * srcRowStride + x * 3 + c] = static_cast<std::uint8_t>(y * 100 + x * 10 + c);
+        }
+    }
+
+    LLGL::SrcImageDescriptor srcImageDesc { LLGL::ImageFormat::RGB, LLGL::DataType::UInt8, srcImage.data(), srcImage.size() };
+    srcImageDesc.rowStride = srcRowStride;
+
+    /* Convert format only into tightly packed image */
+    std::vector<std::uint8_t> rgbaImage(extent.width * extent.height * 4);
+    LLGL::ConvertImageBuffer(
+        srcImageDesc,
+        LLGL::DstImageDescriptor{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, rgbaImage.data(), rgbaImage.size() },
+        extent
+    );
+
+    /* Convert format and data type into padded image */
+    const std::uint32_t dstRowStride = 96;
+
+    std::vector<float> bgraImage((dstRowStride + extent.width * 16) / sizeof(float));
+    LLGL::DstImageDescriptor bgraImageDesc { LLGL::ImageFormat::BGRA, LLGL::DataType::Float32, bgraImage.data(), bgraImage.size() * sizeof(float) };
+    bgraImageDesc.rowStride = dstRowStride;
+    LLGL::ConvertImageBuffer(srcImageDesc, bgraImageDesc, extent, 2);
+
+    int numErrors = 0;
+    for (std::uint32_t y = 0; y < extent.height; ++y)
+    {
+        for (std::uint32_t x = 0; x < extent.width; ++x)
+        {
+            const auto red      = static_cast<std::uint8_t>(y * 100 + x * 10);
+            const auto blue     = static_cast<std::uint8_t>(red + 2);
+            const auto rgba     = &rgbaImage[(y * extent.width + x) * 4];
+            const auto bgra     = &bgraImage[(y * dstRowStride + x * 16) / sizeof(float)];
+            if (rgba[0] != red || rgba[2] != blue || rgba[3] != 0xFF)
+                ++numErrors;
+            if (std::abs(bgra[0] - blue / 255.0f) > 0.0001f || std::abs(bgra[2] - red / 255.0f) > 0.0001f)
+                ++numErrors;
+        }
+    }
+
+    std::cout << "Strided conversion: errors = " << numErrors;
+    if (numErrors > 0)
+    {
+        std::cout << " (FAILED)";
+        ++g_numFailures;
+    }
+    std::cout << std::endl;
+}
+
 int main(int argc, char* argv[])
 {
     try
@@ -115,6 +403,9 @@ int main(int argc, char* argv[])
         //Test_PixelOperations();
         //Test_Blit();
         Test_Resize();
+        Test_BlockCompression();
+        Test_Float16Conversion();
+        Test_StridedConversion();
     }
     catch (const std::exception& e)
     {
@@ -122,6 +413,14 @@ int main(int argc, char* argv[])
         #ifdef _WIN32
         system("pause");
         #endif
+        return 1;
     }
+
+    if (g_numFailures > 0)
+    {
+        std::cerr << g_numFailures << " check(s) failed" << std::endl;
+        return 1;
+    }
+
     return 0;
 }
@@ -0,0 +1,275 @@
+/*
+ * Test_RenderGraph.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/RenderGraph.h>
+#include <LLGL/Utility.h>
+#include <iostream>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+
+static int g_numFailures = 0;
+
+#define TEST_CHECK(EXPR)                                                        \
+    if (!(EXPR))                                                                \
+    {                                                                           \
+        std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #EXPR;   \
+        std::cerr << std::endl;                                                 \
+        ++g_numFailures;                                                        \
+    }
+
+static const LLGL::TextureDescriptor g_colorDesc = LLGL::Texture2DDesc(LLGL::Format::RGBA8UNorm, 256, 256);
+
+static LLGL::RenderGraphPassDescriptor PassDesc(
+    const char*                                     name,
+    const std::vector<LLGL::RenderGraphAttachment>& attachments,
+    const std::vector<LLGL::RenderGraphResource>&   reads   = {},
+    long                                            flags   = 0)
+{
+    LLGL::RenderGraphPassDescriptor passDesc;
+    {
+        passDesc.name           = name;
+        passDesc.flags          = flags;
+        passDesc.attachments    = attachments;
+        passDesc.reads          = reads;
+    }
+    return passDesc;
+}
+
+// Passes whose outputs are never used must be culled and their callbacks must not be invoked.
+static void TestCulling(LLGL::RenderSystem& renderer, LLGL::CommandBuffer& commands, LLGL::Texture& backBuffer)
+{
+    LLGL::RenderGraph renderGraph{ renderer };
+
+    auto unused = renderGraph.CreateTexture(g_colorDesc, "unused");
+    auto target = renderGraph.ImportTexture(backBuffer, "target");
+
+    int numUnusedCalls = 0, numTargetCalls = 0;
+
+    renderGraph.AddPass(
+        PassDesc("Unused", { { LLGL::AttachmentType::Color, unused, LLGL::AttachmentLoadOp::Clear } }),
+        [&](LLGL::CommandBuffer&) { ++numUnusedCalls; }
+    );
+    renderGraph.AddPass(
+        PassDesc("Target", { { LLGL::AttachmentType::Color, target, LLGL::AttachmentLoadOp::Clear } }),
+        [&](LLGL::CommandBuffer&) { ++numTargetCalls; }
+    );
+
+    commands.Begin();
+    renderGraph.Execute(commands);
+    commands.End();
+
+    const auto& stats = renderGraph.GetStatistics();
+    TEST_CHECK(stats.numPasses == 2);
+    TEST_CHECK(stats.numCulledPasses == 1);
+    TEST_CHECK(stats.numTransientTextures == 0);
+    TEST_CHECK(numUnusedCalls == 0);
+    TEST_CHECK(numTargetCalls == 1);
+    TEST_CHECK(renderGraph.GetTexture(unused) == nullptr);
+    TEST_CHECK(renderGraph.GetTexture(target) == &backBuffer);
+}
+
+// Transient textures with disjoint lifetimes must share the same texture, overlapping lifetimes must not.
+static void TestAliasing(LLGL::RenderSystem& renderer, LLGL::CommandBuffer& commands, LLGL::Texture& backBuffer)
+{
+    LLGL::RenderGraph renderGraph{ renderer };
+
+    auto first  = renderGraph.CreateTexture(g_colorDesc, "first");
+    auto second = renderGraph.CreateTexture(g_colorDesc, "second");
+    auto third  = renderGraph.CreateTexture(g_colorDesc, "third");
+    auto target = renderGraph.ImportTexture(backBuffer, "target");
+
+    auto NoOp = [](LLGL::CommandBuffer&) {};
+
+    /* Lifetime of 'first' ends before 'second' begins; 'third' overlaps with 'second' */
+    renderGraph.AddPass(PassDesc("WriteFirst",  { { LLGL::AttachmentType::Color, first,  LLGL::AttachmentLoadOp::Clear } }), NoOp);
+    renderGraph.AddPass(PassDesc("ReadFirst",   { { LLGL::AttachmentType::Color, target, LLGL::AttachmentLoadOp::Clear } }, { first }), NoOp);
+    renderGraph.AddPass(PassDesc("WriteSecond", { { LLGL::AttachmentType::Color, second, LLGL::AttachmentLoadOp::Clear } }), NoOp);
+    renderGraph.AddPass(PassDesc("WriteThird",  { { LLGL::AttachmentType::Color, third,  LLGL::AttachmentLoadOp::Clear } }), NoOp);
+    renderGraph.AddPass(PassDesc("ReadBoth",    { { LLGL::AttachmentType::Color, target } }, { second, third }), NoOp);
+
+    commands.Begin();
+    renderGraph.Execute(commands);
+    commands.End();
+
+    const auto& stats = renderGraph.GetStatistics();
+    TEST_CHECK(stats.numCulledPasses == 0);
+    TEST_CHECK(stats.numTransientTextures == 3);
+    TEST_CHECK(stats.numPhysicalTextures == 2);
+    TEST_CHECK(renderGraph.GetTexture(first) != nullptr);
+    TEST_CHECK(renderGraph.GetTexture(first) == renderGraph.GetTexture(second));
+    TEST_CHECK(renderGraph.GetTexture(second) != renderGraph.GetTexture(third));
+
+    /* Recompiling the same graph must reuse the textures of the previous compilation */
+    auto previousTexture = renderGraph.GetTexture(third);
+    renderGraph.Compile();
+    TEST_CHECK(renderGraph.GetTexture(third) == previousTexture);
+}
+
+// Consecutive passes with the same attachments are merged unless they clear them or use a different kind of encoding.
+static void TestMerging(LLGL::RenderSystem& renderer, LLGL::CommandBuffer& commands, LLGL::Texture& backBuffer)
+{
+    LLGL::RenderGraph renderGraph{ renderer };
+
+    auto target = renderGraph.ImportTexture(backBuffer, "target");
+
+    std::vector<int> order;
+
+    renderGraph.AddPass(
+        PassDesc("Clear", { { LLGL::AttachmentType::Color, target, LLGL::AttachmentLoadOp::Clear } }),
+        [&](LLGL::CommandBuffer&) { order.push_back(0); }
+    );
+    renderGraph.AddPass(
+        PassDesc("Opaque", { { LLGL::AttachmentType::Color, target } }),
+        [&](LLGL::CommandBuffer&) { order.push_back(1); }
+    );
+    renderGraph.AddPass(
+        PassDesc("Transparent", { { LLGL::AttachmentType::Color, target } }),
+        [&](LLGL::CommandBuffer&) { order.push_back(2); }
+    );
+    renderGraph.AddPass(
+        PassDesc("Overlay", { { LLGL::AttachmentType::Color, target, LLGL::AttachmentLoadOp::Clear } }),
+        [&](LLGL::CommandBuffer&) { order.push_back(3); }
+    );
+    renderGraph.AddPass(
+        PassDesc("Parallel", { { LLGL::AttachmentType::Color, target } }, {}, LLGL::RenderGraphPassFlags::ParallelEncoding),
+        [&](LLGL::CommandBuffer&) { order.push_back(4); }
+    );
+
+    commands.Begin();
+    renderGraph.Execute(commands);
+    commands.End();
+
+    const auto& stats = renderGraph.GetStatistics();
+    TEST_CHECK(stats.numPasses == 5);
+    TEST_CHECK(stats.numMergedPasses == 2);
+    TEST_CHECK(stats.numRenderPasses == 3);
+    TEST_CHECK((order == std::vector<int>{ 0, 1, 2, 3, 4 }));
+}
+
+// Passes with parallel encoding must be encoded exactly once per execution, also when the worker threads are reused.
+static void TestParallelEncoding(LLGL::RenderSystem& renderer, LLGL::CommandBuffer& commands, LLGL::Texture& backBuffer)
+{
+    LLGL::RenderGraph renderGraph{ renderer };
+
+    auto target = renderGraph.ImportTexture(backBuffer, "target");
+
+    const int numPasses = 8;
+    std::atomic<int> numCalls{ 0 };
+
+    for (int i = 0; i < numPasses; ++i)
+    {
+        renderGraph.AddPass(
+            PassDesc(nullptr, { { LLGL::AttachmentType::Color, target } }, {}, LLGL::RenderGraphPassFlags::ParallelEncoding),
+            [&](LLGL::CommandBuffer&) { ++numCalls; }
+        );
+    }
+
+    const int numFrames = 3;
+    const std::size_t threadCounts[numFrames] = { 4, 2, LLGL::Constants::maxThreadCount };
+
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        commands.Begin();
+        renderGraph.Execute(commands, threadCounts[frame]);
+        commands.End();
+    }
+
+    TEST_CHECK(renderGraph.GetStatistics().numMergedPasses == numPasses - 1);
+    TEST_CHECK(numCalls == numPasses * numFrames);
+
+    /* Exceptions from worker threads must be forwarded to the caller */
+    renderGraph.AddPass(
+        PassDesc("Throwing", { { LLGL::AttachmentType::Color, target } }, {}, LLGL::RenderGraphPassFlags::ParallelEncoding),
+        [](LLGL::CommandBuffer&) { throw std::runtime_error("pass failed"); }
+    );
+
+    bool forwarded = false;
+    commands.Begin();
+    try
+    {
+        renderGraph.Execute(commands, 4);
+    }
+    catch (const std::runtime_error&)
+    {
+        forwarded = true;
+    }
+    commands.End();
+
+    TEST_CHECK(forwarded);
+}
+
+// Invalid pass declarations must be rejected.
+static void TestValidation(LLGL::RenderSystem& renderer)
+{
+    LLGL::RenderGraph renderGraph{ renderer };
+
+    auto texture    = renderGraph.CreateTexture(g_colorDesc, "texture");
+    auto buffer     = renderGraph.CreateBuffer(LLGL::ConstantBufferDesc(256), "buffer");
+    auto NoOp       = [](LLGL::CommandBuffer&) {};
+
+    auto Throws = [&](const LLGL::RenderGraphPassDescriptor& passDesc, bool outOfRange) -> bool
+    {
+        try
+        {
+            renderGraph.AddPass(passDesc, NoOp);
+        }
+        catch (const std::out_of_range&)
+        {
+            return outOfRange;
+        }
+        catch (const std::invalid_argument&)
+        {
+            return !outOfRange;
+        }
+        return false;
+    };
+
+    TEST_CHECK(Throws(PassDesc("ReadUnwritten", { { LLGL::AttachmentType::Color, texture } }, { buffer }), false));
+    TEST_CHECK(Throws(PassDesc("BufferAttachment", { { LLGL::AttachmentType::Color, buffer } }), false));
+    TEST_CHECK(Throws(PassDesc("InvalidHandle", { { LLGL::AttachmentType::Color, texture + 100 } }), true));
+    TEST_CHECK(Throws(PassDesc("ParallelWithoutAttachments", {}, {}, LLGL::RenderGraphPassFlags::ParallelEncoding), false));
+}
+
+int main()
+{
+    try
+    {
+        // Load render system module; the Null renderer allows to run this test without a graphics device
+        auto renderer = LLGL::RenderSystem::Load("Null");
+
+        auto commands   = renderer->CreateCommandBuffer();
+        auto backBuffer = renderer->CreateTexture(g_colorDesc);
+
+        TestCulling(*renderer, *commands, *backBuffer);
+        TestAliasing(*renderer, *commands, *backBuffer);
+        TestMerging(*renderer, *commands, *backBuffer);
+        TestParallelEncoding(*renderer, *commands, *backBuffer);
+        TestValidation(*renderer);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    if (g_numFailures > 0)
+    {
+        std::cerr << g_numFailures << " check(s) failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "all render graph tests passed" << std::endl;
+
+    return 0;
+}
+
+
+
+// ================================================================================
@@ -7,6 +7,10 @@
 
 #include <LLGL/Utility.h>
 #include "Helper.h"
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <cstring>
 
 int main()
 {
@@ -81,6 +85,77 @@ int main()
         {
             std::cout << "  " << unif.name << " @ " << unif.location << std::endl;
         }
+
+        // Validate reflection of the compute shader
+        int numFailures = 0;
+
+        auto Check = [&numFailures](bool condition, const char* message)
+        {
+            if (!condition)
+            {
+                std::cerr << "check failed: " << message << std::endl;
+                ++numFailures;
+            }
+        };
+
+        auto HasResourceSlot = [](const LLGL::ShaderReflection& reflection, std::uint32_t slot) -> bool
+        {
+            for (const auto& resc : reflection.resources)
+            {
+                if (resc.binding.slot == slot)
+                    return true;
+            }
+            return false;
+        };
+
+        Check(workGroupSize.width == 8 && workGroupSize.height == 8 && workGroupSize.depth == 1, "work group size must be (8, 8, 1)");
+
+        for (std::uint32_t slot = 1; slot <= 6; ++slot)
+            Check(HasResourceSlot(reflect, slot), "resources must contain binding slots 1 to 6");
+
+        // Reflect a module with identical byte code and a module that differs only in the generator word of its header
+        std::ifstream byteCodeFile { "Shaders/SpirvReflectTest.comp.spv", std::ios::binary };
+        std::vector<char> byteCode { std::istreambuf_iterator<char>(byteCodeFile), std::istreambuf_iterator<char>() };
+
+        Check(byteCode.size() >= 20, "shader module must contain a header");
+
+        for (std::uint32_t generatorWord : { 0u, 1u })
+        {
+            if (byteCode.size() < 20)
+                break;
+
+            if (generatorWord > 0)
+                std::memcpy(&byteCode[8], &generatorWord, sizeof(generatorWord));
+
+            LLGL::ShaderDescriptor shaderDesc;
+            {
+                shaderDesc.type         = LLGL::ShaderType::Compute;
+                shaderDesc.source       = byteCode.data();
+                shaderDesc.sourceSize   = byteCode.size();
+                shaderDesc.sourceType   = LLGL::ShaderSourceType::BinaryBuffer;
+            }
+            auto shader = renderer->CreateShader(shaderDesc);
+            auto program = renderer->CreateShaderProgram(LLGL::ShaderProgramDesc({ shader }));
+
+            LLGL::ShaderReflection otherReflect;
+            program->Reflect(otherReflect);
+
+            Check(otherReflect.resources.size() == reflect.resources.size(), "reflection of equivalent modules must have the same number of resources");
+            for (std::size_t i = 0; i < otherReflect.resources.size() && i < reflect.resources.size(); ++i)
+            {
+                Check(otherReflect.resources[i].binding.name == reflect.resources[i].binding.name, "reflection of equivalent modules must have the same resource names");
+                Check(otherReflect.resources[i].binding.slot == reflect.resources[i].binding.slot, "reflection of equivalent modules must have the same resource slots");
+            }
+
+            renderer->Release(*program);
+            renderer->Release(*shader);
+        }
+
+        if (numFailures > 0)
+        {
+            std::cerr << numFailures << " check(s) failed" << std::endl;
+            return 1;
+        }
     }
     catch (const std::exception& e)
     {
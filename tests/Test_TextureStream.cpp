@@ -0,0 +1,251 @@
+/*
+ * Test_TextureStream.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utility.h>
+#include <iostream>
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+
+static int g_numFailures = 0;
+
+#define TEST_CHECK(EXPR)                                                        \
+    if (!(EXPR))                                                                \
+    {                                                                           \
+        std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #EXPR;   \
+        std::cerr << std::endl;                                                 \
+        ++g_numFailures;                                                        \
+    }
+
+using Texel = std::uint32_t;
+
+// Encodes the location of a texel, so each texel of the streamed image is unique.
+static Texel MakeTexel(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::uint32_t x, std::uint32_t y)
+{
+    return ((mipLevel << 24) | (arrayLayer << 16) | (y << 8) | x);
+}
+
+static LLGL::TextureDescriptor TextureArrayDesc(std::uint32_t width, std::uint32_t height, std::uint32_t arrayLayers, std::uint32_t mipLevels)
+{
+    auto textureDesc = LLGL::Texture2DArrayDesc(LLGL::Format::RGBA8UNorm, width, height, arrayLayers);
+    textureDesc.mipLevels = mipLevels;
+    return textureDesc;
+}
+
+static LLGL::TextureRegion StreamRegion(const LLGL::Offset3D& offset, const LLGL::Extent3D& extent, std::uint32_t numArrayLayers, std::uint32_t numMipLevels)
+{
+    LLGL::TextureRegion region;
+    {
+        region.subresource.numArrayLayers   = numArrayLayers;
+        region.subresource.numMipLevels     = numMipLevels;
+        region.offset                       = offset;
+        region.extent                       = extent;
+    }
+    return region;
+}
+
+// Returns true if the streamed region of the specified MIP-map level contains the expected texels.
+static bool VerifyMipLevel(
+    LLGL::RenderSystem&         renderer,
+    LLGL::Texture&              texture,
+    const LLGL::TextureRegion&  region,
+    std::uint32_t               mipLevel)
+{
+    const auto mipExtent    = texture.GetMipExtent(mipLevel);
+    const auto offsetX      = static_cast<std::uint32_t>(region.offset.x) >> mipLevel;
+    const auto offsetY      = static_cast<std::uint32_t>(region.offset.y) >> mipLevel;
+    const auto width        = std::max(1u, region.extent.width  >> mipLevel);
+    const auto height       = std::max(1u, region.extent.height >> mipLevel);
+
+    std::vector<Texel> texels(mipExtent.width * mipExtent.height * mipExtent.depth);
+    renderer.ReadTexture(
+        texture,
+        mipLevel,
+        LLGL::DstImageDescriptor{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, texels.data(), texels.size() * sizeof(Texel) }
+    );
+
+    for (std::uint32_t layer = 0; layer < region.subresource.numArrayLayers; ++layer)
+    {
+        for (std::uint32_t y = 0; y < height; ++y)
+        {
+            for (std::uint32_t x = 0; x < width; ++x)
+            {
+                const auto index = (layer * mipExtent.height + offsetY + y) * mipExtent.width + offsetX + x;
+                if (texels[index] != MakeTexel(mipLevel, layer, offsetX + x, offsetY + y))
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Image data of all MIP-map levels must be streamed from the tightly packed source image, also when tiles contain multiple array layers.
+static void TestStreamFromData(LLGL::RenderSystem& renderer)
+{
+    const std::uint32_t numLayers = 3, numMips = 5;
+
+    auto texture = renderer.CreateTexture(TextureArrayDesc(16, 8, numLayers, numMips));
+    auto region  = StreamRegion({ 0, 0, 0 }, { 16, 8, 1 }, numLayers, numMips);
+
+    /* Generate tightly packed image data beginning with the base MIP-map level */
+    std::vector<Texel> imageData;
+
+    for (std::uint32_t mipLevel = 0; mipLevel < numMips; ++mipLevel)
+    {
+        const auto extent = texture->GetMipExtent(mipLevel);
+        for (std::uint32_t layer = 0; layer < numLayers; ++layer)
+        {
+            for (std::uint32_t y = 0; y < extent.height; ++y)
+            {
+                for (std::uint32_t x = 0; x < extent.width; ++x)
+                    imageData.push_back(MakeTexel(mipLevel, layer, x, y));
+            }
+        }
+    }
+
+    /* Tile size of two rows splits the base MIP-map level into rows and combines array layers of the lower MIP-map levels */
+    LLGL::StreamImageDescriptor imageDesc;
+    {
+        imageDesc.data      = imageData.data();
+        imageDesc.dataSize  = imageData.size() * sizeof(Texel);
+        imageDesc.tileSize  = 2 * 16 * sizeof(Texel);
+    }
+    renderer.WriteTextureStreamed(*texture, region, imageDesc);
+
+    for (std::uint32_t mipLevel = 0; mipLevel < numMips; ++mipLevel)
+        TEST_CHECK(VerifyMipLevel(renderer, *texture, region, mipLevel));
+
+    renderer.Release(*texture);
+}
+
+// Tiles must cover the texture region exactly once, beginning with the lowest resolution, and must not exceed the tile size.
+static void TestStreamFromCallback(LLGL::RenderSystem& renderer)
+{
+    const std::uint32_t numLayers = 2, numMips = 3;
+    const std::size_t   tileSize  = 3 * 8 * sizeof(Texel);
+
+    auto texture = renderer.CreateTexture(TextureArrayDesc(16, 16, numLayers, 5));
+    auto region  = StreamRegion({ 4, 6, 0 }, { 8, 8, 1 }, numLayers, numMips);
+
+    std::vector<std::uint32_t>  tileMipLevels;
+    std::size_t                 numTexels   = 0;
+    bool                        tilesFit    = true;
+
+    LLGL::StreamImageDescriptor imageDesc;
+    {
+        imageDesc.tileSize      = tileSize;
+        imageDesc.readCallback  = [&](const LLGL::TextureRegion& tileRegion, void* data, std::size_t dataSize)
+        {
+            const auto& subresource = tileRegion.subresource;
+            const auto  tileTexels  = tileRegion.extent.width * tileRegion.extent.height * subresource.numArrayLayers;
+
+            tileMipLevels.push_back(subresource.baseMipLevel);
+            numTexels += tileTexels;
+
+            if (dataSize != tileTexels * sizeof(Texel) || (dataSize > tileSize && tileRegion.extent.height > 1))
+                tilesFit = false;
+
+            auto texels = reinterpret_cast<Texel*>(data);
+            for (std::uint32_t layer = 0; layer < subresource.numArrayLayers; ++layer)
+            {
+                for (std::uint32_t y = 0; y < tileRegion.extent.height; ++y)
+                {
+                    for (std::uint32_t x = 0; x < tileRegion.extent.width; ++x)
+                    {
+                        *texels++ = MakeTexel(
+                            subresource.baseMipLevel,
+                            subresource.baseArrayLayer + layer,
+                            static_cast<std::uint32_t>(tileRegion.offset.x) + x,
+                            static_cast<std::uint32_t>(tileRegion.offset.y) + y
+                        );
+                    }
+                }
+            }
+        };
+    }
+    renderer.WriteTextureStreamed(*texture, region, imageDesc);
+
+    TEST_CHECK(tilesFit);
+    TEST_CHECK(numTexels == (8*8 + 4*4 + 2*2) * numLayers);
+    TEST_CHECK(!tileMipLevels.empty() && tileMipLevels.front() == numMips - 1 && tileMipLevels.back() == 0);
+    TEST_CHECK(std::is_sorted(tileMipLevels.rbegin(), tileMipLevels.rend()));
+
+    for (std::uint32_t mipLevel = 0; mipLevel < numMips; ++mipLevel)
+        TEST_CHECK(VerifyMipLevel(renderer, *texture, region, mipLevel));
+
+    renderer.Release(*texture);
+}
+
+// Texture regions whose lower MIP-map levels exceed the texture must be rejected.
+static void TestValidation(LLGL::RenderSystem& renderer)
+{
+    auto texture = renderer.CreateTexture(TextureArrayDesc(5, 5, 1, 3));
+
+    std::vector<Texel> imageData(64);
+
+    auto Throws = [&](const LLGL::TextureRegion& region) -> bool
+    {
+        LLGL::StreamImageDescriptor imageDesc;
+        {
+            imageDesc.data      = imageData.data();
+            imageDesc.dataSize  = imageData.size() * sizeof(Texel);
+        }
+        try
+        {
+            renderer.WriteTextureStreamed(*texture, region, imageDesc);
+        }
+        catch (const std::invalid_argument&)
+        {
+            return true;
+        }
+        return false;
+    };
+
+    /* Odd offset (4, 4) is rounded down to (2, 2) on MIP-map level 1, but its extent is only 2x2 */
+    TEST_CHECK(Throws(StreamRegion({ 4, 4, 0 }, { 1, 1, 1 }, 1, 2)));
+    TEST_CHECK(Throws(StreamRegion({ 0, 0, 0 }, { 5, 5, 1 }, 1, 4)));
+    TEST_CHECK(!Throws(StreamRegion({ 4, 4, 0 }, { 1, 1, 1 }, 1, 1)));
+    TEST_CHECK(!Throws(StreamRegion({ 0, 0, 0 }, { 5, 5, 1 }, 1, 3)));
+
+    renderer.Release(*texture);
+}
+
+int main()
+{
+    try
+    {
+        // Load render system module; the Null renderer allows to run this test without a graphics device
+        auto renderer = LLGL::RenderSystem::Load("Null");
+
+        TestStreamFromData(*renderer);
+        TestStreamFromCallback(*renderer);
+        TestValidation(*renderer);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    if (g_numFailures > 0)
+    {
+        std::cerr << g_numFailures << " check(s) failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "all texture stream tests passed" << std::endl;
+
+    return 0;
+}
+
+
+
+// ================================================================================